@@ -0,0 +1,466 @@
+/****************************************************************************************************************/
+/*                                                                                                              */
+/*   OpenNN: Open Neural Networks Library                                                                       */
+/*   www.opennn.net                                                                                             */
+/*                                                                                                              */
+/*   B E N C H M A R K   C L A S S                                                                              */
+/*                                                                                                              */
+/*   Roberto Lopez                                                                                              */
+/*   Artelnics - Making intelligent use of data                                                                 */
+/*   robertolopez@artelnics.com                                                                                 */
+/*                                                                                                              */
+/****************************************************************************************************************/
+
+// Benchmark includes
+
+#include "benchmark.h"
+
+using namespace OpenNN;
+
+// DEFAULT CONSTRUCTOR
+
+Benchmark::Benchmark(void)
+{
+   repetitions = 5;
+
+   filter = "";
+
+   display = true;
+}
+
+
+// DESTRUCTOR
+
+/// Destructor.
+
+Benchmark::~Benchmark(void)
+{
+}
+
+
+// METHODS
+
+// const size_t& get_repetitions(void) const method
+
+/// Returns the number of timed repetitions of each benchmark.
+
+const size_t& Benchmark::get_repetitions(void) const
+{
+   return(repetitions);
+}
+
+
+// const std::string& get_filter(void) const method
+
+/// Returns the string which the names of the benchmarks to be run must contain.
+
+const std::string& Benchmark::get_filter(void) const
+{
+   return(filter);
+}
+
+
+// const bool& get_display(void) const method
+
+/// Returns true if the results are displayed as they are obtained, and false otherwise.
+
+const bool& Benchmark::get_display(void) const
+{
+   return(display);
+}
+
+
+// const Vector<Result>& get_results(void) const method
+
+/// Returns the results of all the benchmarks which have been run.
+
+const Vector<Benchmark::Result>& Benchmark::get_results(void) const
+{
+   return(results);
+}
+
+
+// void set_repetitions(const size_t&) method
+
+/// Sets the number of timed repetitions of each benchmark.
+/// @param new_repetitions Number of repetitions. It must be greater than zero.
+
+void Benchmark::set_repetitions(const size_t& new_repetitions)
+{
+   if(new_repetitions == 0)
+   {
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: Benchmark class.\n"
+             << "void set_repetitions(const size_t&) method.\n"
+             << "Number of repetitions must be greater than zero.\n";
+
+      throw std::logic_error(buffer.str());
+   }
+
+   repetitions = new_repetitions;
+}
+
+
+// void set_filter(const std::string&) method
+
+/// Sets the string which the names of the benchmarks to be run must contain.
+/// @param new_filter Filter string. If it is empty, all the benchmarks are run.
+
+void Benchmark::set_filter(const std::string& new_filter)
+{
+   filter = new_filter;
+}
+
+
+// void set_display(const bool&) method
+
+/// Sets whether the results are to be displayed as they are obtained.
+/// @param new_display True to display the results, false otherwise.
+
+void Benchmark::set_display(const bool& new_display)
+{
+   display = new_display;
+}
+
+
+// bool is_selected(const std::string&) const method
+
+/// Returns true if the benchmark with the given name passes the filter, and false otherwise.
+/// It is meant to be checked before building the data of a benchmark, which might be expensive.
+/// @param name Name of the benchmark.
+
+bool Benchmark::is_selected(const std::string& name) const
+{
+   return(filter.empty() || name.find(filter) != std::string::npos);
+}
+
+
+// void run(const std::string&, const std::string&, const std::function<void(void)>&) method
+
+/// Runs a function once to warm the caches, and then times it for the given number of repetitions.
+/// The minimum, mean and median times are added to the results.
+/// Nothing is done if the benchmark does not pass the filter.
+/// @param name Name of the benchmark.
+/// @param parameters Parameters of the benchmark, separated by spaces.
+/// @param function Code to be timed.
+
+void Benchmark::run(const std::string& name, const std::string& parameters, const std::function<void(void)>& function)
+{
+   if(!is_selected(name))
+   {
+      return;
+   }
+
+   function();
+
+   std::vector<double> times(repetitions);
+
+   for(size_t i = 0; i < repetitions; i++)
+   {
+      const std::chrono::steady_clock::time_point beginning_time = std::chrono::steady_clock::now();
+
+      function();
+
+      times[i] = std::chrono::duration<double>(std::chrono::steady_clock::now() - beginning_time).count();
+   }
+
+   std::sort(times.begin(), times.end());
+
+   Result result;
+
+   result.name = name;
+   result.parameters = parameters;
+   result.repetitions = repetitions;
+   result.minimum_time = times[0];
+
+   for(size_t i = 0; i < repetitions; i++)
+   {
+      result.mean_time += times[i];
+   }
+
+   result.mean_time /= (double)repetitions;
+
+   result.median_time = repetitions%2 == 1 ? times[repetitions/2] : (times[repetitions/2-1] + times[repetitions/2])/2.0;
+
+   results.push_back(result);
+
+   if(display)
+   {
+      std::cout << std::left << std::setw(48) << name
+                << std::setw(56) << parameters
+                << std::right << std::setw(14) << result.median_time << " s" << std::endl;
+   }
+}
+
+
+// Vector<double> calculate_time_ratios(const Vector<Result>&) const method
+
+/// Returns the ratio between the median time of each result and the median time of the same benchmark in a baseline.
+/// Results are matched by name and parameters. The ratio of results which are not in the baseline is zero.
+/// @param baseline Results of a previous run.
+
+Vector<double> Benchmark::calculate_time_ratios(const Vector<Result>& baseline) const
+{
+   const size_t results_number = results.size();
+
+   Vector<double> ratios(results_number, 0.0);
+
+   for(size_t i = 0; i < results_number; i++)
+   {
+      for(size_t j = 0; j < baseline.size(); j++)
+      {
+         if(baseline[j].name == results[i].name && baseline[j].parameters == results[i].parameters)
+         {
+            if(baseline[j].median_time > 0.0)
+            {
+               ratios[i] = results[i].median_time/baseline[j].median_time;
+            }
+
+            break;
+         }
+      }
+   }
+
+   return(ratios);
+}
+
+
+// size_t print_comparison(const Vector<Result>&, const double&) const method
+
+/// Prints the ratios between the median times of the results and those of a baseline,
+/// and returns the number of regressions.
+/// A benchmark regresses if it is slower than its baseline by more than the given tolerance.
+/// @param baseline Results of a previous run.
+/// @param tolerance Relative increase of the median time which is accepted, such as 0.1 for ten percent.
+
+size_t Benchmark::print_comparison(const Vector<Result>& baseline, const double& tolerance) const
+{
+   const Vector<double> ratios = calculate_time_ratios(baseline);
+
+   size_t regressions_number = 0;
+
+   for(size_t i = 0; i < results.size(); i++)
+   {
+      std::cout << std::left << std::setw(48) << results[i].name
+                << std::setw(56) << results[i].parameters
+                << std::right;
+
+      if(ratios[i] == 0.0)
+      {
+         std::cout << std::setw(14) << "new" << std::endl;
+      }
+      else if(ratios[i] > 1.0 + tolerance)
+      {
+         std::cout << std::setw(14) << ratios[i] << " x  REGRESSION" << std::endl;
+
+         regressions_number++;
+      }
+      else
+      {
+         std::cout << std::setw(14) << ratios[i] << " x" << std::endl;
+      }
+   }
+
+   return(regressions_number);
+}
+
+
+// std::string to_CSV(void) const method
+
+/// Returns a comma separated values table with the results, with a header row.
+
+std::string Benchmark::to_CSV(void) const
+{
+   std::ostringstream buffer;
+
+   buffer.precision(9);
+
+   buffer << "name,parameters,repetitions,minimum_time,mean_time,median_time\n";
+
+   for(size_t i = 0; i < results.size(); i++)
+   {
+      buffer << results[i].name << ","
+             << results[i].parameters << ","
+             << results[i].repetitions << ","
+             << results[i].minimum_time << ","
+             << results[i].mean_time << ","
+             << results[i].median_time << "\n";
+   }
+
+   return(buffer.str());
+}
+
+
+// std::string to_JSON(void) const method
+
+/// Returns a JSON array with the results.
+/// Each result is an object with the name, parameters, repetitions and times (in seconds) fields.
+
+std::string Benchmark::to_JSON(void) const
+{
+   std::ostringstream buffer;
+
+   buffer.precision(9);
+
+   buffer << "[";
+
+   for(size_t i = 0; i < results.size(); i++)
+   {
+      buffer << (i == 0 ? "\n" : ",\n")
+             << "  {\"name\": \"" << results[i].name << "\", "
+             << "\"parameters\": \"" << results[i].parameters << "\", "
+             << "\"repetitions\": " << results[i].repetitions << ", "
+             << "\"minimum_time\": " << results[i].minimum_time << ", "
+             << "\"mean_time\": " << results[i].mean_time << ", "
+             << "\"median_time\": " << results[i].median_time << "}";
+   }
+
+   buffer << "\n]\n";
+
+   return(buffer.str());
+}
+
+
+// void save_CSV(const std::string&) const method
+
+/// Saves the results to a comma separated values file, which can be loaded later as a baseline.
+/// @param file_name Name of the CSV file.
+
+void Benchmark::save_CSV(const std::string& file_name) const
+{
+   std::ofstream file(file_name.c_str());
+
+   if(!file.is_open())
+   {
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: Benchmark class.\n"
+             << "void save_CSV(const std::string&) const method.\n"
+             << "Cannot open benchmark file: " << file_name << "\n";
+
+      throw std::logic_error(buffer.str());
+   }
+
+   file << to_CSV();
+
+   file.close();
+}
+
+
+// void save_JSON(const std::string&) const method
+
+/// Saves the results to a JSON file.
+/// @param file_name Name of the JSON file.
+
+void Benchmark::save_JSON(const std::string& file_name) const
+{
+   std::ofstream file(file_name.c_str());
+
+   if(!file.is_open())
+   {
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: Benchmark class.\n"
+             << "void save_JSON(const std::string&) const method.\n"
+             << "Cannot open benchmark file: " << file_name << "\n";
+
+      throw std::logic_error(buffer.str());
+   }
+
+   file << to_JSON();
+
+   file.close();
+}
+
+
+// static Vector<Result> load_CSV(const std::string&) method
+
+/// Loads the results saved to a comma separated values file by a previous run.
+/// @param file_name Name of the CSV file.
+
+Vector<Benchmark::Result> Benchmark::load_CSV(const std::string& file_name)
+{
+   std::ifstream file(file_name.c_str());
+
+   if(!file.is_open())
+   {
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: Benchmark class.\n"
+             << "static Vector<Result> load_CSV(const std::string&) method.\n"
+             << "Cannot open benchmark file: " << file_name << "\n";
+
+      throw std::logic_error(buffer.str());
+   }
+
+   Vector<Result> baseline;
+
+   std::string line;
+
+   std::getline(file, line);
+
+   while(std::getline(file, line))
+   {
+      if(line.empty() || line == "\r")
+      {
+         continue;
+      }
+
+      std::istringstream line_buffer(line);
+
+      std::string repetitions_string;
+      std::string minimum_time_string;
+      std::string mean_time_string;
+      std::string median_time_string;
+
+      Result result;
+
+      std::getline(line_buffer, result.name, ',');
+      std::getline(line_buffer, result.parameters, ',');
+      std::getline(line_buffer, repetitions_string, ',');
+      std::getline(line_buffer, minimum_time_string, ',');
+      std::getline(line_buffer, mean_time_string, ',');
+      std::getline(line_buffer, median_time_string, ',');
+
+      if(median_time_string.empty())
+      {
+         std::ostringstream buffer;
+
+         buffer << "OpenNN Exception: Benchmark class.\n"
+                << "static Vector<Result> load_CSV(const std::string&) method.\n"
+                << "Wrong number of fields in line: " << line << "\n";
+
+         throw std::logic_error(buffer.str());
+      }
+
+      result.repetitions = (size_t)atol(repetitions_string.c_str());
+      result.minimum_time = atof(minimum_time_string.c_str());
+      result.mean_time = atof(mean_time_string.c_str());
+      result.median_time = atof(median_time_string.c_str());
+
+      baseline.push_back(result);
+   }
+
+   file.close();
+
+   return(baseline);
+}
+
+
+// OpenNN: Open Neural Networks Library.
+// Copyright (C) 2005-2016 Roberto Lopez.
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
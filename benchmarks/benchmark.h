@@ -0,0 +1,170 @@
+/****************************************************************************************************************/
+/*                                                                                                              */
+/*   OpenNN: Open Neural Networks Library                                                                       */
+/*   www.opennn.net                                                                                             */
+/*                                                                                                              */
+/*   B E N C H M A R K   C L A S S   H E A D E R                                                                */
+/*                                                                                                              */
+/*   Roberto Lopez                                                                                              */
+/*   Artelnics - Making intelligent use of data                                                                 */
+/*   robertolopez@artelnics.com                                                                                 */
+/*                                                                                                              */
+/****************************************************************************************************************/
+
+#ifndef __BENCHMARK_H__
+#define __BENCHMARK_H__
+
+// System includes
+
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <sstream>
+#include <algorithm>
+#include <functional>
+#include <chrono>
+#include <stdexcept>
+
+// OpenNN includes
+
+#include "../opennn/opennn.h"
+
+///
+/// This class times pieces of code over a number of repetitions and keeps the results of all of them.
+/// The results can be exported to comma separated values or JSON files,
+/// and compared against the results of a previous run saved as a baseline.
+///
+
+class Benchmark
+{
+
+public:
+
+   // DEFAULT CONSTRUCTOR
+
+   explicit Benchmark(void);
+
+   // DESTRUCTOR
+
+   virtual ~Benchmark(void);
+
+   // STRUCTURES
+
+   ///
+   /// This structure contains the timings of a benchmark for a given set of parameters.
+   ///
+
+   struct Result
+   {
+      /// Default constructor.
+
+      Result(void) : repetitions(0), minimum_time(0.0), mean_time(0.0), median_time(0.0)
+      {
+      }
+
+      /// Name of the benchmark, such as the method which is timed.
+
+      std::string name;
+
+      /// Parameters of the benchmark, such as the sizes of the problem, separated by spaces.
+
+      std::string parameters;
+
+      /// Number of timed repetitions.
+
+      size_t repetitions;
+
+      /// Minimum time of a repetition, in seconds.
+
+      double minimum_time;
+
+      /// Mean time of a repetition, in seconds.
+
+      double mean_time;
+
+      /// Median time of a repetition, in seconds.
+
+      double median_time;
+   };
+
+   // METHODS
+
+   // Get methods
+
+   const size_t& get_repetitions(void) const;
+   const std::string& get_filter(void) const;
+   const bool& get_display(void) const;
+
+   const OpenNN::Vector<Result>& get_results(void) const;
+
+   // Set methods
+
+   void set_repetitions(const size_t&);
+   void set_filter(const std::string&);
+   void set_display(const bool&);
+
+   // Benchmarking methods
+
+   bool is_selected(const std::string&) const;
+
+   void run(const std::string&, const std::string&, const std::function<void(void)>&);
+
+   // Comparison methods
+
+   OpenNN::Vector<double> calculate_time_ratios(const OpenNN::Vector<Result>&) const;
+
+   size_t print_comparison(const OpenNN::Vector<Result>&, const double&) const;
+
+   // Serialization methods
+
+   std::string to_CSV(void) const;
+   std::string to_JSON(void) const;
+
+   void save_CSV(const std::string&) const;
+   void save_JSON(const std::string&) const;
+
+   static OpenNN::Vector<Result> load_CSV(const std::string&);
+
+private:
+
+   // MEMBERS
+
+   /// Number of timed repetitions of each benchmark. A first untimed run is always performed to warm the caches.
+
+   size_t repetitions;
+
+   /// Only the benchmarks whose name contains this string are run. If it is empty, all the benchmarks are run.
+
+   std::string filter;
+
+   /// True if the results are to be displayed as they are obtained, false otherwise.
+
+   bool display;
+
+   /// Results of all the benchmarks which have been run.
+
+   OpenNN::Vector<Result> results;
+};
+
+#endif
+
+
+// OpenNN: Open Neural Networks Library.
+// Copyright (C) 2005-2016 Roberto Lopez.
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
@@ -0,0 +1,511 @@
+/****************************************************************************************************************/
+/*                                                                                                              */
+/*   OpenNN: Open Neural Networks Library                                                                       */
+/*   www.opennn.net                                                                                             */
+/*                                                                                                              */
+/*   B E N C H M A R K S   A P P L I C A T I O N                                                                */
+/*                                                                                                              */
+/*   Roberto Lopez                                                                                              */
+/*   Artelnics - Making intelligent use of data                                                                 */
+/*   robertolopez@artelnics.com                                                                                 */
+/*                                                                                                              */
+/****************************************************************************************************************/
+
+// System includes
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <cstring>
+#include <cstdio>
+#include <time.h>
+
+// Benchmark includes
+
+#include "benchmark.h"
+
+using namespace OpenNN;
+
+// Sink for the outputs of the timed code, so that the compiler does not discard it.
+
+static volatile double sink = 0.0;
+
+
+// size_t scale_size(const size_t&, const double&) function
+
+/// Returns a problem size multiplied by the scale factor of the benchmarks, which is at least one.
+
+static size_t scale_size(const size_t& size, const double& scale)
+{
+   const size_t scaled_size = (size_t)(size*scale);
+
+   return(scaled_size > 0 ? scaled_size : 1);
+}
+
+
+// void benchmark_matrix(Benchmark&, const double&) function
+
+/// Times the dense matrix kernels for square matrices of increasing sizes.
+
+static void benchmark_matrix(Benchmark& benchmark, const double& scale)
+{
+   const size_t sizes[] = {64, 128, 256};
+
+   for(size_t i = 0; i < 3; i++)
+   {
+      const size_t n = scale_size(sizes[i], scale);
+
+      std::ostringstream parameters;
+      parameters << "n=" << n;
+
+      Matrix<double> a(n, n);
+      a.randomize_normal();
+
+      Matrix<double> b(n, n);
+      b.randomize_normal();
+
+      if(benchmark.is_selected("Matrix::dot"))
+      {
+         benchmark.run("Matrix::dot", parameters.str(), [&]()
+         {
+            const Matrix<double> c = a.dot(b);
+
+            sink = c(0, 0);
+         });
+      }
+
+      if(benchmark.is_selected("Matrix::calculate_transpose"))
+      {
+         benchmark.run("Matrix::calculate_transpose", parameters.str(), [&]()
+         {
+            const Matrix<double> c = a.calculate_transpose();
+
+            sink = c(0, 0);
+         });
+      }
+   }
+}
+
+
+// void benchmark_perceptron_layer(Benchmark&, const double&) function
+
+/// Times the combinations of square perceptron layers over a batch of input vectors.
+
+static void benchmark_perceptron_layer(Benchmark& benchmark, const double& scale)
+{
+   if(!benchmark.is_selected("PerceptronLayer::calculate_combinations"))
+   {
+      return;
+   }
+
+   const size_t sizes[] = {16, 64, 256};
+
+   const size_t calls_number = 1000;
+
+   for(size_t i = 0; i < 3; i++)
+   {
+      const size_t n = scale_size(sizes[i], scale);
+
+      std::ostringstream parameters;
+      parameters << "inputs=" << n << " perceptrons=" << n << " calls=" << calls_number;
+
+      PerceptronLayer perceptron_layer(n, n);
+
+      Vector<double> inputs(n);
+      inputs.randomize_normal();
+
+      benchmark.run("PerceptronLayer::calculate_combinations", parameters.str(), [&]()
+      {
+         for(size_t j = 0; j < calls_number; j++)
+         {
+            const Vector<double> combinations = perceptron_layer.calculate_combinations(inputs);
+
+            sink = combinations[0];
+         }
+      });
+   }
+}
+
+
+// void benchmark_sum_squared_error(Benchmark&, const double&) function
+
+/// Times the gradient and the terms Jacobian of the sum squared error on synthetic data sets.
+
+static void benchmark_sum_squared_error(Benchmark& benchmark, const double& scale)
+{
+   if(!benchmark.is_selected("SumSquaredError::calculate_gradient")
+   && !benchmark.is_selected("SumSquaredError::calculate_terms_Jacobian"))
+   {
+      return;
+   }
+
+   const size_t instances_numbers[] = {1000, 10000};
+
+   const size_t inputs_number = 10;
+   const size_t hidden_perceptrons_number = 10;
+
+   for(size_t i = 0; i < 2; i++)
+   {
+      const size_t instances_number = scale_size(instances_numbers[i], scale);
+
+      std::ostringstream parameters;
+      parameters << "instances=" << instances_number << " inputs=" << inputs_number << " hidden=" << hidden_perceptrons_number;
+
+      DataSet data_set;
+      data_set.generate_artificial_data(instances_number, inputs_number+1);
+
+      NeuralNetwork neural_network(inputs_number, hidden_perceptrons_number, 1);
+
+      SumSquaredError sum_squared_error(&neural_network, &data_set);
+
+      benchmark.run("SumSquaredError::calculate_gradient", parameters.str(), [&]()
+      {
+         const Vector<double> gradient = sum_squared_error.calculate_gradient();
+
+         sink = gradient[0];
+      });
+
+      benchmark.run("SumSquaredError::calculate_terms_Jacobian", parameters.str(), [&]()
+      {
+         const Matrix<double> terms_Jacobian = sum_squared_error.calculate_terms_Jacobian();
+
+         sink = terms_Jacobian(0, 0);
+      });
+   }
+}
+
+
+// void benchmark_data_set(Benchmark&, const double&) function
+
+/// Times the loading of synthetic data files and the calculation of their statistics.
+
+static void benchmark_data_set(Benchmark& benchmark, const double& scale)
+{
+   if(!benchmark.is_selected("DataSet::load_data")
+   && !benchmark.is_selected("DataSet::calculate_data_statistics"))
+   {
+      return;
+   }
+
+   const size_t instances_numbers[] = {1000, 10000};
+
+   const size_t variables_number = 11;
+
+   const std::string data_file_name = "benchmark_data_set.dat";
+
+   for(size_t i = 0; i < 2; i++)
+   {
+      const size_t instances_number = scale_size(instances_numbers[i], scale);
+
+      std::ostringstream parameters;
+      parameters << "instances=" << instances_number << " variables=" << variables_number;
+
+      DataSet data_set;
+      data_set.generate_artificial_data(instances_number, variables_number);
+
+      if(benchmark.is_selected("DataSet::load_data"))
+      {
+         data_set.set_data_file_name(data_file_name);
+         data_set.save_data();
+
+         DataSet loaded_data_set;
+         loaded_data_set.set_data_file_name(data_file_name);
+
+         benchmark.run("DataSet::load_data", parameters.str(), [&]()
+         {
+            loaded_data_set.load_data();
+
+            sink = loaded_data_set.get_data()(0, 0);
+         });
+
+         remove(data_file_name.c_str());
+      }
+
+      benchmark.run("DataSet::calculate_data_statistics", parameters.str(), [&]()
+      {
+         const Vector< Statistics<double> > statistics = data_set.calculate_data_statistics();
+
+         sink = statistics[0].mean;
+      });
+   }
+}
+
+
+// void benchmark_training(Benchmark&, const double&) function
+
+/// Times complete training processes with a fixed number of iterations on a synthetic data set.
+/// All the stopping criteria other than the number of iterations are disabled,
+/// and every repetition starts from the same parameters.
+
+static void benchmark_training(Benchmark& benchmark, const double& scale)
+{
+   const size_t instances_number = scale_size(1000, scale);
+   const size_t inputs_number = 10;
+   const size_t hidden_perceptrons_number = 10;
+   const size_t iterations_number = 20;
+
+   std::ostringstream parameters;
+   parameters << "instances=" << instances_number << " inputs=" << inputs_number
+              << " hidden=" << hidden_perceptrons_number << " iterations=" << iterations_number;
+
+   DataSet data_set;
+   data_set.generate_artificial_data(instances_number, inputs_number+1);
+
+   NeuralNetwork neural_network(inputs_number, hidden_perceptrons_number, 1);
+
+   const Vector<double> initial_parameters = neural_network.arrange_parameters();
+
+   PerformanceFunctional performance_functional(&neural_network, &data_set);
+   performance_functional.set_objective_type(PerformanceFunctional::SUM_SQUARED_ERROR_OBJECTIVE);
+
+   if(benchmark.is_selected("GradientDescent::perform_training"))
+   {
+      GradientDescent gradient_descent(&performance_functional);
+
+      gradient_descent.set_display(false);
+      gradient_descent.set_maximum_iterations_number(iterations_number);
+      gradient_descent.set_performance_goal(0.0);
+      gradient_descent.set_gradient_norm_goal(0.0);
+      gradient_descent.set_minimum_performance_increase(0.0);
+      gradient_descent.set_minimum_parameters_increment_norm(0.0);
+
+      benchmark.run("GradientDescent::perform_training", parameters.str(), [&]()
+      {
+         neural_network.set_parameters(initial_parameters);
+
+         GradientDescent::GradientDescentResults* results_pointer = gradient_descent.perform_training();
+
+         sink = results_pointer->final_performance;
+
+         delete results_pointer;
+      });
+   }
+
+   if(benchmark.is_selected("QuasiNewtonMethod::perform_training"))
+   {
+      QuasiNewtonMethod quasi_Newton_method(&performance_functional);
+
+      quasi_Newton_method.set_display(false);
+      quasi_Newton_method.set_maximum_iterations_number(iterations_number);
+      quasi_Newton_method.set_performance_goal(0.0);
+      quasi_Newton_method.set_gradient_norm_goal(0.0);
+      quasi_Newton_method.set_minimum_performance_increase(0.0);
+      quasi_Newton_method.set_minimum_parameters_increment_norm(0.0);
+
+      benchmark.run("QuasiNewtonMethod::perform_training", parameters.str(), [&]()
+      {
+         neural_network.set_parameters(initial_parameters);
+
+         QuasiNewtonMethod::QuasiNewtonMethodResults* results_pointer = quasi_Newton_method.perform_training();
+
+         sink = results_pointer->final_performance;
+
+         delete results_pointer;
+      });
+   }
+
+   if(benchmark.is_selected("LevenbergMarquardtAlgorithm::perform_training"))
+   {
+      LevenbergMarquardtAlgorithm Levenberg_Marquardt_algorithm(&performance_functional);
+
+      Levenberg_Marquardt_algorithm.set_display(false);
+      Levenberg_Marquardt_algorithm.set_maximum_iterations_number(iterations_number);
+      Levenberg_Marquardt_algorithm.set_performance_goal(0.0);
+      Levenberg_Marquardt_algorithm.set_gradient_norm_goal(0.0);
+      Levenberg_Marquardt_algorithm.set_minimum_performance_increase(0.0);
+      Levenberg_Marquardt_algorithm.set_minimum_parameters_increment_norm(0.0);
+
+      benchmark.run("LevenbergMarquardtAlgorithm::perform_training", parameters.str(), [&]()
+      {
+         neural_network.set_parameters(initial_parameters);
+
+         LevenbergMarquardtAlgorithm::LevenbergMarquardtAlgorithmResults* results_pointer = Levenberg_Marquardt_algorithm.perform_training();
+
+         sink = results_pointer->final_performance;
+
+         delete results_pointer;
+      });
+   }
+
+   neural_network.set_parameters(initial_parameters);
+}
+
+
+// void print_usage(void) function
+
+/// Prints the command line arguments of the benchmarks application.
+
+static void print_usage(void)
+{
+   std::cout << "Usage: opennnbenchmarks [options]\n"
+             << "  --filter <string>         Run only the benchmarks whose name contains the string.\n"
+             << "  --repetitions <number>    Number of timed repetitions of each benchmark (default 5).\n"
+             << "  --scale <number>          Factor applied to all the problem sizes (default 1).\n"
+             << "  --csv <file>              Save the results to a comma separated values file.\n"
+             << "  --json <file>             Save the results to a JSON file.\n"
+             << "  --baseline <file>         Compare the results against a CSV file saved by a previous run.\n"
+             << "  --tolerance <number>      Relative slowdown accepted against the baseline (default 0.1).\n"
+             << "  --instrumentation <file>  Save the instrumentation records to a CSV file.\n"
+             << "The application returns 2 if any benchmark is slower than its baseline by more than the tolerance." << std::endl;
+}
+
+
+int main(int argc, char* argv[])
+{
+   try
+   {
+      std::cout << "OpenNN. Benchmarks Application." << std::endl;
+
+      Benchmark benchmark;
+
+      double scale = 1.0;
+
+      std::string CSV_file_name;
+      std::string JSON_file_name;
+      std::string baseline_file_name;
+      std::string instrumentation_file_name;
+
+      double tolerance = 0.1;
+
+      for(int i = 1; i < argc; i++)
+      {
+         const std::string argument = argv[i];
+
+         if(argument == "--help")
+         {
+            print_usage();
+
+            return(0);
+         }
+
+         if(i+1 >= argc)
+         {
+            print_usage();
+
+            return(1);
+         }
+
+         const std::string value = argv[++i];
+
+         if(argument == "--filter")
+         {
+            benchmark.set_filter(value);
+         }
+         else if(argument == "--repetitions")
+         {
+            benchmark.set_repetitions((size_t)atol(value.c_str()));
+         }
+         else if(argument == "--scale")
+         {
+            scale = atof(value.c_str());
+         }
+         else if(argument == "--csv")
+         {
+            CSV_file_name = value;
+         }
+         else if(argument == "--json")
+         {
+            JSON_file_name = value;
+         }
+         else if(argument == "--baseline")
+         {
+            baseline_file_name = value;
+         }
+         else if(argument == "--tolerance")
+         {
+            tolerance = atof(value.c_str());
+         }
+         else if(argument == "--instrumentation")
+         {
+            instrumentation_file_name = value;
+         }
+         else
+         {
+            print_usage();
+
+            return(1);
+         }
+      }
+
+      if(scale <= 0.0)
+      {
+         std::cout << "Scale must be greater than zero." << std::endl;
+
+         return(1);
+      }
+
+      // Fixed seed, so that all the runs time the same problems
+
+      set_random_seed(1);
+
+      const Vector<Instrumentation::Record> beginning_records = Instrumentation::get_records();
+
+      benchmark_matrix(benchmark, scale);
+      benchmark_perceptron_layer(benchmark, scale);
+      benchmark_sum_squared_error(benchmark, scale);
+      benchmark_data_set(benchmark, scale);
+      benchmark_training(benchmark, scale);
+
+      if(!CSV_file_name.empty())
+      {
+         benchmark.save_CSV(CSV_file_name);
+      }
+
+      if(!JSON_file_name.empty())
+      {
+         benchmark.save_JSON(JSON_file_name);
+      }
+
+      if(!instrumentation_file_name.empty())
+      {
+         const Vector<Instrumentation::Record> records
+         = Instrumentation::calculate_records_difference(Instrumentation::get_records(), beginning_records);
+
+         Instrumentation::save_CSV(records, instrumentation_file_name);
+      }
+
+      if(!baseline_file_name.empty())
+      {
+         const Vector<Benchmark::Result> baseline = Benchmark::load_CSV(baseline_file_name);
+
+         std::cout << "Comparison against " << baseline_file_name << ":" << std::endl;
+
+         const size_t regressions_number = benchmark.print_comparison(baseline, tolerance);
+
+         if(regressions_number > 0)
+         {
+            std::cout << regressions_number << " benchmarks have regressed." << std::endl;
+
+            return(2);
+         }
+      }
+
+      return(0);
+   }
+
+   catch(std::exception& e)
+   {
+      std::cout << e.what() << std::endl;
+
+      return(1);
+   }
+}
+
+
+// OpenNN: Open Neural Networks Library.
+// Copyright (C) 2005-2016 Roberto Lopez.
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
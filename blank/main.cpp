@@ -32,7 +32,7 @@ int main(void)
     {
         std::cout << "OpenNN. Blank Application." << std::endl;
 
-        srand((unsigned)time(NULL));
+        set_random_seed((unsigned long)time(NULL));
 
         return(0);
     }
@@ -34,7 +34,7 @@ int main(void)
    {
       std::cout << "OpenNN. Iris Plant Application." << std::endl;	
 
-      srand((unsigned)time(NULL));
+      set_random_seed((unsigned long)time(NULL));
 
       // Data set 
   
@@ -31,7 +31,7 @@ int main(void)
    {
       std::cout << "OpenNN. Logical Operations Application." << std::endl;	
 
-      srand((unsigned)time(NULL));
+      set_random_seed((unsigned long)time(NULL));
 
       // Data set
 
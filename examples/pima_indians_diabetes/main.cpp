@@ -30,7 +30,7 @@ int main(void)
    {
       std::cout << "OpenNN. Pima Indians Diabetes Application." << std::endl;	 
 
-      srand((unsigned)time(NULL));
+      set_random_seed((unsigned long)time(NULL));
 
       // Data set 
 
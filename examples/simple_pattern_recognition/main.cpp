@@ -32,7 +32,7 @@ int main(void)
    {
       std::cout << "OpenNN. Simple Pattern Recognition Application." << std::endl;
 
-      srand( (unsigned)time( NULL ) );
+      set_random_seed((unsigned long)time(NULL));
 
       // Data set object
 
@@ -26,3 +26,4 @@ SUBDIRS += opennn
 SUBDIRS += examples
 SUBDIRS += blank
 SUBDIRS += tests
+SUBDIRS += benchmarks
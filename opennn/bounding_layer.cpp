@@ -610,6 +610,57 @@ Vector<double> BoundingLayer::calculate_outputs(const Vector<double>& inputs) co
 }  
 
 
+// Matrix<float> calculate_outputs(const Matrix<float>&) const method
+
+/// Bounds a batch of inputs in single precision between the lower and upper bounds of each column.
+/// @param inputs Matrix of inputs, with the instances in the rows and the bounding neurons in the columns. 
+
+Matrix<float> BoundingLayer::calculate_outputs(const Matrix<float>& inputs) const
+{
+   const size_t rows_number = inputs.get_rows_number();
+   const size_t bounding_neurons_number = get_bounding_neurons_number();
+
+   // Control sentence (if debug)
+
+   #ifdef __OPENNN_DEBUG__
+
+   if(inputs.get_columns_number() != bounding_neurons_number) 
+   {
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: BoundingLayer class.\n"
+             << "Matrix<float> calculate_outputs(const Matrix<float>&) const method.\n"
+             << "Number of columns of inputs must be equal to number of bounding neurons.\n";
+
+	  throw std::logic_error(buffer.str());
+   }   
+
+   #endif
+
+   Matrix<float> outputs(inputs);
+
+   for(size_t j = 0; j < bounding_neurons_number; j++)
+   {
+      const float lower_bound = (float)lower_bounds[j];
+      const float upper_bound = (float)upper_bounds[j];
+
+      for(size_t i = 0; i < rows_number; i++)
+      {
+         if(outputs(i,j) < lower_bound)
+         {
+            outputs(i,j) = lower_bound;
+         }
+         else if(outputs(i,j) > upper_bound)
+         {
+            outputs(i,j) = upper_bound;
+         }
+      }
+   }
+
+   return(outputs);
+}
+
+
 // Vector<double> calculate_derivative(const Vector<double>&) const method
 
 /// Returns the derivatives of the outputs with respect to the inputs.
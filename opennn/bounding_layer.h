@@ -124,6 +124,7 @@ public:
    // Lower and upper bounds
 
    Vector<double> calculate_outputs(const Vector<double>&) const;
+   Matrix<float> calculate_outputs(const Matrix<float>&) const;
    Vector<double> calculate_derivative(const Vector<double>&) const;
    Vector<double> calculate_second_derivative(const Vector<double>&) const;
 
@@ -1582,6 +1582,78 @@ void ConjugateGradient::ConjugateGradientResults::resize_training_history(const
 }
 
 
+// void arrange_training_history(const size_t&) method
+
+/// Sorts the reserved training history variables in chronological order and removes their unused records,
+/// once the training process has finished.
+/// @param iteration Last iteration of the training process.
+
+void ConjugateGradient::ConjugateGradientResults::arrange_training_history(const size_t& iteration)
+{
+    // Control sentence (if debug)
+
+    #ifdef __OPENNN_DEBUG__
+
+    if(conjugate_gradient_pointer == NULL)
+    {
+       std::ostringstream buffer;
+
+       buffer << "OpenNN Exception: ConjugateGradientResults structure.\n"
+              << "void arrange_training_history(const size_t&) method.\n"
+              << "Conjugate gradient pointer is NULL.\n";
+
+       throw std::logic_error(buffer.str());
+    }
+
+    #endif
+
+    if(conjugate_gradient_pointer->get_reserve_parameters_history())
+    {
+        conjugate_gradient_pointer->arrange_history(parameters_history, iteration);
+    }
+
+    if(conjugate_gradient_pointer->get_reserve_parameters_norm_history())
+    {
+        conjugate_gradient_pointer->arrange_history(parameters_norm_history, iteration);
+    }
+
+    if(conjugate_gradient_pointer->get_reserve_performance_history())
+    {
+        conjugate_gradient_pointer->arrange_history(performance_history, iteration);
+    }
+
+    if(conjugate_gradient_pointer->get_reserve_selection_performance_history())
+    {
+        conjugate_gradient_pointer->arrange_history(selection_performance_history, iteration);
+    }
+
+    if(conjugate_gradient_pointer->get_reserve_gradient_history())
+    {
+        conjugate_gradient_pointer->arrange_history(gradient_history, iteration);
+    }
+
+    if(conjugate_gradient_pointer->get_reserve_gradient_norm_history())
+    {
+        conjugate_gradient_pointer->arrange_history(gradient_norm_history, iteration);
+    }
+
+    if(conjugate_gradient_pointer->get_reserve_training_direction_history())
+    {
+        conjugate_gradient_pointer->arrange_history(training_direction_history, iteration);
+    }
+
+    if(conjugate_gradient_pointer->get_reserve_training_rate_history())
+    {
+        conjugate_gradient_pointer->arrange_history(training_rate_history, iteration);
+    }
+
+    if(conjugate_gradient_pointer->get_reserve_elapsed_time_history())
+    {
+        conjugate_gradient_pointer->arrange_history(elapsed_time_history, iteration);
+    }
+}
+
+
 // std::string to_string(void) const method
 
 std::string ConjugateGradient::ConjugateGradientResults::to_string(void) const
@@ -1785,7 +1857,9 @@ ConjugateGradient::ConjugateGradientResults* ConjugateGradient::perform_training
    }
 
    ConjugateGradientResults* results_pointer = new ConjugateGradientResults(this);
-   results_pointer->resize_training_history(maximum_iterations_number+1);
+   results_pointer->resize_training_history(calculate_history_size(maximum_iterations_number+1));
+
+   open_history_file();
 
    // Elapsed time
 
@@ -1839,10 +1913,42 @@ ConjugateGradient::ConjugateGradientResults* ConjugateGradient::perform_training
    bool stop_training = false;
 
    size_t selection_failures = 0;
+
+   // Resume from checkpoint
+
+   size_t first_iteration = 0;
+   double initial_elapsed_time = 0.0;
+
+   if(resume_checkpoint_pointer)
+   {
+      check_resume_checkpoint(3, Vector<size_t>(2, parameters_number));
+
+      first_iteration = resume_checkpoint_pointer->iteration;
+      initial_elapsed_time = resume_checkpoint_pointer->elapsed_time;
+
+      selection_failures = resume_checkpoint_pointer->selection_failures;
+      old_performance = resume_checkpoint_pointer->old_performance;
+      old_selection_performance = resume_checkpoint_pointer->old_selection_performance;
+
+      directional_point[0] = resume_checkpoint_pointer->scalars[0];
+      directional_point[1] = resume_checkpoint_pointer->scalars[1];
+      old_training_rate = resume_checkpoint_pointer->scalars[2];
+
+      old_gradient = resume_checkpoint_pointer->vectors[0];
+      old_training_direction = resume_checkpoint_pointer->vectors[1];
+
+      neural_network_pointer->set_parameters(resume_checkpoint_pointer->parameters);
+   }
+
+   history_first_iteration = first_iteration;
+
+   TrainingCheckpoint checkpoint;
+
+   checkpoint.training_algorithm_type = write_training_algorithm_type();
    
    // Main loop    
    
-   for(size_t iteration = 0; iteration <= maximum_iterations_number; iteration++)
+   for(size_t iteration = first_iteration; iteration <= maximum_iterations_number; iteration++)
    {
 
       // Neural network
@@ -1961,57 +2067,57 @@ ConjugateGradient::ConjugateGradientResults* ConjugateGradient::perform_training
       // Elapsed time
 
       time(&current_time);
-      elapsed_time = difftime(current_time, beginning_time);
+      elapsed_time = difftime(current_time, beginning_time) + initial_elapsed_time;
 
       // Training history neural network
 
       if(reserve_parameters_history)
       {
-         results_pointer->parameters_history[iteration] = parameters;
+         record_history(results_pointer->parameters_history, "parameters", iteration, parameters);
       }
 
       if(reserve_parameters_norm_history)
       {
-         results_pointer->parameters_norm_history[iteration] = parameters_norm;
+         record_history(results_pointer->parameters_norm_history, "parameters_norm", iteration, parameters_norm);
       }
 
       // Training history performance functional
 
       if(reserve_performance_history)
       {
-         results_pointer->performance_history[iteration] = performance;
+         record_history(results_pointer->performance_history, "performance", iteration, performance);
       }
 
       if(reserve_selection_performance_history)
       {
-         results_pointer->selection_performance_history[iteration] = selection_performance;
+         record_history(results_pointer->selection_performance_history, "selection_performance", iteration, selection_performance);
       }
 
       if(reserve_gradient_history)
       {
-         results_pointer->gradient_history[iteration] = gradient;
+         record_history(results_pointer->gradient_history, "gradient", iteration, gradient);
       }
 
       if(reserve_gradient_norm_history)
       {
-         results_pointer->gradient_norm_history[iteration] = gradient_norm;
+         record_history(results_pointer->gradient_norm_history, "gradient_norm", iteration, gradient_norm);
       }
 
       // Training history training algorithm
 
       if(reserve_training_direction_history)
       {
-         results_pointer->training_direction_history[iteration] = training_direction;
+         record_history(results_pointer->training_direction_history, "training_direction", iteration, training_direction);
       }
 
       if(reserve_training_rate_history)
       {
-         results_pointer->training_rate_history[iteration] = training_rate;
+         record_history(results_pointer->training_rate_history, "training_rate", iteration, training_rate);
       }
 
       if(reserve_elapsed_time_history)
       {
-         results_pointer->elapsed_time_history[iteration] = elapsed_time;
+         record_history(results_pointer->elapsed_time_history, "elapsed_time", iteration, elapsed_time);
       }
 
       // Stopping Criteria
@@ -2113,7 +2219,7 @@ ConjugateGradient::ConjugateGradientResults* ConjugateGradient::perform_training
              }
           }
 
-         results_pointer->resize_training_history(1+iteration);
+         results_pointer->arrange_training_history(iteration);
 
          results_pointer->final_parameters = parameters;
          results_pointer->final_parameters_norm = parameters_norm;
@@ -2165,8 +2271,33 @@ ConjugateGradient::ConjugateGradientResults* ConjugateGradient::perform_training
 
       old_training_direction = training_direction;   
       old_training_rate = training_rate;
+
+      // Checkpoint
+
+      if(checkpoint_period != 0 && (iteration+1) % checkpoint_period == 0)
+      {
+         checkpoint.iteration = iteration+1;
+         checkpoint.elapsed_time = elapsed_time;
+         checkpoint.selection_failures = selection_failures;
+         checkpoint.old_performance = old_performance;
+         checkpoint.old_selection_performance = old_selection_performance;
+         checkpoint.parameters = parameters;
+         checkpoint.scalars.set(3);
+         checkpoint.scalars[0] = directional_point[0];
+         checkpoint.scalars[1] = directional_point[1];
+         checkpoint.scalars[2] = old_training_rate;
+         checkpoint.vectors.set(2);
+         checkpoint.vectors[0] = old_gradient;
+         checkpoint.vectors[1] = old_training_direction;
+
+         write_checkpoint(checkpoint);
+      }
    } 
 
+   close_history_file();
+
+   wait_checkpoint();
+
    return(results_pointer);
 
 }
@@ -27,6 +27,7 @@ namespace OpenNN
 
 CrossEntropyError::CrossEntropyError(void) : PerformanceTerm()
 {
+   set_default();
 }
 
 
@@ -40,6 +41,7 @@ CrossEntropyError::CrossEntropyError(void) : PerformanceTerm()
 CrossEntropyError::CrossEntropyError(NeuralNetwork* new_neural_network_pointer)
  : PerformanceTerm(new_neural_network_pointer)
 {
+   set_default();
 }
 
 
@@ -53,6 +55,7 @@ CrossEntropyError::CrossEntropyError(NeuralNetwork* new_neural_network_pointer)
 CrossEntropyError::CrossEntropyError(DataSet* new_data_set_pointer) 
 : PerformanceTerm(new_data_set_pointer)
 {
+   set_default();
 }
 
 
@@ -67,6 +70,7 @@ CrossEntropyError::CrossEntropyError(DataSet* new_data_set_pointer)
 CrossEntropyError::CrossEntropyError(NeuralNetwork* new_neural_network_pointer, DataSet* new_data_set_pointer)
 : PerformanceTerm(new_neural_network_pointer, new_data_set_pointer)
 {
+   set_default();
 }
 
 
@@ -80,6 +84,7 @@ CrossEntropyError::CrossEntropyError(NeuralNetwork* new_neural_network_pointer,
 CrossEntropyError::CrossEntropyError(const tinyxml2::XMLDocument& sum_squared_error_document)
  : PerformanceTerm(sum_squared_error_document)
 {
+   set_default();
 }
 
 
@@ -93,7 +98,7 @@ CrossEntropyError::CrossEntropyError(const tinyxml2::XMLDocument& sum_squared_er
 CrossEntropyError::CrossEntropyError(const CrossEntropyError& new_cross_entropy_error)
  : PerformanceTerm(new_cross_entropy_error)
 {
-
+   fused_softmax = new_cross_entropy_error.fused_softmax;
 }
 
 
@@ -118,6 +123,7 @@ CrossEntropyError& CrossEntropyError::operator = (const CrossEntropyError& other
       *neural_network_pointer = *other_cross_entropy_error.neural_network_pointer;
       *data_set_pointer = *other_cross_entropy_error.data_set_pointer;
       display = other_cross_entropy_error.display;
+      fused_softmax = other_cross_entropy_error.fused_softmax;
    }
 
    return(*this);
@@ -134,7 +140,8 @@ bool CrossEntropyError::operator == (const CrossEntropyError& other_cross_entrop
 {
    if(*neural_network_pointer == *other_cross_entropy_error.neural_network_pointer
    && *mathematical_model_pointer == *other_cross_entropy_error.mathematical_model_pointer
-   && display == other_cross_entropy_error.display)    
+   && display == other_cross_entropy_error.display
+   && fused_softmax == other_cross_entropy_error.fused_softmax)    
    {
       return(true);
    }
@@ -149,6 +156,92 @@ bool CrossEntropyError::operator == (const CrossEntropyError& other_cross_entrop
 // METHODS
 
 
+// EvaluationMethod get_evaluation_method(void) const method
+
+/// Returns the method used for evaluating the cross entropy error and its gradient.
+/// <ul>
+/// <li> Fused softmax: The fused softmax evaluation is enabled, the probabilistic layer uses the softmax method 
+/// and the output layer of the multilayer perceptron is linear.
+/// <li> Fused logistic: There is not a softmax probabilistic layer and the output layer of the multilayer perceptron is logistic.
+/// <li> Generic: Any other case, or when the neural network has a conditions layer.
+/// </ul>
+
+CrossEntropyError::EvaluationMethod CrossEntropyError::get_evaluation_method(void) const
+{
+   if(!neural_network_pointer || neural_network_pointer->has_conditions_layer())
+   {
+      return(Generic);
+   }
+
+   const MultilayerPerceptron* multilayer_perceptron_pointer = neural_network_pointer->get_multilayer_perceptron_pointer();
+
+   if(!multilayer_perceptron_pointer || multilayer_perceptron_pointer->get_layers_number() == 0)
+   {
+      return(Generic);
+   }
+
+   const size_t layers_number = multilayer_perceptron_pointer->get_layers_number();
+
+   const Perceptron::ActivationFunction& output_activation_function
+   = multilayer_perceptron_pointer->get_layer(layers_number-1).get_activation_function();
+
+   const bool has_softmax_layer = neural_network_pointer->has_probabilistic_layer()
+   && neural_network_pointer->get_probabilistic_layer_pointer()->get_probabilistic_method() == ProbabilisticLayer::Softmax;
+
+   if(fused_softmax && has_softmax_layer && output_activation_function == Perceptron::Linear)
+   {
+      return(FusedSoftmax);
+   }
+   else if(!has_softmax_layer && output_activation_function == Perceptron::Logistic)
+   {
+      return(FusedLogistic);
+   }
+
+   return(Generic);
+}
+
+
+// const bool& get_fused_softmax(void) const method
+
+/// Returns true if a softmax probabilistic layer on a linear output layer is evaluated with the fused softmax method, 
+/// and false otherwise. 
+
+const bool& CrossEntropyError::get_fused_softmax(void) const
+{
+   return(fused_softmax);
+}
+
+
+// void set_default(void) method
+
+/// Sets the default values to a cross entropy error object:
+/// <ul>
+/// <li> Fused softmax: false.
+/// <li> Display: true.
+/// </ul>
+
+void CrossEntropyError::set_default(void)
+{
+   fused_softmax = false;
+
+   display = true;
+}
+
+
+// void set_fused_softmax(const bool&) method
+
+/// Sets whether a softmax probabilistic layer on a linear output layer is evaluated with the fused softmax method. 
+/// That method computes the categorical cross entropy of the softmax probabilities, 
+/// instead of the binary cross entropy of the multilayer perceptron outputs, 
+/// so its values are not comparable with those of the generic method. 
+/// @param new_fused_softmax True for the fused softmax method, false for the generic method.
+
+void CrossEntropyError::set_fused_softmax(const bool& new_fused_softmax)
+{
+   fused_softmax = new_fused_softmax;
+}
+
+
 // void check(void) const method
 
 /// Checks that there are a neural network and a data set associated to the cross entropy error, 
@@ -286,15 +379,6 @@ double CrossEntropyError::calculate_performance(void) const
 
    const size_t training_instances_number = instances.count_training_instances_number();
 
-   const Vector<size_t> training_indices = instances.arrange_training_indices();
-
-   size_t training_index;
-
-   const Variables& variables = data_set_pointer->get_variables();
-
-   const Vector<size_t> inputs_indices = variables.arrange_inputs_indices();
-   const Vector<size_t> targets_indices = variables.arrange_targets_indices();
-
    // Cross entropy error
 
    Vector<double> inputs(inputs_number);
@@ -303,25 +387,34 @@ double CrossEntropyError::calculate_performance(void) const
 
    double cross_entropy_error = 0.0;
 
+   const EvaluationMethod evaluation_method = get_evaluation_method();
+
    int i = 0;
 
-   #pragma omp parallel for private(i, training_index, inputs, outputs, targets) reduction(+ : cross_entropy_error)
+   #pragma omp parallel for private(i, inputs, outputs, targets) reduction(+ : cross_entropy_error)
 
    for(i = 0; i < (int)training_instances_number; i++)
    {
-       training_index = training_indices[i];
-
       // Input vector
 
-      inputs = data_set_pointer->get_instance(training_index, inputs_indices);
+      data_set_pointer->get_training_inputs(i, inputs);
 
-      // Output vector
+      // Target vector
 
-      outputs = multilayer_perceptron_pointer->calculate_outputs(inputs);
+      data_set_pointer->get_training_targets(i, targets);
 
-      // Target vector
+      if(evaluation_method != Generic)
+      {
+         outputs = multilayer_perceptron_pointer->calculate_output_combinations(inputs);
+
+         cross_entropy_error += calculate_fused_error(evaluation_method, outputs, targets);
+
+         continue;
+      }
 
-      targets = data_set_pointer->get_instance(training_index, targets_indices);
+      // Output vector
+
+      outputs = multilayer_perceptron_pointer->calculate_outputs(inputs);
 
       // Cross entropy error
 
@@ -394,15 +487,6 @@ double CrossEntropyError::calculate_performance(const Vector<double>& parameters
 
     const size_t training_instances_number = instances.count_training_instances_number();
 
-    const Vector<size_t> training_indices = instances.arrange_training_indices();
-
-    size_t training_index;
-
-    const Variables& variables = data_set_pointer->get_variables();
-
-    const Vector<size_t> inputs_indices = variables.arrange_inputs_indices();
-    const Vector<size_t> targets_indices = variables.arrange_targets_indices();
-
     // Cross-entropy error stuff
 
     Vector<double> inputs(inputs_number);
@@ -411,25 +495,34 @@ double CrossEntropyError::calculate_performance(const Vector<double>& parameters
 
     double cross_entropy_error = 0.0;
 
+    const EvaluationMethod evaluation_method = get_evaluation_method();
+
     int i = 0;
 
-    #pragma omp parallel for private(i, training_index, inputs, outputs, targets) reduction(+ : cross_entropy_error)
+    #pragma omp parallel for private(i, inputs, outputs, targets) reduction(+ : cross_entropy_error)
 
     for(i = 0; i < (int)training_instances_number; i++)
     {
-        training_index = training_indices[i];
-
        // Input vector
 
-       inputs = data_set_pointer->get_instance(training_index, inputs_indices);
+       data_set_pointer->get_training_inputs(i, inputs);
 
-       // Output vector
+       // Target vector
 
-       outputs = multilayer_perceptron_pointer->calculate_outputs(inputs, parameters);
+       data_set_pointer->get_training_targets(i, targets);
 
-       // Target vector
+       if(evaluation_method != Generic)
+       {
+          outputs = multilayer_perceptron_pointer->calculate_output_combinations(inputs, parameters);
 
-       targets = data_set_pointer->get_instance(training_index, targets_indices);
+          cross_entropy_error += calculate_fused_error(evaluation_method, outputs, targets);
+
+          continue;
+       }
+
+       // Output vector
+
+       outputs = multilayer_perceptron_pointer->calculate_outputs(inputs, parameters);
 
        // Cross-entropy error
 
@@ -480,15 +573,6 @@ double CrossEntropyError::calculate_minimum_performance(void) const
 
     const size_t training_instances_number = instances.count_training_instances_number();
 
-    const Vector<size_t> training_indices = instances.arrange_training_indices();
-
-    size_t training_index;
-
-    const Variables& variables = data_set_pointer->get_variables();
-
-    const Vector<size_t> inputs_indices = variables.arrange_inputs_indices();
-    const Vector<size_t> targets_indices = variables.arrange_targets_indices();
-
     // Cross-entropy error stuff
 
     Vector<double> inputs(inputs_number);
@@ -499,15 +583,13 @@ double CrossEntropyError::calculate_minimum_performance(void) const
 
     int i = 0;
 
-    #pragma omp parallel for private(i, training_index, inputs, outputs, targets) reduction(+ : minimum_cross_entropy_error)
+    #pragma omp parallel for private(i, inputs, outputs, targets) reduction(+ : minimum_cross_entropy_error)
 
     for(i = 0; i < (int)training_instances_number; i++)
     {
-        training_index = training_indices[i];
-
         // Input vector
 
-       inputs = data_set_pointer->get_instance(training_index, inputs_indices);
+       data_set_pointer->get_training_inputs(i, inputs);
 
        // Output vector
 
@@ -515,7 +597,7 @@ double CrossEntropyError::calculate_minimum_performance(void) const
 
        // Target vector
 
-       targets = data_set_pointer->get_instance(training_index, targets_indices);
+       data_set_pointer->get_training_targets(i, targets);
 
        // Cross-entropy error
 
@@ -574,15 +656,6 @@ double CrossEntropyError::calculate_selection_performance(void) const
 
    const size_t selection_instances_number = instances.count_selection_instances_number();
 
-   const Vector<size_t> selection_indices = instances.arrange_selection_indices();
-
-   size_t selection_index;
-
-   const Variables& variables = data_set_pointer->get_variables();
-
-   const Vector<size_t> inputs_indices = variables.arrange_inputs_indices();
-   const Vector<size_t> targets_indices = variables.arrange_targets_indices();
-
    // Performance functional
 
    Vector<double> inputs(inputs_number);
@@ -591,25 +664,34 @@ double CrossEntropyError::calculate_selection_performance(void) const
 
    double selection_performance = 0.0;
 
+   const EvaluationMethod evaluation_method = get_evaluation_method();
+
    int i = 0;
 
-   #pragma omp parallel for private(i, selection_index, inputs, outputs, targets) reduction(- : selection_performance)
+   #pragma omp parallel for private(i, inputs, outputs, targets) reduction(- : selection_performance)
 
    for(i = 0; i < (int)selection_instances_number; i++)
    {
-       selection_index = selection_indices[i];
-
       // Input vector
 
-      inputs = data_set_pointer->get_instance(selection_index, inputs_indices);
+      data_set_pointer->get_selection_inputs(i, inputs);
 
-      // Output vector
+      // Target vector
 
-      outputs = multilayer_perceptron_pointer->calculate_outputs(inputs);
+      data_set_pointer->get_selection_targets(i, targets);
 
-      // Target vector
+      if(evaluation_method != Generic)
+      {
+         outputs = multilayer_perceptron_pointer->calculate_output_combinations(inputs);
+
+         selection_performance += calculate_fused_error(evaluation_method, outputs, targets);
+
+         continue;
+      }
 
-      targets = data_set_pointer->get_instance(selection_index, targets_indices);
+      // Output vector
+
+      outputs = multilayer_perceptron_pointer->calculate_outputs(inputs);
 
       // Cross entropy error
 
@@ -660,15 +742,6 @@ double CrossEntropyError::calculate_minimum_selection_performance(void) const
 
     const size_t selection_instances_number = instances.count_selection_instances_number();
 
-    const Vector<size_t> selection_indices = instances.arrange_selection_indices();
-
-    size_t selection_index;
-
-    const Variables& variables = data_set_pointer->get_variables();
-
-    const Vector<size_t> inputs_indices = variables.arrange_inputs_indices();
-    const Vector<size_t> targets_indices = variables.arrange_targets_indices();
-
     // Performance functional
 
     Vector<double> inputs(inputs_number);
@@ -679,15 +752,13 @@ double CrossEntropyError::calculate_minimum_selection_performance(void) const
 
     int i = 0;
 
-    #pragma omp parallel for private(i, selection_index, inputs, outputs, targets) reduction(- : minimum_selection_performance)
+    #pragma omp parallel for private(i, inputs, outputs, targets) reduction(- : minimum_selection_performance)
 
     for(i = 0; i < (int)selection_instances_number; i++)
     {
-        selection_index = selection_indices[i];
-
        // Input vector
 
-       inputs = data_set_pointer->get_instance(selection_index, inputs_indices);
+       data_set_pointer->get_selection_inputs(i, inputs);
 
        // Output vector
 
@@ -695,7 +766,7 @@ double CrossEntropyError::calculate_minimum_selection_performance(void) const
 
        // Target vector
 
-       targets = data_set_pointer->get_instance(selection_index, targets_indices);
+       data_set_pointer->get_selection_targets(i, targets);
 
        // Cross entropy error
 
@@ -741,6 +812,13 @@ Vector<double> CrossEntropyError::calculate_gradient(void) const
 
    #endif
 
+   const EvaluationMethod evaluation_method = get_evaluation_method();
+
+   if(evaluation_method != Generic)
+   {
+      return(calculate_fused_gradient(evaluation_method));
+   }
+
    // Neural network stuff
 
    const MultilayerPerceptron* multilayer_perceptron_pointer = neural_network_pointer->get_multilayer_perceptron_pointer();
@@ -795,15 +873,6 @@ Vector<double> CrossEntropyError::calculate_gradient(void) const
 
    const size_t training_instances_number = instances.count_training_instances_number();
 
-   const Vector<size_t> training_indices = instances.arrange_training_indices();
-
-   size_t training_index;
-
-   const Variables& variables = data_set_pointer->get_variables();
-
-   const Vector<size_t> inputs_indices = variables.arrange_inputs_indices();
-   const Vector<size_t> targets_indices = variables.arrange_targets_indices();
-
    Vector<double> inputs(inputs_number);
    Vector<double> targets(outputs_number);
 
@@ -819,11 +888,9 @@ Vector<double> CrossEntropyError::calculate_gradient(void) const
 
    for(size_t i = 0; i < training_instances_number; i++)
    {
-       training_index = training_indices[i];
-
-      inputs = data_set_pointer->get_instance(training_index, inputs_indices);
+      data_set_pointer->get_training_inputs(i, inputs);
 
-      targets = data_set_pointer->get_instance(training_index, targets_indices);
+      data_set_pointer->get_training_targets(i, targets);
 
       first_order_forward_propagation = multilayer_perceptron_pointer->calculate_first_order_forward_propagation(inputs);
 
@@ -887,6 +954,137 @@ Vector<double> CrossEntropyError::calculate_gradient(void) const
 }
 
 
+// double calculate_fused_error(const EvaluationMethod&, const Vector<double>&, const Vector<double>&) const method
+
+/// Returns the cross entropy error of a single instance, computed from the combinations of the output layer.
+/// For logistic outputs, each output contributes log(1+exp(z)) - t*z, evaluated without overflow.
+/// For softmax outputs, the error is the log-sum-exp of the combinations times the sum of the targets, minus the targets dot the combinations.
+/// @param evaluation_method Fused evaluation method.
+/// @param output_combinations Combinations of the output layer of the multilayer perceptron.
+/// @param targets Target values for that instance.
+
+double CrossEntropyError::calculate_fused_error(const EvaluationMethod& evaluation_method,
+                                                const Vector<double>& output_combinations,
+                                                const Vector<double>& targets) const
+{
+   const size_t outputs_number = output_combinations.size();
+
+   double error = 0.0;
+
+   if(evaluation_method == FusedSoftmax)
+   {
+      error = output_combinations.calculate_log_sum_exp()*targets.calculate_sum() - targets.dot(output_combinations);
+   }
+   else
+   {
+      for(size_t j = 0; j < outputs_number; j++)
+      {
+         const double& combination = output_combinations[j];
+
+         error += (combination > 0.0 ? combination : 0.0) + log1p(exp(-fabs(combination))) - targets[j]*combination;
+      }
+   }
+
+   return(error);
+}
+
+
+// Vector<double> calculate_fused_output_delta(const EvaluationMethod&, const Vector<double>&, const Vector<double>&) const method
+
+/// Returns the partial derivatives of the cross entropy error of a single instance 
+/// with respect to the combinations of the output layer.
+/// This is the probabilities minus the targets, so that no Jacobian of the softmax or logistic functions is needed.
+/// @param evaluation_method Fused evaluation method.
+/// @param outputs Activations of the output layer of the multilayer perceptron.
+/// That is, logistic probabilities for the fused logistic method, and combinations for the fused softmax method.
+/// @param targets Target values for that instance.
+
+Vector<double> CrossEntropyError::calculate_fused_output_delta(const EvaluationMethod& evaluation_method,
+                                                               const Vector<double>& outputs,
+                                                               const Vector<double>& targets) const
+{
+   if(evaluation_method == FusedSoftmax)
+   {
+      return(outputs.calculate_softmax()*targets.calculate_sum() - targets);
+   }
+   else
+   {
+      return(outputs - targets);
+   }
+}
+
+
+// Vector<double> calculate_fused_gradient(const EvaluationMethod&) const method
+
+/// Returns the cross entropy error gradient of a neural network with fused logistic or softmax outputs.
+/// The output layer delta is computed directly as probabilities minus targets and back-propagated to the hidden layers.
+/// The training instances are evaluated in parallel.
+/// @param evaluation_method Fused evaluation method.
+
+Vector<double> CrossEntropyError::calculate_fused_gradient(const EvaluationMethod& evaluation_method) const
+{
+   // Neural network stuff
+
+   const MultilayerPerceptron* multilayer_perceptron_pointer = neural_network_pointer->get_multilayer_perceptron_pointer();
+
+   const size_t inputs_number = multilayer_perceptron_pointer->get_inputs_number();
+   const size_t outputs_number = multilayer_perceptron_pointer->get_outputs_number();
+
+   const size_t layers_number = multilayer_perceptron_pointer->get_layers_number();
+
+   const size_t neural_parameters_number = multilayer_perceptron_pointer->count_parameters_number();
+
+   Vector< Vector< Vector<double> > > first_order_forward_propagation(2);
+
+   // Data set stuff
+
+   const Instances& instances = data_set_pointer->get_instances();
+
+   const size_t training_instances_number = instances.count_training_instances_number();
+
+   Vector<double> inputs(inputs_number);
+   Vector<double> targets(outputs_number);
+
+   // Cross-entropy error stuff
+
+   Vector<double> output_delta(outputs_number);
+
+   Vector< Vector<double> > layers_delta;
+
+   Vector<double> point_gradient(neural_parameters_number, 0.0);
+
+   Vector<double> gradient(neural_parameters_number, 0.0);
+
+   int i = 0;
+
+   #pragma omp parallel for private(i, inputs, targets, first_order_forward_propagation, \
+    output_delta, layers_delta, point_gradient)
+
+   for(i = 0; i < (int)training_instances_number; i++)
+   {
+      data_set_pointer->get_training_inputs(i, inputs);
+
+      data_set_pointer->get_training_targets(i, targets);
+
+      first_order_forward_propagation = multilayer_perceptron_pointer->calculate_first_order_forward_propagation(inputs);
+
+      const Vector< Vector<double> >& layers_activation = first_order_forward_propagation[0];
+      const Vector< Vector<double> >& layers_activation_derivative = first_order_forward_propagation[1];
+
+      output_delta = calculate_fused_output_delta(evaluation_method, layers_activation[layers_number-1], targets);
+
+      layers_delta = calculate_hidden_layers_delta(layers_activation_derivative, output_delta);
+
+      point_gradient = calculate_point_gradient(inputs, layers_activation, layers_delta);
+
+      #pragma omp critical
+      gradient += point_gradient;
+   }
+
+   return(gradient);
+}
+
+
 // Matrix<double> calculate_Hessian(void) const
 
 /// @todo
@@ -926,6 +1124,19 @@ tinyxml2::XMLDocument* CrossEntropyError::to_XML(void) const
 
    document->InsertFirstChild(cross_entropy_error_element);
 
+   // Fused softmax
+
+   {
+      tinyxml2::XMLElement* fused_softmax_element = document->NewElement("FusedSoftmax");
+      cross_entropy_error_element->LinkEndChild(fused_softmax_element);
+
+      buffer.str("");
+      buffer << fused_softmax;
+
+      tinyxml2::XMLText* fused_softmax_text = document->NewText(buffer.str().c_str());
+      fused_softmax_element->LinkEndChild(fused_softmax_text);
+   }
+
    // Display
 
    {
@@ -963,6 +1174,18 @@ void CrossEntropyError::from_XML(const tinyxml2::XMLDocument& document)
         throw std::logic_error(buffer.str());
     }
 
+  // Fused softmax
+  {
+     const tinyxml2::XMLElement* fused_softmax_element = root_element->FirstChildElement("FusedSoftmax");
+
+     if(fused_softmax_element)
+     {
+        const std::string new_fused_softmax_string = fused_softmax_element->GetText();
+
+        set_fused_softmax(new_fused_softmax_string != "0");
+     }
+  }
+
   // Display
   {
      const tinyxml2::XMLElement* display_element = root_element->FirstChildElement("Display");
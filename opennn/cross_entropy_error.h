@@ -77,8 +77,30 @@ public:
 
    bool operator == (const CrossEntropyError&) const;
 
+   // ENUMERATIONS
+
+   /// Enumeration of the ways of evaluating the cross entropy error.
+   /// The fused methods evaluate the loss from the combinations of the output layer, 
+   /// with logistic or softmax outputs, and compute the output delta directly as outputs minus targets. 
+   /// The fused logistic method gives the same loss as the generic one, 
+   /// while the fused softmax method gives the categorical cross entropy of the softmax probabilities. 
+
+   enum EvaluationMethod{Generic, FusedLogistic, FusedSoftmax};
+
    // METHODS
 
+   // Get methods
+
+   EvaluationMethod get_evaluation_method(void) const;
+
+   const bool& get_fused_softmax(void) const;
+
+   // Set methods
+
+   void set_default(void);
+
+   void set_fused_softmax(const bool&);
+
    // Checking methods
 
    void check(void) const;
@@ -96,12 +118,28 @@ public:
    Vector<double> calculate_gradient(void) const;
    Matrix<double> calculate_Hessian(void) const;
 
+   // Fused output methods
+
+   double calculate_fused_error(const EvaluationMethod&, const Vector<double>&, const Vector<double>&) const;
+   Vector<double> calculate_fused_output_delta(const EvaluationMethod&, const Vector<double>&, const Vector<double>&) const;
+
+   Vector<double> calculate_fused_gradient(const EvaluationMethod&) const;
+
    std::string write_performance_term_type(void) const;
 
    // Serialization methods
 
    tinyxml2::XMLDocument* to_XML(void) const;   
    void from_XML(const tinyxml2::XMLDocument&);
+
+private:
+
+   // MEMBERS
+
+   /// True if the categorical cross entropy of a softmax probabilistic layer is evaluated with the fused softmax method.
+   /// It changes the loss from the binary cross entropy of the multilayer perceptron outputs, so it must be enabled explicitly.
+
+   bool fused_softmax;
 };
 
 }
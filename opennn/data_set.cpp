@@ -148,6 +148,12 @@ DataSet& DataSet::operator = (const DataSet& other_data_set)
 
       data = other_data_set.data;
 
+      // Packed blocks
+
+      packed_blocks = other_data_set.packed_blocks;
+
+      reset_blocks();
+
       // Variables
 
       variables = other_data_set.variables;
@@ -247,10 +253,22 @@ const bool& DataSet::get_display(void) const
 // bool empty(void) const method
 
 /// Returns true if the data matrix is empty, and false otherwise.
+/// A data set with a time series view is not empty.
 
 bool DataSet::empty(void) const
 {
-   return(data.empty());
+   return(data.empty() && !has_time_series_view());
+}
+
+
+// bool has_time_series_view(void) const method
+
+/// Returns true if the data set has been converted to a time series view,
+/// that is, the lagged variables are read from the original series instead of from the data matrix.
+
+bool DataSet::has_time_series_view(void) const
+{
+   return(time_series_view && data.empty() && !time_series_data.empty());
 }
 
 
@@ -259,6 +277,8 @@ bool DataSet::empty(void) const
 /// Returns a reference to the data matrix in the data set. 
 /// The number of rows is equal to the number of instances.
 /// The number of columns is equal to the number of variables. 
+/// In time series view mode the lagged data matrix is not stored, and this matrix is empty.
+/// Use get_value, get_instance or the arrange methods in that case.
 
 const Matrix<double>& DataSet::get_data(void) const
 {
@@ -607,6 +627,28 @@ const size_t& DataSet::get_steps_ahead(void) const
 }
 
 
+// const bool& get_time_series_view(void) const
+
+/// Returns true if the lagged variables of a time series are read from the original series on demand,
+/// and false if they are materialized in the data matrix.
+
+const bool& DataSet::get_time_series_view(void) const
+{
+    return(time_series_view);
+}
+
+
+// const bool& get_packed_blocks(void) const
+
+/// Returns true if the inputs and targets of the training and selection instances are kept in contiguous blocks,
+/// and false if they are gathered from the data matrix on each read.
+
+const bool& DataSet::get_packed_blocks(void) const
+{
+    return(packed_blocks);
+}
+
+
 // const bool& get_autoassociation(void) const
 
 /// Returns true if the data set will be used for an autoassociation application, and false otherwise.
@@ -682,7 +724,7 @@ Matrix<double> DataSet::arrange_training_data(void) const
 
    const Vector<size_t> training_indices = instances.arrange_training_indices();
 
-   return(data.arrange_submatrix(training_indices, variables_indices));
+   return(arrange_data(training_indices, variables_indices));
 }
 
 
@@ -700,7 +742,7 @@ Matrix<double> DataSet::arrange_selection_data(void) const
 
    Vector<size_t> variables_indices(0, 1, (int)variables_number-1);
 
-   return(data.arrange_submatrix(selection_indices, variables_indices));
+   return(arrange_data(selection_indices, variables_indices));
 }
 
 
@@ -717,7 +759,7 @@ Matrix<double> DataSet::arrange_testing_data(void) const
 
    const Vector<size_t> testing_indices = instances.arrange_testing_indices();
 
-   return(data.arrange_submatrix(testing_indices, variables_indices));
+   return(arrange_data(testing_indices, variables_indices));
 }
 
 
@@ -734,7 +776,7 @@ Matrix<double> DataSet::arrange_input_data(void) const
 
    const Vector<size_t> inputs_indices = variables.arrange_inputs_indices();
 
-   return(data.arrange_submatrix(indices, inputs_indices));
+   return(arrange_data(indices, inputs_indices));
 }
 
 
@@ -751,7 +793,7 @@ Matrix<double> DataSet::arrange_target_data(void) const
 
    const Vector<size_t> targets_indices = variables.arrange_targets_indices();
 
-   return(data.arrange_submatrix(indices, targets_indices));
+   return(arrange_data(indices, targets_indices));
 }
 
 
@@ -767,7 +809,7 @@ Matrix<double> DataSet::arrange_training_input_data(void) const
 
    const Vector<size_t> training_indices = instances.arrange_training_indices();
 
-   return(data.arrange_submatrix(training_indices, inputs_indices));
+   return(arrange_data(training_indices, inputs_indices));
 }
 
 
@@ -783,7 +825,7 @@ Matrix<double> DataSet::arrange_training_target_data(void) const
 
    const Vector<size_t> targets_indices = variables.arrange_targets_indices();
 
-   return(data.arrange_submatrix(training_indices, targets_indices));
+   return(arrange_data(training_indices, targets_indices));
 }
 
 
@@ -799,7 +841,7 @@ Matrix<double> DataSet::get_selection_input_data(void) const
 
    const Vector<size_t> inputs_indices = variables.arrange_inputs_indices();
 
-   return(data.arrange_submatrix(selection_indices, inputs_indices));
+   return(arrange_data(selection_indices, inputs_indices));
 }
 
 
@@ -815,7 +857,7 @@ Matrix<double> DataSet::get_selection_target_data(void) const
 
    const Vector<size_t> targets_indices = variables.arrange_targets_indices();
 
-   return(data.arrange_submatrix(selection_indices, targets_indices));
+   return(arrange_data(selection_indices, targets_indices));
 }
 
 
@@ -831,7 +873,7 @@ Matrix<double> DataSet::arrange_testing_input_data(void) const
 
    const Vector<size_t> testing_indices = instances.arrange_testing_indices();
 
-   return(data.arrange_submatrix(testing_indices, inputs_indices));
+   return(arrange_data(testing_indices, inputs_indices));
 }
 
 
@@ -847,7 +889,7 @@ Matrix<double> DataSet::arrange_testing_target_data(void) const
 
    const Vector<size_t> testing_indices = instances.arrange_testing_indices();
 
-   return(data.arrange_submatrix(testing_indices, targets_indices));
+   return(arrange_data(testing_indices, targets_indices));
 }
 
 
@@ -877,8 +919,24 @@ Vector<double> DataSet::get_instance(const size_t& i) const
 
    #endif
 
+   OPENNN_COUNT("data_set.get_instance", 1);
+
    // Get instance
 
+   if(has_time_series_view())
+   {
+       const size_t variables_number = variables.get_variables_number();
+
+       Vector<double> instance(variables_number);
+
+       for(size_t j = 0; j < variables_number; j++)
+       {
+           instance[j] = get_value(i, j);
+       }
+
+       return(instance);
+   }
+
    return(data.arrange_row(i));
 }
 
@@ -910,12 +968,291 @@ Vector<double> DataSet::get_instance(const size_t& instance_index, const Vector<
 
    #endif
 
+   OPENNN_COUNT("data_set.get_instance", 1);
+
    // Get instance
 
+   if(has_time_series_view())
+   {
+       const size_t size = variables_indices.size();
+
+       Vector<double> instance(size);
+
+       for(size_t j = 0; j < size; j++)
+       {
+           instance[j] = get_value(instance_index, variables_indices[j]);
+       }
+
+       return(instance);
+   }
+
    return(data.arrange_row(instance_index, variables_indices));
 }
 
 
+// double get_value(const size_t&, const size_t&) const method
+
+/// Returns the value of a single variable in a single instance of the data set.
+/// In time series view mode, the lagged variable is read from the original series,
+/// so that the variable j of the instance i is the variable j%n of the row i+j/n in the series,
+/// where n is the number of variables in the series.
+/// The scaling of that lagged variable is then applied to the value. 
+/// The autoassociation variables read the same values as the lagged variables. 
+/// @param instance_index Index of the instance.
+/// @param variable_index Index of the variable.
+
+double DataSet::get_value(const size_t& instance_index, const size_t& variable_index) const
+{
+   if(has_time_series_view())
+   {
+       const size_t series_variables_number = time_series_data.get_columns_number();
+
+       const size_t lagged_variable_index = variable_index%(series_variables_number*(1 + lags_number));
+
+       const double value = time_series_data(instance_index + lagged_variable_index/series_variables_number, lagged_variable_index%series_variables_number);
+
+       return(time_series_slopes[variable_index]*value + time_series_intercepts[variable_index]);
+   }
+
+   return(data(instance_index, variable_index));
+}
+
+
+// const Matrix<double>& get_training_inputs_block(void) const method
+
+/// Returns the packed block with the inputs of the training instances, building it first if it is out of date.
+/// The number of rows is the number of inputs and the number of columns is the number of training instances.
+/// Packed blocks must be enabled.
+
+const Matrix<double>& DataSet::get_training_inputs_block(void) const
+{
+   update_blocks();
+
+   return(training_inputs_block);
+}
+
+
+// const Matrix<double>& get_training_targets_block(void) const method
+
+/// Returns the packed block with the targets of the training instances, building it first if it is out of date.
+/// The number of rows is the number of targets and the number of columns is the number of training instances.
+/// Packed blocks must be enabled.
+
+const Matrix<double>& DataSet::get_training_targets_block(void) const
+{
+   update_blocks();
+
+   return(training_targets_block);
+}
+
+
+// const Matrix<double>& get_selection_inputs_block(void) const method
+
+/// Returns the packed block with the inputs of the selection instances, building it first if it is out of date.
+/// The number of rows is the number of inputs and the number of columns is the number of selection instances.
+/// Packed blocks must be enabled.
+
+const Matrix<double>& DataSet::get_selection_inputs_block(void) const
+{
+   update_blocks();
+
+   return(selection_inputs_block);
+}
+
+
+// const Matrix<double>& get_selection_targets_block(void) const method
+
+/// Returns the packed block with the targets of the selection instances, building it first if it is out of date.
+/// The number of rows is the number of targets and the number of columns is the number of selection instances.
+/// Packed blocks must be enabled.
+
+const Matrix<double>& DataSet::get_selection_targets_block(void) const
+{
+   update_blocks();
+
+   return(selection_targets_block);
+}
+
+
+// const Matrix<float>& get_training_float_inputs_block(void) const method
+
+/// Returns the inputs of the training instances in single precision, building them first if they are out of date.
+/// The number of rows is the number of training instances and the number of columns is the number of inputs.
+/// The values are converted as they are read, and they are kept until the data, the instances or the variables change,
+/// so that single precision training does not convert the data on each epoch.
+/// It does not depend on the packed blocks flag.
+
+const Matrix<float>& DataSet::get_training_float_inputs_block(void) const
+{
+   update_float_blocks();
+
+   return(training_float_inputs_block);
+}
+
+
+// const Matrix<float>& get_training_float_targets_block(void) const method
+
+/// Returns the targets of the training instances in single precision, building them first if they are out of date.
+/// The number of rows is the number of training instances and the number of columns is the number of targets.
+
+const Matrix<float>& DataSet::get_training_float_targets_block(void) const
+{
+   update_float_blocks();
+
+   return(training_float_targets_block);
+}
+
+
+// void get_training_inputs(const size_t&, Vector<double>&) const method
+
+/// Writes the inputs of a training instance into a given vector, reusing its storage.
+/// If packed blocks are enabled they are copied from the training inputs block,
+/// otherwise they are gathered from the data matrix.
+/// @param i Position of the instance among the training instances, not its index in the data set.
+/// @param inputs Vector to be filled with the input values.
+
+void DataSet::get_training_inputs(const size_t& i, Vector<double>& inputs) const
+{
+   OPENNN_COUNT("data_set.training_instances", 1);
+
+   if(packed_blocks)
+   {
+      update_blocks();
+
+      copy_block_instance(training_inputs_block, i, inputs);
+   }
+   else
+   {
+      inputs = get_instance(instances.get_training_indices()[i], variables.get_inputs_indices());
+   }
+}
+
+
+// void get_training_targets(const size_t&, Vector<double>&) const method
+
+/// Writes the targets of a training instance into a given vector, reusing its storage.
+/// @param i Position of the instance among the training instances, not its index in the data set.
+/// @param targets Vector to be filled with the target values.
+
+void DataSet::get_training_targets(const size_t& i, Vector<double>& targets) const
+{
+   if(packed_blocks)
+   {
+      update_blocks();
+
+      copy_block_instance(training_targets_block, i, targets);
+   }
+   else
+   {
+      targets = get_instance(instances.get_training_indices()[i], variables.get_targets_indices());
+   }
+}
+
+
+// void get_selection_inputs(const size_t&, Vector<double>&) const method
+
+/// Writes the inputs of a selection instance into a given vector, reusing its storage.
+/// @param i Position of the instance among the selection instances, not its index in the data set.
+/// @param inputs Vector to be filled with the input values.
+
+void DataSet::get_selection_inputs(const size_t& i, Vector<double>& inputs) const
+{
+   OPENNN_COUNT("data_set.selection_instances", 1);
+
+   if(packed_blocks)
+   {
+      update_blocks();
+
+      copy_block_instance(selection_inputs_block, i, inputs);
+   }
+   else
+   {
+      inputs = get_instance(instances.get_selection_indices()[i], variables.get_inputs_indices());
+   }
+}
+
+
+// void get_selection_targets(const size_t&, Vector<double>&) const method
+
+/// Writes the targets of a selection instance into a given vector, reusing its storage.
+/// @param i Position of the instance among the selection instances, not its index in the data set.
+/// @param targets Vector to be filled with the target values.
+
+void DataSet::get_selection_targets(const size_t& i, Vector<double>& targets) const
+{
+   if(packed_blocks)
+   {
+      update_blocks();
+
+      copy_block_instance(selection_targets_block, i, targets);
+   }
+   else
+   {
+      targets = get_instance(instances.get_selection_indices()[i], variables.get_targets_indices());
+   }
+}
+
+
+// Matrix<double> arrange_data(const Vector<size_t>&, const Vector<size_t>&) const method
+
+/// Returns a matrix with given instances and variables of the data set.
+/// This is the method through which all the batch extraction methods read the data,
+/// both for a materialized data matrix and for a time series view.
+/// @param instances_indices Indices of the instances, which are the rows of the returned matrix.
+/// @param variables_indices Indices of the variables, which are the columns of the returned matrix.
+
+Matrix<double> DataSet::arrange_data(const Vector<size_t>& instances_indices, const Vector<size_t>& variables_indices) const
+{
+   if(!has_time_series_view())
+   {
+       return(data.arrange_submatrix(instances_indices, variables_indices));
+   }
+
+   const size_t instances_number = instances_indices.size();
+   const size_t variables_number = variables_indices.size();
+
+   Matrix<double> submatrix(instances_number, variables_number);
+
+   for(size_t j = 0; j < variables_number; j++)
+   {
+       for(size_t i = 0; i < instances_number; i++)
+       {
+           submatrix(i,j) = get_value(instances_indices[i], variables_indices[j]);
+       }
+   }
+
+   return(submatrix);
+}
+
+
+// Matrix<float> arrange_float_data(const Vector<size_t>&, const Vector<size_t>&) const method
+
+/// Returns a single precision matrix with the given instances and variables of the data set.
+/// The values are converted as they are read, so that no double precision copy of the submatrix is made. 
+/// It is intended for large batch evaluations of neural networks in single precision. 
+/// For repeated passes over the training instances, use the single precision training blocks instead, which are converted only once. 
+/// @param instances_indices Indices of the instances.
+/// @param variables_indices Indices of the variables.
+
+Matrix<float> DataSet::arrange_float_data(const Vector<size_t>& instances_indices, const Vector<size_t>& variables_indices) const
+{
+   const size_t instances_number = instances_indices.size();
+   const size_t variables_number = variables_indices.size();
+
+   Matrix<float> submatrix(instances_number, variables_number);
+
+   for(size_t j = 0; j < variables_number; j++)
+   {
+       for(size_t i = 0; i < instances_number; i++)
+       {
+           submatrix(i,j) = (float)get_value(instances_indices[i], variables_indices[j]);
+       }
+   }
+
+   return(submatrix);
+}
+
+
 // Vector<double> get_variable(const size_t&) const method
 
 /// Returns all the instances of a single variable in the data set. 
@@ -944,6 +1281,20 @@ Vector<double> DataSet::get_variable(const size_t& i) const
 
    // Get variable
 
+   if(has_time_series_view())
+   {
+       const size_t instances_number = instances.get_instances_number();
+
+       Vector<double> variable(instances_number);
+
+       for(size_t j = 0; j < instances_number; j++)
+       {
+           variable[j] = get_value(j, i);
+       }
+
+       return(variable);
+   }
+
    return(data.arrange_column(i));
 }
 
@@ -977,6 +1328,20 @@ Vector<double> DataSet::get_variable(const size_t& variable_index, const Vector<
 
    // Get variable
 
+   if(has_time_series_view())
+   {
+       const size_t size = instances_indices.size();
+
+       Vector<double> variable(size);
+
+       for(size_t j = 0; j < size; j++)
+       {
+           variable[j] = get_value(instances_indices[j], variable_index);
+       }
+
+       return(variable);
+   }
+
    return(data.arrange_column(variable_index, instances_indices));
 }
 
@@ -991,6 +1356,8 @@ void DataSet::set(void)
 
    data.set();
 
+   reset_blocks();
+
    variables.set();
    instances.set();
 
@@ -1018,6 +1385,8 @@ void DataSet::set(const Matrix<double>& new_data)
 
    data = new_data;
 
+   reset_blocks();
+
    display = true;
 
    file_type = DAT;
@@ -1064,6 +1433,8 @@ void DataSet::set(const size_t& new_instances_number, const size_t& new_variable
 
    data.set(new_instances_number, new_variables_number);
 
+   reset_blocks();
+
    instances.set(new_instances_number);
 
    variables.set(new_variables_number);
@@ -1092,6 +1463,8 @@ void DataSet::set(const size_t& new_instances_number, const size_t& new_inputs_n
 
    data.set(new_instances_number, new_variables_number);
 
+   reset_blocks();
+
    variables.set(new_inputs_number, new_targets_number);
 
    instances.set(new_instances_number);
@@ -1119,8 +1492,24 @@ void DataSet::set(const DataSet& other_data_set)
 
    missing_values_label = other_data_set.missing_values_label;
 
+   lags_number = other_data_set.lags_number;
+
+   steps_ahead = other_data_set.steps_ahead;
+
+   time_series_view = other_data_set.time_series_view;
+
    data = other_data_set.data;
 
+   packed_blocks = other_data_set.packed_blocks;
+
+   reset_blocks();
+
+   time_series_data = other_data_set.time_series_data;
+
+   time_series_slopes = other_data_set.time_series_slopes;
+
+   time_series_intercepts = other_data_set.time_series_intercepts;
+
    variables = other_data_set.variables;
 
    instances = other_data_set.instances;
@@ -1189,6 +1578,12 @@ void DataSet::set_default(void)
 
     steps_ahead = 0;
 
+    time_series_view = false;
+
+    packed_blocks = false;
+
+    reset_blocks();
+
     autoassociation = false;
 
     angular_units = Degrees;
@@ -1247,9 +1642,13 @@ void DataSet::set_data(const Matrix<double>& new_data)
    
    data = new_data;   
 
+   reset_blocks();
+
    instances.set_instances_number(data.get_rows_number());
    variables.set_variables_number(data.get_columns_number());
 
+   missing_values.set_instances_number(data.get_rows_number());
+   missing_values.set_variables_number(data.get_columns_number());
 }
 
 
@@ -1450,6 +1849,49 @@ void DataSet::set_steps_ahead_number(const size_t& new_steps_ahead_number)
 }
 
 
+// void set_time_series_view(const bool&)
+
+/// Sets whether a time series is to be converted to a lazy view or to a materialized data matrix.
+/// When loading the data file, the time series data will be converted according to this flag.
+/// The view does not copy the original series for each lag, but scaling and missing values methods
+/// which modify the data matrix are not available on it.
+/// @param new_time_series_view True for a time series view, false for a materialized data matrix.
+
+void DataSet::set_time_series_view(const bool& new_time_series_view)
+{
+    time_series_view = new_time_series_view;
+
+    reset_blocks();
+}
+
+
+// void set_packed_blocks(const bool&)
+
+/// Sets a new packed blocks flag.
+/// If true, the inputs and targets of the training and selection instances are copied to contiguous blocks the first time that they are read,
+/// and the performance terms stream through them sequentially.
+/// The blocks are built again only when the uses of the instances or the variables, or the data, change.
+/// If false, the blocks are released and the instances are gathered from the data matrix on each read.
+/// @param new_packed_blocks True to keep packed blocks, false otherwise.
+
+void DataSet::set_packed_blocks(const bool& new_packed_blocks)
+{
+    packed_blocks = new_packed_blocks;
+
+    reset_blocks();
+
+    if(!packed_blocks)
+    {
+        std::lock_guard<std::mutex> lock(blocks_mutex);
+
+        training_inputs_block.set();
+        training_targets_block.set();
+        selection_inputs_block.set();
+        selection_targets_block.set();
+    }
+}
+
+
 // void set_autoassociation(const size_t&)
 
 /// Sets a new autoasociation flag.
@@ -1546,6 +1988,8 @@ void DataSet::set_instances_number(const size_t& new_instances_number)
 
    data.set(new_instances_number, variables_number);
 
+   reset_blocks();
+
    instances.set(new_instances_number);
 }
 
@@ -1563,6 +2007,8 @@ void DataSet::set_variables_number(const size_t& new_variables_number)
 
    data.set(instances_number, new_variables_number);
 
+   reset_blocks();
+
    variables.set(new_variables_number);
 }
 
@@ -1611,6 +2057,8 @@ void DataSet::set_instance(const size_t& instance_index, const Vector<double>& i
    // Set instance
 
    data.set_row(instance_index, instance);
+
+   reset_blocks();
 }
 
 
@@ -1648,6 +2096,8 @@ void DataSet::add_instance(const Vector<double>& instance)
 
    data.append_row(instance);
 
+   reset_blocks();
+
    instances.set(instances_number+1);
 }
 
@@ -1682,6 +2132,8 @@ void DataSet::subtract_instance(const size_t& instance_index)
 
    data.subtract_row(instance_index);
 
+   reset_blocks();
+
    instances.set_instances_number(instances_number-1);
 
 }
@@ -1718,6 +2170,8 @@ void DataSet::append_variable(const Vector<double>& variable)
 
    data.append_column(variable);
 
+   reset_blocks();
+
    Matrix<double> new_data(data);
 
    const size_t new_variables_number = variables_number + 1;
@@ -1756,6 +2210,8 @@ void DataSet::subtract_variable(const size_t& variable_index)
 
    data.subtract_column(variable_index);
 
+   reset_blocks();
+
    Matrix<double> new_data(data);
 
    const size_t new_variables_number = variables_number - 1;
@@ -1792,7 +2248,7 @@ Vector<size_t> DataSet::unuse_constant_variables(void)
 
    #endif
 
-   const Vector< Statistics<double> > statistics = data.calculate_statistics();
+   const Vector< Statistics<double> > statistics = has_time_series_view() ? calculate_data_statistics() : data.calculate_statistics();
 
    Vector<size_t> constant_variables;
 
@@ -1877,29 +2333,17 @@ Vector<size_t> DataSet::unuse_repeated_instances(void)
 
 Vector< Histogram<double> > DataSet::calculate_data_histograms(const size_t& bins_number) const
 {
-   const size_t used_variables_number = variables.count_used_variables_number();
-   const Vector<size_t> used_variables_indices = variables.arrange_used_indices();
-   const size_t used_instances_number = instances.count_used_instances_number();
-   const Vector<size_t> used_instances_indices = instances.arrange_used_indices();
+   const Vector<size_t>& used_variables_indices = variables.get_used_indices();
+   const Vector<size_t>& used_instances_indices = instances.get_used_indices();
 
 //   const Vector< Vector<size_t> > missing_indices = missing_values.arrange_missing_indices();
 
-   Vector< Histogram<double> > histograms(used_variables_number);
-
-   Vector<double> column(used_instances_number);
-
-   int i = 0;
-
-   #pragma omp parallel for private(i, column) shared(histograms)
-
-   for(i = 0; i < (int)used_variables_number; i++)
+   if(has_time_series_view())
    {
-       column = data.arrange_column(used_variables_indices[i], used_instances_indices);
-
-       histograms[i] = column.calculate_histogram(bins_number);
+       return(arrange_data(used_instances_indices, used_variables_indices).calculate_histograms(bins_number));
    }
 
-   return(histograms);
+   return(data.calculate_histograms(used_instances_indices, used_variables_indices, bins_number));
 }
 
 
@@ -1930,9 +2374,9 @@ Vector< Histogram<double> > DataSet::calculate_targets_histograms(const size_t&
 
    for(size_t i = 0; i < targets_number; i++)
    {
-       column = data.arrange_column(targets_indices[i], used_instances_indices);
+       column = get_variable(targets_indices[i], used_instances_indices);
 
-       histograms[i] = column.calculate_histogram_missing_values(missing_indices[i], bins_number);
+       histograms[i] = has_time_series_view() ? column.calculate_histogram(bins_number) : column.calculate_histogram_missing_values(missing_indices[i], bins_number);
    }
 
    return(histograms);
@@ -1967,7 +2411,7 @@ Vector< Vector<double> > DataSet::calculate_box_and_whiskers(void) const
 
     for(size_t i = 0; i < variables_number; i++)
     {
-        column = data.arrange_column(variables_indices[i], instances_indices);
+        column = get_variable(variables_indices[i], instances_indices);
 
         box_and_whiskers[i] = column.calculate_box_and_whiskers();
     }
@@ -1991,6 +2435,20 @@ Vector< Statistics<double> > DataSet::calculate_data_statistics(void) const
 {
     const Vector< Vector<size_t> > missing_indices = missing_values.arrange_missing_indices();
 
+    if(has_time_series_view())
+    {
+        const size_t variables_number = variables.get_variables_number();
+
+        Vector< Statistics<double> > statistics(variables_number);
+
+        for(size_t i = 0; i < variables_number; i++)
+        {
+            statistics[i] = get_variable(i).calculate_statistics_missing_values(missing_indices[i]);
+        }
+
+        return(statistics);
+    }
+
     return(data.calculate_statistics_missing_values(missing_indices));
 }
 
@@ -2006,6 +2464,11 @@ Vector< Statistics<double> > DataSet::calculate_data_statistics(void) const
 
 Vector< Vector<double> > DataSet::calculate_data_shape_parameters(void) const
 {
+    if(has_time_series_view())
+    {
+        return(arrange_data(Vector<size_t>(0, 1, instances.get_instances_number()-1), Vector<size_t>(0, 1, variables.get_variables_number()-1)).calculate_shape_parameters());
+    }
+
     const Vector< Vector<size_t> > missing_indices = missing_values.arrange_missing_indices();
 
     return(data.calculate_shape_parameters_missing_values(missing_indices));
@@ -2027,7 +2490,7 @@ Matrix<double> DataSet::calculate_data_statistics_matrix(void) const
 
     const Vector< Vector<size_t> > used_missing_indices = missing_indices.arrange_subvector(used_variables_indices);
 
-    const Matrix<double> used_data = data.arrange_submatrix(used_instances_indices, used_variables_indices);
+    const Matrix<double> used_data = arrange_data(used_instances_indices, used_variables_indices);
 
     const Vector< Statistics<double> > data_statistics = used_data.calculate_statistics_missing_values(used_missing_indices);
 
@@ -2059,7 +2522,7 @@ Matrix<double> DataSet::calculate_data_shape_parameters_matrix(void) const
 
     const Vector< Vector<size_t> > used_missing_indices = missing_indices.arrange_subvector(used_variables_indices);
 
-    const Matrix<double> used_data = data.arrange_submatrix(used_instances_indices, used_variables_indices);
+    const Matrix<double> used_data = arrange_data(used_instances_indices, used_variables_indices);
 
     const Vector< Vector<double> > shape_parameters = used_data.calculate_shape_parameters_missing_values(used_missing_indices);
 
@@ -2093,6 +2556,11 @@ Vector< Statistics<double> > DataSet::calculate_training_instances_statistics(vo
 
    const Vector< Vector<size_t> > missing_indices = missing_values.arrange_missing_indices();
 
+   if(has_time_series_view())
+   {
+       return(arrange_data(training_indices, Vector<size_t>(0, 1, variables.get_variables_number()-1)).calculate_statistics());
+   }
+
    return(data.calculate_rows_statistics_missing_values(training_indices, missing_indices));
 }
 
@@ -2114,6 +2582,11 @@ Vector< Statistics<double> > DataSet::calculate_selection_instances_statistics(v
 
     const Vector< Vector<size_t> > missing_indices = missing_values.arrange_missing_indices();
 
+   if(has_time_series_view())
+   {
+       return(arrange_data(selection_indices, Vector<size_t>(0, 1, variables.get_variables_number()-1)).calculate_statistics());
+   }
+
    return(data.calculate_rows_statistics_missing_values(selection_indices, missing_indices));
 }
 
@@ -2135,6 +2608,11 @@ Vector< Statistics<double> > DataSet::calculate_testing_instances_statistics(voi
 
     const Vector< Vector<size_t> > missing_indices = missing_values.arrange_missing_indices();
 
+   if(has_time_series_view())
+   {
+       return(arrange_data(testing_indices, Vector<size_t>(0, 1, variables.get_variables_number()-1)).calculate_statistics());
+   }
+
    return(data.calculate_rows_statistics_missing_values(testing_indices, missing_indices));
 }
 
@@ -2154,6 +2632,11 @@ Vector< Vector<double> > DataSet::calculate_training_instances_shape_parameters(
 
    const Vector< Vector<size_t> > missing_indices = missing_values.arrange_missing_indices();
 
+   if(has_time_series_view())
+   {
+       return(arrange_data(training_indices, Vector<size_t>(0, 1, variables.get_variables_number()-1)).calculate_shape_parameters());
+   }
+
    return(data.calculate_rows_shape_parameters_missing_values(training_indices, missing_indices));
 }
 
@@ -2173,6 +2656,11 @@ Vector< Vector<double> > DataSet::calculate_selection_instances_shape_parameters
 
     const Vector< Vector<size_t> > missing_indices = missing_values.arrange_missing_indices();
 
+   if(has_time_series_view())
+   {
+       return(arrange_data(selection_indices, Vector<size_t>(0, 1, variables.get_variables_number()-1)).calculate_shape_parameters());
+   }
+
    return(data.calculate_rows_shape_parameters_missing_values(selection_indices, missing_indices));
 }
 
@@ -2192,6 +2680,11 @@ Vector< Vector<double> > DataSet::calculate_testing_instances_shape_parameters(v
 
     const Vector< Vector<size_t> > missing_indices = missing_values.arrange_missing_indices();
 
+   if(has_time_series_view())
+   {
+       return(arrange_data(testing_indices, Vector<size_t>(0, 1, variables.get_variables_number()-1)).calculate_shape_parameters());
+   }
+
    return(data.calculate_rows_shape_parameters_missing_values(testing_indices, missing_indices));
 }
 
@@ -2214,6 +2707,20 @@ Vector< Statistics<double> > DataSet::calculate_inputs_statistics(void) const
 
     const Vector< Vector<size_t> > missing_indices = missing_values.arrange_missing_indices();
 
+   if(has_time_series_view())
+   {
+       const size_t size = inputs_indices.size();
+
+       Vector< Statistics<double> > statistics(size);
+
+       for(size_t i = 0; i < size; i++)
+       {
+           statistics[i] = get_variable(inputs_indices[i]).calculate_statistics();
+       }
+
+       return(statistics);
+   }
+
    return(data.calculate_columns_statistics_missing_values(inputs_indices, missing_indices));
 }
 
@@ -2235,6 +2742,20 @@ Vector< Statistics<double> > DataSet::calculate_targets_statistics(void) const
 
    const Vector< Vector<size_t> > missing_indices = missing_values.arrange_missing_indices();
 
+   if(has_time_series_view())
+   {
+       const size_t size = targets_indices.size();
+
+       Vector< Statistics<double> > statistics(size);
+
+       for(size_t i = 0; i < size; i++)
+       {
+           statistics[i] = get_variable(targets_indices[i]).calculate_statistics();
+       }
+
+       return(statistics);
+   }
+
    return(data.calculate_columns_statistics_missing_values(targets_indices, missing_indices));
 }
 
@@ -2251,6 +2772,11 @@ Vector<double> DataSet::calculate_training_target_data_mean(void) const
 
    const Vector< Vector<size_t> > missing_indices = missing_values.arrange_missing_indices();
 
+   if(has_time_series_view())
+   {
+       return(arrange_data(training_indices, targets_indices).calculate_mean());
+   }
+
    return(data.calculate_mean_missing_values(training_indices, targets_indices, missing_indices));
 }
 
@@ -2267,6 +2793,11 @@ Vector<double> DataSet::calculate_selection_target_data_mean(void) const
 
    const Vector< Vector<size_t> > missing_indices = missing_values.arrange_missing_indices();
 
+   if(has_time_series_view())
+   {
+       return(arrange_data(selection_indices, targets_indices).calculate_mean());
+   }
+
    return(data.calculate_mean_missing_values(selection_indices, targets_indices, missing_indices));
 }
 
@@ -2283,6 +2814,11 @@ Vector<double> DataSet::calculate_testing_target_data_mean(void) const
 
    const Vector< Vector<size_t> > missing_indices = missing_values.arrange_missing_indices();
 
+   if(has_time_series_view())
+   {
+       return(arrange_data(testing_indices, targets_indices).calculate_mean());
+   }
+
    return(data.calculate_mean_missing_values(testing_indices, targets_indices, missing_indices));
 }
 
@@ -2317,13 +2853,13 @@ Matrix<double> DataSet::calculate_linear_correlations(void) const
    {
        input_index = input_indices[i];
 
-       input_variable = data.arrange_column(input_index);
+       input_variable = get_variable(input_index);
 
        for(size_t j = 0; j < targets_number; j++)
        {
            target_index = target_indices[j];
 
-           target_variable = data.arrange_column(target_index);
+           target_variable = get_variable(target_index);
 
 //           linear_correlations(i,j) = input_variable.calculate_linear_correlation_missing_values(target_variable, missing_indices[target_index]);
            linear_correlations(i,j) = input_variable.calculate_linear_correlation(target_variable);
@@ -2349,7 +2885,7 @@ void DataSet::scale_data_mean_standard_deviation(const Vector< Statistics<double
 
    std::ostringstream buffer;
 
-   const size_t columns_number = data.get_columns_number();
+   const size_t columns_number = variables.get_variables_number();
 
    const size_t statistics_size = data_statistics.size();
 
@@ -2377,7 +2913,16 @@ void DataSet::scale_data_mean_standard_deviation(const Vector< Statistics<double
         }
     }
 
-   data.scale_mean_standard_deviation(data_statistics);
+   if(has_time_series_view())
+   {
+       scale_time_series_variables_mean_standard_deviation(data_statistics, Vector<size_t>(0, 1, variables.get_variables_number()-1));
+   }
+   else
+   {
+       data.scale_mean_standard_deviation(data_statistics);
+   }
+
+   reset_blocks();
 }
 
 
@@ -2455,7 +3000,16 @@ void DataSet::scale_data_minimum_maximum(const Vector< Statistics<double> >& dat
     }
 
 
-   data.scale_minimum_maximum(data_statistics);
+   if(has_time_series_view())
+   {
+       scale_time_series_variables_minimum_maximum(data_statistics, Vector<size_t>(0, 1, variables.get_variables_number()-1));
+   }
+   else
+   {
+       data.scale_minimum_maximum(data_statistics);
+   }
+
+   reset_blocks();
 }
 
 
@@ -2506,7 +3060,7 @@ void DataSet::scale_data(const std::string& scaling_unscaling_method_string, con
 
 Vector< Statistics<double> > DataSet::scale_data(const std::string& scaling_unscaling_method)
 {
-   const Vector< Statistics<double> > statistics = data.calculate_statistics();
+   const Vector< Statistics<double> > statistics = has_time_series_view() ? calculate_data_statistics() : data.calculate_statistics();
 
    switch(get_scaling_unscaling_method(scaling_unscaling_method))
    {
@@ -2550,7 +3104,16 @@ void DataSet::scale_inputs_mean_standard_deviation(const Vector< Statistics<doub
 {
     const Vector<size_t> inputs_indices = variables.arrange_inputs_indices();
 
-    data.scale_columns_mean_standard_deviation(inputs_statistics, inputs_indices);
+    if(has_time_series_view())
+    {
+        scale_time_series_variables_mean_standard_deviation(inputs_statistics, inputs_indices);
+    }
+    else
+    {
+        data.scale_columns_mean_standard_deviation(inputs_statistics, inputs_indices);
+    }
+
+    reset_blocks();
 }
 
 
@@ -2566,7 +3129,7 @@ Vector< Statistics<double> > DataSet::scale_inputs_mean_standard_deviation(void)
 
     #ifdef __OPENNN_DEBUG__
 
-    if(data.empty())
+    if(empty())
     {
        std::ostringstream buffer;
 
@@ -2598,7 +3161,16 @@ void DataSet::scale_inputs_minimum_maximum(const Vector< Statistics<double> >& i
 {
     const Vector<size_t> inputs_indices = variables.arrange_inputs_indices();
 
-    data.scale_columns_minimum_maximum(inputs_statistics, inputs_indices);
+    if(has_time_series_view())
+    {
+        scale_time_series_variables_minimum_maximum(inputs_statistics, inputs_indices);
+    }
+    else
+    {
+        data.scale_columns_minimum_maximum(inputs_statistics, inputs_indices);
+    }
+
+    reset_blocks();
 }
 
 
@@ -2614,7 +3186,7 @@ Vector< Statistics<double> > DataSet::scale_inputs_minimum_maximum(void)
 
     #ifdef __OPENNN_DEBUG__
 
-    if(data.empty())
+    if(empty())
     {
        std::ostringstream buffer;
 
@@ -2721,7 +3293,16 @@ void DataSet::scale_targets_mean_standard_deviation(const Vector< Statistics<dou
 {
     const Vector<size_t> targets_indices = variables.arrange_targets_indices();
 
-    data.scale_columns_mean_standard_deviation(targets_statistics, targets_indices);
+    if(has_time_series_view())
+    {
+        scale_time_series_variables_mean_standard_deviation(targets_statistics, targets_indices);
+    }
+    else
+    {
+        data.scale_columns_mean_standard_deviation(targets_statistics, targets_indices);
+    }
+
+    reset_blocks();
 }
 
 
@@ -2737,7 +3318,7 @@ Vector< Statistics<double> > DataSet::scale_targets_mean_standard_deviation(void
 
     #ifdef __OPENNN_DEBUG__
 
-    if(data.empty())
+    if(empty())
     {
        std::ostringstream buffer;
 
@@ -2771,7 +3352,7 @@ void DataSet::scale_targets_minimum_maximum(const Vector< Statistics<double> >&
 
     #ifdef __OPENNN_DEBUG__
 
-    if(data.empty())
+    if(empty())
     {
        std::ostringstream buffer;
 
@@ -2786,7 +3367,16 @@ void DataSet::scale_targets_minimum_maximum(const Vector< Statistics<double> >&
 
     const Vector<size_t> targets_indices = variables.arrange_targets_indices();
 
-    data.scale_columns_minimum_maximum(targets_statistics, targets_indices);
+    if(has_time_series_view())
+    {
+        scale_time_series_variables_minimum_maximum(targets_statistics, targets_indices);
+    }
+    else
+    {
+        data.scale_columns_minimum_maximum(targets_statistics, targets_indices);
+    }
+
+    reset_blocks();
 }
 
 
@@ -2889,7 +3479,16 @@ void DataSet::scale_targets(const std::string& scaling_unscaling_method, const V
 
 void DataSet::unscale_data_mean_standard_deviation(const Vector< Statistics<double> >& data_statistics)
 {
-   data.unscale_mean_standard_deviation(data_statistics);
+   if(has_time_series_view())
+   {
+       unscale_time_series_variables_mean_standard_deviation(data_statistics, Vector<size_t>(0, 1, variables.get_variables_number()-1));
+   }
+   else
+   {
+       data.unscale_mean_standard_deviation(data_statistics);
+   }
+
+   reset_blocks();
 }
 
 
@@ -2902,7 +3501,16 @@ void DataSet::unscale_data_mean_standard_deviation(const Vector< Statistics<doub
 
 void DataSet::unscale_data_minimum_maximum(const Vector< Statistics<double> >& data_statistics)
 {
-   data.unscale_minimum_maximum(data_statistics);
+   if(has_time_series_view())
+   {
+       unscale_time_series_variables_minimum_maximum(data_statistics, Vector<size_t>(0, 1, variables.get_variables_number()-1));
+   }
+   else
+   {
+       data.unscale_minimum_maximum(data_statistics);
+   }
+
+   reset_blocks();
 }
 
 
@@ -2917,7 +3525,16 @@ void DataSet::unscale_inputs_mean_standard_deviation(const Vector< Statistics<do
 {
     const Vector<size_t> inputs_indices = variables.arrange_inputs_indices();
 
-    data.unscale_columns_mean_standard_deviation(data_statistics, inputs_indices);
+    if(has_time_series_view())
+    {
+        unscale_time_series_variables_mean_standard_deviation(data_statistics, inputs_indices);
+    }
+    else
+    {
+        data.unscale_columns_mean_standard_deviation(data_statistics, inputs_indices);
+    }
+
+    reset_blocks();
 }
 
 
@@ -2932,7 +3549,16 @@ void DataSet::unscale_inputs_minimum_maximum(const Vector< Statistics<double> >&
 {
     const Vector<size_t> inputs_indices = variables.arrange_inputs_indices();
 
-    data.unscale_columns_minimum_maximum(data_statistics, inputs_indices);
+    if(has_time_series_view())
+    {
+        unscale_time_series_variables_minimum_maximum(data_statistics, inputs_indices);
+    }
+    else
+    {
+        data.unscale_columns_minimum_maximum(data_statistics, inputs_indices);
+    }
+
+    reset_blocks();
 }
 
 
@@ -2947,7 +3573,16 @@ void DataSet::unscale_targets_mean_standard_deviation(const Vector< Statistics<d
 {
     const Vector<size_t> targets_indices = variables.arrange_targets_indices();
 
-    data.unscale_columns_mean_standard_deviation(data_statistics, targets_indices);
+    if(has_time_series_view())
+    {
+        unscale_time_series_variables_mean_standard_deviation(data_statistics, targets_indices);
+    }
+    else
+    {
+        data.unscale_columns_mean_standard_deviation(data_statistics, targets_indices);
+    }
+
+    reset_blocks();
 }
 
 
@@ -2962,7 +3597,16 @@ void DataSet::unscale_targets_minimum_maximum(const Vector< Statistics<double> >
 {
     const Vector<size_t> targets_indices = variables.arrange_targets_indices();
 
-    data.unscale_columns_minimum_maximum(data_statistics, targets_indices);
+    if(has_time_series_view())
+    {
+        unscale_time_series_variables_minimum_maximum(data_statistics, targets_indices);
+    }
+    else
+    {
+        data.unscale_columns_minimum_maximum(data_statistics, targets_indices);
+    }
+
+    reset_blocks();
 }
 
 
@@ -2973,7 +3617,19 @@ void DataSet::unscale_targets_minimum_maximum(const Vector< Statistics<double> >
 
 void DataSet::initialize_data(const double& new_value)
 {
-   data.initialize(new_value);
+   if(has_time_series_view())
+   {
+       time_series_data.initialize(new_value);
+
+       time_series_slopes.initialize(1.0);
+       time_series_intercepts.initialize(0.0);
+   }
+   else
+   {
+       data.initialize(new_value);
+   }
+
+   reset_blocks();
 }
 
 
@@ -2984,7 +3640,19 @@ void DataSet::initialize_data(const double& new_value)
 
 void DataSet::randomize_data_uniform(const double& minimum, const double& maximum)
 {
-   data.randomize_uniform(minimum, maximum);
+   if(has_time_series_view())
+   {
+       time_series_data.randomize_uniform(minimum, maximum);
+
+       time_series_slopes.initialize(1.0);
+       time_series_intercepts.initialize(0.0);
+   }
+   else
+   {
+       data.randomize_uniform(minimum, maximum);
+   }
+
+   reset_blocks();
 }
 
 
@@ -2995,7 +3663,19 @@ void DataSet::randomize_data_uniform(const double& minimum, const double& maximu
 
 void DataSet::randomize_data_normal(const double& mean, const double& standard_deviation)
 {
-   data.randomize_normal(mean, standard_deviation);
+   if(has_time_series_view())
+   {
+       time_series_data.randomize_normal(mean, standard_deviation);
+
+       time_series_slopes.initialize(1.0);
+       time_series_intercepts.initialize(0.0);
+   }
+   else
+   {
+       data.randomize_normal(mean, standard_deviation);
+   }
+
+   reset_blocks();
 }
 
 
@@ -3099,6 +3779,18 @@ tinyxml2::XMLDocument* DataSet::to_XML(void) const
        element->LinkEndChild(text);
    }
 
+   // Time series view
+   {
+       element = document->NewElement("TimeSeriesView");
+       data_file_element->LinkEndChild(element);
+
+       buffer.str("");
+       buffer << time_series_view;
+
+       text = document->NewText(buffer.str().c_str());
+       element->LinkEndChild(text);
+   }
+
    // Header line
    {
       element = document->NewElement("ColumnsName");
@@ -3289,11 +3981,23 @@ void DataSet::from_XML(const tinyxml2::XMLDocument& data_set_document)
             throw std::logic_error(buffer.str());
         }
 
-        if(steps_ahead_element->GetText())
+        if(steps_ahead_element->GetText())
+        {
+             const size_t new_steps_ahead = atoi(steps_ahead_element->GetText());
+
+             set_steps_ahead_number(new_steps_ahead);
+        }
+    }
+
+    // Time series view
+    {
+        const tinyxml2::XMLElement* time_series_view_element = data_file_element->FirstChildElement("TimeSeriesView");
+
+        if(time_series_view_element && time_series_view_element->GetText())
         {
-             const size_t new_steps_ahead = atoi(steps_ahead_element->GetText());
+             const std::string new_time_series_view = time_series_view_element->GetText();
 
-             set_steps_ahead_number(new_steps_ahead);
+             set_time_series_view(new_time_series_view != "0");
         }
     }
 
@@ -3671,7 +4375,7 @@ void DataSet::print_data_preview(void) const
 
        if(instances_number > 0)
        {
-          const Vector<double> first_instance = data.arrange_row(0);
+          const Vector<double> first_instance = get_instance(0);
 
           std::cout << "First instance:\n"
                     << first_instance << std::endl;
@@ -3679,7 +4383,7 @@ void DataSet::print_data_preview(void) const
 
        if(instances_number > 1)
        {
-          const Vector<double> second_instance = data.arrange_row(1);
+          const Vector<double> second_instance = get_instance(1);
 
           std::cout << "Second instance:\n"
                     << second_instance << std::endl;
@@ -3687,7 +4391,7 @@ void DataSet::print_data_preview(void) const
 
        if(instances_number > 2)
        {
-          const Vector<double> last_instance = data.arrange_row(instances_number-1);
+          const Vector<double> last_instance = get_instance(instances_number-1);
 
           std::cout << "Instance " << instances_number << ":\n"
                     << last_instance << std::endl;
@@ -4235,6 +4939,8 @@ Vector< Vector<std::string> > DataSet::set_from_data_file(void)
 
     data.set(instances_count, variables_count);
 
+    reset_blocks();
+
     if(variables.get_variables_number() != variables_count)
     {
         variables.set(variables_count);
@@ -4324,6 +5030,322 @@ void DataSet::read_from_data_file(const Vector< Vector<std::string> >& nominal_l
 }
 
 
+// void update_blocks(void) const method
+
+/// Builds the packed blocks of the training and selection instances if they are out of date,
+/// that is, if the data changed or the instances or variables moved to a new generation since they were built.
+/// Each column of a block holds one instance, so that reading the instances in order streams through memory.
+
+void DataSet::update_blocks(void) const
+{
+   if(blocks_updated
+   && blocks_instances_generation == instances.get_generation()
+   && blocks_variables_generation == variables.get_generation())
+   {
+      return;
+   }
+
+   std::lock_guard<std::mutex> lock(blocks_mutex);
+
+   if(blocks_updated
+   && blocks_instances_generation == instances.get_generation()
+   && blocks_variables_generation == variables.get_generation())
+   {
+      return;
+   }
+
+   OPENNN_SCOPED_TIMER("data_set.update_blocks");
+
+   const Vector<size_t>& training_indices = instances.get_training_indices();
+   const Vector<size_t>& selection_indices = instances.get_selection_indices();
+
+   const Vector<size_t>& inputs_indices = variables.get_inputs_indices();
+   const Vector<size_t>& targets_indices = variables.get_targets_indices();
+
+   const size_t training_instances_number = training_indices.size();
+   const size_t selection_instances_number = selection_indices.size();
+
+   const size_t inputs_number = inputs_indices.size();
+   const size_t targets_number = targets_indices.size();
+
+   training_inputs_block.set(inputs_number, training_instances_number);
+   training_targets_block.set(targets_number, training_instances_number);
+
+   for(size_t i = 0; i < training_instances_number; i++)
+   {
+      for(size_t j = 0; j < inputs_number; j++)
+      {
+         training_inputs_block(j,i) = get_value(training_indices[i], inputs_indices[j]);
+      }
+
+      for(size_t j = 0; j < targets_number; j++)
+      {
+         training_targets_block(j,i) = get_value(training_indices[i], targets_indices[j]);
+      }
+   }
+
+   selection_inputs_block.set(inputs_number, selection_instances_number);
+   selection_targets_block.set(targets_number, selection_instances_number);
+
+   for(size_t i = 0; i < selection_instances_number; i++)
+   {
+      for(size_t j = 0; j < inputs_number; j++)
+      {
+         selection_inputs_block(j,i) = get_value(selection_indices[i], inputs_indices[j]);
+      }
+
+      for(size_t j = 0; j < targets_number; j++)
+      {
+         selection_targets_block(j,i) = get_value(selection_indices[i], targets_indices[j]);
+      }
+   }
+
+   blocks_instances_generation = instances.get_generation();
+   blocks_variables_generation = variables.get_generation();
+
+   blocks_updated = true;
+}
+
+
+// void update_float_blocks(void) const method
+
+/// Builds the single precision blocks of the training instances if they are out of date.
+/// Each value is converted from the data matrix or the time series as it is read,
+/// so that no double precision copy of the training data is made.
+
+void DataSet::update_float_blocks(void) const
+{
+   if(float_blocks_updated
+   && float_blocks_instances_generation == instances.get_generation()
+   && float_blocks_variables_generation == variables.get_generation())
+   {
+      return;
+   }
+
+   std::lock_guard<std::mutex> lock(blocks_mutex);
+
+   if(float_blocks_updated
+   && float_blocks_instances_generation == instances.get_generation()
+   && float_blocks_variables_generation == variables.get_generation())
+   {
+      return;
+   }
+
+   OPENNN_SCOPED_TIMER("data_set.update_float_blocks");
+
+   const Vector<size_t>& training_indices = instances.get_training_indices();
+
+   const Vector<size_t>& inputs_indices = variables.get_inputs_indices();
+   const Vector<size_t>& targets_indices = variables.get_targets_indices();
+
+   const size_t training_instances_number = training_indices.size();
+
+   const size_t inputs_number = inputs_indices.size();
+   const size_t targets_number = targets_indices.size();
+
+   training_float_inputs_block.set(training_instances_number, inputs_number);
+   training_float_targets_block.set(training_instances_number, targets_number);
+
+   for(size_t j = 0; j < inputs_number; j++)
+   {
+      for(size_t i = 0; i < training_instances_number; i++)
+      {
+         training_float_inputs_block(i,j) = (float)get_value(training_indices[i], inputs_indices[j]);
+      }
+   }
+
+   for(size_t j = 0; j < targets_number; j++)
+   {
+      for(size_t i = 0; i < training_instances_number; i++)
+      {
+         training_float_targets_block(i,j) = (float)get_value(training_indices[i], targets_indices[j]);
+      }
+   }
+
+   float_blocks_instances_generation = instances.get_generation();
+   float_blocks_variables_generation = variables.get_generation();
+
+   float_blocks_updated = true;
+}
+
+
+// void reset_blocks(void) method
+
+/// Marks the packed blocks as out of date.
+/// It must be called by every method which modifies the data matrix.
+
+void DataSet::reset_blocks(void)
+{
+   std::lock_guard<std::mutex> lock(blocks_mutex);
+
+   blocks_updated = false;
+
+   float_blocks_updated = false;
+}
+
+
+// void check_time_series_view(const std::string&) const method
+
+/// Throws an exception if the data set has a time series view.
+/// It is called by the methods which modify single variables of the data matrix,
+/// because each column of the series is shared by the lagged variables of all the lags.
+/// @param method Signature of the calling method, for the exception message.
+
+void DataSet::check_time_series_view(const std::string& method) const
+{
+   if(has_time_series_view())
+   {
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: DataSet class.\n"
+             << method << " method.\n"
+             << "This operation is not supported on a time series view.\n"
+             << "Apply it before calling convert_time_series, or disable the time series view.\n";
+
+      throw std::logic_error(buffer.str());
+   }
+}
+
+
+// void scale_time_series_variables_mean_standard_deviation(const Vector< Statistics<double> >&, const Vector<size_t>&) method
+
+/// Scales some lagged variables of a time series view with the mean and standard deviation method.
+/// The series, which is shared by all the lags, is not modified. 
+/// Instead, the scaling is composed with the slopes and intercepts of the variables, which are applied when the values are read.
+/// Therefore, each lagged variable is scaled with its own statistics, computed over the rows of the series that it reads.
+/// @param statistics Vector of statistics structures for the variables to be scaled.
+/// @param variables_indices Indices of the variables to be scaled.
+
+void DataSet::scale_time_series_variables_mean_standard_deviation(const Vector< Statistics<double> >& statistics, const Vector<size_t>& variables_indices)
+{
+   size_t variable_index;
+
+   for(size_t j = 0; j < variables_indices.size(); j++)
+   {
+      if(statistics[j].standard_deviation < 1e-99)
+      {
+         // Do nothing
+      }
+      else
+      {
+         variable_index = variables_indices[j];
+
+         time_series_slopes[variable_index] = time_series_slopes[variable_index]/statistics[j].standard_deviation;
+         time_series_intercepts[variable_index] = (time_series_intercepts[variable_index] - statistics[j].mean)/statistics[j].standard_deviation;
+      }
+   }
+}
+
+
+// void scale_time_series_variables_minimum_maximum(const Vector< Statistics<double> >&, const Vector<size_t>&) method
+
+/// Scales some lagged variables of a time series view with the minimum and maximum method.
+/// The scaling is composed with the slopes and intercepts of the variables, and the series is not modified.
+/// @param statistics Vector of statistics structures for the variables to be scaled.
+/// @param variables_indices Indices of the variables to be scaled.
+
+void DataSet::scale_time_series_variables_minimum_maximum(const Vector< Statistics<double> >& statistics, const Vector<size_t>& variables_indices)
+{
+   size_t variable_index;
+
+   double range;
+
+   for(size_t j = 0; j < variables_indices.size(); j++)
+   {
+      range = statistics[j].maximum - statistics[j].minimum;
+
+      if(range < 1e-99)
+      {
+         // Do nothing
+      }
+      else
+      {
+         variable_index = variables_indices[j];
+
+         time_series_slopes[variable_index] = 2.0*time_series_slopes[variable_index]/range;
+         time_series_intercepts[variable_index] = 2.0*(time_series_intercepts[variable_index] - statistics[j].minimum)/range - 1.0;
+      }
+   }
+}
+
+
+// void unscale_time_series_variables_mean_standard_deviation(const Vector< Statistics<double> >&, const Vector<size_t>&) method
+
+/// Unscales some lagged variables of a time series view with the mean and standard deviation method.
+/// The unscaling is composed with the slopes and intercepts of the variables, and the series is not modified.
+/// @param statistics Vector of statistics structures for all the variables in the data set.
+/// @param variables_indices Indices of the variables to be unscaled.
+
+void DataSet::unscale_time_series_variables_mean_standard_deviation(const Vector< Statistics<double> >& statistics, const Vector<size_t>& variables_indices)
+{
+   size_t variable_index;
+
+   for(size_t j = 0; j < variables_indices.size(); j++)
+   {
+      variable_index = variables_indices[j];
+
+      if(statistics[variable_index].standard_deviation < 1e-99)
+      {
+         // Do nothing
+      }
+      else
+      {
+         time_series_slopes[variable_index] = time_series_slopes[variable_index]*statistics[variable_index].standard_deviation;
+         time_series_intercepts[variable_index] = time_series_intercepts[variable_index]*statistics[variable_index].standard_deviation + statistics[variable_index].mean;
+      }
+   }
+}
+
+
+// void unscale_time_series_variables_minimum_maximum(const Vector< Statistics<double> >&, const Vector<size_t>&) method
+
+/// Unscales some lagged variables of a time series view with the minimum and maximum method.
+/// The unscaling is composed with the slopes and intercepts of the variables, and the series is not modified.
+/// @param statistics Vector of statistics structures for all the variables in the data set.
+/// @param variables_indices Indices of the variables to be unscaled.
+
+void DataSet::unscale_time_series_variables_minimum_maximum(const Vector< Statistics<double> >& statistics, const Vector<size_t>& variables_indices)
+{
+   size_t variable_index;
+
+   double range;
+
+   for(size_t j = 0; j < variables_indices.size(); j++)
+   {
+      variable_index = variables_indices[j];
+
+      range = statistics[variable_index].maximum - statistics[variable_index].minimum;
+
+      if(range < 1e-99)
+      {
+         // Do nothing
+      }
+      else
+      {
+         time_series_slopes[variable_index] = 0.5*time_series_slopes[variable_index]*range;
+         time_series_intercepts[variable_index] = 0.5*(time_series_intercepts[variable_index] + 1.0)*range + statistics[variable_index].minimum;
+      }
+   }
+}
+
+
+// static void copy_block_instance(const Matrix<double>&, const size_t&, Vector<double>&) method
+
+/// Copies a column of a packed block into a vector, reusing the storage of the vector when it has the right size.
+/// @param block Packed block, with one column for each instance.
+/// @param i Index of the column.
+/// @param instance Vector to be filled with the values of the column.
+
+void DataSet::copy_block_instance(const Matrix<double>& block, const size_t& i, Vector<double>& instance)
+{
+   const size_t rows_number = block.get_rows_number();
+
+   const double* column = block.data() + i*rows_number;
+
+   instance.assign(column, column + rows_number);
+}
+
+
 // Vector<std::string> arrange_time_series_prediction_names(const Vector<std::string>&) const method
 
 /// Returns a vector with the names arranged for time series prediction, according to the number of lags.
@@ -4371,6 +5393,10 @@ Vector<std::string> DataSet::arrange_autoassociation_names(const Vector<std::str
 // void convert_time_series(void) method
 
 /// Arranges an input-target matrix from a time series matrix, according to the number of lags.
+/// In time series view mode, the original series is kept and no lagged matrix is built.
+/// In both modes, each missing value of the series is mapped to all the lagged instances which read it.
+/// The scaling and unscaling methods do not modify the series of a view, 
+/// but the slopes and intercepts of the lagged variables, which are applied when the values are read.
 /// @todo
 
 void DataSet::convert_time_series(void)
@@ -4380,7 +5406,21 @@ void DataSet::convert_time_series(void)
         return;
     }
 
-    data.convert_time_series(lags_number);
+    if(time_series_view)
+    {
+        time_series_data = data;
+
+        data.set();
+
+        time_series_slopes.set(time_series_data.get_columns_number()*(1 + lags_number), 1.0);
+        time_series_intercepts.set(time_series_data.get_columns_number()*(1 + lags_number), 0.0);
+    }
+    else
+    {
+        data.convert_time_series(lags_number);
+    }
+
+    reset_blocks();
 
     variables.convert_time_series(lags_number);
 
@@ -4397,7 +5437,17 @@ void DataSet::convert_time_series(void)
 
 void DataSet::convert_autoassociation(void)
 {
-    data.convert_autoassociation();
+    if(has_time_series_view())
+    {
+        time_series_slopes = time_series_slopes.assemble(time_series_slopes);
+        time_series_intercepts = time_series_intercepts.assemble(time_series_intercepts);
+    }
+    else
+    {
+        data.convert_autoassociation();
+    }
+
+    reset_blocks();
 
     variables.convert_autoassociation();
 
@@ -4519,6 +5569,8 @@ void DataSet::load_data_binary(void)
 
     data.set(instances_number, variables_number);
 
+    reset_blocks();
+
     for(size_t i = 0; i < variables_number*instances_number; i++)
     {
         file.read(reinterpret_cast<char*>(&value), size);
@@ -4612,6 +5664,8 @@ void DataSet::load_time_series_data_binary(void)
 
     data.set(instances_number, variables_number);
 
+    reset_blocks();
+
     for(size_t i = 0; i < variables_number*instances_number; i++)
     {
         file.read(reinterpret_cast<char*>(&value), size);
@@ -4741,7 +5795,7 @@ Vector<size_t> DataSet::calculate_target_distribution(void) const
 
           if(instances.get_use(instance_index) != Instances::Unused)
           {
-             if(data(instance_index,target_index) < 0.5)
+             if(get_value(instance_index, target_index) < 0.5)
              {
                 class_distribution[0]++;
              }
@@ -4762,12 +5816,12 @@ Vector<size_t> DataSet::calculate_target_distribution(void) const
           {
              for(size_t j = 0; j < targets_number; j++)
              {
-                 if(data(i,targets_indices[j]) == -123.456)
+                 if(get_value(i, targets_indices[j]) == -123.456)
                  {
                     continue;
                  }
 
-                if(data(i,targets_indices[j]) > 0.5)
+                if(get_value(i, targets_indices[j]) > 0.5)
                 {
                    class_distribution[j]++;
                 }
@@ -4820,7 +5874,7 @@ Vector<double> DataSet::calculate_distances(void) const
 
     for(i = 0; i < (int)instances_number; i++)
     {
-        instance = data.arrange_row(i);
+        instance = get_instance(i);
 
         distances[i] = (instance-means/standard_deviations).calculate_norm();
     }
@@ -5171,6 +6225,8 @@ Vector<size_t> DataSet::balance_function_regression_targets_distribution(const d
 
 Matrix<double> DataSet::calculate_instances_distances(const size_t& nearest_neighbors_number) const
 {
+    check_time_series_view("Matrix<double> calculate_instances_distances(const size_t&) const");
+
     const size_t instances_number = instances.count_used_instances_number();
     const Vector<size_t> instances_indices = instances.arrange_used_indices();
 
@@ -5459,12 +6515,9 @@ Matrix<double> DataSet::calculate_autocorrelation(const size_t& maximum_lags_num
 
     Matrix<double> autocorrelation(variables_number, maximum_lags_number);
 
-    for(size_t i = 0; i < maximum_lags_number; i++)
+    for(size_t j = 0; j < variables_number; j++)
     {
-        for(size_t j = 0; j < variables_number; j++)
-        {
-            autocorrelation.set_row(j, time_series_data.arrange_column(j).calculate_autocorrelation(maximum_lags_number));
-        }
+        autocorrelation.set_row(j, time_series_data.arrange_column(j).calculate_autocorrelation(maximum_lags_number));
     }
 
     return autocorrelation;
@@ -5474,22 +6527,64 @@ Matrix<double> DataSet::calculate_autocorrelation(const size_t& maximum_lags_num
 // Matrix< Vector<double> > calculate_cross_correlation(void)
 
 /// Calculates the cross-correlation between all the variables in the data set.
+/// The spectrum of each variable is computed only once and reused for all the pairs in which it takes part,
+/// so that every pair costs a single inverse Fourier transform.
 
 Matrix< Vector<double> > DataSet::calculate_cross_correlation(void) const
 {
     const size_t variables_number = variables.count_used_variables_number()/(lags_number + steps_ahead);
 
-    Matrix< Vector<double> > cross_correlation(variables_number, variables_number);
+    const size_t maximum_lags_number = 10;
+
+    const size_t instances_number = time_series_data.get_rows_number();
+
+    const size_t transform_size = calculate_correlation_transform_size(instances_number);
+
+    Vector< Vector< std::complex<double> > > spectra(variables_number);
+    Vector<double> squared_deviations(variables_number);
 
-    Vector<double> actual_column;
+    Vector<double> column;
+    double mean;
 
     for(size_t i = 0; i < variables_number; i++)
     {
-        actual_column = time_series_data.arrange_column(i);
+        column = time_series_data.arrange_column(i);
+
+        spectra[i] = column.calculate_centered_spectrum(transform_size);
+
+        mean = column.calculate_mean();
+
+        squared_deviations[i] = 0.0;
+
+        for(size_t k = 0; k < instances_number; k++)
+        {
+            squared_deviations[i] += (column[k] - mean)*(column[k] - mean);
+        }
+    }
+
+    Matrix< Vector<double> > cross_correlation(variables_number, variables_number);
+
+    double denominator;
 
+    for(size_t i = 0; i < variables_number; i++)
+    {
         for(size_t j = 0; j < variables_number; j++)
         {
-            cross_correlation(i , j) = actual_column.calculate_cross_correlation(time_series_data.arrange_column(j));
+            cross_correlation(i,j) = calculate_spectral_correlation(spectra[i], spectra[j], maximum_lags_number);
+
+            denominator = sqrt(squared_deviations[i]*squared_deviations[j]);
+
+            for(size_t k = 0; k < maximum_lags_number; k++)
+            {
+                if(denominator == 0.0 || k >= instances_number)
+                {
+                    cross_correlation(i,j)[k] = 0.0;
+                }
+                else
+                {
+                    cross_correlation(i,j)[k] /= denominator;
+                }
+            }
         }
     }
 
@@ -5535,6 +6630,8 @@ void DataSet::generate_artificial_data(const size_t& instances_number, const siz
     set(input_data.assemble_columns(target_data));
 
     data.scale_minimum_maximum();
+
+    reset_blocks();
 }
 
 
@@ -5611,7 +6708,7 @@ Vector<size_t> DataSet::filter_data(const Vector<double>& minimums, const Vector
                 continue;
             }
 
-            if(data(i,j) < minimums[j] || data(i,j) > maximums[j])
+            if(get_value(i, j) < minimums[j] || get_value(i, j) > maximums[j])
             {
                 if(instances.is_used(i))
                 {
@@ -5636,6 +6733,8 @@ Vector<size_t> DataSet::filter_data(const Vector<double>& minimums, const Vector
 
 void DataSet::convert_angular_variable_degrees(const size_t& variable_index)
 {
+    check_time_series_view("void convert_angular_variable_degrees(const size_t&)");
+
     // Control sentence (if debug)
 
     #ifdef __OPENNN_DEBUG__
@@ -5670,6 +6769,8 @@ void DataSet::convert_angular_variable_degrees(const size_t& variable_index)
 
     data.convert_angular_variables_degrees(variable_index);
 
+    reset_blocks();
+
 }
 
 
@@ -5682,6 +6783,8 @@ void DataSet::convert_angular_variable_degrees(const size_t& variable_index)
 
 void DataSet::convert_angular_variable_radians(const size_t& variable_index)
 {
+    check_time_series_view("void convert_angular_variable_radians(const size_t&)");
+
     // Control sentence (if debug)
 
     #ifdef __OPENNN_DEBUG__
@@ -5716,6 +6819,8 @@ void DataSet::convert_angular_variable_radians(const size_t& variable_index)
 
     data.convert_angular_variables_radians(variable_index);
 
+    reset_blocks();
+
 }
 
 
@@ -5874,6 +6979,13 @@ void DataSet::scrub_missing_values_unuse(void)
 
 void DataSet::scrub_missing_values_mean(void)
 {
+    if(has_time_series_view())
+    {
+        scrub_time_series_missing_values_mean();
+
+        return;
+    }
+
     const Vector< Vector<size_t> > missing_indices = missing_values.arrange_missing_indices();
 
     const Vector<double> means = data.calculate_mean_missing_values(missing_indices);
@@ -5901,6 +7013,72 @@ void DataSet::scrub_missing_values_mean(void)
             }
         }
     }
+
+    reset_blocks();
+}
+
+
+// void scrub_time_series_missing_values_mean(void) method
+
+/// Substitutes the missing values of a time series view by the mean of the corresponding column of the series.
+/// Each missing value of the series is read by several lagged variables,
+/// so it is substituted once in the series, with the mean of its column over the rows which are not missing.
+/// The instances with a missing target value are set unused, as in the materialized data set.
+
+void DataSet::scrub_time_series_missing_values_mean(void)
+{
+    const size_t series_variables_number = time_series_data.get_columns_number();
+
+    const size_t lagged_variables_number = series_variables_number*(1 + lags_number);
+
+    const Vector<size_t> targets_indices = variables.arrange_targets_indices();
+
+    const Vector<MissingValues::Item>& items = missing_values.get_items();
+
+    const size_t missing_values_number = items.size();
+
+    Vector< Vector<size_t> > series_missing_indices(series_variables_number);
+
+    size_t instance_index;
+    size_t variable_index;
+    size_t row_index;
+    size_t column_index;
+
+    for(size_t i = 0; i < missing_values_number; i++)
+    {
+        instance_index = items[i].instance_index;
+        variable_index = items[i].variable_index;
+
+        row_index = instance_index + (variable_index%lagged_variables_number)/series_variables_number;
+        column_index = variable_index%series_variables_number;
+
+        if(targets_indices.contains(variable_index)
+        && time_series_data(row_index, column_index) == -123.456)
+        {
+            instances.set_use(instance_index, Instances::Unused);
+        }
+
+        series_missing_indices[column_index].push_back(row_index);
+    }
+
+    double mean;
+
+    for(size_t j = 0; j < series_variables_number; j++)
+    {
+        if(series_missing_indices[j].empty())
+        {
+            continue;
+        }
+
+        mean = time_series_data.arrange_column(j).calculate_mean_missing_values(series_missing_indices[j]);
+
+        for(size_t k = 0; k < series_missing_indices[j].size(); k++)
+        {
+            time_series_data(series_missing_indices[j][k], j) = mean;
+        }
+    }
+
+    reset_blocks();
 }
 
 
@@ -5910,6 +7088,8 @@ void DataSet::scrub_missing_values_mean(void)
 
 void DataSet::scrub_input_missing_values_mean(void)
 {
+    check_time_series_view("void scrub_input_missing_values_mean(void)");
+
     const Vector< Vector<size_t> > missing_indices = missing_values.arrange_missing_indices();
 
     const Vector<double> means = data.calculate_mean_missing_values(missing_indices);
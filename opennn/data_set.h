@@ -26,6 +26,8 @@
 #include <stdexcept>
 #include <ctime>
 #include <exception>
+#include <atomic>
+#include <mutex>
 
 // OpenNN includes
 
@@ -142,6 +144,9 @@ public:
 
    const size_t& get_lags_number(void) const;
    const size_t& get_steps_ahead(void) const;
+   const bool& get_time_series_view(void) const;
+
+   const bool& get_packed_blocks(void) const;
 
    const bool& get_autoassociation(void) const;
 
@@ -165,6 +170,8 @@ public:
 
    bool empty(void) const;
 
+   bool has_time_series_view(void) const;
+
    const Matrix<double>& get_data(void) const;
    const Matrix<double> get_input_data(void) const;
    const Matrix<double>& get_time_series_data(void) const;
@@ -183,11 +190,31 @@ public:
    Matrix<double> arrange_testing_input_data(void) const;
    Matrix<double> arrange_testing_target_data(void) const;
 
+   Matrix<double> arrange_data(const Vector<size_t>&, const Vector<size_t>&) const;
+   Matrix<float> arrange_float_data(const Vector<size_t>&, const Vector<size_t>&) const;
+
    // Instance methods
 
    Vector<double> get_instance(const size_t&) const;
    Vector<double> get_instance(const size_t&, const Vector<size_t>&) const;
 
+   double get_value(const size_t&, const size_t&) const;
+
+   // Packed blocks methods
+
+   const Matrix<double>& get_training_inputs_block(void) const;
+   const Matrix<double>& get_training_targets_block(void) const;
+   const Matrix<double>& get_selection_inputs_block(void) const;
+   const Matrix<double>& get_selection_targets_block(void) const;
+
+   const Matrix<float>& get_training_float_inputs_block(void) const;
+   const Matrix<float>& get_training_float_targets_block(void) const;
+
+   void get_training_inputs(const size_t&, Vector<double>&) const;
+   void get_training_targets(const size_t&, Vector<double>&) const;
+   void get_selection_inputs(const size_t&, Vector<double>&) const;
+   void get_selection_targets(const size_t&, Vector<double>&) const;
+
    // Variable methods
 
    Vector<double> get_variable(const size_t&) const;
@@ -226,6 +253,9 @@ public:
 
    void set_lags_number(const size_t&);
    void set_steps_ahead_number(const size_t&);
+   void set_time_series_view(const bool&);
+
+   void set_packed_blocks(const bool&);
 
    void set_autoassociation(const bool&);
 
@@ -510,6 +540,12 @@ private:
 
    size_t steps_ahead;
 
+   /// Time series view flag.
+   /// If true, the lagged variables are not materialized when converting a time series,
+   /// but read from the original series on demand.
+
+   bool time_series_view;
+
    /// Autoassociation flag.
 
     bool autoassociation;
@@ -544,6 +580,15 @@ private:
 
    Matrix<double> time_series_data;
 
+   /// Slopes of the scaling of the lagged variables in a time series view.
+   /// The value of a lagged variable is its slope times the value in the series plus its intercept.
+
+   Vector<double> time_series_slopes;
+
+   /// Intercepts of the scaling of the lagged variables in a time series view.
+
+   Vector<double> time_series_intercepts;
+
    /// Variables object (inputs and target variables).
 
    Variables variables;
@@ -575,6 +620,87 @@ private:
    Vector< Vector<std::string> > set_from_data_file(void);
    void read_from_data_file(const Vector< Vector<std::string> >&);
 
+   void update_blocks(void) const;
+   void update_float_blocks(void) const;
+   void reset_blocks(void);
+
+   void check_time_series_view(const std::string&) const;
+
+   void scrub_time_series_missing_values_mean(void);
+
+   void scale_time_series_variables_mean_standard_deviation(const Vector< Statistics<double> >&, const Vector<size_t>&);
+   void scale_time_series_variables_minimum_maximum(const Vector< Statistics<double> >&, const Vector<size_t>&);
+   void unscale_time_series_variables_mean_standard_deviation(const Vector< Statistics<double> >&, const Vector<size_t>&);
+   void unscale_time_series_variables_minimum_maximum(const Vector< Statistics<double> >&, const Vector<size_t>&);
+
+   static void copy_block_instance(const Matrix<double>&, const size_t&, Vector<double>&);
+
+   // PACKED BLOCKS
+
+   /// Packed blocks flag.
+   /// If true, the inputs and targets of the training and selection instances are kept in contiguous blocks,
+   /// which are built again only when the uses of the instances or the variables, or the data, change.
+
+   bool packed_blocks;
+
+   /// True if the packed blocks correspond to the current data.
+   /// It is atomic so that the instances read in a training loop can check it without taking the lock,
+   /// and so are the generations compared with it.
+
+   mutable std::atomic<bool> blocks_updated;
+
+   /// Generation of the instances when the packed blocks were built.
+
+   mutable std::atomic<size_t> blocks_instances_generation;
+
+   /// Generation of the variables when the packed blocks were built.
+
+   mutable std::atomic<size_t> blocks_variables_generation;
+
+   /// Inputs of the training instances.
+   /// The number of rows is the number of inputs and the number of columns is the number of training instances,
+   /// so that the inputs of each instance are contiguous in memory.
+
+   mutable Matrix<double> training_inputs_block;
+
+   /// Targets of the training instances, with one column for each training instance.
+
+   mutable Matrix<double> training_targets_block;
+
+   /// Inputs of the selection instances, with one column for each selection instance.
+
+   mutable Matrix<double> selection_inputs_block;
+
+   /// Targets of the selection instances, with one column for each selection instance.
+
+   mutable Matrix<double> selection_targets_block;
+
+   /// True if the single precision blocks correspond to the current data.
+   /// It is checked without taking the lock, together with the atomic generations below.
+
+   mutable std::atomic<bool> float_blocks_updated;
+
+   /// Generation of the instances when the single precision blocks were built.
+
+   mutable std::atomic<size_t> float_blocks_instances_generation;
+
+   /// Generation of the variables when the single precision blocks were built.
+
+   mutable std::atomic<size_t> float_blocks_variables_generation;
+
+   /// Inputs of the training instances in single precision.
+   /// Unlike the double precision blocks, the number of rows is the number of training instances
+   /// and the number of columns is the number of inputs, which is the layout of the single precision batch methods.
+
+   mutable Matrix<float> training_float_inputs_block;
+
+   /// Targets of the training instances in single precision, with one row for each training instance.
+
+   mutable Matrix<float> training_float_targets_block;
+
+   /// Lock for building the packed blocks from concurrent const methods.
+
+   mutable std::mutex blocks_mutex;
 };
 
 }
@@ -0,0 +1,1268 @@
+/****************************************************************************************************************/
+/*                                                                                                              */
+/*   OpenNN: Open Neural Networks Library                                                                       */
+/*   www.opennn.net                                                                                             */
+/*                                                                                                              */
+/*   E N S E M B L E   T R A I N I N G   C L A S S                                                              */
+/*                                                                                                              */
+/*   Roberto Lopez                                                                                              */
+/*   Artelnics - Making intelligent use of data                                                                 */
+/*   robertolopez@artelnics.com                                                                                 */
+/*                                                                                                              */
+/****************************************************************************************************************/
+
+// OpenNN includes
+
+#include "ensemble_training.h"
+
+namespace OpenNN
+{
+
+// DEFAULT CONSTRUCTOR
+
+/// Default constructor.
+/// It creates an ensemble training algorithm not associated to any performance functional object.
+/// It also initializes the class members to their default values.
+
+EnsembleTraining::EnsembleTraining(void)
+ : TrainingAlgorithm()
+{
+   set_default();
+}
+
+
+// PERFORMANCE FUNCTIONAL CONSTRUCTOR
+
+/// Performance functional constructor.
+/// It creates an ensemble training algorithm associated to a performance functional object.
+/// It also initializes the class members to their default values.
+/// @param new_performance_functional_pointer Pointer to a performance functional object.
+
+EnsembleTraining::EnsembleTraining(PerformanceFunctional* new_performance_functional_pointer)
+: TrainingAlgorithm(new_performance_functional_pointer)
+{
+   set_default();
+}
+
+
+// XML CONSTRUCTOR
+
+/// XML constructor.
+/// It creates an ensemble training algorithm not associated to any performance functional object.
+/// It also loads the rest of class members from a XML document.
+/// @param document TinyXML document containing the members of an ensemble training object.
+
+EnsembleTraining::EnsembleTraining(const tinyxml2::XMLDocument& document) : TrainingAlgorithm(document)
+{
+   set_default();
+
+   from_XML(document);
+}
+
+
+// DESTRUCTOR
+
+/// Destructor.
+/// It does not delete the neural networks.
+
+EnsembleTraining::~EnsembleTraining(void)
+{
+
+}
+
+
+// const Vector<NeuralNetwork*>& get_neural_networks_pointers(void) const method
+
+/// Returns the pointers to the neural networks to be trained.
+/// If it is empty, the neural network of the performance functional is trained.
+
+const Vector<NeuralNetwork*>& EnsembleTraining::get_neural_networks_pointers(void) const
+{
+   return(neural_networks_pointers);
+}
+
+
+// Vector<NeuralNetwork*> arrange_neural_networks_pointers(void) const method
+
+/// Returns the pointers to the neural networks which are actually trained.
+/// These are the neural networks set in this object or, if there are none, the neural network of the performance functional.
+
+Vector<NeuralNetwork*> EnsembleTraining::arrange_neural_networks_pointers(void) const
+{
+   if(!neural_networks_pointers.empty())
+   {
+      return(neural_networks_pointers);
+   }
+
+   Vector<NeuralNetwork*> performance_functional_neural_network(1, performance_functional_pointer->get_neural_network_pointer());
+
+   return(performance_functional_neural_network);
+}
+
+
+// const double& get_first_training_rate(void) const method
+
+/// Returns the initial training rate of all the neural networks.
+
+const double& EnsembleTraining::get_first_training_rate(void) const
+{
+   return(first_training_rate);
+}
+
+
+// const double& get_training_rate_increase_factor(void) const method
+
+/// Returns the factor which increases the training rate of a neural network after a successful step.
+
+const double& EnsembleTraining::get_training_rate_increase_factor(void) const
+{
+   return(training_rate_increase_factor);
+}
+
+
+// const double& get_training_rate_decrease_factor(void) const method
+
+/// Returns the factor which reduces the training rate of a neural network after an unsuccessful step.
+
+const double& EnsembleTraining::get_training_rate_decrease_factor(void) const
+{
+   return(training_rate_decrease_factor);
+}
+
+
+// const double& get_minimum_training_rate(void) const method
+
+/// Returns the training rate below which a neural network is assumed to have converged.
+
+const double& EnsembleTraining::get_minimum_training_rate(void) const
+{
+   return(minimum_training_rate);
+}
+
+
+// const double& get_performance_goal(void) const method
+
+/// Returns the goal value for the performance of each neural network.
+/// This is used as a stopping criterion when training a neural network.
+
+const double& EnsembleTraining::get_performance_goal(void) const
+{
+   return(performance_goal);
+}
+
+
+// const size_t& get_maximum_iterations_number(void) const method
+
+/// Returns the maximum number of iterations for training.
+
+const size_t& EnsembleTraining::get_maximum_iterations_number(void) const
+{
+   return(maximum_iterations_number);
+}
+
+
+// const double& get_maximum_time(void) const method
+
+/// Returns the maximum training time.
+
+const double& EnsembleTraining::get_maximum_time(void) const
+{
+   return(maximum_time);
+}
+
+
+// const bool& get_reserve_performance_history(void) const method
+
+/// Returns true if the performance history of the neural networks is to be reserved, and false otherwise.
+
+const bool& EnsembleTraining::get_reserve_performance_history(void) const
+{
+   return(reserve_performance_history);
+}
+
+
+// void set_default(void) method
+
+/// Sets all the ensemble training object members to their default values:
+/// <ul>
+/// <li> Neural networks: None (the neural network of the performance functional).
+/// <li> First training rate: 0.01
+/// <li> Training rate increase factor: 1.2
+/// <li> Training rate decrease factor: 0.5
+/// <li> Minimum training rate: 1.0e-9
+/// <li> Performance goal: -1.0e99
+/// <li> Maximum iterations number: 1000
+/// <li> Maximum time: 1.0e6
+/// <li> Reserve performance history: False
+/// <li> Display: True
+/// <li> Display period: 10
+/// </ul>
+
+void EnsembleTraining::set_default(void)
+{
+   neural_networks_pointers.clear();
+
+   // TRAINING PARAMETERS
+
+   first_training_rate = 0.01;
+   training_rate_increase_factor = 1.2;
+   training_rate_decrease_factor = 0.5;
+   minimum_training_rate = 1.0e-9;
+
+   // STOPPING CRITERIA
+
+   performance_goal = -1.0e99;
+
+   maximum_iterations_number = 1000;
+   maximum_time = 1.0e6;
+
+   // TRAINING HISTORY
+
+   reserve_performance_history = false;
+
+   // UTILITIES
+
+   display = true;
+   display_period = 10;
+}
+
+
+// void set_neural_networks_pointers(const Vector<NeuralNetwork*>&) method
+
+/// Sets the neural networks to be trained in lockstep.
+/// They must have the same number of inputs and outputs as the data set of the performance functional.
+/// @param new_neural_networks_pointers Pointers to the neural networks. This object does not take ownership of them.
+
+void EnsembleTraining::set_neural_networks_pointers(const Vector<NeuralNetwork*>& new_neural_networks_pointers)
+{
+   neural_networks_pointers = new_neural_networks_pointers;
+}
+
+
+// void set_first_training_rate(const double&) method
+
+/// Sets the initial training rate of all the neural networks.
+/// @param new_first_training_rate First training rate. It must be greater than zero.
+
+void EnsembleTraining::set_first_training_rate(const double& new_first_training_rate)
+{
+   if(new_first_training_rate <= 0.0)
+   {
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: EnsembleTraining class.\n"
+             << "void set_first_training_rate(const double&) method.\n"
+             << "First training rate must be greater than 0.\n";
+
+      throw std::logic_error(buffer.str());
+   }
+
+   first_training_rate = new_first_training_rate;
+}
+
+
+// void set_training_rate_increase_factor(const double&) method
+
+/// Sets the factor which increases the training rate of a neural network after a step which decreases its performance.
+/// @param new_training_rate_increase_factor Training rate increase factor. It must be equal or greater than one.
+
+void EnsembleTraining::set_training_rate_increase_factor(const double& new_training_rate_increase_factor)
+{
+   if(new_training_rate_increase_factor < 1.0)
+   {
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: EnsembleTraining class.\n"
+             << "void set_training_rate_increase_factor(const double&) method.\n"
+             << "Training rate increase factor must be equal or greater than 1.\n";
+
+      throw std::logic_error(buffer.str());
+   }
+
+   training_rate_increase_factor = new_training_rate_increase_factor;
+}
+
+
+// void set_training_rate_decrease_factor(const double&) method
+
+/// Sets the factor which reduces the training rate of a neural network after a step which does not decrease its performance.
+/// @param new_training_rate_decrease_factor Training rate decrease factor. It must be greater than zero and less than one.
+
+void EnsembleTraining::set_training_rate_decrease_factor(const double& new_training_rate_decrease_factor)
+{
+   if(new_training_rate_decrease_factor <= 0.0 || new_training_rate_decrease_factor >= 1.0)
+   {
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: EnsembleTraining class.\n"
+             << "void set_training_rate_decrease_factor(const double&) method.\n"
+             << "Training rate decrease factor must be greater than 0 and less than 1.\n";
+
+      throw std::logic_error(buffer.str());
+   }
+
+   training_rate_decrease_factor = new_training_rate_decrease_factor;
+}
+
+
+// void set_minimum_training_rate(const double&) method
+
+/// Sets the training rate below which a neural network is assumed to have converged.
+/// @param new_minimum_training_rate Minimum training rate. It must be equal or greater than zero.
+
+void EnsembleTraining::set_minimum_training_rate(const double& new_minimum_training_rate)
+{
+   if(new_minimum_training_rate < 0.0)
+   {
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: EnsembleTraining class.\n"
+             << "void set_minimum_training_rate(const double&) method.\n"
+             << "Minimum training rate must be equal or greater than 0.\n";
+
+      throw std::logic_error(buffer.str());
+   }
+
+   minimum_training_rate = new_minimum_training_rate;
+}
+
+
+// void set_performance_goal(const double&) method
+
+/// Sets a new goal value for the performance of each neural network.
+/// A neural network which reaches this value is no longer trained.
+/// @param new_performance_goal Goal value for the performance.
+
+void EnsembleTraining::set_performance_goal(const double& new_performance_goal)
+{
+   performance_goal = new_performance_goal;
+}
+
+
+// void set_maximum_iterations_number(const size_t&) method
+
+/// Sets a maximum number of iterations for training.
+/// @param new_maximum_iterations_number Maximum number of iterations for training.
+
+void EnsembleTraining::set_maximum_iterations_number(const size_t& new_maximum_iterations_number)
+{
+   maximum_iterations_number = new_maximum_iterations_number;
+}
+
+
+// void set_maximum_time(const double&) method
+
+/// Sets a new maximum training time.
+/// @param new_maximum_time Maximum training time.
+
+void EnsembleTraining::set_maximum_time(const double& new_maximum_time)
+{
+   // Control sentence (if debug)
+
+   #ifdef __OPENNN_DEBUG__
+
+   if(new_maximum_time < 0.0)
+   {
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: EnsembleTraining class.\n"
+             << "void set_maximum_time(const double&) method.\n"
+             << "Maximum time must be equal or greater than 0.\n";
+
+      throw std::logic_error(buffer.str());
+   }
+
+   #endif
+
+   maximum_time = new_maximum_time;
+}
+
+
+// void set_reserve_performance_history(const bool&) method
+
+/// Makes the performance history of the neural networks to be reserved or not in memory.
+/// @param new_reserve_performance_history True if the performance history is to be reserved, false otherwise.
+
+void EnsembleTraining::set_reserve_performance_history(const bool& new_reserve_performance_history)
+{
+   reserve_performance_history = new_reserve_performance_history;
+}
+
+
+// void set_reserve_all_training_history(const bool&) method
+
+/// Makes the training history of all variables to be reserved or not in memory.
+/// @param new_reserve_all_training_history True if the training history of all variables is to be reserved, false otherwise.
+
+void EnsembleTraining::set_reserve_all_training_history(const bool& new_reserve_all_training_history)
+{
+   reserve_performance_history = new_reserve_all_training_history;
+}
+
+
+// void check(void) const method
+
+/// Performs a default checking for ensemble training.
+/// In addition, it checks that the objective of the performance functional is the sum squared error,
+/// that there are no regularization or constraints terms,
+/// and that all the neural networks have the number of inputs and outputs of the data set.
+
+void EnsembleTraining::check(void) const
+{
+   TrainingAlgorithm::check();
+
+   std::ostringstream buffer;
+
+   if(performance_functional_pointer->get_objective_type() != PerformanceFunctional::SUM_SQUARED_ERROR_OBJECTIVE
+   || performance_functional_pointer->get_regularization_type() != PerformanceFunctional::NO_REGULARIZATION
+   || performance_functional_pointer->get_constraints_type() != PerformanceFunctional::NO_CONSTRAINTS)
+   {
+      buffer << "OpenNN Exception: EnsembleTraining class.\n"
+             << "void check(void) const method.\n"
+             << "Performance functional must have a sum squared error objective and no regularization or constraints terms.\n";
+
+      throw std::logic_error(buffer.str());
+   }
+
+   const DataSet* data_set_pointer = performance_functional_pointer->get_data_set_pointer();
+
+   if(!data_set_pointer)
+   {
+      buffer << "OpenNN Exception: EnsembleTraining class.\n"
+             << "void check(void) const method.\n"
+             << "Pointer to data set is NULL.\n";
+
+      throw std::logic_error(buffer.str());
+   }
+
+   const Variables& variables = data_set_pointer->get_variables();
+
+   const size_t inputs_number = variables.count_inputs_number();
+   const size_t targets_number = variables.count_targets_number();
+
+   const Vector<NeuralNetwork*> neural_networks = arrange_neural_networks_pointers();
+
+   for(size_t i = 0; i < neural_networks.size(); i++)
+   {
+      const MultilayerPerceptron* multilayer_perceptron_pointer = neural_networks[i] ? neural_networks[i]->get_multilayer_perceptron_pointer() : NULL;
+
+      if(!multilayer_perceptron_pointer)
+      {
+         buffer << "OpenNN Exception: EnsembleTraining class.\n"
+                << "void check(void) const method.\n"
+                << "Pointer to multilayer perceptron of neural network " << i << " is NULL.\n";
+
+         throw std::logic_error(buffer.str());
+      }
+
+      if(multilayer_perceptron_pointer->get_inputs_number() != inputs_number
+      || multilayer_perceptron_pointer->get_outputs_number() != targets_number)
+      {
+         buffer << "OpenNN Exception: EnsembleTraining class.\n"
+                << "void check(void) const method.\n"
+                << "Number of inputs and outputs of neural network " << i << " must be equal to number of inputs and targets in the data set.\n";
+
+         throw std::logic_error(buffer.str());
+      }
+   }
+}
+
+
+// Vector<PerformanceTerm::FirstOrderPerformance> calculate_first_order_performances(const Vector<NeuralNetwork*>&) const method
+
+/// Returns the sum squared error and its gradient for several neural networks,
+/// which are computed in a single pass over the training instances of the data set.
+/// @param neural_networks Pointers to the neural networks to be evaluated.
+
+Vector<PerformanceTerm::FirstOrderPerformance> EnsembleTraining::calculate_first_order_performances(const Vector<NeuralNetwork*>& neural_networks) const
+{
+   const SumSquaredError* sum_squared_error_pointer = performance_functional_pointer->get_sum_squared_error_objective_pointer();
+
+   return(sum_squared_error_pointer->calculate_first_order_performances(neural_networks));
+}
+
+
+// EnsembleTrainingResults* perform_training(void) method
+
+/// Trains all the neural networks in lockstep by gradient descent with an adaptive training rate for each of them.
+/// At each iteration, the performances and gradients of all the neural networks which have not converged are computed in one data pass.
+/// A step which decreases the performance of a neural network is accepted and its training rate is increased,
+/// while a step which does not is undone and its training rate is reduced.
+/// The neural networks finish with the best parameters found for each of them.
+
+EnsembleTraining::EnsembleTrainingResults* EnsembleTraining::perform_training(void)
+{
+   check();
+
+   EnsembleTrainingResults* results_pointer = new EnsembleTrainingResults(this);
+
+   const Vector<NeuralNetwork*> neural_networks = arrange_neural_networks_pointers();
+
+   const size_t neural_networks_number = neural_networks.size();
+
+   // Start training
+
+   if(display)
+   {
+      std::cout << "Training with ensemble training...\n"
+                << "Number of neural networks: " << neural_networks_number << std::endl;
+   }
+
+   time_t beginning_time, current_time;
+   time(&beginning_time);
+   double elapsed_time;
+
+   // Neural networks stuff
+
+   Vector< Vector<double> > parameters(neural_networks_number);
+
+   for(size_t i = 0; i < neural_networks_number; i++)
+   {
+      parameters[i] = neural_networks[i]->get_multilayer_perceptron_pointer()->arrange_parameters();
+   }
+
+   // Performance functional stuff
+
+   Vector<double> performances(neural_networks_number, 0.0);
+
+   Vector< Vector<double> > gradients(neural_networks_number);
+
+   Vector<PerformanceTerm::FirstOrderPerformance> first_order_performances;
+
+   // Training algorithm stuff
+
+   Vector<double> training_rates(neural_networks_number, first_training_rate);
+
+   Vector<size_t> active_indices;
+
+   Vector<NeuralNetwork*> active_neural_networks;
+
+   double gradient_norm;
+
+   bool stop_training = false;
+
+   size_t iteration;
+
+   // Main loop
+
+   for(iteration = 0; iteration <= maximum_iterations_number; iteration++)
+   {
+      // Neural networks which have not converged yet
+
+      active_indices.clear();
+      active_neural_networks.clear();
+
+      for(size_t i = 0; i < neural_networks_number; i++)
+      {
+         if(iteration == 0 || (training_rates[i] >= minimum_training_rate && performances[i] > performance_goal))
+         {
+            active_indices.push_back(i);
+            active_neural_networks.push_back(neural_networks[i]);
+         }
+      }
+
+      if(active_indices.empty())
+      {
+         if(display)
+         {
+            std::cout << "Iteration " << iteration << ": All the neural networks have converged.\n";
+         }
+
+         break;
+      }
+
+      // Performance functional stuff
+
+      first_order_performances = calculate_first_order_performances(active_neural_networks);
+
+      // Training algorithm stuff
+
+      for(size_t j = 0; j < active_indices.size(); j++)
+      {
+         const size_t i = active_indices[j];
+
+         MultilayerPerceptron* multilayer_perceptron_pointer = neural_networks[i]->get_multilayer_perceptron_pointer();
+
+         if(iteration == 0 || first_order_performances[j].performance < performances[i])
+         {
+            if(iteration != 0)
+            {
+               parameters[i] = multilayer_perceptron_pointer->arrange_parameters();
+
+               training_rates[i] *= training_rate_increase_factor;
+            }
+
+            performances[i] = first_order_performances[j].performance;
+            gradients[i] = first_order_performances[j].gradient;
+         }
+         else
+         {
+            training_rates[i] *= training_rate_decrease_factor;
+         }
+
+         gradient_norm = gradients[i].calculate_norm();
+
+         if(gradient_norm == 0.0)
+         {
+            training_rates[i] = 0.0;
+         }
+         else
+         {
+            multilayer_perceptron_pointer->set_parameters(parameters[i] - gradients[i]*(training_rates[i]/gradient_norm));
+         }
+      }
+
+      time(&current_time);
+      elapsed_time = difftime(current_time, beginning_time);
+
+      // Training history
+
+      if(reserve_performance_history)
+      {
+         results_pointer->performance_history.push_back(performances);
+      }
+
+      // Stopping criteria
+
+      if(iteration == maximum_iterations_number)
+      {
+         if(display)
+         {
+            std::cout << "Iteration " << iteration << ": Maximum number of iterations reached.\n";
+         }
+
+         stop_training = true;
+      }
+
+      else if(elapsed_time >= maximum_time)
+      {
+         if(display)
+         {
+            std::cout << "Iteration " << iteration << ": Maximum training time reached.\n";
+         }
+
+         stop_training = true;
+      }
+
+      if(stop_training)
+      {
+         break;
+      }
+      else if(display && iteration % display_period == 0)
+      {
+         std::cout << "Iteration " << iteration << ";\n"
+                   << "Performances: " << performances << "\n"
+                   << "Training rates: " << training_rates << "\n"
+                   << "Elapsed time: " << elapsed_time << std::endl;
+      }
+   }
+
+   // Set the best parameters found for each neural network
+
+   DataSet* data_set_pointer = performance_functional_pointer->get_data_set_pointer();
+
+   Vector<double> selection_performances(neural_networks_number);
+
+   for(size_t i = 0; i < neural_networks_number; i++)
+   {
+      neural_networks[i]->get_multilayer_perceptron_pointer()->set_parameters(parameters[i]);
+
+      selection_performances[i] = SumSquaredError(neural_networks[i], data_set_pointer).calculate_selection_performance();
+   }
+
+   time(&current_time);
+   elapsed_time = difftime(current_time, beginning_time);
+
+   if(display)
+   {
+      std::cout << "Performances: " << performances << "\n"
+                << "Elapsed time: " << elapsed_time << std::endl;
+   }
+
+   results_pointer->final_parameters = parameters;
+   results_pointer->final_performances = performances;
+   results_pointer->final_selection_performances = selection_performances;
+   results_pointer->final_training_rates = training_rates;
+   results_pointer->elapsed_time = elapsed_time;
+   results_pointer->iterations_number = iteration;
+
+   return(results_pointer);
+}
+
+
+// std::string write_training_algorithm_type(void) const method
+
+std::string EnsembleTraining::write_training_algorithm_type(void) const
+{
+   return("ENSEMBLE_TRAINING");
+}
+
+
+// std::string EnsembleTrainingResults::to_string(void) const method
+
+/// Returns a string representation of the ensemble training results structure.
+
+std::string EnsembleTraining::EnsembleTrainingResults::to_string(void) const
+{
+   std::ostringstream buffer;
+
+   // Performance history
+
+   if(!performance_history.empty())
+   {
+       buffer << "% Performance history:\n"
+              << performance_history << "\n";
+   }
+
+   // Final performances
+
+   buffer << "% Final performances:\n"
+          << final_performances << "\n";
+
+   // Final selection performances
+
+   buffer << "% Final selection performances:\n"
+          << final_selection_performances << "\n";
+
+   // Final training rates
+
+   buffer << "% Final training rates:\n"
+          << final_training_rates << "\n";
+
+   // Iterations number
+
+   buffer << "% Iterations number:\n"
+          << iterations_number << "\n";
+
+   // Elapsed time
+
+   buffer << "% Elapsed time:\n"
+          << elapsed_time << "\n";
+
+   return(buffer.str());
+}
+
+
+// Matrix<std::string> write_final_results(const size_t& precision) const method
+
+/// Returns a default string matrix with the final results from training.
+/// @param precision Number of significant digits.
+
+Matrix<std::string> EnsembleTraining::EnsembleTrainingResults::write_final_results(const size_t& precision) const
+{
+   std::ostringstream buffer;
+
+   Vector<std::string> names;
+   Vector<std::string> values;
+
+   // Final performances
+
+   for(size_t i = 0; i < final_performances.size(); i++)
+   {
+      buffer.str("");
+      buffer << "Final performance " << i+1;
+
+      names.push_back(buffer.str());
+
+      buffer.str("");
+      buffer << std::setprecision(precision) << final_performances[i];
+
+      values.push_back(buffer.str());
+   }
+
+   // Final selection performances
+
+   for(size_t i = 0; i < final_selection_performances.size(); i++)
+   {
+      buffer.str("");
+      buffer << "Final selection performance " << i+1;
+
+      names.push_back(buffer.str());
+
+      buffer.str("");
+      buffer << std::setprecision(precision) << final_selection_performances[i];
+
+      values.push_back(buffer.str());
+   }
+
+   // Iterations number
+
+   names.push_back("Iterations number");
+
+   buffer.str("");
+   buffer << iterations_number;
+
+   values.push_back(buffer.str());
+
+   // Elapsed time
+
+   names.push_back("Elapsed time");
+
+   buffer.str("");
+   buffer << elapsed_time;
+
+   values.push_back(buffer.str());
+
+   const size_t rows_number = names.size();
+   const size_t columns_number = 2;
+
+   Matrix<std::string> final_results(rows_number, columns_number);
+
+   final_results.set_column(0, names);
+   final_results.set_column(1, values);
+
+   return(final_results);
+}
+
+
+// Matrix<std::string> to_string_matrix(void) const method
+
+/// Returns a string matrix with the most representative members of this object.
+
+Matrix<std::string> EnsembleTraining::to_string_matrix(void) const
+{
+   std::ostringstream buffer;
+
+   Vector<std::string> labels;
+   Vector<std::string> values;
+
+   // Neural networks number
+
+   labels.push_back("Neural networks number");
+
+   buffer.str("");
+   buffer << (neural_networks_pointers.empty() ? 1 : neural_networks_pointers.size());
+
+   values.push_back(buffer.str());
+
+   // First training rate
+
+   labels.push_back("First training rate");
+
+   buffer.str("");
+   buffer << first_training_rate;
+
+   values.push_back(buffer.str());
+
+   // Minimum training rate
+
+   labels.push_back("Minimum training rate");
+
+   buffer.str("");
+   buffer << minimum_training_rate;
+
+   values.push_back(buffer.str());
+
+   // Performance goal
+
+   labels.push_back("Performance goal");
+
+   buffer.str("");
+   buffer << performance_goal;
+
+   values.push_back(buffer.str());
+
+   // Maximum iterations number
+
+   labels.push_back("Maximum iterations number");
+
+   buffer.str("");
+   buffer << maximum_iterations_number;
+
+   values.push_back(buffer.str());
+
+   // Maximum time
+
+   labels.push_back("Maximum time");
+
+   buffer.str("");
+   buffer << maximum_time;
+
+   values.push_back(buffer.str());
+
+   const size_t rows_number = labels.size();
+   const size_t columns_number = 2;
+
+   Matrix<std::string> string_matrix(rows_number, columns_number);
+
+   string_matrix.set_column(0, labels);
+   string_matrix.set_column(1, values);
+
+   return(string_matrix);
+}
+
+
+// tinyxml2::XMLDocument* to_XML(void) const method
+
+/// Serializes the ensemble training object into a XML document of the TinyXML library.
+/// The neural networks are not serialized.
+
+tinyxml2::XMLDocument* EnsembleTraining::to_XML(void) const
+{
+   std::ostringstream buffer;
+
+   tinyxml2::XMLDocument* document = new tinyxml2::XMLDocument;
+
+   // Training algorithm
+
+   tinyxml2::XMLElement* root_element = document->NewElement("EnsembleTraining");
+
+   document->InsertFirstChild(root_element);
+
+   tinyxml2::XMLElement* element = NULL;
+   tinyxml2::XMLText* text = NULL;
+
+   // First training rate
+   {
+   element = document->NewElement("FirstTrainingRate");
+   root_element->LinkEndChild(element);
+
+   buffer.str("");
+   buffer << first_training_rate;
+
+   text = document->NewText(buffer.str().c_str());
+   element->LinkEndChild(text);
+   }
+
+   // Training rate increase factor
+   {
+   element = document->NewElement("TrainingRateIncreaseFactor");
+   root_element->LinkEndChild(element);
+
+   buffer.str("");
+   buffer << training_rate_increase_factor;
+
+   text = document->NewText(buffer.str().c_str());
+   element->LinkEndChild(text);
+   }
+
+   // Training rate decrease factor
+   {
+   element = document->NewElement("TrainingRateDecreaseFactor");
+   root_element->LinkEndChild(element);
+
+   buffer.str("");
+   buffer << training_rate_decrease_factor;
+
+   text = document->NewText(buffer.str().c_str());
+   element->LinkEndChild(text);
+   }
+
+   // Minimum training rate
+   {
+   element = document->NewElement("MinimumTrainingRate");
+   root_element->LinkEndChild(element);
+
+   buffer.str("");
+   buffer << minimum_training_rate;
+
+   text = document->NewText(buffer.str().c_str());
+   element->LinkEndChild(text);
+   }
+
+   // Performance goal
+   {
+   element = document->NewElement("PerformanceGoal");
+   root_element->LinkEndChild(element);
+
+   buffer.str("");
+   buffer << performance_goal;
+
+   text = document->NewText(buffer.str().c_str());
+   element->LinkEndChild(text);
+   }
+
+   // Maximum iterations number
+   {
+   element = document->NewElement("MaximumIterationsNumber");
+   root_element->LinkEndChild(element);
+
+   buffer.str("");
+   buffer << maximum_iterations_number;
+
+   text = document->NewText(buffer.str().c_str());
+   element->LinkEndChild(text);
+   }
+
+   // Maximum time
+   {
+   element = document->NewElement("MaximumTime");
+   root_element->LinkEndChild(element);
+
+   buffer.str("");
+   buffer << maximum_time;
+
+   text = document->NewText(buffer.str().c_str());
+   element->LinkEndChild(text);
+   }
+
+   // Reserve performance history
+   {
+   element = document->NewElement("ReservePerformanceHistory");
+   root_element->LinkEndChild(element);
+
+   buffer.str("");
+   buffer << reserve_performance_history;
+
+   text = document->NewText(buffer.str().c_str());
+   element->LinkEndChild(text);
+   }
+
+   // Display period
+   {
+   element = document->NewElement("DisplayPeriod");
+   root_element->LinkEndChild(element);
+
+   buffer.str("");
+   buffer << display_period;
+
+   text = document->NewText(buffer.str().c_str());
+   element->LinkEndChild(text);
+   }
+
+   // Display
+   {
+   element = document->NewElement("Display");
+   root_element->LinkEndChild(element);
+
+   buffer.str("");
+   buffer << display;
+
+   text = document->NewText(buffer.str().c_str());
+   element->LinkEndChild(text);
+   }
+
+   return(document);
+}
+
+
+// void from_XML(const tinyxml2::XMLDocument&) method
+
+/// Loads an ensemble training object from a XML document.
+/// @param document TinyXML document containing the members of the object.
+
+void EnsembleTraining::from_XML(const tinyxml2::XMLDocument& document)
+{
+   const tinyxml2::XMLElement* root_element = document.FirstChildElement("EnsembleTraining");
+
+   if(!root_element)
+   {
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: EnsembleTraining class.\n"
+             << "void from_XML(const tinyxml2::XMLDocument&) method.\n"
+             << "Ensemble training element is NULL.\n";
+
+      throw std::logic_error(buffer.str());
+   }
+
+   // First training rate
+   {
+       const tinyxml2::XMLElement* element = root_element->FirstChildElement("FirstTrainingRate");
+
+       if(element)
+       {
+          const double new_first_training_rate = atof(element->GetText());
+
+          try
+          {
+             set_first_training_rate(new_first_training_rate);
+          }
+          catch(const std::logic_error& e)
+          {
+             std::cout << e.what() << std::endl;
+          }
+       }
+   }
+
+   // Training rate increase factor
+   {
+       const tinyxml2::XMLElement* element = root_element->FirstChildElement("TrainingRateIncreaseFactor");
+
+       if(element)
+       {
+          const double new_training_rate_increase_factor = atof(element->GetText());
+
+          try
+          {
+             set_training_rate_increase_factor(new_training_rate_increase_factor);
+          }
+          catch(const std::logic_error& e)
+          {
+             std::cout << e.what() << std::endl;
+          }
+       }
+   }
+
+   // Training rate decrease factor
+   {
+       const tinyxml2::XMLElement* element = root_element->FirstChildElement("TrainingRateDecreaseFactor");
+
+       if(element)
+       {
+          const double new_training_rate_decrease_factor = atof(element->GetText());
+
+          try
+          {
+             set_training_rate_decrease_factor(new_training_rate_decrease_factor);
+          }
+          catch(const std::logic_error& e)
+          {
+             std::cout << e.what() << std::endl;
+          }
+       }
+   }
+
+   // Minimum training rate
+   {
+       const tinyxml2::XMLElement* element = root_element->FirstChildElement("MinimumTrainingRate");
+
+       if(element)
+       {
+          const double new_minimum_training_rate = atof(element->GetText());
+
+          try
+          {
+             set_minimum_training_rate(new_minimum_training_rate);
+          }
+          catch(const std::logic_error& e)
+          {
+             std::cout << e.what() << std::endl;
+          }
+       }
+   }
+
+   // Performance goal
+   {
+       const tinyxml2::XMLElement* element = root_element->FirstChildElement("PerformanceGoal");
+
+       if(element)
+       {
+          const double new_performance_goal = atof(element->GetText());
+
+          try
+          {
+             set_performance_goal(new_performance_goal);
+          }
+          catch(const std::logic_error& e)
+          {
+             std::cout << e.what() << std::endl;
+          }
+       }
+   }
+
+   // Maximum iterations number
+   {
+       const tinyxml2::XMLElement* element = root_element->FirstChildElement("MaximumIterationsNumber");
+
+       if(element)
+       {
+          const size_t new_maximum_iterations_number = atoi(element->GetText());
+
+          try
+          {
+             set_maximum_iterations_number(new_maximum_iterations_number);
+          }
+          catch(const std::logic_error& e)
+          {
+             std::cout << e.what() << std::endl;
+          }
+       }
+   }
+
+   // Maximum time
+   {
+       const tinyxml2::XMLElement* element = root_element->FirstChildElement("MaximumTime");
+
+       if(element)
+       {
+          const double new_maximum_time = atof(element->GetText());
+
+          try
+          {
+             set_maximum_time(new_maximum_time);
+          }
+          catch(const std::logic_error& e)
+          {
+             std::cout << e.what() << std::endl;
+          }
+       }
+   }
+
+   // Reserve performance history
+   {
+       const tinyxml2::XMLElement* element = root_element->FirstChildElement("ReservePerformanceHistory");
+
+       if(element)
+       {
+          const std::string new_reserve_performance_history = element->GetText();
+
+          try
+          {
+             set_reserve_performance_history(new_reserve_performance_history != "0");
+          }
+          catch(const std::logic_error& e)
+          {
+             std::cout << e.what() << std::endl;
+          }
+       }
+   }
+
+   // Display period
+   {
+       const tinyxml2::XMLElement* element = root_element->FirstChildElement("DisplayPeriod");
+
+       if(element)
+       {
+          const size_t new_display_period = atoi(element->GetText());
+
+          try
+          {
+             set_display_period(new_display_period);
+          }
+          catch(const std::logic_error& e)
+          {
+             std::cout << e.what() << std::endl;
+          }
+       }
+   }
+
+   // Display
+   {
+       const tinyxml2::XMLElement* element = root_element->FirstChildElement("Display");
+
+       if(element)
+       {
+          const std::string new_display = element->GetText();
+
+          try
+          {
+             set_display(new_display != "0");
+          }
+          catch(const std::logic_error& e)
+          {
+             std::cout << e.what() << std::endl;
+          }
+       }
+   }
+}
+
+}
+
+
+// OpenNN: Open Neural Networks Library.
+// Copyright (c) 2005-2016 Roberto Lopez.
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
@@ -0,0 +1,282 @@
+/****************************************************************************************************************/
+/*                                                                                                              */
+/*   OpenNN: Open Neural Networks Library                                                                       */
+/*   www.opennn.net                                                                                             */
+/*                                                                                                              */
+/*   E N S E M B L E   T R A I N I N G   C L A S S   H E A D E R                                                */
+/*                                                                                                              */
+/*   Roberto Lopez                                                                                              */
+/*   Artelnics - Making intelligent use of data                                                                 */
+/*   robertolopez@artelnics.com                                                                                 */
+/*                                                                                                              */
+/****************************************************************************************************************/
+
+#ifndef __ENSEMBLETRAINING_H__
+#define __ENSEMBLETRAINING_H__
+
+// System includes
+
+#include <string>
+#include <sstream>
+#include <iostream>
+#include <fstream>
+#include <algorithm>
+#include <functional>
+#include <cmath>
+#include <ctime>
+
+// OpenNN includes
+
+#include "performance_functional.h"
+
+#include "training_algorithm.h"
+
+// TinyXml includes
+
+#include "../tinyxml2/tinyxml2.h"
+
+namespace OpenNN
+{
+
+///
+/// This concrete class trains several independent neural networks in lockstep on the data set of a performance functional.
+/// At each iteration the training instances are loaded once and propagated through all the neural networks,
+/// which are then moved along their gradient descent directions with their own adaptive training rates.
+/// It is intended for repeated trials and bagging ensembles, where the networks differ in their initial parameters or architectures.
+/// The objective of the performance functional must be the sum squared error, with no regularization and no constraints.
+///
+
+class EnsembleTraining : public TrainingAlgorithm
+{
+
+public:
+
+   // DEFAULT CONSTRUCTOR
+
+   explicit EnsembleTraining(void);
+
+
+   // PERFORMANCE FUNCTIONAL CONSTRUCTOR
+
+   explicit EnsembleTraining(PerformanceFunctional*);
+
+
+   // XML CONSTRUCTOR
+
+   explicit EnsembleTraining(const tinyxml2::XMLDocument&);
+
+
+   // DESTRUCTOR
+
+   virtual ~EnsembleTraining(void);
+
+   // STRUCTURES
+
+   ///
+   /// This structure contains the training results for the ensemble training.
+   ///
+
+   struct EnsembleTrainingResults : public TrainingAlgorithm::TrainingAlgorithmResults
+   {
+       /// Default constructor.
+
+       EnsembleTrainingResults(void)
+       {
+           ensemble_training_pointer = NULL;
+       }
+
+       /// Ensemble training constructor.
+
+       EnsembleTrainingResults(EnsembleTraining* new_ensemble_training_pointer)
+       {
+           ensemble_training_pointer = new_ensemble_training_pointer;
+       }
+
+       /// Destructor.
+
+       virtual ~EnsembleTrainingResults(void)
+       {
+       }
+
+      /// Pointer to the ensemble training object for which the training results are to be stored.
+
+      EnsembleTraining* ensemble_training_pointer;
+
+      // TRAINING HISTORY
+
+      /// History of the performance of each neural network over the training iterations.
+
+      Vector< Vector<double> > performance_history;
+
+      // FINAL VALUES
+
+      /// Final parameters of each neural network.
+
+      Vector< Vector<double> > final_parameters;
+
+      /// Final performance of each neural network.
+
+      Vector<double> final_performances;
+
+      /// Final selection performance of each neural network.
+
+      Vector<double> final_selection_performances;
+
+      /// Final training rate of each neural network.
+
+      Vector<double> final_training_rates;
+
+      /// Elapsed time of the training process.
+
+      double elapsed_time;
+
+      /// Number of training iterations.
+
+      size_t iterations_number;
+
+      // METHODS
+
+      std::string to_string(void) const;
+
+      Matrix<std::string> write_final_results(const size_t& precision = 3) const;
+  };
+
+
+   // METHODS
+
+   // Get methods
+
+   const Vector<NeuralNetwork*>& get_neural_networks_pointers(void) const;
+
+   Vector<NeuralNetwork*> arrange_neural_networks_pointers(void) const;
+
+   const double& get_first_training_rate(void) const;
+   const double& get_training_rate_increase_factor(void) const;
+   const double& get_training_rate_decrease_factor(void) const;
+   const double& get_minimum_training_rate(void) const;
+
+   // Stopping criteria
+
+   const double& get_performance_goal(void) const;
+
+   const size_t& get_maximum_iterations_number(void) const;
+   const double& get_maximum_time(void) const;
+
+   // Reserve training history
+
+   const bool& get_reserve_performance_history(void) const;
+
+   // Set methods
+
+   void set_default(void);
+
+   void set_neural_networks_pointers(const Vector<NeuralNetwork*>&);
+
+   void set_first_training_rate(const double&);
+   void set_training_rate_increase_factor(const double&);
+   void set_training_rate_decrease_factor(const double&);
+   void set_minimum_training_rate(const double&);
+
+   // Stopping criteria
+
+   void set_performance_goal(const double&);
+
+   void set_maximum_iterations_number(const size_t&);
+   void set_maximum_time(const double&);
+
+   // Reserve training history
+
+   void set_reserve_performance_history(const bool&);
+
+   void set_reserve_all_training_history(const bool&);
+
+   // Checking methods
+
+   void check(void) const;
+
+   // Training methods
+
+   Vector<PerformanceTerm::FirstOrderPerformance> calculate_first_order_performances(const Vector<NeuralNetwork*>&) const;
+
+   EnsembleTrainingResults* perform_training(void);
+
+   std::string write_training_algorithm_type(void) const;
+
+   // Serialization methods
+
+   Matrix<std::string> to_string_matrix(void) const;
+
+   tinyxml2::XMLDocument* to_XML(void) const;
+   void from_XML(const tinyxml2::XMLDocument&);
+
+private:
+
+   // MEMBERS
+
+   /// Pointers to the neural networks to be trained.
+   /// If it is empty, the neural network of the performance functional is trained.
+
+   Vector<NeuralNetwork*> neural_networks_pointers;
+
+   // TRAINING PARAMETERS
+
+   /// Initial training rate of all the neural networks.
+
+   double first_training_rate;
+
+   /// Factor which increases the training rate of a neural network after a step which decreases its performance.
+   /// It must be equal or greater than one.
+
+   double training_rate_increase_factor;
+
+   /// Factor which reduces the training rate of a neural network after a step which does not decrease its performance.
+   /// It must be greater than zero and less than one.
+
+   double training_rate_decrease_factor;
+
+   /// Training rate below which a neural network is assumed to have converged, and it is no longer evaluated.
+
+   double minimum_training_rate;
+
+   // STOPPING CRITERIA
+
+   /// Goal value for the performance of each neural network. It is used as a stopping criterion.
+
+   double performance_goal;
+
+   /// Maximum number of iterations to perform_training. It is used as a stopping criterion.
+
+   size_t maximum_iterations_number;
+
+   /// Maximum training time. It is used as a stopping criterion.
+
+   double maximum_time;
+
+   // TRAINING HISTORY
+
+   /// True if the performance history of the neural networks is to be reserved, false otherwise.
+
+   bool reserve_performance_history;
+};
+
+}
+
+#endif
+
+
+// OpenNN: Open Neural Networks Library.
+// Copyright (c) 2005-2016 Roberto Lopez.
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
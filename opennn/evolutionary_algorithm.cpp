@@ -4093,7 +4093,7 @@ void EvolutionaryAlgorithm::initialize_random(void)
 
     // Recombination method
 
-    switch(rand()%2)
+    switch(calculate_random_index(2))
    {
       case 0:
       {
@@ -4122,7 +4122,7 @@ void EvolutionaryAlgorithm::initialize_random(void)
 
     // Mutation method
 
-    switch(rand()%2)
+    switch(calculate_random_index(2))
    {
       case 0:
       {
@@ -464,7 +464,9 @@ void FinalSolutionsError::check(void) const
 }
 
 
-// Vector<double> calculate_performance(void) const method
+// double calculate_performance(void) const method
+
+/// Returns the weighted squared error between the final solutions of the mathematical model and their targets.
 
 double FinalSolutionsError::calculate_performance(void) const   
 {
@@ -476,12 +478,23 @@ double FinalSolutionsError::calculate_performance(void) const
 
    #endif
 
+   return(calculate_performance(*neural_network_pointer));
+}
+
+
+// double calculate_performance(const NeuralNetwork&) const method
+
+/// Returns the final solutions error of a given neural network. 
+/// @param neural_network Neural network to be evaluated.
+
+double FinalSolutionsError::calculate_performance(const NeuralNetwork& neural_network) const   
+{
    // Final state error stuff
 
    const size_t independent_variables_number = mathematical_model_pointer->get_independent_variables_number();
    const size_t dependent_variables_number = mathematical_model_pointer->get_dependent_variables_number();
 
-   const Vector<double> final_solutions = mathematical_model_pointer->calculate_final_solutions(*neural_network_pointer);
+   const Vector<double> final_solutions = mathematical_model_pointer->calculate_final_solutions(neural_network);
 
    const Vector<double> dependent_variables_final_solutions = final_solutions.take_out(independent_variables_number, dependent_variables_number);
 
@@ -493,9 +506,22 @@ double FinalSolutionsError::calculate_performance(void) const
 
 // double calculate_performance(const Vector<double>&) const method
 
-double FinalSolutionsError::calculate_performance(const Vector<double>&) const
+/// Returns the final solutions error of the neural network for a given set of parameters. 
+/// @param parameters Vector of potential neural network parameters. 
+
+double FinalSolutionsError::calculate_performance(const Vector<double>& parameters) const
 {
-    return(0.0);
+   // Control sentence
+
+   #ifdef __OPENNN_DEBUG__ 
+
+   check();
+
+   #endif
+
+   const NeuralNetwork neural_network(*neural_network_pointer, parameters);
+
+   return(calculate_performance(neural_network));
 }
 
 
@@ -961,7 +961,7 @@ void GeneticAlgorithm::initialize_random_population(void)
 
         for (size_t j = 0; j < inputs_number; j++)
         {
-            random = rand()%2;
+            random = calculate_random_index(2);
 
             if (random == 0)
             {
@@ -975,7 +975,7 @@ void GeneticAlgorithm::initialize_random_population(void)
         }
 
         if (zero_ocurrences == inputs_number)
-            inputs[rand()%inputs_number] = true;
+            inputs[calculate_random_index(inputs_number)] = true;
 
         population[i] = inputs;
     }
@@ -1043,7 +1043,7 @@ void GeneticAlgorithm::initialize_weighted_population(void)
         }
 
         if (zero_ocurrences == inputs_number)
-            inputs[rand()%inputs_number] = false;
+            inputs[calculate_random_index(inputs_number)] = false;
 
         population[i] = inputs;
     }
@@ -1217,7 +1217,7 @@ void GeneticAlgorithm::evolve_population(void)
         }
 
         if (zero_ocurrences == population[i].size())
-            population[i][rand()%population[i].size()] = true;
+            population[i][calculate_random_index(population[i].size())] = true;
     }
 
 }
@@ -1407,13 +1407,13 @@ void GeneticAlgorithm::perform_1point_crossover(void)
 
     while(population.size() < population_size)
     {
-        parent1_index = rand()%selected_population;
-        parent2_index = rand()%selected_population;
+        parent1_index = calculate_random_index(selected_population);
+        parent2_index = calculate_random_index(selected_population);
 
         random_loops = 0;
         while(parent1_index == parent2_index)
         {
-            parent2_index = rand()%selected_population;
+            parent2_index = calculate_random_index(selected_population);
             random_loops++;
 
             if (random_loops == 5 && parent1_index != selected_population-1)
@@ -1426,7 +1426,7 @@ void GeneticAlgorithm::perform_1point_crossover(void)
         parent2 = population[parent2_index];
 
         if (crossover_first_point == 0)
-            first_point = 1 + rand()%(inputs_number-1);
+            first_point = 1 + calculate_random_index(inputs_number-1);
 
         for (size_t i = 0; i < inputs_number; i++)
         {
@@ -1471,13 +1471,13 @@ void GeneticAlgorithm::perform_2point_crossover(void)
 
     while(population.size() < population_size)
     {
-        parent1_index = rand()%selected_population;
-        parent2_index = rand()%selected_population;
+        parent1_index = calculate_random_index(selected_population);
+        parent2_index = calculate_random_index(selected_population);
 
         random_loops = 0;
         while(parent1_index == parent2_index)
         {
-            parent2_index = rand()%selected_population;
+            parent2_index = calculate_random_index(selected_population);
             random_loops++;
 
             if (random_loops == 5 && parent1_index != selected_population-1)
@@ -1490,10 +1490,10 @@ void GeneticAlgorithm::perform_2point_crossover(void)
         parent2 = population[parent2_index];
 
         if (crossover_first_point == 0)
-            first_point = 1 + rand()%(inputs_number-2);
+            first_point = 1 + calculate_random_index(inputs_number-2);
 
         if (crossover_second_point == 0)
-            second_point = first_point + rand()%(inputs_number-1-first_point);
+            second_point = first_point + calculate_random_index(inputs_number-1-first_point);
 
         for (size_t i = 0; i < inputs_number; i++)
         {
@@ -1541,13 +1541,13 @@ void GeneticAlgorithm::perform_uniform_crossover(void)
 
     while(population.size() < population_size)
     {
-        parent1_index = rand()%selected_population;
-        parent2_index = rand()%selected_population;
+        parent1_index = calculate_random_index(selected_population);
+        parent2_index = calculate_random_index(selected_population);
 
         random_loops = 0;
         while(parent1_index == parent2_index)
         {
-            parent2_index = rand()%selected_population;
+            parent2_index = calculate_random_index(selected_population);
             random_loops++;
 
             if (random_loops == 5 && parent1_index != selected_population-1)
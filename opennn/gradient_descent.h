@@ -179,6 +179,7 @@ public:
       std::string stopping_criterion;
 
       void resize_training_history(const size_t&);
+      void arrange_training_history(const size_t&);
 
       std::string to_string(void) const;
 
@@ -2085,7 +2085,7 @@ void IndependentParameters::randomize_parameters_normal(const Vector< Vector<dou
 
 void IndependentParameters::initialize_random(void)
 {
-   const size_t parameters_number = rand()%10 + 1;
+   const size_t parameters_number = calculate_random_index(10) + 1;
 
    set(parameters_number);
 
@@ -2103,7 +2103,7 @@ void IndependentParameters::initialize_random(void)
    standard_deviations.set(parameters_number);
    standard_deviations.randomize_normal();
 
-   switch(rand()%3)
+   switch(calculate_random_index(3))
    {
        case 0:
        {
@@ -2130,7 +2130,7 @@ void IndependentParameters::initialize_random(void)
    upper_bounds.set(parameters_number);
    upper_bounds.randomize_uniform(0.0, 1.0);
 
-   if(rand()%2)
+   if(calculate_random_index(2))
    {
       set_bounding_method(NoBounding);
    }
@@ -2139,7 +2139,7 @@ void IndependentParameters::initialize_random(void)
       set_bounding_method(Bounding);
    }
 
-   if(rand()%2)
+   if(calculate_random_index(2))
    {
       set_display(false);
    }
@@ -2240,15 +2240,19 @@ Vector<double> IndependentParameters::calculate_scaled_parameters(void) const
 }
 
 
-// void unscale_parameters(void) method
+// Vector<double> calculate_unscaled_parameters(const Vector<double>&) const method
 
-/// Postprocesses the independendent parameters according to their scaling and unscaling method.
-/// This form of scaling is used when setting a new vector of parameters.
+/// Returns the independent parameters which correspond to a vector of scaled parameters,
+/// according to their scaling and unscaling method and bounded by their lower and upper bounds.
+/// It does not set those parameters to this object.
+/// @param scaled_parameters Vector of scaled independent parameters.
 
-void IndependentParameters::unscale_parameters(const Vector<double>& scaled_parameters)
+Vector<double> IndependentParameters::calculate_unscaled_parameters(const Vector<double>& scaled_parameters) const
 {
    const size_t parameters_number = get_parameters_number();
 
+   Vector<double> unscaled_parameters(parameters);
+
    switch(scaling_method)   
    {
       case NoScaling:
@@ -2266,16 +2270,16 @@ void IndependentParameters::unscale_parameters(const Vector<double>& scaled_para
                if(display)
                {
                   std::cout << "OpenNN Warning: IndependentParameters class\n"
-                            << "void unscale_parameters(void) method.\n"
+                            << "Vector<double> calculate_unscaled_parameters(const Vector<double>&) const method.\n"
                             << "Standard deviation of parameter " << i << " is zero.\n" 
                             << "That parameter won't be scaled.\n";
                }
                
-               parameters[i] = scaled_parameters[i];
+               unscaled_parameters[i] = scaled_parameters[i];
             }      
             else
             {
-               parameters[i] = means[i] + scaled_parameters[i]*standard_deviations[i]; 
+               unscaled_parameters[i] = means[i] + scaled_parameters[i]*standard_deviations[i]; 
             } 
          }
       }
@@ -2290,16 +2294,16 @@ void IndependentParameters::unscale_parameters(const Vector<double>& scaled_para
                if(display)
                {
                   std::cout << "OpenNN Warning: IndependentParameters class\n"
-                            << "void unscale_parameters(void) method.\n"
+                            << "Vector<double> calculate_unscaled_parameters(const Vector<double>&) const method.\n"
                             << "Maximum and minimum of parameter " << i << " are equal.\n"
                             << "That parameter won't be scaled.\n"; 
                }
                
-               parameters[i] = scaled_parameters[i];
+               unscaled_parameters[i] = scaled_parameters[i];
             }      
             else
             {
-               parameters[i] = 0.5*(scaled_parameters[i] + 1.0)*(maximums[i]-minimums[i]) + minimums[i]; 
+               unscaled_parameters[i] = 0.5*(scaled_parameters[i] + 1.0)*(maximums[i]-minimums[i]) + minimums[i]; 
             }
          }
       }
@@ -2310,7 +2314,7 @@ void IndependentParameters::unscale_parameters(const Vector<double>& scaled_para
          std::ostringstream buffer;
 
          buffer << "OpenNN Exception: IndependentParameters class\n"
-                << "void unscale_parameters(void) method.\n" 
+                << "Vector<double> calculate_unscaled_parameters(const Vector<double>&) const method.\n" 
                 << "Unknown scaling and unscaling method.\n";
 
 	     throw std::logic_error(buffer.str());
@@ -2318,7 +2322,34 @@ void IndependentParameters::unscale_parameters(const Vector<double>& scaled_para
       break;
    }// end switch       
 
-   bound_parameters();
+   const size_t lower_bounds_size = lower_bounds.size();
+   const size_t upper_bounds_size = upper_bounds.size();
+ 
+   if(lower_bounds_size == parameters_number && upper_bounds_size == parameters_number)
+   {
+      unscaled_parameters.apply_lower_upper_bounds(lower_bounds, upper_bounds);
+   }
+   else if(lower_bounds_size == parameters_number)
+   {
+      unscaled_parameters.apply_lower_bound(lower_bounds);   
+   }
+   else if(upper_bounds_size == parameters_number)
+   {
+      unscaled_parameters.apply_upper_bound(upper_bounds);   
+   }
+
+   return(unscaled_parameters);
+}
+
+
+// void unscale_parameters(void) method
+
+/// Postprocesses the independendent parameters according to their scaling and unscaling method.
+/// This form of scaling is used when setting a new vector of parameters.
+
+void IndependentParameters::unscale_parameters(const Vector<double>& scaled_parameters)
+{
+   parameters = calculate_unscaled_parameters(scaled_parameters);
 }
 
 
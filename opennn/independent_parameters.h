@@ -238,6 +238,7 @@ public:
    // Independent parameters
 
    Vector<double> calculate_scaled_parameters(void) const;
+   Vector<double> calculate_unscaled_parameters(const Vector<double>&) const;
    void unscale_parameters(const Vector<double>&);
 
    void bound_parameters(void);
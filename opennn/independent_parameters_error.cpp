@@ -343,11 +343,18 @@ double IndependentParametersError::calculate_performance(void) const
 
    #endif
 
-   // Neural network stuff
+   return(calculate_performance(*neural_network_pointer));
+}
 
-   const IndependentParameters* independent_parameters_pointer = neural_network_pointer->get_independent_parameters_pointer();
 
-   const Vector<double> independent_parameters = independent_parameters_pointer->get_parameters();
+// double calculate_performance(const NeuralNetwork&) const method
+
+/// Returns the independent parameters error of a given neural network. 
+/// @param neural_network Neural network to be evaluated.
+
+double IndependentParametersError::calculate_performance(const NeuralNetwork& neural_network) const
+{
+   const Vector<double> independent_parameters = neural_network.arrange_independent_parameters();
 
    const Vector<double> independent_parameters_error = independent_parameters - target_independent_parameters;
 
@@ -357,7 +364,8 @@ double IndependentParametersError::calculate_performance(void) const
 
 // double calculate_performance(const Vector<double>&) const method
 
-/// @todo
+/// Returns the independent parameters error of the neural network for a given set of parameters. 
+/// @param parameters Vector of potential neural network parameters. 
 
 double IndependentParametersError::calculate_performance(const Vector<double>& parameters) const  
 {
@@ -389,15 +397,9 @@ double IndependentParametersError::calculate_performance(const Vector<double>& p
 
    #endif
 
-   NeuralNetwork neural_network_copy(*neural_network_pointer);
-
-   neural_network_copy.set_parameters(parameters);
-
-   IndependentParametersError independent_parameters_error_copy(*this);
-
-   independent_parameters_error_copy.set_neural_network_pointer(&neural_network_copy);
+   const NeuralNetwork neural_network(*neural_network_pointer, parameters);
 
-   return(independent_parameters_error_copy.calculate_performance());
+   return(calculate_performance(neural_network));
 }
 
 
@@ -97,6 +97,7 @@ public:
 
    double calculate_performance(void) const;   
    double calculate_performance(const Vector<double>&) const;   
+   double calculate_performance(const NeuralNetwork&) const;   
 
    Vector<double> calculate_gradient(void) const;   
    Matrix<double> calculate_Hessian(void) const;   
@@ -1199,6 +1199,12 @@ Vector<double> InputsSelectionAlgorithm::get_final_performances(const TrainingSt
         performances[1] = results.Levenberg_Marquardt_algorithm_results_pointer->final_selection_performance;
         break;
     }
+    case TrainingStrategy::ENSEMBLE_TRAINING:
+    {
+        performances[0] = results.ensemble_training_results_pointer->final_performances[0];
+        performances[1] = results.ensemble_training_results_pointer->final_selection_performances[0];
+        break;
+    }
     case TrainingStrategy::USER_MAIN:
     {
         performances[0] = 0;
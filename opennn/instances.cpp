@@ -67,6 +67,8 @@ Instances::Instances(const Instances& other_instances)
    items = other_instances.items;
 
    display = other_instances.display;
+
+   reset_indices();
 }
 
 
@@ -91,6 +93,8 @@ Instances& Instances::operator=(const Instances& other_instances)
    {
       items = other_instances.items;
       display = other_instances.display;
+
+      reset_indices();
    }
 
    return(*this);
@@ -366,19 +370,7 @@ bool Instances::is_unused(const size_t& i) const
 
 size_t Instances::count_unused_instances_number(void) const
 {
-    const size_t instances_number = get_instances_number();
-
-    size_t unused_instances_number = 0;
-
-    for(size_t i = 0; i < instances_number; i++)
-	{
-       if(items[i].use == Unused)
-	   {
-	      unused_instances_number++;
-	   }
-	}
-
-	return(unused_instances_number);
+    return(get_unused_indices().size());
 }
 
 
@@ -389,10 +381,7 @@ size_t Instances::count_unused_instances_number(void) const
 
 size_t Instances::count_used_instances_number(void) const
 {
-    const size_t instances_number = get_instances_number();
-    const size_t unused_instances_number = count_unused_instances_number();
-
-    return(instances_number - unused_instances_number);
+    return(get_used_indices().size());
 }
 
 
@@ -402,19 +391,7 @@ size_t Instances::count_used_instances_number(void) const
 
 size_t Instances::count_training_instances_number(void) const
 {
-    const size_t instances_number = get_instances_number();
-
-    size_t training_instances_number = 0;
-
-    for(size_t i = 0; i < instances_number; i++)
-	{
-       if(items[i].use == Training)
-	   {
-	      training_instances_number++;
-	   }
-	}
-
-	return(training_instances_number);
+    return(get_training_indices().size());
 }
 
 
@@ -424,19 +401,7 @@ size_t Instances::count_training_instances_number(void) const
 
 size_t Instances::count_selection_instances_number(void) const
 {
-    const size_t instances_number = get_instances_number();
-
-    size_t selection_instances_number = 0;
-
-    for(size_t i = 0; i < instances_number; i++)
-	{
-       if(items[i].use == Selection)
-	   {
-	      selection_instances_number++;
-	   }
-	}
-
-	return(selection_instances_number);
+    return(get_selection_indices().size());
 }
 
 
@@ -446,19 +411,7 @@ size_t Instances::count_selection_instances_number(void) const
 
 size_t Instances::count_testing_instances_number(void) const
 {
-    const size_t instances_number = get_instances_number();
-
-    size_t testing_instances_number = 0;
-
-    for(size_t i = 0; i < instances_number; i++)
-	{
-       if(items[i].use == Testing)
-	   {
-	      testing_instances_number++;
-	   }
-	}
-
-	return(testing_instances_number);
+    return(get_testing_indices().size());
 }
 
 
@@ -470,29 +423,14 @@ size_t Instances::count_testing_instances_number(void) const
 
 Vector<size_t> Instances::count_uses(void) const
 {
-    Vector<size_t> count(4, 0);
+    update_indices();
 
-    const size_t instances_number = get_instances_number();
+    Vector<size_t> count(4);
 
-    for(size_t i = 0; i < instances_number; i++)
-    {
-        if(items[i].use == Training)
-        {
-           count[0]++;
-        }
-        else if(items[i].use == Selection)
-        {
-           count[1]++;
-        }
-        else if(items[i].use == Testing)
-        {
-           count[2]++;
-        }
-        else
-        {
-           count[3]++;
-        }
-    }
+    count[0] = training_indices.size();
+    count[1] = selection_indices.size();
+    count[2] = testing_indices.size();
+    count[3] = unused_indices.size();
 
     return(count);
 }
@@ -504,144 +442,124 @@ Vector<size_t> Instances::count_uses(void) const
 
 Vector<size_t> Instances::arrange_used_indices(void) const
 {
-    const size_t instances_number = get_instances_number();
-
-    const size_t training_instances_number = count_training_instances_number();
-    const size_t selection_instances_number = count_selection_instances_number();
-    const size_t testing_instances_number = count_testing_instances_number();
+    return(get_used_indices());
+}
 
-    Vector<size_t> used_indices(training_instances_number + selection_instances_number + testing_instances_number);
 
-    size_t count = 0;
+// Vector<size_t> arrange_unused_indices(void) const method
 
-    for(size_t i = 0; i < instances_number; i++)
-    {
-        if(items[i].use == Training)
-        {
-            used_indices [count] = (size_t)i;
-            count++;
-        }
-        else if(items[i].use == Selection)
-        {
-            used_indices [count] = (size_t)i;
-            count++;
-        }
-        else if(items[i].use == Testing)
-        {
-            used_indices[count] = (size_t)i;
-            count++;
-        }
-    }
+/// Returns the indices of the instances set unused.
 
-    return(used_indices);
+Vector<size_t> Instances::arrange_unused_indices(void) const
+{
+    return(get_unused_indices());
 }
 
 
-// Vector<size_t> arrange_unused_indices(void) const method
+// Vector<size_t> arrange_training_indices(void) const method
 
-/// Returns the indices of the instances set unused.
+/// Returns the indices of the instances which will be used for training.
 
-Vector<size_t> Instances::arrange_unused_indices(void) const
+Vector<size_t> Instances::arrange_training_indices(void) const
 {
-    const size_t instances_number = get_instances_number();
+    return(get_training_indices());
+}
 
-    const size_t unused_instances_number = count_unused_instances_number();
 
-    Vector<size_t> unused_indices(unused_instances_number);
+// Vector<size_t> arrange_selection_indices(void) const method
 
-    size_t count = 0;
+/// Returns the indices of the instances which will be used for selection.
 
-    for(size_t i = 0; i < instances_number; i++)
-    {
-        if(items[i].use == Unused)
-        {
-            unused_indices[count] = (size_t)i;
-            count++;
-        }
-    }
+Vector<size_t> Instances::arrange_selection_indices(void) const
+{
+    return(get_selection_indices());
+}
 
-    return(unused_indices);
+
+// Vector<size_t> arrange_testing_indices(void) const method
+
+/// Returns the indices of the instances which will be used for testing.
+
+Vector<size_t> Instances::arrange_testing_indices(void) const
+{
+    return(get_testing_indices());
 }
 
 
-// Vector<size_t> arrange_training_indices(void) const method
+// const Vector<size_t>& get_used_indices(void) const method
 
-/// Returns the indices of the instances which will be used for training.
+/// Returns a reference to the indices of the used instances.
+/// The indices are only computed again when the uses of the instances change.
 
-Vector<size_t> Instances::arrange_training_indices(void) const
+const Vector<size_t>& Instances::get_used_indices(void) const
 {
-   const size_t instances_number = get_instances_number();
+    update_indices();
 
-   const size_t training_instances_number = count_training_instances_number();
+    return(used_indices);
+}
 
-   Vector<size_t> training_indices(training_instances_number);
 
-   size_t count = 0;
+// const Vector<size_t>& get_unused_indices(void) const method
 
-   for(size_t i = 0; i < instances_number; i++)
-   {
-      if(items[i].use == Training)
-	  {
-         training_indices[count] = (size_t)i;
-		 count++;
-	  }
-   }
+/// Returns a reference to the indices of the unused instances.
+/// The indices are only computed again when the uses of the instances change.
 
-   return(training_indices);
+const Vector<size_t>& Instances::get_unused_indices(void) const
+{
+    update_indices();
+
+    return(unused_indices);
 }
 
 
-// Vector<size_t> arrange_selection_indices(void) const method
+// const Vector<size_t>& get_training_indices(void) const method
 
-/// Returns the indices of the instances which will be used for selection.
+/// Returns a reference to the indices of the training instances.
+/// The indices are only computed again when the uses of the instances change.
 
-Vector<size_t> Instances::arrange_selection_indices(void) const
+const Vector<size_t>& Instances::get_training_indices(void) const
 {
-   const size_t instances_number = get_instances_number();
+    update_indices();
 
-   const size_t selection_instances_number = count_selection_instances_number();
+    return(training_indices);
+}
 
-   Vector<size_t> selection_indices(selection_instances_number);
 
-   size_t count = 0;
+// const Vector<size_t>& get_selection_indices(void) const method
 
-   for(size_t i = 0; i < instances_number; i++)
-   {
-      if(items[i].use == Selection)
-	  {
-	     selection_indices[count] = i;
-		 count++;
-	  }
-   }
+/// Returns a reference to the indices of the selection instances.
+/// The indices are only computed again when the uses of the instances change.
 
-   return(selection_indices);
+const Vector<size_t>& Instances::get_selection_indices(void) const
+{
+    update_indices();
+
+    return(selection_indices);
 }
 
 
-// Vector<size_t> arrange_testing_indices(void) const method
+// const Vector<size_t>& get_testing_indices(void) const method
 
-/// Returns the indices of the instances which will be used for testing.
+/// Returns a reference to the indices of the testing instances.
+/// The indices are only computed again when the uses of the instances change.
 
-Vector<size_t> Instances::arrange_testing_indices(void) const
+const Vector<size_t>& Instances::get_testing_indices(void) const
 {
-   const size_t instances_number = get_instances_number();
+    update_indices();
 
-   const size_t testing_instances_number = count_testing_instances_number();
+    return(testing_indices);
+}
 
-   Vector<size_t> testing_indices(testing_instances_number);
 
-   size_t count = 0;
+// const size_t& get_generation(void) const method
 
-   for(size_t i = 0; i < instances_number; i++)
-   {
-      if(items[i].use == Testing)
-	  {
-	     testing_indices[count] = i;
-		 count++;
-	  }
-   }
+/// Returns a number which changes every time that the uses of the instances change. 
+/// Objects which keep data derived from the instances uses can compare it with the generation at the time they computed that data,
+/// to know when it must be computed again.
 
-   return(testing_indices);
+const size_t& Instances::get_generation(void) const
+{
+    return(generation);
 }
 
 
@@ -689,6 +607,8 @@ void Instances::set(const size_t& new_instances_number)
 
 void Instances::set(const tinyxml2::XMLDocument& instances_document)
 {
+    reset_indices();
+
     set_default();
 
    from_XML(instances_document);
@@ -741,6 +661,8 @@ void Instances::set_uses(const Vector<Instances::Use>& new_uses)
    {
        items[i].use = new_uses[i];
    }
+
+    reset_indices();
 }
 
 
@@ -800,7 +722,9 @@ void Instances::set_uses(const Vector<std::string>& new_uses)
  
 	     throw std::logic_error(buffer.str());
 	  }
-   }   
+   }
+
+    reset_indices();
 }
 
 
@@ -813,6 +737,8 @@ void Instances::set_uses(const Vector<std::string>& new_uses)
 void Instances::set_use(const size_t& i, const Use& new_use)
 {
     items[i].use = new_use;
+
+    reset_indices();
 }
 
 
@@ -850,6 +776,8 @@ void Instances::set_use(const size_t& i, const std::string& new_use)
 
        throw std::logic_error(buffer.str());
     }
+
+    reset_indices();
 }
 
 
@@ -867,6 +795,8 @@ void Instances::set_unused(const Vector<size_t> & indices)
 
         items[index].use = Unused;
     }
+
+    reset_indices();
 }
 
 
@@ -882,6 +812,8 @@ void Instances::set_training(void)
    {
        items[i].use = Training;
    }
+
+   reset_indices();
 }
 
 
@@ -897,6 +829,8 @@ void Instances::set_selection(void)
     {
         items[i].use = Selection;
     }
+
+    reset_indices();
 }
 
 
@@ -912,6 +846,8 @@ void Instances::set_testing(void)
     {
         items[i].use = Testing;
     }
+
+    reset_indices();
 }
 
 
@@ -938,6 +874,8 @@ void Instances::set_instances_number(const size_t& new_instances_number)
 {
    items.set(new_instances_number);
 
+   reset_indices();
+
    split_instances();
 }
 
@@ -1145,7 +1083,7 @@ void Instances::split_random_indices
    const size_t instances_number = get_instances_number();
 
    Vector<size_t> indices(0, 1, instances_number-1);
-   std::random_shuffle(indices.begin(), indices.end());
+   std::shuffle(indices.begin(), indices.end(), get_random_engine());
 
    size_t i = 0;
    size_t index;
@@ -1200,6 +1138,8 @@ void Instances::split_random_indices
 
       i++;
    }
+
+   reset_indices();
 }
 
 
@@ -1286,6 +1226,8 @@ void Instances::split_sequential_indices(const double& training_instances_ratio,
 
       i++;
    }
+
+   reset_indices();
 }
 
 
@@ -1421,6 +1363,79 @@ void Instances::convert_time_series(const size_t& lags_number)
 }
 
 
+// void update_indices(void) const method
+
+/// Computes again the cached indices of the used, unused, training, selection and testing instances,
+/// if the uses of the instances have changed since they were last computed.
+/// It can be called from several threads at the same time.
+/// Once the indices are built, the flag is read without taking the lock, as in DataSet::update_blocks.
+
+void Instances::update_indices(void) const
+{
+    if(indices_updated.load(std::memory_order_acquire))
+    {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(indices_mutex);
+
+    if(indices_updated.load(std::memory_order_relaxed))
+    {
+        return;
+    }
+
+    const size_t instances_number = get_instances_number();
+
+    used_indices.clear();
+    unused_indices.clear();
+    training_indices.clear();
+    selection_indices.clear();
+    testing_indices.clear();
+
+    for(size_t i = 0; i < instances_number; i++)
+    {
+        if(items[i].use == Training)
+        {
+            training_indices.push_back(i);
+            used_indices.push_back(i);
+        }
+        else if(items[i].use == Selection)
+        {
+            selection_indices.push_back(i);
+            used_indices.push_back(i);
+        }
+        else if(items[i].use == Testing)
+        {
+            testing_indices.push_back(i);
+            used_indices.push_back(i);
+        }
+        else
+        {
+            unused_indices.push_back(i);
+        }
+    }
+
+    indices_updated.store(true, std::memory_order_release);
+}
+
+
+// void reset_indices(void) method
+
+/// Marks the cached indices as out of date and moves to a new generation.
+/// It must be called by every method which modifies the uses of the instances.
+
+void Instances::reset_indices(void)
+{
+    static std::atomic<size_t> generations_number(0);
+
+    std::lock_guard<std::mutex> lock(indices_mutex);
+
+    generation = ++generations_number;
+
+    indices_updated = false;
+}
+
+
 // std::string to_string(void) const method
 
 /// Returns a string representation of the current instances object. 
@@ -26,6 +26,8 @@
 #include <stdexcept>
 #include <ctime>
 #include <exception>
+#include <atomic>
+#include <mutex>
 
 // OpenNN includes
 
@@ -164,6 +166,14 @@ public:
    Vector<size_t> arrange_selection_indices(void) const;
    Vector<size_t> arrange_testing_indices(void) const;
 
+   const Vector<size_t>& get_used_indices(void) const;
+   const Vector<size_t>& get_unused_indices(void) const;
+   const Vector<size_t>& get_training_indices(void) const;
+   const Vector<size_t>& get_selection_indices(void) const;
+   const Vector<size_t>& get_testing_indices(void) const;
+
+   const size_t& get_generation(void) const;
+
    const bool& get_display(void) const;
 
    // Set methods
@@ -216,6 +226,9 @@ public:
 
 private:
 
+   void update_indices(void) const;
+   void reset_indices(void);
+
    // MEMBERS
 
    /// Uses of instances (none, training, selection or testing).
@@ -225,6 +238,41 @@ private:
    /// Display messages to screen.
    
    bool display;
+
+   // INDICES
+
+   /// Number which changes every time that the uses of the instances change.
+   /// Objects which keep data derived from the uses compare it to know when that data is out of date.
+
+   size_t generation;
+
+   /// True if the cached indices correspond to the current uses of the instances.
+
+   mutable std::atomic<bool> indices_updated;
+
+   /// Cached indices of the used instances.
+
+   mutable Vector<size_t> used_indices;
+
+   /// Cached indices of the unused instances.
+
+   mutable Vector<size_t> unused_indices;
+
+   /// Cached indices of the training instances.
+
+   mutable Vector<size_t> training_indices;
+
+   /// Cached indices of the selection instances.
+
+   mutable Vector<size_t> selection_indices;
+
+   /// Cached indices of the testing instances.
+
+   mutable Vector<size_t> testing_indices;
+
+   /// Lock for building the cached indices from concurrent const methods.
+
+   mutable std::mutex indices_mutex;
 };
 
 }
@@ -0,0 +1,296 @@
+/****************************************************************************************************************/
+/*                                                                                                              */
+/*   OpenNN: Open Neural Networks Library                                                                       */
+/*   www.opennn.net                                                                                             */
+/*                                                                                                              */
+/*   I N S T R U M E N T A T I O N   C L A S S                                                                  */
+/*                                                                                                              */
+/*   Roberto Lopez                                                                                              */
+/*   Artelnics - Making intelligent use of data                                                                 */
+/*   robertolopez@artelnics.com                                                                                 */
+/*                                                                                                              */
+/****************************************************************************************************************/
+
+// OpenNN includes
+
+#include "instrumentation.h"
+
+namespace OpenNN
+{
+
+// bool is_enabled(void) method
+
+/// Returns true if the library has been compiled with the hot paths instrumented, and false otherwise.
+
+bool Instrumentation::is_enabled(void)
+{
+   #ifdef __OPENNN_INSTRUMENTATION__
+
+   return(true);
+
+   #else
+
+   return(false);
+
+   #endif
+}
+
+
+// Entry& get_entry(const std::string&) method
+
+/// Returns the entry with a given name, which is created if it does not exist.
+/// Entries are never destroyed, so the returned reference can be kept by the caller.
+/// @param name Name of the timer or counter.
+
+Instrumentation::Entry& Instrumentation::get_entry(const std::string& name)
+{
+   std::lock_guard<std::mutex> lock(get_entries_mutex());
+
+   std::map<std::string, Entry>& entries = get_entries();
+
+   std::map<std::string, Entry>::iterator iterator = entries.find(name);
+
+   if(iterator == entries.end())
+   {
+      iterator = entries.emplace(std::piecewise_construct, std::forward_as_tuple(name), std::forward_as_tuple(name)).first;
+   }
+
+   return(iterator->second);
+}
+
+
+// Vector<Record> get_records(void) method
+
+/// Returns a snapshot of all the entries, sorted by name.
+
+Vector<Instrumentation::Record> Instrumentation::get_records(void)
+{
+   std::lock_guard<std::mutex> lock(get_entries_mutex());
+
+   const std::map<std::string, Entry>& entries = get_entries();
+
+   Vector<Record> records;
+
+   records.reserve(entries.size());
+
+   for(std::map<std::string, Entry>::const_iterator iterator = entries.begin(); iterator != entries.end(); ++iterator)
+   {
+      Record record;
+
+      record.name = iterator->first;
+      record.calls = (size_t)iterator->second.calls.load();
+      record.time = (double)iterator->second.nanoseconds.load()*1.0e-9;
+      record.count = (size_t)iterator->second.count.load();
+
+      records.push_back(record);
+   }
+
+   return(records);
+}
+
+
+// Vector<Record> calculate_records_difference(const Vector<Record>&, const Vector<Record>&) method
+
+/// Returns the measures accumulated between two snapshots of the entries, such as the beginning and the end of a training process.
+/// Entries which have not changed are not included.
+/// If the entries were reset between both snapshots, the measures which would be negative are set to zero.
+/// @param records Later snapshot of the entries.
+/// @param beginning_records Earlier snapshot of the entries.
+
+Vector<Instrumentation::Record> Instrumentation::calculate_records_difference(const Vector<Record>& records, const Vector<Record>& beginning_records)
+{
+   Vector<Record> difference;
+
+   size_t j = 0;
+
+   for(size_t i = 0; i < records.size(); i++)
+   {
+      Record record = records[i];
+
+      while(j < beginning_records.size() && beginning_records[j].name < record.name)
+      {
+         j++;
+      }
+
+      if(j < beginning_records.size() && beginning_records[j].name == record.name)
+      {
+         record.calls = record.calls > beginning_records[j].calls ? record.calls - beginning_records[j].calls : 0;
+         record.time = record.time > beginning_records[j].time ? record.time - beginning_records[j].time : 0.0;
+         record.count = record.count > beginning_records[j].count ? record.count - beginning_records[j].count : 0;
+      }
+
+      if(record.calls != 0 || record.count != 0)
+      {
+         difference.push_back(record);
+      }
+   }
+
+   return(difference);
+}
+
+
+// void reset(void) method
+
+/// Sets the measures of all the entries to zero.
+
+void Instrumentation::reset(void)
+{
+   std::lock_guard<std::mutex> lock(get_entries_mutex());
+
+   std::map<std::string, Entry>& entries = get_entries();
+
+   for(std::map<std::string, Entry>::iterator iterator = entries.begin(); iterator != entries.end(); ++iterator)
+   {
+      iterator->second.calls = 0;
+      iterator->second.nanoseconds = 0;
+      iterator->second.count = 0;
+   }
+}
+
+
+// std::string to_JSON(const Vector<Record>&) method
+
+/// Returns a JSON array with the given records.
+/// Each record is an object with the name, calls, time (in seconds) and count fields.
+/// @param records Records to be exported.
+
+std::string Instrumentation::to_JSON(const Vector<Record>& records)
+{
+   std::ostringstream buffer;
+
+   buffer << "[";
+
+   for(size_t i = 0; i < records.size(); i++)
+   {
+      buffer << (i == 0 ? "\n" : ",\n")
+             << "  {\"name\": \"" << records[i].name << "\", "
+             << "\"calls\": " << records[i].calls << ", "
+             << "\"time\": " << records[i].time << ", "
+             << "\"count\": " << records[i].count << "}";
+   }
+
+   buffer << "\n]\n";
+
+   return(buffer.str());
+}
+
+
+// std::string to_CSV(const Vector<Record>&) method
+
+/// Returns a comma separated values table with the given records, with a header row.
+/// @param records Records to be exported.
+
+std::string Instrumentation::to_CSV(const Vector<Record>& records)
+{
+   std::ostringstream buffer;
+
+   buffer << "name,calls,time,count\n";
+
+   for(size_t i = 0; i < records.size(); i++)
+   {
+      buffer << records[i].name << ","
+             << records[i].calls << ","
+             << records[i].time << ","
+             << records[i].count << "\n";
+   }
+
+   return(buffer.str());
+}
+
+
+// void save_JSON(const Vector<Record>&, const std::string&) method
+
+/// Saves the given records to a JSON file.
+/// @param records Records to be saved.
+/// @param file_name Name of the JSON file.
+
+void Instrumentation::save_JSON(const Vector<Record>& records, const std::string& file_name)
+{
+   std::ofstream file(file_name.c_str());
+
+   if(!file.is_open())
+   {
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: Instrumentation class.\n"
+             << "static void save_JSON(const Vector<Record>&, const std::string&) method.\n"
+             << "Cannot open instrumentation file: " << file_name << "\n";
+
+      throw std::logic_error(buffer.str());
+   }
+
+   file << to_JSON(records);
+
+   file.close();
+}
+
+
+// void save_CSV(const Vector<Record>&, const std::string&) method
+
+/// Saves the given records to a comma separated values file.
+/// @param records Records to be saved.
+/// @param file_name Name of the CSV file.
+
+void Instrumentation::save_CSV(const Vector<Record>& records, const std::string& file_name)
+{
+   std::ofstream file(file_name.c_str());
+
+   if(!file.is_open())
+   {
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: Instrumentation class.\n"
+             << "static void save_CSV(const Vector<Record>&, const std::string&) method.\n"
+             << "Cannot open instrumentation file: " << file_name << "\n";
+
+      throw std::logic_error(buffer.str());
+   }
+
+   file << to_CSV(records);
+
+   file.close();
+}
+
+
+// std::mutex& get_entries_mutex(void) method
+
+/// Returns the mutex which guards the creation and the snapshots of the entries.
+
+std::mutex& Instrumentation::get_entries_mutex(void)
+{
+   static std::mutex entries_mutex;
+
+   return(entries_mutex);
+}
+
+
+// std::map<std::string, Entry>& get_entries(void) method
+
+/// Returns the map of all the entries by name.
+
+std::map<std::string, Instrumentation::Entry>& Instrumentation::get_entries(void)
+{
+   static std::map<std::string, Entry> entries;
+
+   return(entries);
+}
+
+}
+
+
+// OpenNN: Open Neural Networks Library.
+// Copyright (c) 2005-2016 Roberto Lopez.
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
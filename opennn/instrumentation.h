@@ -0,0 +1,234 @@
+/****************************************************************************************************************/
+/*                                                                                                              */
+/*   OpenNN: Open Neural Networks Library                                                                       */
+/*   www.opennn.net                                                                                             */
+/*                                                                                                              */
+/*   I N S T R U M E N T A T I O N   C L A S S   H E A D E R                                                    */
+/*                                                                                                              */
+/*   Roberto Lopez                                                                                              */
+/*   Artelnics - Making intelligent use of data                                                                 */
+/*   robertolopez@artelnics.com                                                                                 */
+/*                                                                                                              */
+/****************************************************************************************************************/
+
+#ifndef __INSTRUMENTATION_H__
+#define __INSTRUMENTATION_H__
+
+// System includes
+
+#include <string>
+#include <sstream>
+#include <iostream>
+#include <fstream>
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <tuple>
+#include <stdexcept>
+
+// OpenNN includes
+
+#include "vector.h"
+
+namespace OpenNN
+{
+
+///
+/// This class gathers the timers and counters placed in the training and evaluation hot paths of OpenNN.
+/// Each timer or counter is an entry identified by its name, which accumulates the number of calls,
+/// the time spent in them and a free count (instances processed, floating point operations...).
+/// The hot paths are only instrumented when the library is compiled with __OPENNN_INSTRUMENTATION__ defined,
+/// through the OPENNN_SCOPED_TIMER and OPENNN_COUNT macros. Otherwise these macros expand to nothing.
+///
+
+class Instrumentation
+{
+
+public:
+
+   // STRUCTURES
+
+   ///
+   /// This structure accumulates the measures of a timer or counter.
+   /// All its members can be updated concurrently.
+   ///
+
+   struct Entry
+   {
+      /// Name constructor.
+
+      explicit Entry(const std::string& new_name)
+       : name(new_name), calls(0), nanoseconds(0), count(0)
+      {
+      }
+
+      /// Name of the timer or counter.
+
+      const std::string name;
+
+      /// Number of times the timed scope has been executed.
+
+      std::atomic<unsigned long long> calls;
+
+      /// Total time spent in the timed scope, in nanoseconds.
+
+      std::atomic<unsigned long long> nanoseconds;
+
+      /// Free count associated to the entry.
+
+      std::atomic<unsigned long long> count;
+   };
+
+
+   ///
+   /// This structure is a snapshot of an entry, which can be copied, compared and exported.
+   ///
+
+   struct Record
+   {
+      /// Default constructor.
+
+      Record(void) : calls(0), time(0.0), count(0)
+      {
+      }
+
+      /// Name of the timer or counter.
+
+      std::string name;
+
+      /// Number of times the timed scope has been executed.
+
+      size_t calls;
+
+      /// Total time spent in the timed scope, in seconds.
+
+      double time;
+
+      /// Free count associated to the entry.
+
+      size_t count;
+   };
+
+
+   ///
+   /// This class adds the time elapsed between its construction and its destruction to an entry.
+   ///
+
+   class ScopedTimer
+   {
+
+   public:
+
+      /// Entry constructor. It starts timing.
+
+      explicit ScopedTimer(Entry& new_entry)
+       : entry(new_entry), beginning_time(std::chrono::steady_clock::now())
+      {
+      }
+
+      /// Destructor. It adds the elapsed time and one call to the entry.
+
+      ~ScopedTimer(void)
+      {
+         const std::chrono::steady_clock::duration elapsed_time = std::chrono::steady_clock::now() - beginning_time;
+
+         entry.nanoseconds += (unsigned long long)std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed_time).count();
+         entry.calls++;
+      }
+
+   private:
+
+      ScopedTimer(const ScopedTimer&);
+
+      ScopedTimer& operator = (const ScopedTimer&);
+
+      /// Entry to which the elapsed time is added.
+
+      Entry& entry;
+
+      /// Time at which the timer was constructed.
+
+      const std::chrono::steady_clock::time_point beginning_time;
+   };
+
+
+   // METHODS
+
+   static bool is_enabled(void);
+
+   static Entry& get_entry(const std::string&);
+
+   static Vector<Record> get_records(void);
+
+   static Vector<Record> calculate_records_difference(const Vector<Record>&, const Vector<Record>&);
+
+   static void reset(void);
+
+   // Serialization methods
+
+   static std::string to_JSON(const Vector<Record>&);
+   static std::string to_CSV(const Vector<Record>&);
+
+   static void save_JSON(const Vector<Record>&, const std::string&);
+   static void save_CSV(const Vector<Record>&, const std::string&);
+
+private:
+
+   static std::mutex& get_entries_mutex(void);
+
+   static std::map<std::string, Entry>& get_entries(void);
+};
+
+}
+
+
+// Instrumentation macros
+
+#ifdef __OPENNN_INSTRUMENTATION__
+
+#define OPENNN_INSTRUMENTATION_CONCATENATE_NAMES(a, b) a##b
+#define OPENNN_INSTRUMENTATION_NAME(a, b) OPENNN_INSTRUMENTATION_CONCATENATE_NAMES(a, b)
+
+/// Times the rest of the enclosing scope into the entry with the given name.
+/// The entry is looked up only the first time the scope is executed.
+
+#define OPENNN_SCOPED_TIMER(name) \
+   static OpenNN::Instrumentation::Entry& OPENNN_INSTRUMENTATION_NAME(instrumentation_entry_, __LINE__) = OpenNN::Instrumentation::get_entry(name); \
+   const OpenNN::Instrumentation::ScopedTimer OPENNN_INSTRUMENTATION_NAME(instrumentation_timer_, __LINE__)(OPENNN_INSTRUMENTATION_NAME(instrumentation_entry_, __LINE__))
+
+/// Adds an amount to the count of the entry with the given name.
+
+#define OPENNN_COUNT(name, amount) \
+   do \
+   { \
+      static OpenNN::Instrumentation::Entry& instrumentation_entry = OpenNN::Instrumentation::get_entry(name); \
+      instrumentation_entry.count += (unsigned long long)(amount); \
+   } while(0)
+
+#else
+
+#define OPENNN_SCOPED_TIMER(name)
+#define OPENNN_COUNT(name, amount) do {} while(0)
+
+#endif
+
+#endif
+
+
+// OpenNN: Open Neural Networks Library.
+// Copyright (c) 2005-2016 Roberto Lopez.
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
@@ -288,6 +288,17 @@ double InverseSumSquaredError::calculate_performance(void) const
 
    #endif
 
+   return(calculate_performance(*neural_network_pointer));
+}
+
+
+// double calculate_performance(const NeuralNetwork&) const method
+
+/// Returns the inverse sum squared error of a given neural network on the training instances. 
+/// @param neural_network Neural network to be evaluated.
+
+double InverseSumSquaredError::calculate_performance(const NeuralNetwork& neural_network) const
+{
    // Data set stuff
 
    const Matrix<double> training_input_data = data_set_pointer->arrange_training_input_data();
@@ -297,7 +308,7 @@ double InverseSumSquaredError::calculate_performance(void) const
 
    // Mathematical model stuff 
 
-   const Matrix<double> training_solution_data = mathematical_model_pointer->calculate_dependent_variables(*neural_network_pointer, training_input_data);
+   const Matrix<double> training_solution_data = mathematical_model_pointer->calculate_dependent_variables(neural_network, training_input_data);
 
    return(training_solution_data.calculate_sum_squared_error(training_target_data)/(double)training_instances_number);
 }
@@ -334,15 +345,9 @@ double InverseSumSquaredError::calculate_performance(const Vector<double>& poten
 
    #endif
 
-   NeuralNetwork neural_network_copy(*neural_network_pointer);
-
-   neural_network_copy.set_parameters(potential_parameters);
+   const NeuralNetwork neural_network(*neural_network_pointer, potential_parameters);
 
-   InverseSumSquaredError inverse_sum_squared_error_copy(*this);
-
-   inverse_sum_squared_error_copy.set_neural_network_pointer(&neural_network_copy);
-
-   return(inverse_sum_squared_error_copy.calculate_performance());
+   return(calculate_performance(neural_network));
 }
 
 
@@ -373,15 +378,6 @@ double InverseSumSquaredError::calculate_selection_performance(void) const
 
    const size_t selection_instances_number = instances.count_selection_instances_number();
 
-   const Vector<size_t> selection_indices = instances.arrange_selection_indices();
-
-   size_t selection_index;
-
-   const Variables& variables = data_set_pointer->get_variables();
-
-   const Vector<size_t> inputs_indices = variables.arrange_inputs_indices();
-   const Vector<size_t> targets_indices = variables.arrange_targets_indices();
-
    // Performance functional
 
    Vector<double> inputs(inputs_number);
@@ -392,15 +388,13 @@ double InverseSumSquaredError::calculate_selection_performance(void) const
 
    int i = 0;
 
-   #pragma omp parallel for private(i, selection_index, inputs, outputs, targets) reduction(+ : selection_objective)
+   #pragma omp parallel for private(i, inputs, outputs, targets) reduction(+ : selection_objective)
 
    for(i = 0; i < (int)selection_instances_number; i++)
    {
-       selection_index = selection_indices[i];
-
       // Input vector
 
-      inputs = data_set_pointer->get_instance(selection_index, inputs_indices);
+      data_set_pointer->get_selection_inputs(i, inputs);
 
       // Output vector
 
@@ -408,7 +402,7 @@ double InverseSumSquaredError::calculate_selection_performance(void) const
 
       // Target vector
 
-      targets = data_set_pointer->get_instance(selection_index, targets_indices);
+      data_set_pointer->get_selection_targets(i, targets);
 
       // Sum of squares error
 
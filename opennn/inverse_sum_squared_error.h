@@ -91,6 +91,7 @@ public:
 
    double calculate_performance(void) const;   
    double calculate_performance(const Vector<double>&) const;
+   double calculate_performance(const NeuralNetwork&) const;
    double calculate_selection_performance(void) const;
 
    std::string write_performance_term_type(void) const;
@@ -1015,7 +1015,7 @@ Vector<double> LevenbergMarquardtAlgorithm
 
    #endif
 
-   return(terms_Jacobian.calculate_transpose().dot(terms)*2.0);
+   return(terms_Jacobian.transpose_dot(terms)*2.0);
 }
 
 
@@ -1050,7 +1050,7 @@ Matrix<double> LevenbergMarquardtAlgorithm::calculate_Hessian_approximation(cons
 
    #endif
 
-   return((terms_Jacobian.calculate_transpose().dot(terms_Jacobian)*2.0).sum_diagonal(damping_parameter));
+   return((terms_Jacobian.calculate_rank_k_update()*2.0).sum_diagonal(damping_parameter));
 }
 
 
@@ -1125,6 +1125,78 @@ void LevenbergMarquardtAlgorithm::LevenbergMarquardtAlgorithmResults::resize_tra
 }
 
 
+// void arrange_training_history(const size_t&) method
+
+/// Sorts the reserved training history variables in chronological order and removes their unused records,
+/// once the training process has finished.
+/// @param iteration Last iteration of the training process.
+
+void LevenbergMarquardtAlgorithm::LevenbergMarquardtAlgorithmResults::arrange_training_history(const size_t& iteration)
+{
+    // Control sentence (if debug)
+
+    #ifdef __OPENNN_DEBUG__
+
+    if(Levenberg_Marquardt_algorithm_pointer == NULL)
+    {
+       std::ostringstream buffer;
+
+       buffer << "OpenNN Exception: LevenbergMarquardtAlgorithmResults structure.\n"
+              << "void arrange_training_history(const size_t&) method.\n"
+              << "Levenberg-Marquardt algorithm pointer is NULL.\n";
+
+       throw std::logic_error(buffer.str());
+    }
+
+    #endif
+
+    if(Levenberg_Marquardt_algorithm_pointer->get_reserve_parameters_history())
+    {
+        Levenberg_Marquardt_algorithm_pointer->arrange_history(parameters_history, iteration);
+    }
+
+    if(Levenberg_Marquardt_algorithm_pointer->get_reserve_parameters_norm_history())
+    {
+        Levenberg_Marquardt_algorithm_pointer->arrange_history(parameters_norm_history, iteration);
+    }
+
+    if(Levenberg_Marquardt_algorithm_pointer->get_reserve_performance_history())
+    {
+        Levenberg_Marquardt_algorithm_pointer->arrange_history(performance_history, iteration);
+    }
+
+    if(Levenberg_Marquardt_algorithm_pointer->get_reserve_selection_performance_history())
+    {
+        Levenberg_Marquardt_algorithm_pointer->arrange_history(selection_performance_history, iteration);
+    }
+
+    if(Levenberg_Marquardt_algorithm_pointer->get_reserve_gradient_history())
+    {
+        Levenberg_Marquardt_algorithm_pointer->arrange_history(gradient_history, iteration);
+    }
+
+    if(Levenberg_Marquardt_algorithm_pointer->get_reserve_gradient_norm_history())
+    {
+        Levenberg_Marquardt_algorithm_pointer->arrange_history(gradient_norm_history, iteration);
+    }
+
+    if(Levenberg_Marquardt_algorithm_pointer->get_reserve_Hessian_approximation_history())
+    {
+        Levenberg_Marquardt_algorithm_pointer->arrange_history(Hessian_approximation_history, iteration);
+    }
+
+    if(Levenberg_Marquardt_algorithm_pointer->get_reserve_damping_parameter_history())
+    {
+        Levenberg_Marquardt_algorithm_pointer->arrange_history(damping_parameter_history, iteration);
+    }
+
+    if(Levenberg_Marquardt_algorithm_pointer->get_reserve_elapsed_time_history())
+    {
+        Levenberg_Marquardt_algorithm_pointer->arrange_history(elapsed_time_history, iteration);
+    }
+}
+
+
 // std::string to_string(void) const method
 
 /// Returns a string representation of the current Levenberg-Marquardt algorithm results structure. 
@@ -1324,7 +1396,9 @@ LevenbergMarquardtAlgorithm::LevenbergMarquardtAlgorithmResults* LevenbergMarqua
 
    LevenbergMarquardtAlgorithmResults* results_pointer = new LevenbergMarquardtAlgorithmResults(this);
 
-   results_pointer->resize_training_history(1+maximum_iterations_number);
+   results_pointer->resize_training_history(calculate_history_size(1+maximum_iterations_number));
+
+   open_history_file();
 
    // Neural network stuff
 
@@ -1377,9 +1451,38 @@ LevenbergMarquardtAlgorithm::LevenbergMarquardtAlgorithmResults* LevenbergMarqua
    time(&beginning_time);
    double elapsed_time;
 
+   // Resume from checkpoint
+
+   size_t first_iteration = 0;
+   double initial_elapsed_time = 0.0;
+
+   if(resume_checkpoint_pointer)
+   {
+      check_resume_checkpoint(1, Vector<size_t>());
+
+      first_iteration = resume_checkpoint_pointer->iteration;
+      initial_elapsed_time = resume_checkpoint_pointer->elapsed_time;
+
+      selection_failures = resume_checkpoint_pointer->selection_failures;
+      old_performance = resume_checkpoint_pointer->old_performance;
+      old_selection_performance = resume_checkpoint_pointer->old_selection_performance;
+
+      set_damping_parameter(resume_checkpoint_pointer->scalars[0]);
+
+      parameters = resume_checkpoint_pointer->parameters;
+
+      neural_network_pointer->set_parameters(parameters);
+   }
+
+   history_first_iteration = first_iteration;
+
+   TrainingCheckpoint checkpoint;
+
+   checkpoint.training_algorithm_type = write_training_algorithm_type();
+
    // Main loop
 
-   for(size_t iteration = 0; iteration <= maximum_iterations_number; iteration++)
+   for(size_t iteration = first_iteration; iteration <= maximum_iterations_number; iteration++)
    {
       // Neural network
 
@@ -1407,7 +1510,7 @@ LevenbergMarquardtAlgorithm::LevenbergMarquardtAlgorithmResults* LevenbergMarqua
          std::cout << "OpenNN Warning: Gradient norm is " << gradient_norm << "." << std::endl;          
       }
 
-      JacobianT_dot_Jacobian = terms_Jacobian.calculate_transpose().dot(terms_Jacobian);
+      JacobianT_dot_Jacobian = terms_Jacobian.calculate_rank_k_update();
 
       do
       {
@@ -1454,57 +1557,57 @@ LevenbergMarquardtAlgorithm::LevenbergMarquardtAlgorithmResults* LevenbergMarqua
       // Elapsed time
 
       time(&current_time);
-      elapsed_time = difftime(current_time, beginning_time);
+      elapsed_time = difftime(current_time, beginning_time) + initial_elapsed_time;
 
       // Training history neural network
 
       if(reserve_parameters_history)
       {
-         results_pointer->parameters_history[iteration] = parameters;
+         record_history(results_pointer->parameters_history, "parameters", iteration, parameters);
       }
 
       if(reserve_parameters_norm_history)
       {
-         results_pointer->parameters_norm_history[iteration] = parameters_norm;
+         record_history(results_pointer->parameters_norm_history, "parameters_norm", iteration, parameters_norm);
       }
 
       // Training history performance functional
 
       if(reserve_performance_history)
       {
-         results_pointer->performance_history[iteration] = performance;
+         record_history(results_pointer->performance_history, "performance", iteration, performance);
       }
 
       if(reserve_selection_performance_history)
       {
-         results_pointer->selection_performance_history[iteration] = selection_performance;
+         record_history(results_pointer->selection_performance_history, "selection_performance", iteration, selection_performance);
       }
 
       if(reserve_gradient_history)
       {
-         results_pointer->gradient_history[iteration] = gradient;
+         record_history(results_pointer->gradient_history, "gradient", iteration, gradient);
       }
 
       if(reserve_gradient_norm_history)
       {
-         results_pointer->gradient_norm_history[iteration] = gradient_norm;
+         record_history(results_pointer->gradient_norm_history, "gradient_norm", iteration, gradient_norm);
       }
 
       if(reserve_Hessian_approximation_history)
       {
-         results_pointer->Hessian_approximation_history[iteration] = Hessian_approximation; // as computed by linear algebraic equations object
+         record_history(results_pointer->Hessian_approximation_history, "Hessian_approximation", iteration, Hessian_approximation); // as computed by linear algebraic equations object
       }
 
       // Training history training algorithm
 
       if(reserve_damping_parameter_history)
       {
-         results_pointer->damping_parameter_history[iteration] = damping_parameter;
+         record_history(results_pointer->damping_parameter_history, "damping_parameter", iteration, damping_parameter);
       }
 
       if(reserve_elapsed_time_history)
       {
-         results_pointer->elapsed_time_history[iteration] = elapsed_time;
+         record_history(results_pointer->elapsed_time_history, "elapsed_time", iteration, elapsed_time);
       }
 
 	  // Stopping Criteria
@@ -1606,7 +1709,7 @@ LevenbergMarquardtAlgorithm::LevenbergMarquardtAlgorithmResults* LevenbergMarqua
 
           neural_network_pointer->set_parameters(parameters);
 
-          results_pointer->resize_training_history(1+iteration);
+          results_pointer->arrange_training_history(iteration);
 
          results_pointer->final_parameters = parameters;
          results_pointer->final_parameters_norm = parameters_norm;
@@ -1648,8 +1751,27 @@ LevenbergMarquardtAlgorithm::LevenbergMarquardtAlgorithmResults* LevenbergMarqua
       // Set new parameters
 
       neural_network_pointer->set_parameters(parameters);
+
+      // Checkpoint
+
+      if(checkpoint_period != 0 && (iteration+1) % checkpoint_period == 0)
+      {
+         checkpoint.iteration = iteration+1;
+         checkpoint.elapsed_time = elapsed_time;
+         checkpoint.selection_failures = selection_failures;
+         checkpoint.old_performance = old_performance;
+         checkpoint.old_selection_performance = old_selection_performance;
+         checkpoint.parameters = parameters;
+         checkpoint.scalars.set(1, damping_parameter);
+
+         write_checkpoint(checkpoint);
+      }
    } 
 
+   close_history_file();
+
+   wait_checkpoint();
+
    return(results_pointer);
 }
 
@@ -2657,6 +2779,9 @@ Vector<double> LevenbergMarquardtAlgorithm::perform_Householder_QR_decomposition
 {
     const size_t n = A.get_rows_number();
 
+    OPENNN_SCOPED_TIMER("levenberg_marquardt_algorithm.Householder_QR_decomposition");
+    OPENNN_COUNT("levenberg_marquardt_algorithm.Householder_QR_decomposition", 4*n*n*n/3);
+
     Vector<double> x(n);
 
     const Eigen::Map<Eigen::MatrixXd> A_eigen((double*)A.data(), n, n);
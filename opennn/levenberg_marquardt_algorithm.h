@@ -166,6 +166,7 @@ public:
       size_t iterations_number;
 
       void resize_training_history(const size_t&);
+      void arrange_training_history(const size_t&);
       std::string to_string(void) const;
 
       Matrix<std::string> write_final_results(const size_t& precision = 3) const;
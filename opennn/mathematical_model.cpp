@@ -165,6 +165,18 @@ const bool& MathematicalModel::get_display(void) const
 }  
 
 
+// bool is_thread_safe(void) const method
+
+/// Returns true if the solutions of this mathematical model can be calculated concurrently from several threads, 
+/// and false otherwise. 
+/// The mathematical model is not modified by the solution methods, so this is true by default. 
+
+bool MathematicalModel::is_thread_safe(void) const
+{
+   return(true);
+}
+
+
 // void set(const MathematicalModel&) method
 
 /// Sets the members of this mathematical model object with those from other mathematical model object. 
@@ -268,6 +280,24 @@ Vector<double> MathematicalModel::calculate_final_solutions(const NeuralNetwork&
 }
 
 
+// Matrix<double> calculate_dense_solutions(const NeuralNetwork&, const Vector<double>&) const method
+
+/// This virtual method returns the solutions to the mathematical model at a given set of points of the independent variable. 
+/// Each row contains the requested independent variable and the corresponding dependent variables. 
+/// Needs to be derived, otherwise an exception is thrown.
+
+Matrix<double> MathematicalModel::calculate_dense_solutions(const NeuralNetwork&, const Vector<double>&) const
+{
+   std::ostringstream buffer;
+
+   buffer << "OpenNN Exception: MathematicalModel class.\n"
+          << "Matrix<double> calculate_dense_solutions(const NeuralNetwork&, const Vector<double>&) const method.\n"
+          << "This method has not been derived.\n";
+ 
+   throw std::logic_error(buffer.str());
+}
+
+
 // Matrix<double> calculate_dependent_variables(const NeuralNetwork&, const Matrix<double>&) const method
 
 /// This virtual method returns the dependent variables solutions to the mathematical model, 
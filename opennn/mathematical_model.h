@@ -81,6 +81,8 @@ public:
 
    const bool& get_display(void) const;
 
+   virtual bool is_thread_safe(void) const;
+
    // Set methods
 
    void set(const MathematicalModel&);
@@ -98,6 +100,8 @@ public:
 
    virtual Vector<double> calculate_final_solutions(const NeuralNetwork&) const;
 
+   virtual Matrix<double> calculate_dense_solutions(const NeuralNetwork&, const Vector<double>&) const;
+
    virtual Matrix<double> calculate_dependent_variables(const NeuralNetwork&, const Matrix<double>&) const;  
 
 
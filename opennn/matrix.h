@@ -27,6 +27,7 @@
 // OpenNN includes
 
 #include "vector.h"
+#include "instrumentation.h"
 
 namespace OpenNN
 {
@@ -256,6 +257,7 @@ public:
     Vector< Vector<double> > calculate_columns_shape_parameters_missing_values(const Vector<size_t>&, const Vector< Vector<size_t> >&) const;
 
     Vector< Histogram<T> > calculate_histograms(const size_t& = 10) const;
+    Vector< Histogram<T> > calculate_histograms(const Vector<size_t>&, const Vector<size_t>&, const size_t& = 10) const;
 
     Vector< Histogram<T> > calculate_histograms_missing_values(const Vector< Vector<size_t> >&, const size_t& = 10) const;
 
@@ -301,6 +303,8 @@ public:
 
     double calculate_sum_squared_error(const Vector<double>&) const;
 
+    double calculate_sum_squared_error(const Matrix<float>&) const;
+
     Vector<double> calculate_rows_norm(void) const;
 
     Matrix<T> calculate_absolute_value(void) const;
@@ -361,6 +365,12 @@ public:
 
     Matrix<double> dot(const Matrix<double>&) const;
 
+    Vector<double> transpose_dot(const Vector<double>&) const;
+
+    Matrix<double> transpose_dot(const Matrix<double>&) const;
+
+    Matrix<double> calculate_rank_k_update(void) const;
+
     Matrix<T> direct(const Matrix<T>&) const;
 
     bool empty(void) const;
@@ -394,6 +404,7 @@ public:
     void load_binary(const std::string&);
 
     void save(const std::string&) const;
+    void save_binary(const std::string&) const;
 
     void save_csv(const std::string&) const;
 
@@ -407,6 +418,9 @@ public:
 
     Vector<T> to_vector(void) const;
 
+    Matrix<float> to_float_matrix(void) const;
+    Matrix<double> to_double_matrix(void) const;
+
     void print_preview(void) const;
 
 private:
@@ -4216,15 +4230,154 @@ Vector< Vector<double> > Matrix<T>::calculate_columns_shape_parameters_missing_v
 template <class T>
 Vector< Histogram<T> > Matrix<T>::calculate_histograms(const size_t& bins_number) const
 {
-   Vector< Histogram<T> > histograms(columns_number);
+   Vector<size_t> rows_indices(rows_number);
+   Vector<size_t> columns_indices(columns_number);
 
-   Vector<T> column(rows_number);
+   for(size_t i = 0; i < rows_number; i++)
+   {
+      rows_indices[i] = i;
+   }
 
-   for(size_t i = 0; i < columns_number; i++)
+   for(size_t j = 0; j < columns_number; j++)
    {
-      column = arrange_column(i);
+      columns_indices[j] = j;
+   }
+
+   return(calculate_histograms(rows_indices, columns_indices, bins_number));
+}
+
+
+// Vector<Histogram<T> > calculate_histograms(const Vector<size_t>&, const Vector<size_t>&, const size_t&) const method
+
+/// Calculates a histogram of equally spaced bins for each of some columns, using only some rows,
+/// without copying the columns.
+/// The rows are split in blocks which are counted in parallel, each thread into its own frequencies,
+/// and the frequencies of all the threads are added at the end.
+/// The bin of each value is computed in constant time.
+/// @param rows_indices Indices of the rows to be binned.
+/// @param columns_indices Indices of the columns for which a histogram is computed.
+/// @param bins_number Number of bins for each histogram.
+
+template <class T>
+Vector< Histogram<T> > Matrix<T>::calculate_histograms(const Vector<size_t>& rows_indices, const Vector<size_t>& columns_indices, const size_t& bins_number) const
+{
+   // Control sentence (if debug)
+
+   #ifdef __OPENNN_DEBUG__
+
+   if(bins_number < 1)
+   {
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: Matrix Template.\n"
+             << "Vector< Histogram<T> > calculate_histograms(const Vector<size_t>&, const Vector<size_t>&, const size_t&) const method.\n"
+             << "Number of bins is less than one.\n";
+
+      throw std::logic_error(buffer.str());
+   }
+
+   #endif
+
+   const size_t histograms_number = columns_indices.size();
+   const size_t indices_number = rows_indices.size();
+
+   Vector< Histogram<T> > histograms(histograms_number);
+
+   Vector<double> minimums(histograms_number, 0.0);
+   Vector<double> lengths(histograms_number, 0.0);
+
+   // Bins
+
+   int j = 0;
+
+   #pragma omp parallel for private(j)
+
+   for(j = 0; j < (int)histograms_number; j++)
+   {
+      const T* column = this->data() + columns_indices[j]*rows_number;
+
+      T minimum = indices_number == 0 ? T() : column[rows_indices[0]];
+      T maximum = minimum;
+
+      for(size_t i = 1; i < indices_number; i++)
+      {
+         const T& value = column[rows_indices[i]];
+
+         if(value < minimum)
+         {
+            minimum = value;
+         }
+         else if(value > maximum)
+         {
+            maximum = value;
+         }
+      }
+
+      const double length = (maximum - minimum)/(double)bins_number;
+
+      Histogram<T>& histogram = histograms[j];
+
+      histogram.centers.set(bins_number);
+      histogram.frequencies.set(bins_number, 0);
+
+      T bin_minimum = minimum;
+      T bin_maximum = minimum + length;
+
+      histogram.centers[0] = (bin_maximum + bin_minimum)/2.0;
+
+      for(size_t k = 1; k < bins_number; k++)
+      {
+         bin_minimum = bin_minimum + length;
+         bin_maximum = bin_maximum + length;
+
+         histogram.centers[k] = (bin_maximum + bin_minimum)/2.0;
+      }
+
+      minimums[j] = (double)minimum;
+      lengths[j] = length;
+   }
+
+   // Frequencies
+
+   const size_t block_size = 4096;
+
+   const size_t blocks_number = (indices_number + block_size - 1)/block_size;
+
+   Matrix<size_t> frequencies(bins_number, histograms_number, 0);
+
+   #pragma omp parallel
+   {
+      Matrix<size_t> thread_frequencies(bins_number, histograms_number, 0);
+
+      int block = 0;
+
+      #pragma omp for private(block)
+
+      for(block = 0; block < (int)blocks_number; block++)
+      {
+         const size_t begin = block*block_size;
+         const size_t end = std::min(begin + block_size, indices_number);
+
+         for(size_t k = 0; k < histograms_number; k++)
+         {
+            const T* column = this->data() + columns_indices[k]*rows_number;
+
+            size_t* column_frequencies = thread_frequencies.data() + k*bins_number;
+
+            for(size_t i = begin; i < end; i++)
+            {
+               column_frequencies[Histogram<T>::calculate_uniform_bin((double)column[rows_indices[i]], minimums[k], lengths[k], bins_number)]++;
+            }
+         }
+      }
 
-      histograms[i] = column.calculate_histogram(bins_number);
+      #pragma omp critical
+      frequencies += thread_frequencies;
+   }
+
+   for(size_t k = 0; k < histograms_number; k++)
+   {
+      histograms[k].frequencies = frequencies.arrange_column(k);
    }
 
    return(histograms);
@@ -4237,6 +4390,7 @@ Vector< Histogram<T> > Matrix<T>::calculate_histograms(const size_t& bins_number
 /// It returns a vector of vectors of vectors.
 /// The size of the main vector is the number of columns.
 /// Each subvector contains the frequencies and centers of that colums.
+/// The columns are binned in parallel.
 /// @param bins_number Number of bins for each histogram.
 /// @param missing_indices Vector of vectors with the indices of the missing values.
 
@@ -4247,7 +4401,11 @@ Vector< Histogram<T> > Matrix<T>::calculate_histograms_missing_values(const Vect
 
    Vector<T> column(rows_number);
 
-   for(size_t i = 0; i < columns_number; i++)
+   int i = 0;
+
+   #pragma omp parallel for private(i, column)
+
+   for(i = 0; i < (int)columns_number; i++)
    {
       column = arrange_column(i);
 
@@ -5086,6 +5244,51 @@ double Matrix<T>::calculate_sum_squared_error(const Matrix<double>& other_matrix
 }
 
 
+// double calculate_sum_squared_error(const Matrix<float>&) const method
+
+/// Returns the sum squared error between the elements of this matrix and the elements of a single precision matrix.
+/// The differences are computed in the precision of the matrices, but they are accumulated in double precision,
+/// so that the result does not degrade with the number of elements.
+/// @param other_matrix Other matrix.
+
+template <class T>
+double Matrix<T>::calculate_sum_squared_error(const Matrix<float>& other_matrix) const
+{
+   // Control sentence (if debug)
+
+   #ifdef __OPENNN_DEBUG__
+
+   const size_t other_rows_number = other_matrix.get_rows_number();
+   const size_t other_columns_number = other_matrix.get_columns_number();
+
+   if(other_rows_number != rows_number || other_columns_number != columns_number)
+   {
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: Matrix Template.\n"
+             << "double calculate_sum_squared_error(const Matrix<float>&) const method.\n"
+             << "Other matrix must have the same dimensions as this matrix.\n";
+
+      throw std::logic_error(buffer.str());
+   }
+
+   #endif
+
+   const size_t size = this->size();
+
+   double sum_squared_error = 0.0;
+
+   for(size_t i = 0; i < size; i++)
+   {
+      const double error = (double)((*this)[i] - other_matrix[i]);
+
+      sum_squared_error += error*error;
+   }
+
+   return(sum_squared_error);
+}
+
+
 // double calculate_sum_squared_error(const Vector<double>&) const method
 
 /// This method retuns the sum squared error between the elements of this matrix and the elements of a vector, by columns.
@@ -5182,16 +5385,30 @@ Matrix<T> Matrix<T>::calculate_absolute_value(void) const
 
 /// Returns the transpose of the matrix.
 
+/// The matrix is traversed in square tiles, so that both the reads and the strided writes of a tile stay in cache.
+
 template <class T>
 Matrix<T> Matrix<T>::calculate_transpose(void) const
 {
+   const size_t block_size = 32;
+
    Matrix<T> transpose(columns_number, rows_number);
 
-   for(size_t i = 0; i < columns_number; i++)
+   for(size_t i_block = 0; i_block < columns_number; i_block += block_size)
    {
-      for(size_t j = 0; j < rows_number; j++)
+      const size_t i_end = std::min(i_block + block_size, columns_number);
+
+      for(size_t j_block = 0; j_block < rows_number; j_block += block_size)
       {
-         transpose(i,j) = (*this)(j,i);
+         const size_t j_end = std::min(j_block + block_size, rows_number);
+
+         for(size_t i = i_block; i < i_end; i++)
+         {
+            for(size_t j = j_block; j < j_end; j++)
+            {
+               transpose(i,j) = (*this)(j,i);
+            }
+         }
       }
    }
 
@@ -6193,6 +6410,9 @@ Matrix<double> Matrix<T>::dot(const Matrix<double>& other_matrix) const
 
    #endif
 
+   OPENNN_SCOPED_TIMER("matrix.dot");
+   OPENNN_COUNT("matrix.dot", 2*rows_number*columns_number*other_columns_number);
+
    Matrix<T> product(rows_number, other_columns_number);
 
 //   for(size_t i = 0; i < rows_number; i++) {
@@ -6213,6 +6433,115 @@ Matrix<double> Matrix<T>::dot(const Matrix<double>& other_matrix) const
 }
 
 
+// Vector<double> transpose_dot(const Vector<double>&) const method
+
+/// Returns the dot product of the transpose of this matrix with a vector, without building the transpose.
+/// The size of the vector must be equal to the number of rows of the matrix.
+/// @param vector Vector to be multiplied to the transpose of this matrix.
+
+template <class T>
+Vector<double> Matrix<T>::transpose_dot(const Vector<double>& vector) const
+{
+   // Control sentence (if debug)
+
+   #ifdef __OPENNN_DEBUG__
+
+   const size_t size = vector.size();
+
+   if(size != rows_number)
+   {
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: Matrix Template.\n"
+             << "Vector<double> transpose_dot(const Vector<double>&) const method.\n"
+             << "Vector size must be equal to matrix number of rows.\n";
+
+      throw std::logic_error(buffer.str());
+   }
+
+   #endif
+
+   Vector<double> product(columns_number);
+
+   const Eigen::Map<Eigen::MatrixXd> matrix_eigen((double*)this->data(), rows_number, columns_number);
+   const Eigen::Map<Eigen::VectorXd> vector_eigen((double*)vector.data(), rows_number);
+   Eigen::Map<Eigen::VectorXd> product_eigen(product.data(), columns_number);
+
+   product_eigen.noalias() = matrix_eigen.transpose()*vector_eigen;
+
+   return(product);
+}
+
+
+// Matrix<double> transpose_dot(const Matrix<double>&) const method
+
+/// Returns the dot product of the transpose of this matrix with another matrix, without building the transpose.
+/// The number of rows of the other matrix must be equal to the number of rows of this matrix.
+/// @param other_matrix Matrix to be multiplied to the transpose of this matrix.
+
+template <class T>
+Matrix<double> Matrix<T>::transpose_dot(const Matrix<double>& other_matrix) const
+{
+   const size_t other_columns_number = other_matrix.get_columns_number();
+   const size_t other_rows_number = other_matrix.get_rows_number();
+
+   // Control sentence (if debug)
+
+   #ifdef __OPENNN_DEBUG__
+
+   if(other_rows_number != rows_number)
+   {
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: Matrix Template.\n"
+             << "Matrix<double> transpose_dot(const Matrix<double>&) const method.\n"
+             << "The number of rows of the other matrix (" << other_rows_number << ") must be equal to the number of rows of this matrix (" << rows_number << ").\n";
+
+      throw std::logic_error(buffer.str());
+   }
+
+   #endif
+
+   OPENNN_SCOPED_TIMER("matrix.transpose_dot");
+   OPENNN_COUNT("matrix.transpose_dot", 2*rows_number*columns_number*other_columns_number);
+
+   Matrix<double> product(columns_number, other_columns_number);
+
+   const Eigen::Map<Eigen::MatrixXd> this_eigen((double*)this->data(), rows_number, columns_number);
+   const Eigen::Map<Eigen::MatrixXd> other_eigen((double*)other_matrix.data(), other_rows_number, other_columns_number);
+   Eigen::Map<Eigen::MatrixXd> product_eigen(product.data(), columns_number, other_columns_number);
+
+   product_eigen.noalias() = this_eigen.transpose()*other_eigen;
+
+   return(product);
+}
+
+
+// Matrix<double> calculate_rank_k_update(void) const method
+
+/// Returns the product of the transpose of this matrix with this matrix, which is a symmetric matrix.
+/// Only the lower triangle is computed, as a symmetric rank-k update, and then it is mirrored to the upper triangle.
+/// This is the normal equations matrix of least squares problems, such as the Gauss-Newton approximation of the Hessian.
+
+template <class T>
+Matrix<double> Matrix<T>::calculate_rank_k_update(void) const
+{
+   OPENNN_SCOPED_TIMER("matrix.rank_k_update");
+   OPENNN_COUNT("matrix.rank_k_update", rows_number*columns_number*columns_number);
+
+   Matrix<double> product(columns_number, columns_number, 0.0);
+
+   const Eigen::Map<Eigen::MatrixXd> this_eigen((double*)this->data(), rows_number, columns_number);
+   Eigen::Map<Eigen::MatrixXd> product_eigen(product.data(), columns_number, columns_number);
+
+   product_eigen.template selfadjointView<Eigen::Lower>().rankUpdate(this_eigen.transpose());
+
+   product_eigen.template triangularView<Eigen::StrictlyUpper>() = product_eigen.transpose();
+
+   return(product);
+}
+
+
 // Matrix<T> direct(const Matrix<T>&) const method
 
 /// Calculates the direct product of this matrix with another matrix.
@@ -6528,18 +6857,15 @@ void Matrix<T>::convert_time_series(const size_t& lags_number)
 
     Matrix<T> new_matrix(new_rows_number, new_columns_number);
 
-    Vector<T> row(rows_number);
-
-    for(size_t i = 0; i < new_rows_number; i++)
+    for(size_t j = 0; j < new_columns_number; j++)
     {
-        row = arrange_row(i);
+        const size_t lag = j/columns_number;
+        const size_t column_index = j%columns_number;
 
-        for(size_t j = 1; j <= lags_number; j++)
+        for(size_t i = 0; i < new_rows_number; i++)
         {
-            row = row.assemble(arrange_row(i+j));
+            new_matrix(i,j) = (*this)(i+lag, column_index);
         }
-
-        new_matrix.set_row(i, row);
     }
 
     set(new_matrix);
@@ -6669,12 +6995,14 @@ void Matrix<T>::print(void) const
 // void load(const std::string&) method
 
 /// Loads the numbers of rows and columns and the values of the matrix from a data file.
+/// Each non empty line is a row, and the number of columns is the number of values in the first row.
+/// The file is read with a single bulk read and parsed in one pass, independently of the global locale.
 /// @param file_name File name.
 
 template <class T>
 void Matrix<T>::load(const std::string& file_name)
 {
-   std::ifstream file(file_name.c_str());
+   std::ifstream file(file_name.c_str(), std::ios::binary);
 
    if(!file.is_open())
    {
@@ -6687,81 +7015,92 @@ void Matrix<T>::load(const std::string& file_name)
       throw std::logic_error(buffer.str());
    }
 
-   if(file.peek() == std::ifstream::traits_type::eof())
-   {
-      //std::ostringstream buffer;
+   const std::string content = read_text_file(file);
 
-      //buffer << "OpenNN Exception: Matrix template.\n"
-      //       << "void load(const std::string&) method.\n"
-      //       << "Data file " << file_name << " is empty.\n";
+   file.close();
 
-      //throw std::logic_error(buffer.str());
+   const char* position = content.data();
+   const char* end = position + content.size();
 
-      this->set();
+   std::vector<T> values;
 
-      return;
-   }
+   size_t new_rows_number = 0;
+   size_t new_columns_number = 0;
 
-   //file.is
+   T value;
 
-   // Set matrix sizes
+   while(position != end)
+   {
+      const char* line_end = std::find(position, end, '\n');
 
-   std::string line;
+      const size_t previous_size = values.size();
 
-   std::getline(file, line);
+      while(position != line_end)
+      {
+         if(is_text_space(*position))
+         {
+            position++;
 
-   if(line.empty())
-   {
-      set();
-   }
-   else
-   {
-      std::istringstream buffer(line);
+            continue;
+         }
 
-      std::istream_iterator<std::string> it(buffer);
-      std::istream_iterator<std::string> end;
+         if(!parse_text_value(position, line_end, value))
+         {
+            std::ostringstream buffer;
 
-      const std::vector<std::string> results(it, end);
+            buffer << "OpenNN Exception: Matrix template.\n"
+                   << "void load(const std::string&) method.\n"
+                   << "Cannot read value " << values.size() - previous_size << " of row " << new_rows_number << " in matrix data file: " << file_name << "\n";
 
-      const size_t new_columns_number = (size_t)results.size();
+            throw std::logic_error(buffer.str());
+         }
 
-      size_t new_rows_number = 1;
+         values.push_back(value);
+      }
 
-      while(file.good())
+      if(values.size() != previous_size)
       {
-         getline(file, line);
-
-         if(!line.empty())
+         if(new_rows_number == 0)
          {
-            new_rows_number++;
+            new_columns_number = values.size();
          }
+
+         new_rows_number++;
       }
 
-      set(new_rows_number, new_columns_number);
+      position = (line_end == end) ? end : line_end + 1;
+   }
 
-      // Clear file
+   if(values.size() != new_rows_number*new_columns_number)
+   {
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: Matrix template.\n"
+             << "void load(const std::string&) method.\n"
+             << "Number of values (" << values.size() << ") is not equal to number of rows (" << new_rows_number << ") times number of columns (" << new_columns_number << ") in matrix data file: " << file_name << "\n";
+
+      throw std::logic_error(buffer.str());
+   }
 
-      file.clear();
-      file.seekg(0, std::ios::beg);
+   set(new_rows_number, new_columns_number);
 
+   for(size_t j = 0; j < columns_number; j++)
+   {
       for(size_t i = 0; i < rows_number; i++)
       {
-          for(size_t j = 0; j < columns_number; j++)
-          {
-                file >> (*this)(i,j);
-          }
+         (*this)(i,j) = values[i*columns_number + j];
       }
    }
-
-   // Close file
-
-   file.close();
 }
 
 
 // void load_binary(const std::string&) method
 
 /// Loads the numbers of rows and columns and the values of the matrix from a binary file.
+/// Files written by save_binary start with a header and are read with a single bulk read.
+/// Files without that header are read with the former layout, which is the number of columns,
+/// the number of rows and then the values in column order, as double precision numbers.
+/// The sizes in the file are checked against the length of the file before any memory is allocated.
 /// @param file_name Name of binary file.
 
 template <class T>
@@ -6782,28 +7121,88 @@ void Matrix<T>::load_binary(const std::string& file_name)
         throw std::logic_error(buffer.str());
     }
 
-    std::streamsize size = sizeof(size_t);
+    char magic[8];
 
-    size_t columns_number;
-    size_t rows_number;
+    file.read(magic, 8);
 
-    file.read(reinterpret_cast<char*>(&columns_number), size);
-    file.read(reinterpret_cast<char*>(&rows_number), size);
+    if(file && memcmp(magic, "OPENNNM", 8) == 0)
+    {
+        uint32_t version = 0;
+        uint32_t element_size = 0;
+        uint64_t new_rows_number = 0;
+        uint64_t new_columns_number = 0;
 
-    size = sizeof(double);
+        file.read(reinterpret_cast<char*>(&version), sizeof(uint32_t));
+        file.read(reinterpret_cast<char*>(&element_size), sizeof(uint32_t));
+        file.read(reinterpret_cast<char*>(&new_rows_number), sizeof(uint64_t));
+        file.read(reinterpret_cast<char*>(&new_columns_number), sizeof(uint64_t));
 
-    double value;
+        if(!file || version != 1 || element_size != sizeof(T))
+        {
+            std::ostringstream buffer;
 
-    this->set(rows_number, columns_number);
+            buffer << "OpenNN Exception: Matrix template.\n"
+                   << "void load_binary(const std::string&) method.\n"
+                   << "Unknown binary matrix format in file: " << file_name << "\n";
 
-    for(size_t i = 0; i < columns_number; i++)
+            throw std::logic_error(buffer.str());
+        }
+
+        if(new_columns_number != 0 && new_rows_number > count_remaining_binary_bytes(file)/sizeof(T)/new_columns_number)
+        {
+            std::ostringstream buffer;
+
+            buffer << "OpenNN Exception: Matrix template.\n"
+                   << "void load_binary(const std::string&) method.\n"
+                   << "Binary file is truncated: " << file_name << "\n";
+
+            throw std::logic_error(buffer.str());
+        }
+
+        this->set((size_t)new_rows_number, (size_t)new_columns_number);
+
+        file.read(reinterpret_cast<char*>(this->data()), new_rows_number*new_columns_number*sizeof(T));
+    }
+    else
     {
-        for(size_t j = 0; j < rows_number; j++)
+        file.clear();
+        file.seekg(0, std::ios::beg);
+
+        size_t new_columns_number = 0;
+        size_t new_rows_number = 0;
+
+        file.read(reinterpret_cast<char*>(&new_columns_number), sizeof(size_t));
+        file.read(reinterpret_cast<char*>(&new_rows_number), sizeof(size_t));
+
+        if(!file || (new_columns_number != 0 && new_rows_number > count_remaining_binary_bytes(file)/sizeof(double)/new_columns_number))
         {
-            file.read(reinterpret_cast<char*>(&value), size);
+            std::ostringstream buffer;
+
+            buffer << "OpenNN Exception: Matrix template.\n"
+                   << "void load_binary(const std::string&) method.\n"
+                   << "Binary file is truncated: " << file_name << "\n";
 
-            (*this)(j,i) = value;
+            throw std::logic_error(buffer.str());
         }
+
+        Vector<double> values(new_rows_number*new_columns_number);
+
+        file.read(reinterpret_cast<char*>(values.data()), values.size()*sizeof(double));
+
+        this->set(new_rows_number, new_columns_number);
+
+        std::copy(values.begin(), values.end(), this->begin());
+    }
+
+    if(!file)
+    {
+        std::ostringstream buffer;
+
+        buffer << "OpenNN Exception: Matrix template.\n"
+               << "void load_binary(const std::string&) method.\n"
+               << "Binary file is truncated: " << file_name << "\n";
+
+        throw std::logic_error(buffer.str());
     }
 
     file.close();
@@ -6813,6 +7212,7 @@ void Matrix<T>::load_binary(const std::string& file_name)
 // void save(const std::string&) const method
 
 /// Saves the values of the matrix to a data file separated by spaces.
+/// The text is formatted in memory and written in large blocks.
 /// @param file_name File name.
 
 template <class T>
@@ -6833,22 +7233,82 @@ void Matrix<T>::save(const std::string& file_name) const
 
    // Write file
 
+   const size_t block_size = 1 << 20;
+
+   std::string content;
+
+   content.reserve(block_size + 1024);
+
    for(size_t i = 0; i < rows_number; i++)
    {
       for(size_t j = 0; j < columns_number; j++)
       {
-         file << (*this)(i,j) << " ";
+         append_text_value(content, (*this)(i,j));
+
+         content += ' ';
       }
 
-      file << std::endl;
+      content += '\n';
+
+      if(content.size() >= block_size)
+      {
+         file.write(content.data(), content.size());
+
+         content.clear();
+      }
    }
 
+   file.write(content.data(), content.size());
+
    // Close file
 
    file.close();
 }
 
 
+// void save_binary(const std::string&) const method
+
+/// Saves the numbers of rows and columns and the values of the matrix to a binary file.
+/// The file contains the characters "OPENNNM" followed by a null character, the format version,
+/// the size in bytes of an element and the numbers of rows and columns,
+/// followed by the values in column order, which is the order of the matrix in memory.
+/// The type of the elements must be trivially copyable.
+/// @param file_name Name of binary file.
+
+template <class T>
+void Matrix<T>::save_binary(const std::string& file_name) const
+{
+    static_assert(std::is_trivially_copyable<T>::value, "Binary matrix files need trivially copyable elements.");
+
+    std::ofstream file(file_name.c_str(), std::ios::binary);
+
+    if(!file.is_open())
+    {
+        std::ostringstream buffer;
+
+        buffer << "OpenNN Exception: Matrix template.\n"
+               << "void save_binary(const std::string&) const method.\n"
+               << "Cannot open binary file: " << file_name << "\n";
+
+        throw std::logic_error(buffer.str());
+    }
+
+    const uint32_t version = 1;
+    const uint32_t element_size = sizeof(T);
+    const uint64_t new_rows_number = rows_number;
+    const uint64_t new_columns_number = columns_number;
+
+    file.write("OPENNNM", 8);
+    file.write(reinterpret_cast<const char*>(&version), sizeof(uint32_t));
+    file.write(reinterpret_cast<const char*>(&element_size), sizeof(uint32_t));
+    file.write(reinterpret_cast<const char*>(&new_rows_number), sizeof(uint64_t));
+    file.write(reinterpret_cast<const char*>(&new_columns_number), sizeof(uint64_t));
+    file.write(reinterpret_cast<const char*>(this->data()), new_rows_number*new_columns_number*sizeof(T));
+
+    file.close();
+}
+
+
 // void save_csv(const std::string&) const method
 
 /// Saves the values of the matrix to a data file separated by commas.
@@ -7054,6 +7514,36 @@ Vector<T> Matrix<T>::to_vector(void) const
 }
 
 
+// Matrix<float> to_float_matrix(void) const method
+
+/// Returns a single precision copy of this matrix, with the same dimensions. 
+
+template <class T>
+Matrix<float> Matrix<T>::to_float_matrix(void) const
+{
+    Matrix<float> float_matrix(rows_number, columns_number);
+
+    std::copy(this->begin(), this->end(), float_matrix.begin());
+
+    return(float_matrix);
+}
+
+
+// Matrix<double> to_double_matrix(void) const method
+
+/// Returns a double precision copy of this matrix, with the same dimensions. 
+
+template <class T>
+Matrix<double> Matrix<T>::to_double_matrix(void) const
+{
+    Matrix<double> double_matrix(rows_number, columns_number);
+
+    std::copy(this->begin(), this->end(), double_matrix.begin());
+
+    return(double_matrix);
+}
+
+
 // void print_preview(void) const method
 
 /// Prints to the sceen a preview of the matrix,
@@ -227,15 +227,6 @@ double MeanSquaredError::calculate_performance(void) const
 
    const size_t training_instances_number = instances.count_training_instances_number();
 
-   const Vector<size_t> training_indices = instances.arrange_training_indices();
-
-   size_t training_index;
-
-   const Variables& variables = data_set_pointer->get_variables();
-
-   const Vector<size_t> inputs_indices = variables.arrange_inputs_indices();
-   const Vector<size_t> targets_indices = variables.arrange_targets_indices();
-
    // Mean squared error stuff
 
    Vector<double> inputs(inputs_number);
@@ -246,15 +237,13 @@ double MeanSquaredError::calculate_performance(void) const
 
    double sum_squared_error = 0.0;
 
-   #pragma omp parallel for private(i, training_index, inputs, outputs, targets) reduction(+:sum_squared_error)
+   #pragma omp parallel for private(i, inputs, outputs, targets) reduction(+:sum_squared_error)
 
    for(i = 0; i < (int)training_instances_number; i++)
    {
-       training_index = training_indices[i];
-
       // Input vector
 
-      inputs = data_set_pointer->get_instance(training_index, inputs_indices);
+      data_set_pointer->get_training_inputs(i, inputs);
 
       // Output vector
 
@@ -262,7 +251,7 @@ double MeanSquaredError::calculate_performance(void) const
 
       // Target vector
 
-      targets = data_set_pointer->get_instance(training_index, targets_indices);
+      data_set_pointer->get_training_targets(i, targets);
 
       // Sum squared error
 
@@ -321,15 +310,6 @@ double MeanSquaredError::calculate_performance(const Vector<double>& parameters)
 
    const size_t training_instances_number = instances.count_training_instances_number();
 
-   const Vector<size_t> training_indices = instances.arrange_training_indices();
-
-   size_t training_index;
-
-   const Variables& variables = data_set_pointer->get_variables();
-
-   const Vector<size_t> inputs_indices = variables.arrange_inputs_indices();
-   const Vector<size_t> targets_indices = variables.arrange_targets_indices();
-
    // Mean squared error stuff
 
    Vector<double> inputs(inputs_number);
@@ -340,15 +320,13 @@ double MeanSquaredError::calculate_performance(const Vector<double>& parameters)
 
    int i = 0;
 
-   #pragma omp parallel for private(i, training_index, inputs, outputs, targets) reduction(+:sum_squared_error)
+   #pragma omp parallel for private(i, inputs, outputs, targets) reduction(+:sum_squared_error)
 
    for(i = 0; i < (int)training_instances_number; i++)
    {
-       training_index = training_indices[i];
-
       // Input vector
 
-      inputs = data_set_pointer->get_instance(training_index, inputs_indices);
+      data_set_pointer->get_training_inputs(i, inputs);
 
       // Output vector
 
@@ -356,7 +334,7 @@ double MeanSquaredError::calculate_performance(const Vector<double>& parameters)
 
       // Target vector
 
-      targets = data_set_pointer->get_instance(training_index, targets_indices);
+      data_set_pointer->get_training_targets(i, targets);
 
       // Sum squared error
 
@@ -396,16 +374,6 @@ double MeanSquaredError::calculate_selection_performance(void) const
       return(0.0);
    }
 
-   const Vector<size_t> selection_indices = instances.arrange_selection_indices();
-
-   size_t selection_index;
-
-   const Variables& variables = data_set_pointer->get_variables();
-
-   const Vector<size_t> inputs_indices = variables.arrange_inputs_indices();
-   const Vector<size_t> targets_indices = variables.arrange_targets_indices();
-
-
       Vector<double> inputs(inputs_number);
       Vector<double> outputs(outputs_number);
       Vector<double> targets(outputs_number);
@@ -414,15 +382,13 @@ double MeanSquaredError::calculate_selection_performance(void) const
 
       int i = 0;
 
-      #pragma omp parallel for private(i, selection_index, inputs, outputs, targets) reduction(+:selection_performance)
+      #pragma omp parallel for private(i, inputs, outputs, targets) reduction(+:selection_performance)
 
       for(i = 0; i < (int)selection_instances_number; i++)
       {
-          selection_index = selection_indices[i];
-
          // Input vector
 
-         inputs = data_set_pointer->get_instance(selection_index, inputs_indices);
+         data_set_pointer->get_selection_inputs(i, inputs);
 
          // Output vector
 
@@ -430,7 +396,7 @@ double MeanSquaredError::calculate_selection_performance(void) const
 
          // Target vector
 
-         targets = data_set_pointer->get_instance(selection_index, targets_indices);
+         data_set_pointer->get_selection_targets(i, targets);
 
          // Sum of squares error
 
@@ -482,15 +448,6 @@ Vector<double> MeanSquaredError::calculate_gradient(void) const
 
    const size_t training_instances_number = instances.count_training_instances_number();
 
-   const Vector<size_t> training_indices = instances.arrange_training_indices();
-
-   size_t training_index;
-
-   const Variables& variables = data_set_pointer->get_variables();
-
-   const Vector<size_t> inputs_indices = variables.arrange_inputs_indices();
-   const Vector<size_t> targets_indices = variables.arrange_targets_indices();
-
    Vector<double> inputs(inputs_number);
    Vector<double> targets(outputs_number);
 
@@ -506,16 +463,14 @@ Vector<double> MeanSquaredError::calculate_gradient(void) const
 
    int i = 0;
 
-   #pragma omp parallel for private(i, training_index, inputs, targets, first_order_forward_propagation, \
+   #pragma omp parallel for private(i, inputs, targets, first_order_forward_propagation, \
     output_gradient, layers_delta, particular_solution, homogeneous_solution, point_gradient)
 
    for(i = 0; i < (int)training_instances_number; i++)
    {
-       training_index = training_indices[i];
+      data_set_pointer->get_training_inputs(i, inputs);
 
-      inputs = data_set_pointer->get_instance(training_index, inputs_indices);
-
-      targets = data_set_pointer->get_instance(training_index, targets_indices);
+      data_set_pointer->get_training_targets(i, targets);
 
       first_order_forward_propagation = multilayer_perceptron_pointer->calculate_first_order_forward_propagation(inputs);
 
@@ -635,15 +590,6 @@ Vector<double> MeanSquaredError::calculate_terms(void) const
 
    const size_t training_instances_number = instances.count_training_instances_number();
 
-   const Vector<size_t> training_indices = instances.arrange_training_indices();
-
-   size_t training_index;
-
-   const Variables& variables = data_set_pointer->get_variables();
-
-   const Vector<size_t> inputs_indices = variables.arrange_inputs_indices();
-   const Vector<size_t> targets_indices = variables.arrange_targets_indices();
-
    // Mean squared error stuff
 
    Vector<double> performance_terms(training_instances_number);
@@ -654,15 +600,13 @@ Vector<double> MeanSquaredError::calculate_terms(void) const
 
    int i = 0;
 
-   #pragma omp parallel for private(i, training_index, inputs, outputs, targets)
+   #pragma omp parallel for private(i, inputs, outputs, targets)
 
    for(i = 0; i < (int)training_instances_number; i++)
    {
-       training_index = training_indices[i];
-
       // Input vector
 
-      inputs = data_set_pointer->get_instance(training_index, inputs_indices);
+      data_set_pointer->get_training_inputs(i, inputs);
 
       // Output vector
 
@@ -670,7 +614,7 @@ Vector<double> MeanSquaredError::calculate_terms(void) const
 
       // Target vector
 
-      targets = data_set_pointer->get_instance(training_index, targets_indices);
+      data_set_pointer->get_training_targets(i, targets);
 
       // Error
 
@@ -769,15 +713,6 @@ Matrix<double> MeanSquaredError::calculate_terms_Jacobian(void) const
 
    const size_t training_instances_number = instances.count_training_instances_number();
 
-   const Vector<size_t> training_indices = instances.arrange_training_indices();
-
-   size_t training_index;
-
-   const Variables& variables = data_set_pointer->get_variables();
-
-   const Vector<size_t> inputs_indices = variables.arrange_inputs_indices();
-   const Vector<size_t> targets_indices = variables.arrange_targets_indices();
-
    Vector<double> inputs(inputs_number);
    Vector<double> targets(outputs_number);
 
@@ -797,16 +732,14 @@ Matrix<double> MeanSquaredError::calculate_terms_Jacobian(void) const
 
    int i = 0;
 
-#pragma omp parallel for private(i, training_index, inputs, targets, first_order_forward_propagation,  \
+#pragma omp parallel for private(i, inputs, targets, first_order_forward_propagation,  \
  term, term_norm, output_gradient, layers_delta, particular_solution, homogeneous_solution, point_gradient)
 
    for(i = 0; i < (int)training_instances_number; i++)
    {
-       training_index = training_indices[i];
-
-      inputs = data_set_pointer->get_instance(training_index, inputs_indices);
+      data_set_pointer->get_training_inputs(i, inputs);
 
-      targets = data_set_pointer->get_instance(training_index, targets_indices);
+      data_set_pointer->get_training_targets(i, targets);
 
       first_order_forward_propagation = multilayer_perceptron_pointer->calculate_first_order_forward_propagation(inputs);
 
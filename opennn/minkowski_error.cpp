@@ -272,15 +272,6 @@ double MinkowskiError::calculate_performance(void) const
 
    const size_t training_instances_number = instances.count_training_instances_number();
 
-   const Vector<size_t> training_indices = instances.arrange_training_indices();
-
-   size_t training_index;
-
-   const Variables& variables = data_set_pointer->get_variables();
-
-   const Vector<size_t> inputs_indices = variables.arrange_inputs_indices();
-   const Vector<size_t> targets_indices = variables.arrange_targets_indices();
-
    Vector<double> inputs(inputs_number);
    Vector<double> outputs(outputs_number);
    Vector<double> targets(outputs_number);
@@ -289,15 +280,14 @@ double MinkowskiError::calculate_performance(void) const
 
    int i = 0;
 
-   #pragma omp parallel for private(i, training_index, inputs, outputs, targets) reduction(+ : Minkowski_error)
+   #pragma omp parallel for private(i, inputs, outputs, targets) reduction(+ : Minkowski_error)
 
    for(i = 0; i < (int)training_instances_number; i++)
    {       
-       training_index = training_indices[i];
 
       // Input vector
 
-      inputs = data_set_pointer->get_instance(training_index, inputs_indices);
+      data_set_pointer->get_training_inputs(i, inputs);
 
       // Output vector
 
@@ -305,7 +295,7 @@ double MinkowskiError::calculate_performance(void) const
 
       // Target vector
 
-      targets = data_set_pointer->get_instance(training_index, targets_indices);
+      data_set_pointer->get_training_targets(i, targets);
 
       // Minkowski error
 
@@ -363,15 +353,6 @@ double MinkowskiError::calculate_performance(const Vector<double>& parameters) c
    const Instances& instances = data_set_pointer->get_instances();
    const size_t training_instances_number = instances.count_training_instances_number();
 
-   const Vector<size_t> training_indices = instances.arrange_training_indices();
-
-   size_t training_index;
-
-   const Variables& variables = data_set_pointer->get_variables();
-
-   const Vector<size_t> inputs_indices = variables.arrange_inputs_indices();
-   const Vector<size_t> targets_indices = variables.arrange_targets_indices();
-
    Vector<double> inputs(inputs_number);
    Vector<double> outputs(outputs_number);
    Vector<double> targets(outputs_number);
@@ -380,15 +361,13 @@ double MinkowskiError::calculate_performance(const Vector<double>& parameters) c
 
    int i = 0;
 
-   #pragma omp parallel for private(i, training_index, inputs, outputs, targets) reduction(+ : Minkowski_error)
+   #pragma omp parallel for private(i, inputs, outputs, targets) reduction(+ : Minkowski_error)
 
    for(i = 0; i < (int)training_instances_number; i++)
    {
-       training_index = training_indices[i];
-
       // Input vector
 
-      inputs = data_set_pointer->get_instance(training_index, inputs_indices);
+      data_set_pointer->get_training_inputs(i, inputs);
 
       // Output vector
 
@@ -396,7 +375,7 @@ double MinkowskiError::calculate_performance(const Vector<double>& parameters) c
 
       // Target vector
 
-      targets = data_set_pointer->get_instance(training_index, targets_indices);
+      data_set_pointer->get_training_targets(i, targets);
 
       // Minkowski error
 
@@ -435,15 +414,6 @@ double MinkowskiError::calculate_selection_performance(void) const
 
    const size_t selection_instances_number = instances.count_selection_instances_number();
 
-   const Vector<size_t> selection_indices = instances.arrange_selection_indices();
-
-   size_t selection_index;
-
-   const Variables& variables = data_set_pointer->get_variables();
-
-   const Vector<size_t> inputs_indices = variables.arrange_inputs_indices();
-   const Vector<size_t> targets_indices = variables.arrange_targets_indices();
-
    // Performance functional
 
    Vector<double> inputs(inputs_number);
@@ -454,15 +424,13 @@ double MinkowskiError::calculate_selection_performance(void) const
 
    int i = 0;
 
-   #pragma omp parallel for private(i, selection_index, inputs, outputs, targets) reduction(+ : selection_performance)
+   #pragma omp parallel for private(i, inputs, outputs, targets) reduction(+ : selection_performance)
 
    for(i = 0; i < (int)selection_instances_number; i++)
    {
-       selection_index = selection_indices[i];
-
       // Input vector
 
-      inputs = data_set_pointer->get_instance(selection_index, inputs_indices);
+      data_set_pointer->get_selection_inputs(i, inputs);
 
       // Output vector
 
@@ -470,7 +438,7 @@ double MinkowskiError::calculate_selection_performance(void) const
 
       // Target vector
 
-      targets = data_set_pointer->get_instance(selection_index, targets_indices);
+      data_set_pointer->get_selection_targets(i, targets);
 
       // Minkowski error
 
@@ -524,15 +492,6 @@ Vector<double> MinkowskiError::calculate_gradient(void) const
 
    const size_t training_instances_number = instances.count_training_instances_number();
 
-   const Vector<size_t> training_indices = instances.arrange_training_indices();
-
-   size_t training_index;
-
-   const Variables& variables = data_set_pointer->get_variables();
-
-   const Vector<size_t> inputs_indices = variables.arrange_inputs_indices();
-   const Vector<size_t> targets_indices = variables.arrange_targets_indices();
-
    Vector<double> inputs(inputs_number);
    Vector<double> targets(outputs_number);
 
@@ -551,18 +510,16 @@ Vector<double> MinkowskiError::calculate_gradient(void) const
 
    int i = 0;
 
-   #pragma omp parallel for private(i, training_index, inputs, targets, first_order_forward_propagation, layers_inputs, layers_combination_parameters_Jacobian, \
+   #pragma omp parallel for private(i, inputs, targets, first_order_forward_propagation, layers_inputs, layers_combination_parameters_Jacobian, \
     output_gradient, layers_delta, particular_solution, homogeneous_solution, point_gradient)
 
    for(i = 0; i < (int)training_instances_number; i++)
    {
-       training_index = training_indices[i];
-
        // Data set
 
-      inputs = data_set_pointer->get_instance(training_index, inputs_indices);
+      data_set_pointer->get_training_inputs(i, inputs);
 
-      targets = data_set_pointer->get_instance(training_index, targets_indices);
+      data_set_pointer->get_training_targets(i, targets);
 
       // Neural network
 
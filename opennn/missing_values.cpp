@@ -708,7 +708,12 @@ Vector<size_t> MissingValues::arrange_missing_variables(void) const
 
 // void convert_time_series(const size_t&) method
 
-/// @todo Complete method.
+/// Converts the missing values to the lagged data set, which has lags_number instances less 
+/// and lags_number+1 times as many variables. 
+/// The instance i of the lagged data set reads the rows i to i+lags_number of the time series.
+/// Therefore, a missing value at row r and variable v of the time series is missing in the variable k*n+v of the instance r-k, 
+/// for every lag k such that that instance exists, where n is the number of variables in the time series. 
+/// @param lags_number Number of lags.
 
 void MissingValues::convert_time_series(const size_t& lags_number)
 {
@@ -716,35 +721,43 @@ void MissingValues::convert_time_series(const size_t& lags_number)
     {
         return;
     }
-/*
-    const size_t missing_values_number = get_missing_values_number();
 
-    //    const size_t new_missing_values_number = missing_values_number*(1+lags_number);
+    const size_t series_variables_number = variables_number;
+
+    instances_number = instances_number > lags_number ? instances_number - lags_number : 0;
+
+    variables_number *= 1 + lags_number;
+
+    const size_t missing_values_number = get_missing_values_number();
 
     Vector<Item> new_items;
 
-//    size_t instance_index;
-//    size_t variable_index;
+    new_items.reserve(missing_values_number*(1+lags_number));
+
+    size_t row_index;
 
     Item new_item;
 
     for(size_t i = 0; i < missing_values_number; i++)
     {
-        instance_index = items[i].instance_index;
-        variable_index = items[i].variable_index;
+        row_index = items[i].instance_index;
 
-        for(size_t j = 0; j < 1+lags_number; j++)
+        for(size_t k = 0; k <= lags_number && k <= row_index; k++)
         {
-            new_item.instance_index = items[i].instance_index+j;
+            if(row_index - k >= instances_number)
+            {
+                continue;
+            }
+
+            new_item.instance_index = row_index - k;
 
-            new_item.variable_index = items[i].variable_index*(1+j);
+            new_item.variable_index = k*series_variables_number + items[i].variable_index;
 
             new_items.push_back(new_item);
         }
     }
 
     set_items(new_items);
-*/
 }
 
 
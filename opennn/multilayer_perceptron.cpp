@@ -763,6 +763,32 @@ Vector<std::string> MultilayerPerceptron::write_layers_activation_function(void)
 }
 
 
+// bool get_fast_activation(void) const method
+
+/// Returns true if all the layers compute the logistic and hyperbolic tangent activations 
+/// with the fast exponential approximation, and false otherwise.
+
+bool MultilayerPerceptron::get_fast_activation(void) const
+{
+   const size_t layers_number = get_layers_number();
+
+   if(layers_number == 0)
+   {
+      return(false);
+   }
+
+   for(size_t i = 0; i < layers_number; i++)
+   {
+      if(!layers[i].get_fast_activation())
+      {
+         return(false);
+      }
+   }
+
+   return(true);
+}
+
+
 // const bool& get_display(void) const method
 
 /// Returns true if messages from this class are to be displayed on the screen, or false if messages 
@@ -1351,6 +1377,23 @@ void MultilayerPerceptron::set_layers_activation_function(const Vector<std::stri
 }
 
 
+// void set_fast_activation(const bool&) method
+
+/// Sets whether all the layers compute the logistic and hyperbolic tangent activations 
+/// with the fast exponential approximation, trading a relative error below 2e-7 for speed.
+/// @param new_fast_activation True for the fast approximation, false for the exact functions.
+
+void MultilayerPerceptron::set_fast_activation(const bool& new_fast_activation)
+{
+   const size_t layers_number = get_layers_number();
+
+   for(size_t i = 0; i < layers_number; i++)
+   {
+      layers[i].set_fast_activation(new_fast_activation);
+   }
+}
+
+
 // void set_display(const bool&) method
 
 /// Sets a new display value. 
@@ -1554,13 +1597,13 @@ void MultilayerPerceptron::prune_layer_perceptron(const size_t& layer_index, con
 
 void MultilayerPerceptron::initialize_random(void)
 {
-   const size_t architecture_size = rand()%10 + 2;
+   const size_t architecture_size = calculate_random_index(10) + 2;
 
    Vector<size_t> architecture(architecture_size);
 
    for(size_t i = 0; i < architecture_size; i++)
    {
-      architecture[i]  = rand()%10 + 1;
+      architecture[i]  = calculate_random_index(10) + 1;
    }
 
    set(architecture);
@@ -1571,7 +1614,7 @@ void MultilayerPerceptron::initialize_random(void)
 
    for(size_t i = 0; i < layers_number; i++)
    {
-      switch(rand()%5)
+      switch(calculate_random_index(5))
       {
          case 0:
          {
@@ -1889,6 +1932,8 @@ double MultilayerPerceptron::calculate_parameters_norm(void) const
 
 Vector<double> MultilayerPerceptron::calculate_outputs(const Vector<double>& inputs) const
 {
+   OPENNN_SCOPED_TIMER("multilayer_perceptron.forward_propagation");
+
    // Control sentence (if debug)
 
    #ifdef __OPENNN_DEBUG__ 
@@ -1932,6 +1977,56 @@ Vector<double> MultilayerPerceptron::calculate_outputs(const Vector<double>& inp
 }
 
 
+// Matrix<float> calculate_outputs(const Matrix<float>&) const method
+
+/// Returns the outputs from the multilayer perceptron for a batch of inputs in single precision. 
+/// The parameters are converted to single precision layer by layer, 
+/// and each layer is evaluated with a single matrix product. 
+/// This halves the memory traffic with respect to the double precision methods, 
+/// at the cost of about seven significant digits in the outputs. 
+/// @param inputs Matrix of inputs, with the instances in the rows and the inputs in the columns.
+
+Matrix<float> MultilayerPerceptron::calculate_outputs(const Matrix<float>& inputs) const
+{
+   // Control sentence (if debug)
+
+   #ifdef __OPENNN_DEBUG__ 
+
+   const size_t columns_number = inputs.get_columns_number();
+
+   const size_t inputs_number = get_inputs_number();
+
+   if(columns_number != inputs_number) 
+   {
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: MultilayerPerceptron class.\n"
+             << "Matrix<float> calculate_outputs(const Matrix<float>&) const method.\n"
+             << "Number of columns of inputs (" << columns_number <<") must be equal to number of inputs (" << inputs_number << ").\n";
+
+	  throw std::logic_error(buffer.str());
+   }   
+   
+   #endif
+
+   const size_t layers_number = get_layers_number();
+
+   if(layers_number == 0)
+   {
+      return(Matrix<float>());
+   }
+
+   Matrix<float> outputs = layers[0].calculate_outputs(inputs);
+
+   for(size_t i = 1; i < layers_number; i++)
+   {
+      outputs = layers[i].calculate_outputs(outputs);
+   }
+
+   return(outputs);
+}
+
+
 // Matrix<double> calculate_Jacobian(const Vector<double>&) const method
 
 /// Returns the partial derivatives of the outputs from the last layer with respect to the inputs to the first layer.
@@ -2029,7 +2124,7 @@ Vector< Matrix<double> > MultilayerPerceptron::calculate_Hessian_form(const Vect
    {
       for(size_t output_index = 0; output_index < outputs_number; output_index++)
       {
-         Hessian_form[output_index] = (layers_Jacobian[layer_index].calculate_transpose()).dot(Hessian_form[output_index]).dot(layers_Jacobian[layer_index]);
+         Hessian_form[output_index] = layers_Jacobian[layer_index].transpose_dot(Hessian_form[output_index]).dot(layers_Jacobian[layer_index]);
 
          for(size_t neuron_index = 0; neuron_index < layers_size[layer_index]; neuron_index++)
 	     {
@@ -2610,6 +2705,79 @@ Vector<double> MultilayerPerceptron::calculate_outputs(const Vector<double>& inp
 }
 
 
+// Vector<double> calculate_output_combinations(const Vector<double>&) const method
+
+/// Returns the combinations of the output layer for a given vector of inputs.
+/// These are the outputs from the multilayer perceptron before the activation function of the last layer,
+/// which loss functions such as the cross entropy can use to avoid saturation of the activations.
+/// @param inputs Vector of inputs to the first layer of the multilayer perceptron.
+
+Vector<double> MultilayerPerceptron::calculate_output_combinations(const Vector<double>& inputs) const
+{
+   const size_t layers_number = get_layers_number();
+
+   Vector<double> output_combinations;
+
+   if(layers_number == 0)
+   {
+      return(output_combinations);
+   }
+
+   Vector<double> outputs(inputs);
+
+   for(size_t i = 0; i < layers_number-1; i++)
+   {
+      outputs = layers[i].calculate_outputs(outputs);
+   }
+
+   output_combinations = layers[layers_number-1].calculate_combinations(outputs);
+
+   return(output_combinations);
+}
+
+
+// Vector<double> calculate_output_combinations(const Vector<double>&, const Vector<double>&) const method
+
+/// Returns the combinations of the output layer for given sets of inputs and parameters.
+/// @param inputs Vector of inputs to the first layer of the multilayer perceptron.
+/// @param parameters Vector of potential parameters for the multilayer perceptron.
+
+Vector<double> MultilayerPerceptron::calculate_output_combinations(const Vector<double>& inputs, const Vector<double>& parameters) const
+{
+   const size_t layers_number = get_layers_number();
+
+   Vector<double> output_combinations;
+
+   if(layers_number == 0)
+   {
+      return(output_combinations);
+   }
+
+   const Vector<size_t> layers_parameters_numbers = count_layers_parameters_numbers();
+
+   const Vector<size_t> layers_cumulative_parameters_number = arrange_layers_cumulative_parameters_number();
+
+   Vector<double> layer_parameters;
+
+   Vector<double> outputs(inputs);
+
+   for(size_t i = 0; i < layers_number-1; i++)
+   {
+      layer_parameters = parameters.take_out(i == 0 ? 0 : layers_cumulative_parameters_number[i-1], layers_parameters_numbers[i]);
+
+      outputs = layers[i].calculate_outputs(outputs, layer_parameters);
+   }
+
+   const size_t output_layer_index = layers_number-1;
+
+   layer_parameters = parameters.take_out(output_layer_index == 0 ? 0 : layers_cumulative_parameters_number[output_layer_index-1], layers_parameters_numbers[output_layer_index]);
+
+   output_combinations = layers[output_layer_index].calculate_combinations(outputs, layer_parameters);
+
+   return(output_combinations);
+}
+
+
 // Matrix<double> calculate_parameters_Jacobian(const Vector<double>&, const Vector<double>&) const method
 
 /// Calculates the parameters matrix of the multilayer perceptron for an inputs vector. 
@@ -3403,6 +3571,8 @@ Matrix < Matrix<double> > MultilayerPerceptron::calculate_interlayers_combinatio
 
 Vector< Vector< Vector<double> > > MultilayerPerceptron::calculate_first_order_forward_propagation(const Vector<double>& inputs) const
 {
+   OPENNN_SCOPED_TIMER("multilayer_perceptron.first_order_forward_propagation");
+
    // Control sentence (if debug)
 
    #ifdef __OPENNN_DEBUG__ 
@@ -3433,19 +3603,24 @@ Vector< Vector< Vector<double> > > MultilayerPerceptron::calculate_first_order_f
    first_order_forward_propagation[0].set(layers_number);
    first_order_forward_propagation[1].set(layers_number);
 
-   layers_combination[0] = layers[0].calculate_combinations(inputs);
-
-   first_order_forward_propagation[0][0] = layers[0].calculate_activations(layers_combination[0]);
-
-   first_order_forward_propagation[1][0] = layers[0].calculate_activations_derivatives(layers_combination[0]);
+   Vector< Vector<double> > layer_activations_and_derivatives(2);
 
-   for(size_t i = 1; i < layers_number; i++)
+   for(size_t i = 0; i < layers_number; i++)
    {
-      layers_combination[i] = layers[i].calculate_combinations(first_order_forward_propagation[0][i-1]);
+      if(i == 0)
+      {
+         layers_combination[i] = layers[i].calculate_combinations(inputs);
+      }
+      else
+      {
+         layers_combination[i] = layers[i].calculate_combinations(first_order_forward_propagation[0][i-1]);
+      }
+
+      layer_activations_and_derivatives = layers[i].calculate_activations_and_derivatives(layers_combination[i]);
 
-      first_order_forward_propagation[0][i] = layers[i].calculate_activations(layers_combination[i]);
+      first_order_forward_propagation[0][i] = layer_activations_and_derivatives[0];
 
-      first_order_forward_propagation[1][i] = layers[i].calculate_activations_derivatives(layers_combination[i]);
+      first_order_forward_propagation[1][i] = layer_activations_and_derivatives[1];
    }
 
    return(first_order_forward_propagation);
@@ -3584,6 +3759,18 @@ tinyxml2::XMLDocument* MultilayerPerceptron::to_XML(void) const
       parameters_element->LinkEndChild(parameters_text);
    }
 
+   // Fast activation
+   {
+      tinyxml2::XMLElement* fast_activation_element = document->NewElement("FastActivation");
+      multilayer_perceptron_element->LinkEndChild(fast_activation_element);
+
+      buffer.str("");
+      buffer << get_fast_activation();
+
+      tinyxml2::XMLText* fast_activation_text = document->NewText(buffer.str().c_str());
+      fast_activation_element->LinkEndChild(fast_activation_text);
+   }
+
    // Display
    {
       tinyxml2::XMLElement* display_element = document->NewElement("Display");
@@ -3689,6 +3876,25 @@ void MultilayerPerceptron::from_XML(const tinyxml2::XMLDocument& document)
          }
       }
 
+      // Fast activation
+      {
+         const tinyxml2::XMLElement* fast_activation_element = root_element->FirstChildElement("FastActivation");
+
+         if(fast_activation_element)
+         {
+            const std::string new_fast_activation_string = fast_activation_element->GetText();
+
+            try
+            {
+               set_fast_activation(new_fast_activation_string != "0");
+            }
+            catch(const std::logic_error& e)
+            {
+               std::cout << e.what() << std::endl;
+            }
+         }
+      }
+
       // Display 
       {         
          const tinyxml2::XMLElement* display_element = root_element->FirstChildElement("Display");
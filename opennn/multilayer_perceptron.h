@@ -256,6 +256,8 @@ public:
    Vector<Perceptron::ActivationFunction> get_layers_activation_function(void) const;
    Vector<std::string> write_layers_activation_function(void) const;
 
+   bool get_fast_activation(void) const;
+
    // Display messages
 
    const bool& get_display(void) const;
@@ -318,6 +320,8 @@ public:
 
    void set_layer_activation_function(const size_t&, const Perceptron::ActivationFunction&);
 
+   void set_fast_activation(const bool&);
+
 
    // Display messages
 
@@ -401,6 +405,7 @@ public:
    // Output 
 
    Vector<double> calculate_outputs(const Vector<double>&) const;
+   Matrix<float> calculate_outputs(const Matrix<float>&) const;
    Matrix<double> calculate_Jacobian(const Vector<double>&) const;
    Vector< Matrix<double> > calculate_Hessian_form(const Vector<double>&) const;
 
@@ -408,6 +413,9 @@ public:
    Matrix<double> calculate_Jacobian(const Vector<double>&, const Vector<double>&) const;
    Vector< Matrix<double> > calculate_Hessian_form(const Vector<double>&, const Vector<double>&) const;
 
+   Vector<double> calculate_output_combinations(const Vector<double>&) const;
+   Vector<double> calculate_output_combinations(const Vector<double>&, const Vector<double>&) const;
+
    // Serialization methods
 
    tinyxml2::XMLDocument* to_XML(void) const;
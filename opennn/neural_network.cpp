@@ -35,6 +35,7 @@ NeuralNetwork::NeuralNetwork(void)
  , inputs_pointer(NULL)
  , outputs_pointer(NULL)
  , independent_parameters_pointer(NULL)
+ , parameters_override_pointer(NULL)
 {
    set_default();
 }
@@ -57,6 +58,7 @@ NeuralNetwork::NeuralNetwork(const MultilayerPerceptron& new_multilayer_perceptr
  , inputs_pointer(NULL)
  , outputs_pointer(NULL)
  , independent_parameters_pointer(NULL)
+ , parameters_override_pointer(NULL)
 {
    multilayer_perceptron_pointer = new MultilayerPerceptron(new_multilayer_perceptron);
 
@@ -90,6 +92,7 @@ NeuralNetwork::NeuralNetwork(const Vector<size_t>& new_multilayer_perceptron_arc
  , inputs_pointer(NULL)
  , outputs_pointer(NULL)
  , independent_parameters_pointer(NULL)
+ , parameters_override_pointer(NULL)
 {
    multilayer_perceptron_pointer = new MultilayerPerceptron(new_multilayer_perceptron_architecture);
 
@@ -122,6 +125,7 @@ NeuralNetwork::NeuralNetwork(const size_t& new_inputs_number, const size_t& new_
  , inputs_pointer(NULL)
  , outputs_pointer(NULL)
  , independent_parameters_pointer(NULL)
+ , parameters_override_pointer(NULL)
 {
    multilayer_perceptron_pointer = new MultilayerPerceptron(new_inputs_number, new_perceptrons_number);
 
@@ -155,6 +159,7 @@ NeuralNetwork::NeuralNetwork(const size_t& new_inputs_number, const size_t& new_
  , inputs_pointer(NULL)
  , outputs_pointer(NULL)
  , independent_parameters_pointer(NULL)
+ , parameters_override_pointer(NULL)
 {
    multilayer_perceptron_pointer = new MultilayerPerceptron(new_inputs_number, new_hidden_perceptrons_number, new_output_perceptrons_number);
 
@@ -185,6 +190,7 @@ NeuralNetwork::NeuralNetwork(const size_t& new_independent_parameters_number)
  , inputs_pointer(NULL)
  , outputs_pointer(NULL)
  , independent_parameters_pointer(NULL)
+ , parameters_override_pointer(NULL)
 {
    independent_parameters_pointer = new IndependentParameters(new_independent_parameters_number);
 
@@ -209,6 +215,7 @@ NeuralNetwork::NeuralNetwork(const std::string& file_name)
  , inputs_pointer(NULL)
  , outputs_pointer(NULL)
  , independent_parameters_pointer(NULL)
+ , parameters_override_pointer(NULL)
 {
    load(file_name);
 }
@@ -230,6 +237,7 @@ NeuralNetwork::NeuralNetwork(const tinyxml2::XMLDocument& document)
  , inputs_pointer(NULL)
  , outputs_pointer(NULL)
  , independent_parameters_pointer(NULL)
+ , parameters_override_pointer(NULL)
 {
    from_XML(document);
 }
@@ -251,26 +259,70 @@ NeuralNetwork::NeuralNetwork(const NeuralNetwork& other_neural_network)
  , inputs_pointer(NULL)
  , outputs_pointer(NULL)
  , independent_parameters_pointer(NULL)
+ , parameters_override_pointer(NULL)
 {
    set(other_neural_network);
 }
 
 
+// PARAMETERS OVERRIDE CONSTRUCTOR
+
+/// Parameters override constructor.
+/// It creates a non-owning evaluation view of an existing neural network with a different set of parameters.
+/// All the layers, the inputs and outputs information and the independent parameters are shared with the other neural network,
+/// and nothing is copied or deleted by this object. 
+/// The view keeps a pointer to the parameters vector, and the outputs are calculated reading the weights directly from it.
+/// Mathematical models and performance terms must evaluate the view through the neural network methods,
+/// such as calculate_outputs() or arrange_independent_parameters(), and not through the layers,
+/// which hold the parameters of the other neural network.
+/// The view is intended to be used as a constant object, and both the other neural network and the parameters vector must outlive it.
+/// @param other_neural_network Neural network object to be viewed.
+/// @param new_parameters Parameters of the view.
+
+NeuralNetwork::NeuralNetwork(const NeuralNetwork& other_neural_network, const Vector<double>& new_parameters)
+ : multilayer_perceptron_pointer(other_neural_network.multilayer_perceptron_pointer)
+ , scaling_layer_pointer(other_neural_network.scaling_layer_pointer)
+ , unscaling_layer_pointer(other_neural_network.unscaling_layer_pointer)
+ , bounding_layer_pointer(other_neural_network.bounding_layer_pointer)
+ , probabilistic_layer_pointer(other_neural_network.probabilistic_layer_pointer)
+ , conditions_layer_pointer(other_neural_network.conditions_layer_pointer)
+ , inputs_pointer(other_neural_network.inputs_pointer)
+ , outputs_pointer(other_neural_network.outputs_pointer)
+ , independent_parameters_pointer(other_neural_network.independent_parameters_pointer)
+ , parameters_override_pointer(&new_parameters)
+{
+   // Control sentence (if debug)
+
+   #ifdef __OPENNN_DEBUG__ 
+
+   const size_t size = new_parameters.size();
+
+   const size_t parameters_number = other_neural_network.count_parameters_number();
+
+   if(size != parameters_number)
+   {
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: NeuralNetwork class.\n"
+             << "NeuralNetwork(const NeuralNetwork&, const Vector<double>&) constructor.\n"
+             << "Size must be equal to number of parameters.\n";
+
+      throw std::logic_error(buffer.str());
+   }
+
+   #endif
+
+   display = other_neural_network.display;
+}
+
+
 // DESTRUCTOR
 
 /// Destructor.
 
 NeuralNetwork::~NeuralNetwork(void)
 {
-   delete multilayer_perceptron_pointer;
-   delete scaling_layer_pointer;
-   delete unscaling_layer_pointer;
-   delete bounding_layer_pointer;
-   delete probabilistic_layer_pointer;
-   delete conditions_layer_pointer;
-   delete inputs_pointer;
-   delete outputs_pointer;
-   delete independent_parameters_pointer;
+   delete_pointers();
 }
 
 
@@ -927,6 +979,13 @@ void NeuralNetwork::set(const NeuralNetwork& other_neural_network)
       independent_parameters_pointer = new IndependentParameters(*other_neural_network.independent_parameters_pointer);
    }
 
+   // Parameters of a parameters override view
+
+   if(other_neural_network.parameters_override_pointer)
+   {
+      set_parameters(*other_neural_network.parameters_override_pointer);
+   }
+
    // Other
 
    display = other_neural_network.display;
@@ -1287,6 +1346,13 @@ size_t NeuralNetwork::count_parameters_number(void) const
 
 Vector<double> NeuralNetwork::arrange_parameters(void) const 
 {
+   // Parameters override view
+
+   if(parameters_override_pointer)
+   {
+      return(*parameters_override_pointer);
+   }
+
    // Only network parameters 
 
    if(multilayer_perceptron_pointer && !independent_parameters_pointer)
@@ -1323,13 +1389,55 @@ Vector<double> NeuralNetwork::arrange_parameters(void) const
 }
 
 
+// Vector<double> arrange_independent_parameters(void) const method
+
+/// Returns the unscaled values of the independent parameters. 
+/// For a parameters override view, they are calculated from the scaled independent parameters at the end of its parameters vector.
+/// If there are no independent parameters, it returns an empty vector. 
+
+Vector<double> NeuralNetwork::arrange_independent_parameters(void) const 
+{
+   if(!independent_parameters_pointer)
+   {
+      const Vector<double> independent_parameters;
+
+      return(independent_parameters);
+   }
+
+   if(!parameters_override_pointer)
+   {
+      return(independent_parameters_pointer->get_parameters());
+   }
+
+   const size_t independent_parameters_number = independent_parameters_pointer->get_parameters_number();
+
+   const size_t neural_parameters_number = parameters_override_pointer->size() - independent_parameters_number;
+
+   const Vector<double> scaled_independent_parameters = parameters_override_pointer->take_out(neural_parameters_number, independent_parameters_number);
+
+   return(independent_parameters_pointer->calculate_unscaled_parameters(scaled_independent_parameters));
+}
+
+
 // void set_parameters(const Vector<double>&) method
 
 /// Sets all the parameters (multilayer_perceptron_pointer parameters and independent parameters) from a single vector.
+/// The parameters of a parameters override view cannot be set, since its layers are shared with other neural network.
 /// @param new_parameters New set of parameter values. 
 
 void NeuralNetwork::set_parameters(const Vector<double>& new_parameters)
 {
+   if(parameters_override_pointer)
+   {
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: NeuralNetwork class.\n"
+             << "void set_parameters(const Vector<double>&) method.\n"
+             << "Cannot set the parameters of a parameters override view.\n";
+
+      throw std::logic_error(buffer.str());
+   }
+
    // Control sentence (if debug)
 
    #ifdef __OPENNN_DEBUG__ 
@@ -1404,6 +1512,23 @@ void NeuralNetwork::set_parameters(const Vector<double>& new_parameters)
 
 void NeuralNetwork::delete_pointers(void)
 {
+   if(parameters_override_pointer)
+   {
+      // Pointers shared with the overridden neural network
+
+      multilayer_perceptron_pointer = NULL;
+      scaling_layer_pointer = NULL;
+      unscaling_layer_pointer = NULL;
+      bounding_layer_pointer = NULL;
+      probabilistic_layer_pointer = NULL;
+      conditions_layer_pointer = NULL;
+      inputs_pointer = NULL;
+      outputs_pointer = NULL;
+      independent_parameters_pointer = NULL;
+
+      parameters_override_pointer = NULL;
+   }
+
    delete multilayer_perceptron_pointer;
    delete scaling_layer_pointer;
    delete unscaling_layer_pointer;
@@ -1723,7 +1848,7 @@ void NeuralNetwork::initialize_random(void)
 
    // Multilayer perceptron
 
-   if(rand()%5)
+   if(calculate_random_index(5))
    {
       if(!multilayer_perceptron_pointer)
       {
@@ -1737,13 +1862,13 @@ void NeuralNetwork::initialize_random(void)
    }
    else
    {
-      inputs_number =  rand()%10 + 1;
-      outputs_number =  rand()%10 + 1;
+      inputs_number =  calculate_random_index(10) + 1;
+      outputs_number =  calculate_random_index(10) + 1;
    }
 
    // Scaling layer
 
-   if(rand()%5)
+   if(calculate_random_index(5))
    {
       if(!scaling_layer_pointer)
       {
@@ -1755,7 +1880,7 @@ void NeuralNetwork::initialize_random(void)
 
    // Unscaling layer
 
-   if(rand()%5)
+   if(calculate_random_index(5))
    {
       if(!unscaling_layer_pointer)
       {
@@ -1767,7 +1892,7 @@ void NeuralNetwork::initialize_random(void)
 
    // Bounding layer 
 
-   if(rand()%5)
+   if(calculate_random_index(5))
    {
       if(!bounding_layer_pointer)
       {
@@ -1779,7 +1904,7 @@ void NeuralNetwork::initialize_random(void)
 
    // Probabilistic layer
 
-   if(rand()%5)
+   if(calculate_random_index(5))
    {
       if(!probabilistic_layer_pointer)
       {
@@ -1791,7 +1916,7 @@ void NeuralNetwork::initialize_random(void)
 
    // Conditions layer
 
-   if(rand()%5)
+   if(calculate_random_index(5))
    {
       if(!conditions_layer_pointer)
       {
@@ -1803,7 +1928,7 @@ void NeuralNetwork::initialize_random(void)
 
    // Inputs
 
-   if(rand()%5)
+   if(calculate_random_index(5))
    {
       if(!inputs_pointer)
       {
@@ -1813,7 +1938,7 @@ void NeuralNetwork::initialize_random(void)
 
    // Outputs
 
-   if(rand()%5)
+   if(calculate_random_index(5))
    {
       if(!outputs_pointer)
       {
@@ -1823,7 +1948,7 @@ void NeuralNetwork::initialize_random(void)
 
    // Independent parameters 
 
-   if(rand()%5)
+   if(calculate_random_index(5))
    {
       if(!independent_parameters_pointer)
       {
@@ -2337,6 +2462,11 @@ Vector<double> NeuralNetwork::calculate_outputs(const Vector<double>& inputs) co
    
    #endif
 
+   if(parameters_override_pointer)
+   {
+      return(calculate_outputs(inputs, *parameters_override_pointer));
+   }
+
    Vector<double> outputs(inputs);
 
    // Scaling layer
@@ -2385,6 +2515,146 @@ Vector<double> NeuralNetwork::calculate_outputs(const Vector<double>& inputs) co
 }
 
 
+// Matrix<float> calculate_outputs(const Matrix<float>&) const method
+
+/// Calculates the outputs of the neural network for a batch of inputs in single precision.
+/// The inputs go through the same layers as in the double precision outputs,
+/// and each layer processes the whole batch at once. 
+/// The conditions layer, if any, is applied to each instance in double precision.
+/// @param inputs Matrix of inputs, with the instances in the rows and the inputs in the columns.
+
+Matrix<float> NeuralNetwork::calculate_outputs(const Matrix<float>& inputs) const
+{
+   // Control sentence (if debug)
+
+   #ifdef __OPENNN_DEBUG__ 
+
+   if(multilayer_perceptron_pointer)
+   {
+      const size_t columns_number = inputs.get_columns_number();
+
+      const size_t inputs_number = multilayer_perceptron_pointer->get_inputs_number();
+
+      if(columns_number != inputs_number) 
+      {
+         std::ostringstream buffer;
+
+         buffer << "OpenNN Exception: NeuralNetwork class.\n"
+                << "Matrix<float> calculate_outputs(const Matrix<float>&) const method.\n"
+                << "Number of columns of inputs must be equal to number of inputs.\n";
+
+	   throw std::logic_error(buffer.str());
+      }
+   }
+   
+   #endif
+
+   // Parameters override view
+
+   if(parameters_override_pointer)
+   {
+      const size_t rows_number = inputs.get_rows_number();
+
+      const size_t inputs_number = inputs.get_columns_number();
+      const size_t outputs_number = get_outputs_number();
+
+      Matrix<float> outputs(rows_number, outputs_number);
+
+      Vector<double> instance_inputs(inputs_number);
+      Vector<double> instance_outputs(outputs_number);
+
+      for(size_t i = 0; i < rows_number; i++)
+      {
+         for(size_t j = 0; j < inputs_number; j++)
+         {
+            instance_inputs[j] = inputs(i,j);
+         }
+
+         instance_outputs = calculate_outputs(instance_inputs, *parameters_override_pointer);
+
+         for(size_t j = 0; j < outputs_number; j++)
+         {
+            outputs(i,j) = (float)instance_outputs[j];
+         }
+      }
+
+      return(outputs);
+   }
+
+   Matrix<float> outputs(inputs);
+
+   // Scaling layer
+
+   if(scaling_layer_pointer)
+   {
+      outputs = scaling_layer_pointer->calculate_outputs(inputs);
+   }
+
+   // Multilayer perceptron
+
+   if(multilayer_perceptron_pointer)
+   {
+      outputs = multilayer_perceptron_pointer->calculate_outputs(outputs);
+   }
+
+   // Conditions
+
+   if(conditions_layer_pointer)
+   {
+      const size_t rows_number = inputs.get_rows_number();
+
+      const size_t inputs_number = inputs.get_columns_number();
+      const size_t outputs_number = outputs.get_columns_number();
+
+      Vector<double> instance_inputs(inputs_number);
+      Vector<double> instance_outputs(outputs_number);
+
+      for(size_t i = 0; i < rows_number; i++)
+      {
+         for(size_t j = 0; j < inputs_number; j++)
+         {
+            instance_inputs[j] = inputs(i,j);
+         }
+
+         for(size_t j = 0; j < outputs_number; j++)
+         {
+            instance_outputs[j] = outputs(i,j);
+         }
+
+         instance_outputs = conditions_layer_pointer->calculate_outputs(instance_inputs, instance_outputs);
+
+         for(size_t j = 0; j < outputs_number; j++)
+         {
+            outputs(i,j) = (float)instance_outputs[j];
+         }
+      }
+   }
+
+   // Unscaling layer
+
+   if(unscaling_layer_pointer)
+   {
+      outputs = unscaling_layer_pointer->calculate_outputs(outputs);
+   }
+
+   // Probabilistic layer
+
+   if(probabilistic_layer_pointer)
+   {
+      outputs = probabilistic_layer_pointer->calculate_outputs(outputs);   
+   }
+
+   // Bounding layer
+
+   if(bounding_layer_pointer)
+   {
+      outputs = bounding_layer_pointer->calculate_outputs(outputs);
+   }
+
+   return(outputs);
+}
+
+
 // Matrix<double> calculate_directional_input_data(const size_t&, const Vector<double>&, const double&, const double&, const size_t& = 101) const
 
 /// Calculates the input data which is necessary to compute the output data from the neural network in some direction.
@@ -2476,7 +2746,16 @@ Vector<double> NeuralNetwork::calculate_outputs(const Vector<double>& inputs, co
 
    if(multilayer_perceptron_pointer)
    {
-      outputs = multilayer_perceptron_pointer->calculate_outputs(outputs, parameters);
+      const size_t neural_parameters_number = multilayer_perceptron_pointer->count_parameters_number();
+
+      if(parameters.size() == neural_parameters_number)
+      {
+         outputs = multilayer_perceptron_pointer->calculate_outputs(outputs, parameters);
+      }
+      else
+      {
+         outputs = multilayer_perceptron_pointer->calculate_outputs(outputs, parameters.take_out(0, neural_parameters_number));
+      }
    }
 
    // Conditions
@@ -2636,6 +2915,17 @@ Matrix<double> NeuralNetwork::calculate_Jacobian(const Vector<double>& inputs) c
 
    #endif
 
+   if(parameters_override_pointer)
+   {
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: NeuralNetwork class.\n"
+             << "Matrix<double> calculate_Jacobian(const Vector<double>&) const method.\n"
+             << "Jacobian is not available for a parameters override view.\n";
+
+      throw std::logic_error(buffer.str());
+   }
+
    Vector<double> outputs(inputs);
 
    Matrix<double> scaling_layer_Jacobian;
@@ -2797,6 +3087,17 @@ Matrix<double> NeuralNetwork::calculate_Jacobian(const Vector<double>& inputs, c
 
 Vector< Matrix<double> > NeuralNetwork::calculate_Hessian_form(const Vector<double>& inputs) const
 {
+   if(parameters_override_pointer)
+   {
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: NeuralNetwork class.\n"
+             << "Vector< Matrix<double> > calculate_Hessian_form(const Vector<double>&) const method.\n"
+             << "Hessian form is not available for a parameters override view.\n";
+
+      throw std::logic_error(buffer.str());
+   }
+
    return(multilayer_perceptron_pointer->calculate_Hessian_form(inputs));
 }
 
@@ -3363,110 +3664,626 @@ void NeuralNetwork::save_parameters(const std::string& file_name) const
 }
 
 
-// void load(const std::string&) method
+// void save_binary(const std::string&) const method
 
-/// Loads from a XML file the members for this neural network object.
-/// Please mind about the file format, which is specified in the User's Guide. 
-/// @param file_name Name of neural network XML file.
+/// Saves the neural network to a compact binary file, which can be loaded much faster than the XML file.
+/// All the values are stored little-endian, in the following order:
+/// <ul>
+/// <li> Header: the characters "OPENNNB" followed by a null character, the format version and a flags word
+/// telling which of the scaling, unscaling, bounding and probabilistic layers are present (32 bits each).
+/// <li> Multilayer perceptron architecture (64 bits size followed by 64 bits values) and, for each layer, 
+/// its activation function and whether it uses the fast activation approximation (32 bits each).
+/// <li> Scaling layer method and, for each input, minimum, maximum, mean and standard deviation.
+/// <li> Unscaling layer method and, for each output, minimum, maximum, mean and standard deviation.
+/// <li> Bounding layer lower and upper bounds.
+/// <li> Probabilistic layer method and decision threshold.
+/// <li> Multilayer perceptron parameters, as a 64 bits size followed by a single block of doubles.
+/// </ul>
+/// The inputs and outputs information, the conditions layer and the independent parameters are not saved. 
+/// @param file_name Name of neural network binary file.
 
-void NeuralNetwork::load(const std::string& file_name)
+void NeuralNetwork::save_binary(const std::string& file_name) const
 {
-    set_default();
-
-   tinyxml2::XMLDocument document;
+   const uint32_t endianness_test = 1;
 
-   if(document.LoadFile(file_name.c_str()))
+   if(!multilayer_perceptron_pointer || *reinterpret_cast<const char*>(&endianness_test) != 1)
    {
-       std::ostringstream buffer;
+      std::ostringstream buffer;
 
       buffer << "OpenNN Exception: NeuralNetwork class.\n"
-             << "void load(const std::string&) method.\n"
-             << "Cannot load XML file " << file_name << ".\n";
+             << "void save_binary(const std::string&) const method.\n"
+             << "Binary files require a multilayer perceptron and a little-endian host.\n";
 
       throw std::logic_error(buffer.str());
    }
 
-   from_XML(document);
-}
-
-
-// void load_parameters(const std::string&) method
-
-/// Loads the multilayer perceptron parameters from a data file.
-/// The format of this file is just a sequence of numbers. 
-/// @param file_name Name of parameters data file. 
-
-void NeuralNetwork::load_parameters(const std::string& file_name)
-{
-   std::ifstream file(file_name.c_str());
+   std::ofstream file(file_name.c_str(), std::ios::binary);
 
    if(!file.is_open())
    {
       std::ostringstream buffer;
 
       buffer << "OpenNN Exception: NeuralNetwork class.\n"
-             << "void load_parameters(const std::string&) method.\n"
-             << "Cannot open parameters data file.\n";
+             << "void save_binary(const std::string&) const method.\n"
+             << "Cannot open neural network binary file: " << file_name << "\n";
 
-	  throw std::logic_error(buffer.str());
+      throw std::logic_error(buffer.str());
    }
 
-   const size_t parameters_number = count_parameters_number();
-
-   Vector<double> new_parameters(parameters_number);
+   // Header
 
-   new_parameters.load(file_name);
+   const uint32_t version = 2;
 
-   set_parameters(new_parameters);
+   uint32_t flags = 0;
 
-   file.close();
-}
+   if(scaling_layer_pointer) flags |= 1;
+   if(unscaling_layer_pointer) flags |= 2;
+   if(bounding_layer_pointer) flags |= 4;
+   if(probabilistic_layer_pointer) flags |= 8;
 
+   file.write("OPENNNB", 8);
+   file.write(reinterpret_cast<const char*>(&version), sizeof(uint32_t));
+   file.write(reinterpret_cast<const char*>(&flags), sizeof(uint32_t));
 
-// std::string write_expression(void) const method
+   // Multilayer perceptron architecture
 
-/// Returns a string with the expression of the function represented by the neural network.
+   const Vector<size_t> architecture = multilayer_perceptron_pointer->arrange_architecture();
+   const Vector<Perceptron::ActivationFunction> activation_functions = multilayer_perceptron_pointer->get_layers_activation_function();
 
-std::string NeuralNetwork::write_expression(void) const
-{
-   std::ostringstream buffer;
+   const uint64_t architecture_size = architecture.size();
 
-   #ifdef __OPENNN_DEBUG__ 
+   file.write(reinterpret_cast<const char*>(&architecture_size), sizeof(uint64_t));
 
-   if(!inputs_pointer)
+   for(size_t i = 0; i < architecture.size(); i++)
    {
-      buffer.str("");
-
-      buffer << "OpenNN Exception: NeuralNetwork class.\n"
-             << "std::string write_expression(void) const method.\n"
-             << "Pointer to inputs is NULL.\n";
+      const uint64_t size = architecture[i];
 
-	  throw std::logic_error(buffer.str());
+      file.write(reinterpret_cast<const char*>(&size), sizeof(uint64_t));
    }
 
-   if(!multilayer_perceptron_pointer)
+   for(size_t i = 0; i < activation_functions.size(); i++)
    {
-      buffer.str("");
+      const uint32_t activation_function = activation_functions[i];
+      const uint32_t fast_activation = multilayer_perceptron_pointer->get_layer(i).get_fast_activation();
 
-      buffer << "OpenNN Exception: NeuralNetwork class.\n"
-             << "std::string write_expression(void) const method.\n"
-             << "Pointer to multilayer perceptron is NULL.\n";
-
-	  throw std::logic_error(buffer.str());
+      file.write(reinterpret_cast<const char*>(&activation_function), sizeof(uint32_t));
+      file.write(reinterpret_cast<const char*>(&fast_activation), sizeof(uint32_t));
    }
 
-   if(!outputs_pointer)
+   // Scaling layer
+
+   if(scaling_layer_pointer)
    {
-      buffer.str("");
+      const uint32_t scaling_method = scaling_layer_pointer->get_scaling_method();
 
-      buffer << "OpenNN Exception: NeuralNetwork class.\n"
-             << "std::string write_expression(void) const method.\n"
-             << "Pointer to outputs is NULL.\n";
+      file.write(reinterpret_cast<const char*>(&scaling_method), sizeof(uint32_t));
 
-      throw std::logic_error(buffer.str());
-   }
+      const Vector< Statistics<double> > statistics = scaling_layer_pointer->get_statistics();
 
-   #endif
+      for(size_t i = 0; i < statistics.size(); i++)
+      {
+         const double values[4] = {statistics[i].minimum, statistics[i].maximum, statistics[i].mean, statistics[i].standard_deviation};
+
+         file.write(reinterpret_cast<const char*>(values), 4*sizeof(double));
+      }
+   }
+
+   // Unscaling layer
+
+   if(unscaling_layer_pointer)
+   {
+      const uint32_t unscaling_method = unscaling_layer_pointer->get_unscaling_method();
+
+      file.write(reinterpret_cast<const char*>(&unscaling_method), sizeof(uint32_t));
+
+      const Vector< Statistics<double> > statistics = unscaling_layer_pointer->get_statistics();
+
+      for(size_t i = 0; i < statistics.size(); i++)
+      {
+         const double values[4] = {statistics[i].minimum, statistics[i].maximum, statistics[i].mean, statistics[i].standard_deviation};
+
+         file.write(reinterpret_cast<const char*>(values), 4*sizeof(double));
+      }
+   }
+
+   // Bounding layer
+
+   if(bounding_layer_pointer)
+   {
+      const Vector<double>& lower_bounds = bounding_layer_pointer->get_lower_bounds();
+      const Vector<double>& upper_bounds = bounding_layer_pointer->get_upper_bounds();
+
+      file.write(reinterpret_cast<const char*>(lower_bounds.data()), lower_bounds.size()*sizeof(double));
+      file.write(reinterpret_cast<const char*>(upper_bounds.data()), upper_bounds.size()*sizeof(double));
+   }
+
+   // Probabilistic layer
+
+   if(probabilistic_layer_pointer)
+   {
+      const uint32_t probabilistic_method = probabilistic_layer_pointer->get_probabilistic_method();
+
+      file.write(reinterpret_cast<const char*>(&probabilistic_method), sizeof(uint32_t));
+      file.write(reinterpret_cast<const char*>(&probabilistic_layer_pointer->get_decision_threshold()), sizeof(double));
+   }
+
+   // Parameters
+
+   const Vector<double> parameters = multilayer_perceptron_pointer->arrange_parameters();
+
+   const uint64_t parameters_number = parameters.size();
+
+   file.write(reinterpret_cast<const char*>(&parameters_number), sizeof(uint64_t));
+   file.write(reinterpret_cast<const char*>(parameters.data()), parameters.size()*sizeof(double));
+
+   if(!file)
+   {
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: NeuralNetwork class.\n"
+             << "void save_binary(const std::string&) const method.\n"
+             << "Cannot write neural network binary file: " << file_name << "\n";
+
+      throw std::logic_error(buffer.str());
+   }
+
+   file.close();
+}
+
+
+// void load(const std::string&) method
+
+/// Loads from a XML file the members for this neural network object.
+/// Please mind about the file format, which is specified in the User's Guide. 
+/// @param file_name Name of neural network XML file.
+
+void NeuralNetwork::load(const std::string& file_name)
+{
+    set_default();
+
+   tinyxml2::XMLDocument document;
+
+   if(document.LoadFile(file_name.c_str()))
+   {
+       std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: NeuralNetwork class.\n"
+             << "void load(const std::string&) method.\n"
+             << "Cannot load XML file " << file_name << ".\n";
+
+      throw std::logic_error(buffer.str());
+   }
+
+   from_XML(document);
+}
+
+
+// void load_parameters(const std::string&) method
+
+/// Loads the multilayer perceptron parameters from a data file.
+/// The format of this file is just a sequence of numbers. 
+/// @param file_name Name of parameters data file. 
+
+void NeuralNetwork::load_parameters(const std::string& file_name)
+{
+   std::ifstream file(file_name.c_str());
+
+   if(!file.is_open())
+   {
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: NeuralNetwork class.\n"
+             << "void load_parameters(const std::string&) method.\n"
+             << "Cannot open parameters data file.\n";
+
+	  throw std::logic_error(buffer.str());
+   }
+
+   const size_t parameters_number = count_parameters_number();
+
+   Vector<double> new_parameters(parameters_number);
+
+   new_parameters.load(file_name);
+
+   set_parameters(new_parameters);
+
+   file.close();
+}
+
+
+// void load_binary(const std::string&) method
+
+/// Loads the neural network from a binary file written by save_binary.
+/// The whole file is read at once, and the parameters are copied as a single block.
+/// All the values are read and checked before the neural network is modified, 
+/// so it is left unchanged if the file is truncated or corrupted. 
+/// The inputs and outputs information are set to their default values. 
+/// Files of the first version of the format, which do not store the fast activation flags, are loaded with exact activations. 
+/// @param file_name Name of neural network binary file.
+
+void NeuralNetwork::load_binary(const std::string& file_name)
+{
+   const uint32_t endianness_test = 1;
+
+   std::ifstream file(file_name.c_str(), std::ios::binary | std::ios::ate);
+
+   if(!file.is_open() || *reinterpret_cast<const char*>(&endianness_test) != 1)
+   {
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: NeuralNetwork class.\n"
+             << "void load_binary(const std::string&) method.\n"
+             << "Cannot open neural network binary file: " << file_name << "\n";
+
+      throw std::logic_error(buffer.str());
+   }
+
+   const std::streamsize file_size = file.tellg();
+
+   std::vector<char> data(file_size);
+
+   file.seekg(0, std::ios::beg);
+   file.read(data.data(), file_size);
+   file.close();
+
+   size_t position = 0;
+
+   std::ostringstream buffer;
+
+   // Header
+
+   char magic[8];
+   uint32_t version;
+   uint32_t flags;
+
+   read_binary(data, position, magic, 8);
+   read_binary(data, position, &version, sizeof(uint32_t));
+   read_binary(data, position, &flags, sizeof(uint32_t));
+
+   if(memcmp(magic, "OPENNNB", 8) != 0 || version < 1 || version > 2 || flags > 15)
+   {
+      buffer << "OpenNN Exception: NeuralNetwork class.\n"
+             << "void load_binary(const std::string&) method.\n"
+             << "Unknown binary file format or version.\n";
+
+      throw std::logic_error(buffer.str());
+   }
+
+   // Multilayer perceptron architecture
+
+   uint64_t architecture_size;
+
+   read_binary(data, position, &architecture_size, sizeof(uint64_t));
+
+   if(architecture_size < 2 || architecture_size > (data.size() - position)/sizeof(uint64_t))
+   {
+      buffer << "OpenNN Exception: NeuralNetwork class.\n"
+             << "void load_binary(const std::string&) method.\n"
+             << "Wrong architecture size: " << architecture_size << ".\n";
+
+      throw std::logic_error(buffer.str());
+   }
+
+   // Every input and every neuron takes at least one parameter, so no size can exceed the number of doubles in the file
+
+   const size_t maximum_size = data.size()/sizeof(double);
+
+   Vector<size_t> architecture((size_t)architecture_size);
+
+   for(size_t i = 0; i < architecture.size(); i++)
+   {
+      uint64_t size;
+
+      read_binary(data, position, &size, sizeof(uint64_t));
+
+      if(size == 0 || size > maximum_size)
+      {
+         buffer << "OpenNN Exception: NeuralNetwork class.\n"
+                << "void load_binary(const std::string&) method.\n"
+                << "Wrong size of architecture element " << i << ": " << size << ".\n";
+
+         throw std::logic_error(buffer.str());
+      }
+
+      architecture[i] = (size_t)size;
+   }
+
+   const size_t layers_number = architecture.size() - 1;
+   const size_t inputs_number = architecture[0];
+   const size_t outputs_number = architecture[layers_number];
+
+   Vector<uint32_t> activation_functions(layers_number);
+   Vector<uint32_t> fast_activations(layers_number, 0);
+
+   for(size_t i = 0; i < layers_number; i++)
+   {
+      read_binary(data, position, &activation_functions[i], sizeof(uint32_t));
+
+      if(activation_functions[i] > Perceptron::Linear)
+      {
+         buffer << "OpenNN Exception: NeuralNetwork class.\n"
+                << "void load_binary(const std::string&) method.\n"
+                << "Unknown activation function of layer " << i << ": " << activation_functions[i] << ".\n";
+
+         throw std::logic_error(buffer.str());
+      }
+
+      if(version >= 2)
+      {
+         read_binary(data, position, &fast_activations[i], sizeof(uint32_t));
+
+         if(fast_activations[i] > 1)
+         {
+            buffer << "OpenNN Exception: NeuralNetwork class.\n"
+                   << "void load_binary(const std::string&) method.\n"
+                   << "Wrong fast activation flag of layer " << i << ": " << fast_activations[i] << ".\n";
+
+            throw std::logic_error(buffer.str());
+         }
+      }
+   }
+
+   // Scaling layer
+
+   uint32_t scaling_method = ScalingLayer::NoScaling;
+
+   Vector< Statistics<double> > scaling_statistics;
+
+   if(flags & 1)
+   {
+      read_binary(data, position, &scaling_method, sizeof(uint32_t));
+
+      if(scaling_method > ScalingLayer::MeanStandardDeviation)
+      {
+         buffer << "OpenNN Exception: NeuralNetwork class.\n"
+                << "void load_binary(const std::string&) method.\n"
+                << "Unknown scaling method: " << scaling_method << ".\n";
+
+         throw std::logic_error(buffer.str());
+      }
+
+      scaling_statistics.set(inputs_number);
+
+      for(size_t i = 0; i < inputs_number; i++)
+      {
+         double values[4];
+
+         read_binary(data, position, values, 4*sizeof(double));
+
+         scaling_statistics[i] = Statistics<double>(values[0], values[1], values[2], values[3]);
+      }
+   }
+
+   // Unscaling layer
+
+   uint32_t unscaling_method = UnscalingLayer::NoUnscaling;
+
+   Vector< Statistics<double> > unscaling_statistics;
+
+   if(flags & 2)
+   {
+      read_binary(data, position, &unscaling_method, sizeof(uint32_t));
+
+      if(unscaling_method > UnscalingLayer::MeanStandardDeviation)
+      {
+         buffer << "OpenNN Exception: NeuralNetwork class.\n"
+                << "void load_binary(const std::string&) method.\n"
+                << "Unknown unscaling method: " << unscaling_method << ".\n";
+
+         throw std::logic_error(buffer.str());
+      }
+
+      unscaling_statistics.set(outputs_number);
+
+      for(size_t i = 0; i < outputs_number; i++)
+      {
+         double values[4];
+
+         read_binary(data, position, values, 4*sizeof(double));
+
+         unscaling_statistics[i] = Statistics<double>(values[0], values[1], values[2], values[3]);
+      }
+   }
+
+   // Bounding layer
+
+   Vector<double> lower_bounds;
+   Vector<double> upper_bounds;
+
+   if(flags & 4)
+   {
+      lower_bounds.set(outputs_number);
+      upper_bounds.set(outputs_number);
+
+      read_binary(data, position, lower_bounds.data(), outputs_number*sizeof(double));
+      read_binary(data, position, upper_bounds.data(), outputs_number*sizeof(double));
+   }
+
+   // Probabilistic layer
+
+   uint32_t probabilistic_method = ProbabilisticLayer::NoProbabilistic;
+   double decision_threshold = 0.0;
+
+   if(flags & 8)
+   {
+      read_binary(data, position, &probabilistic_method, sizeof(uint32_t));
+      read_binary(data, position, &decision_threshold, sizeof(double));
+
+      if(probabilistic_method > ProbabilisticLayer::NoProbabilistic)
+      {
+         buffer << "OpenNN Exception: NeuralNetwork class.\n"
+                << "void load_binary(const std::string&) method.\n"
+                << "Unknown probabilistic method: " << probabilistic_method << ".\n";
+
+         throw std::logic_error(buffer.str());
+      }
+
+      if(decision_threshold <= 0.0 || decision_threshold >= 1.0)
+      {
+         buffer << "OpenNN Exception: NeuralNetwork class.\n"
+                << "void load_binary(const std::string&) method.\n"
+                << "Decision threshold (" << decision_threshold << ") must be between zero and one.\n";
+
+         throw std::logic_error(buffer.str());
+      }
+   }
+
+   // Parameters
+
+   uint64_t parameters_number;
+
+   read_binary(data, position, &parameters_number, sizeof(uint64_t));
+
+   size_t architecture_parameters_number = 0;
+
+   for(size_t i = 0; i < layers_number; i++)
+   {
+      architecture_parameters_number += (architecture[i] + 1)*architecture[i+1];
+   }
+
+   if(parameters_number != architecture_parameters_number)
+   {
+      buffer << "OpenNN Exception: NeuralNetwork class.\n"
+             << "void load_binary(const std::string&) method.\n"
+             << "Number of parameters (" << parameters_number << ") does not match the architecture.\n";
+
+      throw std::logic_error(buffer.str());
+   }
+
+   Vector<double> parameters((size_t)parameters_number);
+
+   read_binary(data, position, parameters.data(), parameters.size()*sizeof(double));
+
+   if(position != data.size())
+   {
+      buffer << "OpenNN Exception: NeuralNetwork class.\n"
+             << "void load_binary(const std::string&) method.\n"
+             << "Unexpected data at the end of binary file.\n";
+
+      throw std::logic_error(buffer.str());
+   }
+
+   // Set members
+
+   set(architecture);
+
+   for(size_t i = 0; i < layers_number; i++)
+   {
+      multilayer_perceptron_pointer->set_layer_activation_function(i, (Perceptron::ActivationFunction)activation_functions[i]);
+      multilayer_perceptron_pointer->get_layer_pointer(i)->set_fast_activation(fast_activations[i] == 1);
+   }
+
+   if(flags & 1)
+   {
+      construct_scaling_layer();
+
+      scaling_layer_pointer->set_statistics(scaling_statistics);
+      scaling_layer_pointer->set_scaling_method((ScalingLayer::ScalingMethod)scaling_method);
+   }
+
+   if(flags & 2)
+   {
+      construct_unscaling_layer();
+
+      unscaling_layer_pointer->set_statistics(unscaling_statistics);
+      unscaling_layer_pointer->set_unscaling_method((UnscalingLayer::UnscalingMethod)unscaling_method);
+   }
+
+   if(flags & 4)
+   {
+      construct_bounding_layer();
+
+      bounding_layer_pointer->set_lower_bounds(lower_bounds);
+      bounding_layer_pointer->set_upper_bounds(upper_bounds);
+   }
+
+   if(flags & 8)
+   {
+      construct_probabilistic_layer();
+
+      probabilistic_layer_pointer->set_probabilistic_method((ProbabilisticLayer::ProbabilisticMethod)probabilistic_method);
+      probabilistic_layer_pointer->set_decision_threshold(decision_threshold);
+   }
+
+   multilayer_perceptron_pointer->set_parameters(parameters);
+}
+
+
+// void read_binary(const std::vector<char>&, size_t&, void*, const size_t&) method
+
+/// Copies a number of bytes from a binary buffer and advances the read position.
+/// It throws an exception if the buffer does not contain enough bytes. 
+/// @param data Binary buffer.
+/// @param position Read position in the buffer.
+/// @param destination Memory where the bytes are copied.
+/// @param bytes_number Number of bytes to copy.
+
+void NeuralNetwork::read_binary(const std::vector<char>& data, size_t& position, void* destination, const size_t& bytes_number)
+{
+   if(position + bytes_number > data.size())
+   {
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: NeuralNetwork class.\n"
+             << "void read_binary(const std::vector<char>&, size_t&, void*, const size_t&) method.\n"
+             << "Unexpected end of binary file.\n";
+
+      throw std::logic_error(buffer.str());
+   }
+
+   if(bytes_number > 0)
+   {
+      memcpy(destination, data.data() + position, bytes_number);
+   }
+
+   position += bytes_number;
+}
+
+
+// std::string write_expression(void) const method
+
+/// Returns a string with the expression of the function represented by the neural network.
+
+std::string NeuralNetwork::write_expression(void) const
+{
+   std::ostringstream buffer;
+
+   #ifdef __OPENNN_DEBUG__ 
+
+   if(!inputs_pointer)
+   {
+      buffer.str("");
+
+      buffer << "OpenNN Exception: NeuralNetwork class.\n"
+             << "std::string write_expression(void) const method.\n"
+             << "Pointer to inputs is NULL.\n";
+
+	  throw std::logic_error(buffer.str());
+   }
+
+   if(!multilayer_perceptron_pointer)
+   {
+      buffer.str("");
+
+      buffer << "OpenNN Exception: NeuralNetwork class.\n"
+             << "std::string write_expression(void) const method.\n"
+             << "Pointer to multilayer perceptron is NULL.\n";
+
+	  throw std::logic_error(buffer.str());
+   }
+
+   if(!outputs_pointer)
+   {
+      buffer.str("");
+
+      buffer << "OpenNN Exception: NeuralNetwork class.\n"
+             << "std::string write_expression(void) const method.\n"
+             << "Pointer to outputs is NULL.\n";
+
+      throw std::logic_error(buffer.str());
+   }
+
+   #endif
 
    const size_t inputs_number = multilayer_perceptron_pointer->get_inputs_number();
    const size_t outputs_number = multilayer_perceptron_pointer->get_outputs_number();
@@ -3800,6 +4617,372 @@ std::string NeuralNetwork::write_expression_R(void) const
     return(expression);
 }
 
+
+// std::string write_expression_cpp(const std::string&) const method
+
+/// Returns the source of a self-contained C++ header which computes the outputs of the neural network.
+/// The parameters of the scaling, perceptron, unscaling and bounding layers are written as constexpr arrays,
+/// and the forward propagation is fused into a single function made of loops with compile-time trip counts.
+/// The scaling and unscaling layers are reduced to a slope and an intercept for each variable.
+/// The header does not depend on OpenNN and provides a single-row and a batch function.
+/// Conditions layers are not supported.
+/// @param name Name of the namespace containing the generated code. It must be a valid C++ identifier.
+
+std::string NeuralNetwork::write_expression_cpp(const std::string& name) const
+{
+    // Control sentence
+
+    if(!multilayer_perceptron_pointer)
+    {
+       std::ostringstream buffer;
+
+       buffer << "OpenNN Exception: NeuralNetwork class.\n"
+              << "std::string write_expression_cpp(const std::string&) const method.\n"
+              << "Pointer to multilayer perceptron is NULL.\n";
+
+       throw std::logic_error(buffer.str());
+    }
+
+    if(conditions_layer_pointer)
+    {
+       std::ostringstream buffer;
+
+       buffer << "OpenNN Exception: NeuralNetwork class.\n"
+              << "std::string write_expression_cpp(const std::string&) const method.\n"
+              << "Conditions layer is not supported.\n";
+
+       throw std::logic_error(buffer.str());
+    }
+
+    const size_t inputs_number = multilayer_perceptron_pointer->get_inputs_number();
+    const size_t outputs_number = multilayer_perceptron_pointer->get_outputs_number();
+
+    const size_t layers_number = multilayer_perceptron_pointer->get_layers_number();
+
+    std::string guard = name;
+
+    for(size_t i = 0; i < guard.size(); i++)
+    {
+       guard[i] = (char)toupper(guard[i]);
+    }
+
+    std::ostringstream buffer;
+
+    buffer.precision(17);
+
+    buffer << "// Neural network generated by OpenNN.\n\n"
+           << "#ifndef __" << guard << "_H__\n"
+           << "#define __" << guard << "_H__\n\n"
+           << "#include <cmath>\n"
+           << "#include <cstddef>\n\n"
+           << "namespace " << name << "\n{\n\n"
+           << "constexpr std::size_t inputs_number = " << inputs_number << ";\n"
+           << "constexpr std::size_t outputs_number = " << outputs_number << ";\n\n";
+
+    // Scaling layer
+
+    if(scaling_layer_pointer && scaling_layer_pointer->get_scaling_method() != ScalingLayer::NoScaling)
+    {
+       const ScalingLayer::ScalingMethod scaling_method = scaling_layer_pointer->get_scaling_method();
+
+       const Vector< Statistics<double> > statistics = scaling_layer_pointer->get_statistics();
+
+       Vector<double> slopes(inputs_number, 1.0);
+       Vector<double> intercepts(inputs_number, 0.0);
+
+       for(size_t i = 0; i < inputs_number; i++)
+       {
+          if(scaling_method == ScalingLayer::MinimumMaximum && statistics[i].maximum - statistics[i].minimum >= 1e-99)
+          {
+             slopes[i] = 2.0/(statistics[i].maximum - statistics[i].minimum);
+             intercepts[i] = -2.0*statistics[i].minimum/(statistics[i].maximum - statistics[i].minimum) - 1.0;
+          }
+          else if(scaling_method == ScalingLayer::MeanStandardDeviation && statistics[i].standard_deviation >= 1e-99)
+          {
+             slopes[i] = 1.0/statistics[i].standard_deviation;
+             intercepts[i] = -statistics[i].mean/statistics[i].standard_deviation;
+          }
+       }
+
+       buffer << write_constant_array_cpp("scaling_slopes", slopes)
+              << write_constant_array_cpp("scaling_intercepts", intercepts);
+    }
+
+    // Multilayer perceptron
+
+    for(size_t i = 0; i < layers_number; i++)
+    {
+       const PerceptronLayer& layer = multilayer_perceptron_pointer->get_layer(i);
+
+       std::ostringstream layer_name;
+       layer_name << "layer_" << i;
+
+       buffer << write_constant_array_cpp(layer_name.str() + "_synaptic_weights", layer.arrange_synaptic_weights().calculate_transpose().to_vector())
+              << write_constant_array_cpp(layer_name.str() + "_biases", layer.arrange_biases());
+    }
+
+    // Unscaling layer
+
+    if(unscaling_layer_pointer && unscaling_layer_pointer->get_unscaling_method() != UnscalingLayer::NoUnscaling)
+    {
+       const UnscalingLayer::UnscalingMethod unscaling_method = unscaling_layer_pointer->get_unscaling_method();
+
+       const Vector< Statistics<double> > statistics = unscaling_layer_pointer->get_statistics();
+
+       Vector<double> slopes(outputs_number, 1.0);
+       Vector<double> intercepts(outputs_number, 0.0);
+
+       for(size_t i = 0; i < outputs_number; i++)
+       {
+          if(unscaling_method == UnscalingLayer::MinimumMaximum && statistics[i].maximum - statistics[i].minimum >= 1e-99)
+          {
+             slopes[i] = 0.5*(statistics[i].maximum - statistics[i].minimum);
+             intercepts[i] = 0.5*(statistics[i].maximum - statistics[i].minimum) + statistics[i].minimum;
+          }
+          else if(unscaling_method == UnscalingLayer::MeanStandardDeviation && statistics[i].standard_deviation >= 1e-99)
+          {
+             slopes[i] = statistics[i].standard_deviation;
+             intercepts[i] = statistics[i].mean;
+          }
+       }
+
+       buffer << write_constant_array_cpp("unscaling_slopes", slopes)
+              << write_constant_array_cpp("unscaling_intercepts", intercepts);
+    }
+
+    // Bounding layer
+
+    if(bounding_layer_pointer)
+    {
+       buffer << write_constant_array_cpp("lower_bounds", bounding_layer_pointer->get_lower_bounds())
+              << write_constant_array_cpp("upper_bounds", bounding_layer_pointer->get_upper_bounds());
+    }
+
+    // Single row function
+
+    buffer << "/// Computes the outputs of the neural network for a single row of inputs.\n\n"
+           << "inline void calculate_outputs(const double* inputs, double* outputs)\n"
+           << "{\n";
+
+    std::string layer_inputs = "inputs";
+
+    if(scaling_layer_pointer && scaling_layer_pointer->get_scaling_method() != ScalingLayer::NoScaling)
+    {
+       buffer << "   // Scaling layer\n\n"
+              << "   double scaled_inputs[" << inputs_number << "];\n\n"
+              << "   for(std::size_t i = 0; i < " << inputs_number << "; i++)\n"
+              << "   {\n"
+              << "      scaled_inputs[i] = scaling_slopes[i]*inputs[i] + scaling_intercepts[i];\n"
+              << "   }\n\n";
+
+       layer_inputs = "scaled_inputs";
+    }
+
+    for(size_t i = 0; i < layers_number; i++)
+    {
+       const PerceptronLayer& layer = multilayer_perceptron_pointer->get_layer(i);
+
+       const size_t layer_inputs_number = layer.get_inputs_number();
+       const size_t perceptrons_number = layer.get_perceptrons_number();
+
+       std::string activation;
+
+       switch(layer.get_activation_function())
+       {
+          case Perceptron::Threshold:
+          {
+             activation = "combination < 0.0 ? 0.0 : 1.0";
+          }
+          break;
+
+          case Perceptron::SymmetricThreshold:
+          {
+             activation = "combination < 0.0 ? -1.0 : 1.0";
+          }
+          break;
+
+          case Perceptron::Logistic:
+          {
+             activation = "1.0/(1.0 + std::exp(-combination))";
+          }
+          break;
+
+          case Perceptron::HyperbolicTangent:
+          {
+             activation = "std::tanh(combination)";
+          }
+          break;
+
+          case Perceptron::Linear:
+          {
+             activation = "combination";
+          }
+          break;
+
+          default:
+          {
+             std::ostringstream buffer;
+
+             buffer << "OpenNN Exception: NeuralNetwork class.\n"
+                    << "std::string write_expression_cpp(const std::string&) const method.\n"
+                    << "Unknown activation function.\n";
+
+             throw std::logic_error(buffer.str());
+          }
+          break;
+       }
+
+       buffer << "   // Perceptron layer " << i << "\n\n"
+              << "   double layer_" << i << "_outputs[" << perceptrons_number << "];\n\n"
+              << "   for(std::size_t i = 0; i < " << perceptrons_number << "; i++)\n"
+              << "   {\n"
+              << "      const double* synaptic_weights = layer_" << i << "_synaptic_weights + i*" << layer_inputs_number << ";\n\n"
+              << "      double combination = layer_" << i << "_biases[i];\n\n"
+              << "      for(std::size_t j = 0; j < " << layer_inputs_number << "; j++)\n"
+              << "      {\n"
+              << "         combination += synaptic_weights[j]*" << layer_inputs << "[j];\n"
+              << "      }\n\n"
+              << "      layer_" << i << "_outputs[i] = " << activation << ";\n"
+              << "   }\n\n";
+
+       std::ostringstream layer_outputs;
+       layer_outputs << "layer_" << i << "_outputs";
+
+       layer_inputs = layer_outputs.str();
+    }
+
+    buffer << "   for(std::size_t i = 0; i < " << outputs_number << "; i++)\n"
+           << "   {\n"
+           << "      outputs[i] = " << layer_inputs << "[i];\n"
+           << "   }\n";
+
+    if(unscaling_layer_pointer && unscaling_layer_pointer->get_unscaling_method() != UnscalingLayer::NoUnscaling)
+    {
+       buffer << "\n   // Unscaling layer\n\n"
+              << "   for(std::size_t i = 0; i < " << outputs_number << "; i++)\n"
+              << "   {\n"
+              << "      outputs[i] = unscaling_slopes[i]*outputs[i] + unscaling_intercepts[i];\n"
+              << "   }\n";
+    }
+
+    if(probabilistic_layer_pointer)
+    {
+       switch(probabilistic_layer_pointer->get_probabilistic_method())
+       {
+          case ProbabilisticLayer::Binary:
+          {
+             buffer << "\n   // Probabilistic layer\n\n"
+                    << "   outputs[0] = outputs[0] < " << probabilistic_layer_pointer->get_decision_threshold() << " ? 0.0 : 1.0;\n";
+          }
+          break;
+
+          case ProbabilisticLayer::Competitive:
+          {
+             buffer << "\n   // Probabilistic layer\n\n"
+                    << "   std::size_t maximal_index = 0;\n\n"
+                    << "   for(std::size_t i = 1; i < " << outputs_number << "; i++)\n"
+                    << "   {\n"
+                    << "      if(outputs[i] > outputs[maximal_index])\n"
+                    << "      {\n"
+                    << "         maximal_index = i;\n"
+                    << "      }\n"
+                    << "   }\n\n"
+                    << "   for(std::size_t i = 0; i < " << outputs_number << "; i++)\n"
+                    << "   {\n"
+                    << "      outputs[i] = (i == maximal_index) ? 1.0 : 0.0;\n"
+                    << "   }\n";
+          }
+          break;
+
+          case ProbabilisticLayer::Softmax:
+          {
+             buffer << "\n   // Probabilistic layer\n\n"
+                    << "   double maximum = outputs[0];\n\n"
+                    << "   for(std::size_t i = 1; i < " << outputs_number << "; i++)\n"
+                    << "   {\n"
+                    << "      maximum = outputs[i] > maximum ? outputs[i] : maximum;\n"
+                    << "   }\n\n"
+                    << "   double sum = 0.0;\n\n"
+                    << "   for(std::size_t i = 0; i < " << outputs_number << "; i++)\n"
+                    << "   {\n"
+                    << "      outputs[i] = std::exp(outputs[i] - maximum);\n"
+                    << "      sum += outputs[i];\n"
+                    << "   }\n\n"
+                    << "   for(std::size_t i = 0; i < " << outputs_number << "; i++)\n"
+                    << "   {\n"
+                    << "      outputs[i] /= sum;\n"
+                    << "   }\n";
+          }
+          break;
+
+          default:
+          {
+             // Probability and no probabilistic methods do not change the outputs
+          }
+          break;
+       }
+    }
+
+    if(bounding_layer_pointer)
+    {
+       buffer << "\n   // Bounding layer\n\n"
+              << "   for(std::size_t i = 0; i < " << outputs_number << "; i++)\n"
+              << "   {\n"
+              << "      outputs[i] = outputs[i] < lower_bounds[i] ? lower_bounds[i] : (outputs[i] > upper_bounds[i] ? upper_bounds[i] : outputs[i]);\n"
+              << "   }\n";
+    }
+
+    buffer << "}\n\n";
+
+    // Batch function
+
+    buffer << "/// Computes the outputs of the neural network for a batch of rows.\n"
+           << "/// The inputs and the outputs are stored row by row.\n\n"
+           << "inline void calculate_outputs(const double* inputs, double* outputs, const std::size_t rows_number)\n"
+           << "{\n"
+           << "   for(std::size_t i = 0; i < rows_number; i++)\n"
+           << "   {\n"
+           << "      calculate_outputs(inputs + i*inputs_number, outputs + i*outputs_number);\n"
+           << "   }\n"
+           << "}\n\n"
+           << "}\n\n"
+           << "#endif\n";
+
+    return(buffer.str());
+}
+
+
+// std::string write_constant_array_cpp(const std::string&, const Vector<double>&) method
+
+/// Returns the C++ definition of a constexpr array of doubles, written with enough digits to be read back exactly.
+/// @param name Name of the array.
+/// @param values Values of the array.
+
+std::string NeuralNetwork::write_constant_array_cpp(const std::string& name, const Vector<double>& values)
+{
+    const size_t size = values.size();
+
+    std::ostringstream buffer;
+
+    buffer.precision(17);
+
+    buffer << "constexpr double " << name << "[" << size << "] = {";
+
+    for(size_t i = 0; i < size; i++)
+    {
+       buffer << values[i];
+
+       if(i != size-1)
+       {
+          buffer << ", ";
+       }
+    }
+
+    buffer << "};\n\n";
+
+    return(buffer.str());
+}
+
 // void save_expression(const std::string&) method
 
 /// Saves the mathematical expression represented by the neural network to a text file.
@@ -3875,6 +5058,33 @@ void NeuralNetwork::save_expression_R(const std::string& file_name)
     file.close();
 }
 
+
+// void save_expression_cpp(const std::string&, const std::string&) const method
+
+/// Saves the C++ header of the neural network to a file.
+/// @param file_name Name of header file.
+/// @param name Name of the namespace containing the generated code.
+
+void NeuralNetwork::save_expression_cpp(const std::string& file_name, const std::string& name) const
+{
+    std::ofstream file(file_name.c_str());
+
+    if(!file.is_open())
+    {
+       std::ostringstream buffer;
+
+       buffer << "OpenNN Exception: NeuralNetwork class.\n"
+              << "void save_expression_cpp(const std::string&, const std::string&) const method.\n"
+              << "Cannot open header file.\n";
+
+       throw std::logic_error(buffer.str());
+    }
+
+    file << write_expression_cpp(name);
+
+    file.close();
+}
+
 // void save_data(const std::string&) const method
 
 /// Saves a set of input-output values from the neural network to a data file.
@@ -18,6 +18,8 @@
 
 #include <cmath>
 #include <cstdlib>
+#include <cstring>
+#include <stdint.h>
 #include <fstream>
 #include <iostream>
 #include <string>
@@ -107,6 +109,10 @@ public:
 
    NeuralNetwork(const NeuralNetwork&);
 
+   // PARAMETERS OVERRIDE CONSTRUCTOR
+
+   explicit NeuralNetwork(const NeuralNetwork&, const Vector<double>&);
+
    // DESTRUCTOR
 
    virtual ~NeuralNetwork(void);
@@ -228,6 +234,7 @@ public:
 
    size_t count_parameters_number(void) const;
    Vector<double> arrange_parameters(void) const;      
+   Vector<double> arrange_independent_parameters(void) const;
 
    void set_parameters(const Vector<double>&);
 
@@ -256,6 +263,7 @@ public:
    // Output 
 
    Vector<double> calculate_outputs(const Vector<double>&) const;
+   Matrix<float> calculate_outputs(const Matrix<float>&) const;
    Matrix<double> calculate_Jacobian(const Vector<double>&) const;
    Vector< Matrix<double> > calculate_Hessian_form(const Vector<double>&) const;
 
@@ -280,9 +288,11 @@ public:
    void print(void) const;
    void save(const std::string&) const;
    void save_parameters(const std::string&) const;
+   void save_binary(const std::string&) const;
 
    virtual void load(const std::string&);
    void load_parameters(const std::string&);
+   void load_binary(const std::string&);
 
    void save_data(const std::string&) const;
 
@@ -291,13 +301,19 @@ public:
    std::string write_expression(void) const;
    std::string write_expression_python(void) const;
    std::string write_expression_R(void) const;
+   std::string write_expression_cpp(const std::string& = "neural_network") const;
 
    void save_expression(const std::string&);
    void save_expression_python(const std::string&);
    void save_expression_R(const std::string&);
+   void save_expression_cpp(const std::string&, const std::string& = "neural_network") const;
 
 protected:
 
+   static std::string write_constant_array_cpp(const std::string&, const Vector<double>&);
+
+   static void read_binary(const std::vector<char>&, size_t&, void*, const size_t&);
+
    // MEMBERS
 
    /// Pointer to a multilayer perceptron object.
@@ -336,6 +352,11 @@ protected:
 
    IndependentParameters* independent_parameters_pointer;
 
+   /// Pointer to the parameters of a parameters override view, which shares all its pointers with other neural network.
+   /// It is NULL if this object is not a view.
+
+   const Vector<double>* parameters_override_pointer;
+
    /// Display messages to screen. 
 
    bool display;
@@ -225,20 +225,10 @@ double NormalizedSquaredError::calculate_performance(void) const
 
    // Data set stuff
 
-
    const Instances& instances = data_set_pointer->get_instances();
 
    const size_t training_instances_number = instances.count_training_instances_number();
 
-   const Vector<size_t> training_indices = instances.arrange_training_indices();
-
-   size_t training_index;
-
-   const Variables& variables = data_set_pointer->get_variables();
-
-   const Vector<size_t> inputs_indices = variables.arrange_inputs_indices();
-   const Vector<size_t> targets_indices = variables.arrange_targets_indices();
-
    const MissingValues& missing_values = data_set_pointer->get_missing_values();
 
    const Vector<size_t> missing_instances = missing_values.arrange_missing_instances();
@@ -256,15 +246,13 @@ double NormalizedSquaredError::calculate_performance(void) const
    double sum_squared_error = 0.0;
    double normalization_coefficient = 0.0;
 
-   #pragma omp parallel for private(i, training_index, inputs, outputs, targets) reduction(+ : sum_squared_error, normalization_coefficient)
+   #pragma omp parallel for private(i, inputs, outputs, targets) reduction(+ : sum_squared_error, normalization_coefficient)
 
    for(i = 0; i < (int)training_instances_number; i++)
    {
-       training_index = training_indices[i];
-
       // Input vector
 
-      inputs = data_set_pointer->get_instance(training_index, inputs_indices);
+      data_set_pointer->get_training_inputs(i, inputs);
 
       // Output vector
 
@@ -272,7 +260,7 @@ double NormalizedSquaredError::calculate_performance(void) const
 
       // Target vector
 
-      targets = data_set_pointer->get_instance(training_index, targets_indices);
+      data_set_pointer->get_training_targets(i, targets);
 
       // Sum squared error
 
@@ -347,15 +335,6 @@ double NormalizedSquaredError::calculate_performance(const Vector<double>& param
 
    const size_t training_instances_number = instances.count_training_instances_number();
 
-   const Vector<size_t> training_indices = instances.arrange_training_indices();
-
-   size_t training_index;
-
-   const Variables& variables = data_set_pointer->get_variables();
-
-   const Vector<size_t> inputs_indices = variables.arrange_inputs_indices();
-   const Vector<size_t> targets_indices = variables.arrange_targets_indices();
-
    const Vector<double> training_target_data_mean = data_set_pointer->calculate_training_target_data_mean();
 
    // Normalized squared error stuff
@@ -369,15 +348,13 @@ double NormalizedSquaredError::calculate_performance(const Vector<double>& param
 
    int i = 0;
 
-   #pragma omp parallel for private(i, training_index, inputs, outputs, targets) reduction(+ : sum_squared_error, normalization_coefficient)
+   #pragma omp parallel for private(i, inputs, outputs, targets) reduction(+ : sum_squared_error, normalization_coefficient)
 
    for(i = 0; i < (int)training_instances_number; i++)
    {
-       training_index = training_indices[i];
-
       // Input vector
 
-      inputs = data_set_pointer->get_instance(training_index, inputs_indices);
+      data_set_pointer->get_training_inputs(i, inputs);
 
       // Output vector
 
@@ -385,7 +362,7 @@ double NormalizedSquaredError::calculate_performance(const Vector<double>& param
 
       // Target vector
 
-      targets = data_set_pointer->get_instance(training_index, targets_indices);
+      data_set_pointer->get_training_targets(i, targets);
 
       // Sum squared error
 
@@ -441,15 +418,6 @@ double NormalizedSquaredError::calculate_selection_performance(void) const
    {
       return(0.0);
    }
-   
-   const Vector<size_t> selection_indices = instances.arrange_selection_indices();
-
-   size_t selection_index;
-
-   const Variables& variables = data_set_pointer->get_variables();
-
-   const Vector<size_t> inputs_indices = variables.arrange_inputs_indices();
-   const Vector<size_t> targets_indices = variables.arrange_targets_indices();
 
    const Vector<double> selection_target_data_mean = data_set_pointer->calculate_selection_target_data_mean();
 
@@ -462,15 +430,13 @@ double NormalizedSquaredError::calculate_selection_performance(void) const
 
    int i = 0;
 
-   #pragma omp parallel for private(i, selection_index, inputs, outputs, targets) reduction(+ : sum_squared_error, normalization_coefficient)
+   #pragma omp parallel for private(i, inputs, outputs, targets) reduction(+ : sum_squared_error, normalization_coefficient)
 
    for(i = 0; i < (int)selection_instances_number; i++)
    {
-       selection_index = selection_indices[i];
-
       // Input vector
 
-      inputs = data_set_pointer->get_instance(selection_index, inputs_indices);
+      data_set_pointer->get_selection_inputs(i, inputs);
 
       // Output vector
 
@@ -478,7 +444,7 @@ double NormalizedSquaredError::calculate_selection_performance(void) const
 
       // Target vector
 
-      targets = data_set_pointer->get_instance(selection_index, targets_indices);
+      data_set_pointer->get_selection_targets(i, targets);
 
       // Sum squared error
 
@@ -550,15 +516,6 @@ Vector<double> NormalizedSquaredError::calculate_gradient(void) const
 
    const size_t training_instances_number = instances.count_training_instances_number();
 
-   const Vector<size_t> training_indices = instances.arrange_training_indices();
-
-   size_t training_index;
-
-   const Variables& variables = data_set_pointer->get_variables();
-
-   const Vector<size_t> inputs_indices = variables.arrange_inputs_indices();
-   const Vector<size_t> targets_indices = variables.arrange_targets_indices();
-
    const Vector<double> training_target_data_mean = data_set_pointer->calculate_training_target_data_mean();
 
    Vector<double> inputs(inputs_number);
@@ -580,19 +537,17 @@ Vector<double> NormalizedSquaredError::calculate_gradient(void) const
 
    int i = 0;
 
-   #pragma omp parallel for private(i, training_index, inputs, targets, first_order_forward_propagation, layers_inputs, layers_combination_parameters_Jacobian,\
+   #pragma omp parallel for private(i, inputs, targets, first_order_forward_propagation, layers_inputs, layers_combination_parameters_Jacobian,\
     output_gradient, layers_delta, particular_solution, homogeneous_solution, point_gradient) \
     reduction(+ : normalization_coefficient)
 
    for(i = 0; i < (int)training_instances_number; i++)
    {
-       training_index = training_indices[i];
-
       // Data set
 
-      inputs = data_set_pointer->get_instance(training_index, inputs_indices);
+      data_set_pointer->get_training_inputs(i, inputs);
 
-      targets = data_set_pointer->get_instance(training_index, targets_indices);
+      data_set_pointer->get_training_targets(i, targets);
 
 	  // Multilayer perceptron
 
@@ -690,15 +645,6 @@ Vector<double> NormalizedSquaredError::calculate_terms(void) const
 
    const size_t training_instances_number = instances.count_training_instances_number();
 
-   const Vector<size_t> training_indices = instances.arrange_training_indices();
-
-   size_t training_index;
-
-   const Variables& variables = data_set_pointer->get_variables();
-
-   const Vector<size_t> inputs_indices = variables.arrange_inputs_indices();
-   const Vector<size_t> targets_indices = variables.arrange_targets_indices();
-
    const Vector<double> training_target_data_mean = data_set_pointer->calculate_training_target_data_mean();
 
    // Calculate
@@ -713,15 +659,13 @@ Vector<double> NormalizedSquaredError::calculate_terms(void) const
 
    int i = 0;
 
-   #pragma omp parallel for private(i, training_index, inputs, outputs, targets) reduction(+ : normalization_coefficient)
+   #pragma omp parallel for private(i, inputs, outputs, targets) reduction(+ : normalization_coefficient)
 
    for(i = 0; i < (int)training_instances_number; i++)
    {
-       training_index = training_indices[i];
-
        // Input vector
 
-      inputs = data_set_pointer->get_instance(training_index, inputs_indices);
+      data_set_pointer->get_training_inputs(i, inputs);
 
       // Output vector
 
@@ -729,7 +673,7 @@ Vector<double> NormalizedSquaredError::calculate_terms(void) const
 
       // Target vector
 
-      targets = data_set_pointer->get_instance(training_index, targets_indices);
+      data_set_pointer->get_training_targets(i, targets);
 
       // Sum squared error
 
@@ -851,15 +795,6 @@ Matrix<double> NormalizedSquaredError::calculate_terms_Jacobian(void) const
 
    const size_t training_instances_number = instances.count_training_instances_number();
 
-   const Vector<size_t> training_indices = instances.arrange_training_indices();
-
-   size_t training_index;
-
-   const Variables& variables = data_set_pointer->get_variables();
-
-   const Vector<size_t> inputs_indices = variables.arrange_inputs_indices();
-   const Vector<size_t> targets_indices = variables.arrange_targets_indices();
-
    const Vector<double> training_target_data_mean = data_set_pointer->calculate_training_target_data_mean();
 
    Vector<double> inputs(inputs_number);
@@ -883,18 +818,16 @@ Matrix<double> NormalizedSquaredError::calculate_terms_Jacobian(void) const
 
    int i = 0;
 
-   #pragma omp parallel for private(i, training_index, inputs, targets, first_order_forward_propagation, layers_inputs, \
+   #pragma omp parallel for private(i, inputs, targets, first_order_forward_propagation, layers_inputs, \
     layers_combination_parameters_Jacobian, term, term_norm, output_gradient, layers_delta, particular_solution, homogeneous_solution, point_gradient)
 
    for(i = 0; i < (int)training_instances_number; i++)
    {
-       training_index = training_indices[i];
-
        // Data set
 
-      inputs = data_set_pointer->get_instance(training_index, inputs_indices);
+      data_set_pointer->get_training_inputs(i, inputs);
 
-      targets = data_set_pointer->get_instance(training_index, targets_indices);
+      data_set_pointer->get_training_targets(i, targets);
 
 	  // Neural network
 
@@ -1017,15 +950,6 @@ Vector<double> NormalizedSquaredError::calculate_squared_errors(void) const
 
    const size_t training_instances_number = instances.count_training_instances_number();
 
-   const Vector<size_t> training_indices = instances.arrange_training_indices();
-
-   size_t training_index;
-
-   const Variables& variables = data_set_pointer->get_variables();
-
-   const Vector<size_t> inputs_indices = variables.arrange_inputs_indices();
-   const Vector<size_t> targets_indices = variables.arrange_targets_indices();
-
    // Calculate
 
    Vector<double> squared_errors(training_instances_number);
@@ -1038,15 +962,13 @@ Vector<double> NormalizedSquaredError::calculate_squared_errors(void) const
 
    int i = 0;
 
-   #pragma omp parallel for private(i, training_index, inputs, outputs, targets)
+   #pragma omp parallel for private(i, inputs, outputs, targets)
 
    for(i = 0; i < (int)training_instances_number; i++)
    {
-       training_index = training_indices[i];
-
        // Input vector
 
-      inputs = data_set_pointer->get_instance(training_index, inputs_indices);
+      data_set_pointer->get_training_inputs(i, inputs);
 
       // Output vector
 
@@ -1054,7 +976,7 @@ Vector<double> NormalizedSquaredError::calculate_squared_errors(void) const
 
       // Target vector
 
-      targets = data_set_pointer->get_instance(training_index, targets_indices);
+      data_set_pointer->get_training_targets(i, targets);
 
       // Error
 
@@ -65,6 +65,8 @@ NumericalDifferentiation& NumericalDifferentiation::operator = (const NumericalD
 
       precision_digits = other_numerical_differentiation.precision_digits;
 
+      parallel_evaluation = other_numerical_differentiation.parallel_evaluation;
+
       display = other_numerical_differentiation.display;
    }
 
@@ -85,6 +87,7 @@ bool NumericalDifferentiation::operator == (const NumericalDifferentiation& othe
 {
    if(numerical_differentiation_method == other_numerical_differentiation.numerical_differentiation_method
    && precision_digits == other_numerical_differentiation.precision_digits
+   && parallel_evaluation == other_numerical_differentiation.parallel_evaluation
    && display == other_numerical_differentiation.display)
    {
       return(true);
@@ -153,6 +156,17 @@ const size_t& NumericalDifferentiation::get_precision_digits(void) const
 }
 
 
+// const bool& get_parallel_evaluation(void) const method
+
+/// Returns true if the perturbed evaluations of the derivatives of const methods are distributed among threads,
+/// and false if they are performed sequentially.
+
+const bool& NumericalDifferentiation::get_parallel_evaluation(void) const
+{
+   return(parallel_evaluation);
+}
+
+
 // const bool& get_display(void) const method
 
 /// Returns the flag used by this class for displaying or not displaying warnings.
@@ -174,6 +188,8 @@ void NumericalDifferentiation::set(const NumericalDifferentiation& other_numeric
 
    precision_digits = other_numerical_differentiation.precision_digits;
 
+   parallel_evaluation = other_numerical_differentiation.parallel_evaluation;
+
    display = other_numerical_differentiation.display;
 
 }
@@ -220,6 +236,21 @@ void NumericalDifferentiation::set_numerical_differentiation_method(const std::s
 }
 
 
+// void set_parallel_evaluation(const bool&) method
+
+/// Sets whether the perturbed evaluations of gradients, Jacobians and Hessians of const methods are distributed among threads. 
+/// Each thread works on its own copies of the perturbed arguments, 
+/// so the differentiated method only needs to be safe to call concurrently on the same object. 
+/// This is not the case of a plug-in mathematical model in script evaluation mode, whose evaluations share the input and output files. 
+/// Performance terms on such a mathematical model, like solutions error or final solutions error, always evaluate sequentially. 
+/// @param new_parallel_evaluation True for parallel evaluation, false for sequential evaluation. 
+
+void NumericalDifferentiation::set_parallel_evaluation(const bool& new_parallel_evaluation)
+{
+   parallel_evaluation = new_parallel_evaluation;
+}
+
+
 // void set_display(const bool&) method
 
 /// Sets a new flag for displaying warnings from this class or not. 
@@ -248,6 +279,7 @@ void NumericalDifferentiation::set_precision_digits(const size_t& new_precision_
 /// <ul> 
 /// <li> Numerical differentiation method: Central differences.
 /// <li> Precision digits: 6.
+/// <li> Parallel evaluation: false.
 /// <li> Display: true.
 /// </ul>
 
@@ -257,6 +289,8 @@ void NumericalDifferentiation::set_default(void)
 
    precision_digits = 6;
 
+   parallel_evaluation = false;
+
    display = true;
 }
 
@@ -331,6 +365,17 @@ tinyxml2::XMLDocument* NumericalDifferentiation::to_XML(void) const
    buffer.str("");
    buffer << precision_digits;
 
+   text = document->NewText(buffer.str().c_str());
+   element->LinkEndChild(text);
+
+   // Parallel evaluation
+
+   element = document->NewElement("ParallelEvaluation");
+   root_element->LinkEndChild(element);
+
+   buffer.str("");
+   buffer << parallel_evaluation;
+
    text = document->NewText(buffer.str().c_str());
    element->LinkEndChild(text);
    
@@ -408,6 +453,25 @@ void NumericalDifferentiation::from_XML(const tinyxml2::XMLDocument& document)
   }
 
 
+  // Parallel evaluation
+  {
+     const tinyxml2::XMLElement* element = root_element->FirstChildElement("ParallelEvaluation");
+
+     if(element)
+     {
+        const std::string new_parallel_evaluation = element->GetText();
+
+        try
+        {
+           set_parallel_evaluation(new_parallel_evaluation != "0");
+        }
+        catch(const std::logic_error& e)
+        {
+           std::cout << e.what() << std::endl;
+        }
+     }
+  }
+
   // Display
   {
      const tinyxml2::XMLElement* element = root_element->FirstChildElement("Display");
@@ -70,6 +70,8 @@ public:
    
    const size_t& get_precision_digits(void) const;
 
+   const bool& get_parallel_evaluation(void) const;
+
    const bool& get_display(void) const;
 
    void set(const NumericalDifferentiation&);
@@ -79,6 +81,8 @@ public:
 
    void set_precision_digits(const size_t&);
 
+   void set_parallel_evaluation(const bool&);
+
    void set_display(const bool&);
 
    void set_default(void);
@@ -744,7 +748,11 @@ public:
 
 	  Vector<double> g(n);
 
-      for(size_t i = 0; i < n; i++)
+      int i = 0;
+
+      #pragma omp parallel for private(i, h, y_forward) firstprivate(x_forward) if(parallel_evaluation)
+
+      for(i = 0; i < (int)n; i++)
       {
          h = calculate_h(x[i]);
  
@@ -782,7 +790,11 @@ public:
 
       Vector<double> g(n);
 
-      for(size_t i = 0; i < n; i++)
+      int i = 0;
+
+      #pragma omp parallel for private(i, h, y_forward, y_backward) firstprivate(x_forward, x_backward) if(parallel_evaluation)
+
+      for(i = 0; i < (int)n; i++)
       {
          h = calculate_h(x[i]);
 
@@ -1220,6 +1232,8 @@ public:
 
    /// Returns the Hessian matrix of a function of several dimensions using the forward differences method. 
    /// The function to be differentiated is of the following form: double f(const Vector<double>&) const. 
+   /// The single perturbations are evaluated once and shared by all the terms, and only the upper triangle is evaluated.
+   /// With parallel evaluation, the perturbed evaluations are distributed among threads. 
    /// @param t : Object constructor containing the member method to differentiate.  
    /// @param f: Pointer to the member method.
    /// @param x: Input vector. 
@@ -1227,62 +1241,58 @@ public:
    template<class T> 
    Matrix<double> calculate_forward_differences_Hessian(const T& t, double (T::*f)(const Vector<double>&) const, const Vector<double>& x) const
    {
-      size_t n = x.size();
+      const size_t n = x.size();
 
       Matrix<double> H(n, n);
 
-      double h_i;
-      double h_j;
+      const double y = (t.*f)(x);
 
-      double y = (t.*f)(x);
+      const Vector<double> h = calculate_h(x);
 
-      Vector<double> x_forward_2i(x);
-      Vector<double> x_forward_ij(x);
-      Vector<double> x_forward_i(x);
-      Vector<double> x_forward_j(x);
+      // Single perturbations, shared by the diagonal and by all the off-diagonal terms
 
-      double y_forward_2i;
-      double y_forward_ij;
-      double y_forward_i;
-      double y_forward_j;
+      Vector<double> y_forward(n);
+      Vector<double> y_forward_2(n);
 
-      for(size_t i = 0; i < n; i++)
+      Vector<double> x_forward(x);
+
+      int i = 0;
+
+      #pragma omp parallel for private(i) firstprivate(x_forward) if(parallel_evaluation)
+
+      for(i = 0; i < (int)n; i++)
       {
-         h_i = calculate_h(x[i]);
+         x_forward[i] += h[i];
+         y_forward[i] = (t.*f)(x_forward);
+         x_forward[i] -= h[i];
 
-         x_forward_i[i] += h_i;       
-         y_forward_i = (t.*f)(x_forward_i);
-         x_forward_i[i] -= h_i;       
+         x_forward[i] += 2.0*h[i];
+         y_forward_2[i] = (t.*f)(x_forward);
+         x_forward[i] -= 2.0*h[i];
 
-         x_forward_2i[i] += 2.0*h_i;       
-         y_forward_2i = (t.*f)(x_forward_2i);
-         x_forward_2i[i] -= 2.0*h_i;       
+         H(i,i) = (y_forward_2[i] - 2.0*y_forward[i] + y)/(h[i]*h[i]);
+      }
 
-         H(i,i) = (y_forward_2i - 2*y_forward_i + y)/pow(h_i, 2);  
+      // Double perturbations, upper triangle only
 
-         for(size_t j = i; j < n; j++)
-         {
-            h_j = calculate_h(x[j]);
+      Vector<double> x_forward_ij(x);
 
-            x_forward_j[j] += h_j;       
-            y_forward_j = (t.*f)(x_forward_j);
-            x_forward_j[j] -= h_j;       
+      double y_forward_ij;
 
-            x_forward_ij[i] += h_i; 
-            x_forward_ij[j] += h_j; 
-            y_forward_ij = (t.*f)(x_forward_ij);   
-            x_forward_ij[i] -= h_i; 
-            x_forward_ij[j] -= h_j; 
-            
-            H(i,j) = (y_forward_ij - y_forward_i - y_forward_j + y)/(h_i*h_j);
-         } 
-      }
+      #pragma omp parallel for private(i, y_forward_ij) firstprivate(x_forward_ij) schedule(dynamic) if(parallel_evaluation)
 
-      for(size_t i = 0; i < n; i++)
+      for(i = 0; i < (int)n; i++)
       {
-         for(size_t j = 0; j < i; j++)
+         for(size_t j = i+1; j < n; j++)
          {
-            H(i,j) = H(j,i);
+            x_forward_ij[i] += h[i];
+            x_forward_ij[j] += h[j];
+            y_forward_ij = (t.*f)(x_forward_ij);
+            x_forward_ij[i] -= h[i];
+            x_forward_ij[j] -= h[j];
+
+            H(i,j) = (y_forward_ij - y_forward[i] - y_forward[j] + y)/(h[i]*h[j]);
+            H(j,i) = H(i,j);
          }
       }
 
@@ -1294,6 +1304,8 @@ public:
 
    /// Returns the Hessian matrix of a function of several dimensions using the central differences method. 
    /// The function to be differentiated is of the following form: double f(const Vector<double>&) const. 
+   /// The diagonal uses the five point stencil, and only the upper triangle of off-diagonal terms is evaluated.
+   /// With parallel evaluation, the perturbed evaluations are distributed among threads. 
    /// @param t : Object constructor containing the member method to differentiate.  
    /// @param f: Pointer to the member method.
    /// @param x: Input vector. 
@@ -1301,98 +1313,78 @@ public:
    template<class T> 
    Matrix<double> calculate_central_differences_Hessian(const T& t, double (T::*f)(const Vector<double>&) const, const Vector<double>& x) const
    {
-      size_t n = x.size();
+      const size_t n = x.size();
 
-      double y = (t.*f)(x);
+      const double y = (t.*f)(x);
 
       Matrix<double> H(n, n);
 
-      double h_i;
-      double h_j;
-
-      Vector<double> x_backward_2i(x);
-      Vector<double> x_backward_i(x);
-
-      Vector<double> x_forward_i(x);
-      Vector<double> x_forward_2i(x);      
+      const Vector<double> h = calculate_h(x);
 
-      Vector<double> x_backward_ij(x);
-      Vector<double> x_forward_ij(x);
+      // Diagonal terms, with the five point stencil
 
-      Vector<double> x_backward_i_forward_j(x);
-      Vector<double> x_forward_i_backward_j(x);
+      Vector<double> x_perturbed(x);
 
       double y_backward_2i;
       double y_backward_i;
-
       double y_forward_i;
       double y_forward_2i;
-   
-      double y_backward_ij;
-      double y_forward_ij;
 
-      double y_backward_i_forward_j;
-      double y_forward_i_backward_j;
+      int i = 0;
 
-      for(size_t i = 0; i < n; i++)
-      {
-         h_i = calculate_h(x[i]);
+      #pragma omp parallel for private(i, y_backward_2i, y_backward_i, y_forward_i, y_forward_2i) firstprivate(x_perturbed) if(parallel_evaluation)
 
-         x_backward_2i[i] -= 2.0*h_i; 
-         y_backward_2i = (t.*f)(x_backward_2i);
-         x_backward_2i[i] += 2.0*h_i; 
+      for(i = 0; i < (int)n; i++)
+      {
+         x_perturbed[i] -= 2.0*h[i];
+         y_backward_2i = (t.*f)(x_perturbed);
+         x_perturbed[i] += h[i];
+         y_backward_i = (t.*f)(x_perturbed);
+         x_perturbed[i] += 2.0*h[i];
+         y_forward_i = (t.*f)(x_perturbed);
+         x_perturbed[i] += h[i];
+         y_forward_2i = (t.*f)(x_perturbed);
+         x_perturbed[i] = x[i];
+
+         H(i,i) = (-y_forward_2i + 16.0*y_forward_i -30.0*y + 16.0*y_backward_i - y_backward_2i)/(12.0*h[i]*h[i]);
+      }
 
-         x_backward_i[i] -= h_i; 
-         y_backward_i = (t.*f)(x_backward_i);
-         x_backward_i[i] += h_i; 
+      // Off-diagonal terms, upper triangle only
 
-         x_forward_i[i] += h_i; 
-         y_forward_i = (t.*f)(x_forward_i);
-         x_forward_i[i] -= h_i; 
+      Vector<double> x_ij(x);
 
-         x_forward_2i[i] += 2.0*h_i; 
-         y_forward_2i = (t.*f)(x_forward_2i);
-         x_forward_2i[i] -= 2.0*h_i; 
+      double y_backward_ij;
+      double y_forward_ij;
+      double y_backward_i_forward_j;
+      double y_forward_i_backward_j;
 
-         H(i,i) = (-y_forward_2i + 16.0*y_forward_i -30.0*y + 16.0*y_backward_i - y_backward_2i)/(12.0*pow(h_i, 2));  
+      #pragma omp parallel for private(i, y_backward_ij, y_forward_ij, y_backward_i_forward_j, y_forward_i_backward_j) firstprivate(x_ij) schedule(dynamic) if(parallel_evaluation)
 
-         for(size_t j = i; j < n; j++)
+      for(i = 0; i < (int)n; i++)
+      {
+         for(size_t j = i+1; j < n; j++)
          {
-            h_j = calculate_h(x[j]);
+            x_ij[i] = x[i] - h[i];
+            x_ij[j] = x[j] - h[j];
+            y_backward_ij = (t.*f)(x_ij);
 
-            x_backward_ij[i] -= h_i;  
-            x_backward_ij[j] -= h_j;  
-            y_backward_ij = (t.*f)(x_backward_ij);   
-            x_backward_ij[i] += h_i;  
-            x_backward_ij[j] += h_j;  
+            x_ij[i] = x[i] + h[i];
+            x_ij[j] = x[j] + h[j];
+            y_forward_ij = (t.*f)(x_ij);
 
-            x_forward_ij[i] += h_i;  
-            x_forward_ij[j] += h_j;  
-            y_forward_ij = (t.*f)(x_forward_ij);   
-            x_forward_ij[i] -= h_i;  
-            x_forward_ij[j] -= h_j;  
-            
-            x_backward_i_forward_j[i] -= h_i;
-            x_backward_i_forward_j[j] += h_j;
-            y_backward_i_forward_j = (t.*f)(x_backward_i_forward_j);   
-            x_backward_i_forward_j[i] += h_i;
-            x_backward_i_forward_j[j] -= h_j;
+            x_ij[i] = x[i] - h[i];
+            x_ij[j] = x[j] + h[j];
+            y_backward_i_forward_j = (t.*f)(x_ij);
 
-            x_forward_i_backward_j[i] += h_i;
-            x_forward_i_backward_j[j] -= h_j;
-            y_forward_i_backward_j = (t.*f)(x_forward_i_backward_j);   
-            x_forward_i_backward_j[i] -= h_i;
-            x_forward_i_backward_j[j] += h_j;
- 
-            H(i,j) = (y_forward_ij - y_forward_i_backward_j - y_backward_i_forward_j + y_backward_ij)/(4.0*h_i*h_j);
-         }
-      }
+            x_ij[i] = x[i] + h[i];
+            x_ij[j] = x[j] - h[j];
+            y_forward_i_backward_j = (t.*f)(x_ij);
 
-      for(size_t i = 0; i < n; i++)
-      {
-         for(size_t j = 0; j < i; j++)
-         {
-            H(i,j) = H(j,i);
+            x_ij[i] = x[i];
+            x_ij[j] = x[j];
+
+            H(i,j) = (y_forward_ij - y_forward_i_backward_j - y_backward_i_forward_j + y_backward_ij)/(4.0*h[i]*h[j]);
+            H(j,i) = H(i,j);
          }
       }
 
@@ -1925,7 +1917,11 @@ public:
 
       Matrix<double> J(m,n);
 
-      for(size_t j = 0; j < n; j++)
+      int j = 0;
+
+      #pragma omp parallel for private(j, h, y_forward) firstprivate(x_forward) if(parallel_evaluation)
+
+      for(j = 0; j < (int)n; j++)
 	   {
          h = calculate_h(x[j]);
 
@@ -1969,7 +1965,11 @@ public:
 
       Matrix<double> J(m,n);
 
-      for(size_t j = 0; j < n; j++)
+      int j = 0;
+
+      #pragma omp parallel for private(j, h, y_forward, y_backward) firstprivate(x_forward, x_backward) if(parallel_evaluation)
+
+      for(j = 0; j < (int)n; j++)
 	  {
          h = calculate_h(x[j]);
 
@@ -3710,6 +3710,11 @@ private:
 
    size_t precision_digits;
 
+   /// True if the perturbed evaluations of gradients, Jacobians and Hessians of const methods are distributed among threads. 
+   /// The evaluated method must then be safe to call concurrently.
+
+   bool parallel_evaluation;
+
    /// Flag for displaying warning messages from this class. 
 
    bool display;
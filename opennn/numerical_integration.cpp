@@ -24,7 +24,7 @@ namespace OpenNN
 
 NumericalIntegration::NumericalIntegration(void)	
 {   
-
+   set_default();
 }
 
 
@@ -85,6 +85,26 @@ std::string NumericalIntegration::write_numerical_integration_method(void) const
 }
 
 
+// const double& get_Gauss_Kronrod_tolerance(void) const method
+
+/// Returns the tolerance on the error estimate of adaptive Gauss-Kronrod quadrature.
+
+const double& NumericalIntegration::get_Gauss_Kronrod_tolerance(void) const
+{
+   return(Gauss_Kronrod_tolerance);
+}
+
+
+// const size_t& get_maximum_Gauss_Kronrod_intervals_number(void) const method
+
+/// Returns the maximum number of subintervals in adaptive Gauss-Kronrod quadrature.
+
+const size_t& NumericalIntegration::get_maximum_Gauss_Kronrod_intervals_number(void) const
+{
+   return(maximum_Gauss_Kronrod_intervals_number);
+}
+
+
 // const bool& get_display(void) const method
 
 /// Returns the flag used by this class for displaying or not displaying warnings.
@@ -104,6 +124,9 @@ void NumericalIntegration::set(const NumericalIntegration& other_numerical_integ
 {
    numerical_integration_method = other_numerical_integration.numerical_integration_method;
 
+   Gauss_Kronrod_tolerance = other_numerical_integration.Gauss_Kronrod_tolerance;
+   maximum_Gauss_Kronrod_intervals_number = other_numerical_integration.maximum_Gauss_Kronrod_intervals_number;
+
    display = other_numerical_integration.display;
 }
 
@@ -149,6 +172,45 @@ void NumericalIntegration::set_numerical_integration_method(const std::string& n
 }
 
 
+// void set_Gauss_Kronrod_tolerance(const double&) method
+
+/// Sets a new tolerance on the error estimate of adaptive Gauss-Kronrod quadrature.
+/// @param new_Gauss_Kronrod_tolerance Tolerance value. It must be greater than zero.
+
+void NumericalIntegration::set_Gauss_Kronrod_tolerance(const double& new_Gauss_Kronrod_tolerance)
+{
+   // Control sentence (if debug)
+
+   #ifdef __OPENNN_DEBUG__ 
+
+   if(new_Gauss_Kronrod_tolerance <= 0.0)
+   {
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: NumericalIntegration class.\n"
+             << "void set_Gauss_Kronrod_tolerance(const double&) method.\n"
+             << "Tolerance must be greater than zero.\n";
+
+      throw std::logic_error(buffer.str());
+   }
+
+   #endif
+
+   Gauss_Kronrod_tolerance = new_Gauss_Kronrod_tolerance;
+}
+
+
+// void set_maximum_Gauss_Kronrod_intervals_number(const size_t&) method
+
+/// Sets the maximum number of subintervals in adaptive Gauss-Kronrod quadrature.
+/// @param new_maximum_Gauss_Kronrod_intervals_number Maximum number of subintervals.
+
+void NumericalIntegration::set_maximum_Gauss_Kronrod_intervals_number(const size_t& new_maximum_Gauss_Kronrod_intervals_number)
+{
+   maximum_Gauss_Kronrod_intervals_number = new_maximum_Gauss_Kronrod_intervals_number;
+}
+
+
 // void set_display(const bool&) method
 
 /// Sets a new flag for displaying warnings from this class or not. 
@@ -165,6 +227,8 @@ void NumericalIntegration::set_display(const bool& new_display)
 /// Sets the default values to the numerical integration object:
 /// <ul>
 /// <li> Numerical integration method: Simpson method.
+/// <li> Gauss-Kronrod tolerance: 1.0e-6.
+/// <li> Maximum Gauss-Kronrod intervals number: 1000.
 /// <li> Display: true
 /// </ul>
 
@@ -172,6 +236,9 @@ void NumericalIntegration::set_default(void)
 {
    numerical_integration_method = SimpsonMethod;
 
+   Gauss_Kronrod_tolerance = 1.0e-6;
+   maximum_Gauss_Kronrod_intervals_number = 1000;
+
    display = true;
 }
 
@@ -326,6 +393,139 @@ double NumericalIntegration::calculate_integral(const Vector<double>& x, const V
  
 }
 
+
+// Matrix<double> calculate_Gauss_Kronrod_abscissae(const Vector<double>&, const Vector<double>&) method
+
+/// Returns the abscissae of the 15 points Kronrod rule on a set of intervals, as a column matrix.
+/// The rows from 15*i to 15*i+14 correspond to the interval i.
+/// Within each interval, the first abscissa is the midpoint, followed by pairs of symmetric abscissae.
+/// @param lower_limits Lower limits of the intervals.
+/// @param upper_limits Upper limits of the intervals.
+
+Matrix<double> NumericalIntegration::calculate_Gauss_Kronrod_abscissae(const Vector<double>& lower_limits, const Vector<double>& upper_limits)
+{
+   static const double nodes[7] = {0.991455371120812639206854697526329,
+                                   0.949107912342758524526189684047851,
+                                   0.864864423359769072789712788640926,
+                                   0.741531185599394439863864773280788,
+                                   0.586087235467691130294144845693013,
+                                   0.405845151377397166906606412076961,
+                                   0.207784955007898467600689403773245};
+
+   const size_t intervals_number = lower_limits.size();
+
+   Matrix<double> abscissae(15*intervals_number, 1);
+
+   for(size_t i = 0; i < intervals_number; i++)
+   {
+      const double center = (lower_limits[i] + upper_limits[i])/2.0;
+      const double half_length = (upper_limits[i] - lower_limits[i])/2.0;
+
+      abscissae(15*i, 0) = center;
+
+      for(size_t j = 0; j < 7; j++)
+      {
+         abscissae(15*i+1+2*j, 0) = center - half_length*nodes[j];
+         abscissae(15*i+2+2*j, 0) = center + half_length*nodes[j];
+      }
+   }
+
+   return(abscissae);
+}
+
+
+// Matrix<double> calculate_Gauss_Kronrod_integrals
+// (const Matrix<double>&, const Vector<double>&, const Vector<double>&, Vector<double>&) method
+
+/// Applies the 7-15 points Gauss-Kronrod rule on a set of intervals.
+/// It returns a matrix with the Kronrod estimate of the integral of each component (columns) on each interval (rows).
+/// @param integrands Values of the integrand at the abscissae given by calculate_Gauss_Kronrod_abscissae.
+/// @param lower_limits Lower limits of the intervals.
+/// @param upper_limits Upper limits of the intervals.
+/// @param errors Output vector with the error estimate on each interval,
+/// which is the greatest difference between the Kronrod and the Gauss estimates over all the components.
+
+Matrix<double> NumericalIntegration::calculate_Gauss_Kronrod_integrals(const Matrix<double>& integrands,
+                                                                       const Vector<double>& lower_limits,
+                                                                       const Vector<double>& upper_limits,
+                                                                       Vector<double>& errors)
+{
+   static const double Kronrod_weights[8] = {0.022935322010529224963732008058970,
+                                             0.063092092629978553290700663189204,
+                                             0.104790010322250183839876322541518,
+                                             0.140653259715525918745189590510238,
+                                             0.169004726639267902826583426598550,
+                                             0.190350578064785409913256402421014,
+                                             0.204432940075298892414161999234649,
+                                             0.209482141084727828012999174891714};
+
+   static const double Gauss_weights[4] = {0.129484966168869693270611432679082,
+                                           0.279705391489276667901467771423780,
+                                           0.381830050505118944950369775488975,
+                                           0.417959183673469387755102040816327};
+
+   const size_t intervals_number = lower_limits.size();
+   const size_t components_number = integrands.get_columns_number();
+
+   // Control sentence (if debug)
+
+   #ifdef __OPENNN_DEBUG__ 
+
+   if(integrands.get_rows_number() != 15*intervals_number)
+   {
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: NumericalIntegration class.\n"
+             << "Matrix<double> calculate_Gauss_Kronrod_integrals(const Matrix<double>&, const Vector<double>&, const Vector<double>&, Vector<double>&) method.\n"
+             << "Number of rows of integrands (" << integrands.get_rows_number() << ") must be 15 times the number of intervals (" << intervals_number << ").\n";
+
+      throw std::logic_error(buffer.str());
+   }
+
+   #endif
+
+   Matrix<double> integrals(intervals_number, components_number);
+
+   errors.set(intervals_number, 0.0);
+
+   for(size_t i = 0; i < intervals_number; i++)
+   {
+      const double half_length = (upper_limits[i] - lower_limits[i])/2.0;
+
+      for(size_t k = 0; k < components_number; k++)
+      {
+         const double center_value = integrands(15*i, k);
+
+         double Kronrod_sum = Kronrod_weights[7]*center_value;
+         double Gauss_sum = Gauss_weights[3]*center_value;
+
+         for(size_t j = 0; j < 7; j++)
+         {
+            const double pair_sum = integrands(15*i+1+2*j, k) + integrands(15*i+2+2*j, k);
+
+            Kronrod_sum += Kronrod_weights[j]*pair_sum;
+
+            if(j%2 != 0)
+            {
+               Gauss_sum += Gauss_weights[j/2]*pair_sum;
+            }
+         }
+
+         integrals(i, k) = half_length*Kronrod_sum;
+
+         const double error = fabs(half_length*(Kronrod_sum - Gauss_sum));
+
+         if(error > errors[i])
+         {
+            errors[i] = error;
+         }
+      }
+   }
+
+   return(integrals);
+}
+
+
 // tinyxml2::XMLDocument* to_XML(void) const method
 
 /// Serializes this numerical integration object into a XML document.
@@ -353,6 +553,28 @@ tinyxml2::XMLDocument* NumericalIntegration::to_XML(void) const
    text = document->NewText(write_numerical_integration_method().c_str());
    element->LinkEndChild(text);
 
+   // Gauss-Kronrod tolerance
+
+   element = document->NewElement("GaussKronrodTolerance");
+   root_element->LinkEndChild(element);
+
+   buffer.str("");
+   buffer << Gauss_Kronrod_tolerance;
+
+   text = document->NewText(buffer.str().c_str());
+   element->LinkEndChild(text);
+
+   // Maximum Gauss-Kronrod intervals number
+
+   element = document->NewElement("MaximumGaussKronrodIntervalsNumber");
+   root_element->LinkEndChild(element);
+
+   buffer.str("");
+   buffer << maximum_Gauss_Kronrod_intervals_number;
+
+   text = document->NewText(buffer.str().c_str());
+   element->LinkEndChild(text);
+
    // Display
    
    element = document->NewElement("Display");
@@ -407,6 +629,44 @@ void NumericalIntegration::from_XML(const tinyxml2::XMLDocument& document)
        }
    }
 
+   // Gauss-Kronrod tolerance
+   {
+       const tinyxml2::XMLElement* element = root_element->FirstChildElement("GaussKronrodTolerance");
+
+       if(element)
+       {
+          const double new_Gauss_Kronrod_tolerance = atof(element->GetText());
+
+          try
+          {
+             set_Gauss_Kronrod_tolerance(new_Gauss_Kronrod_tolerance);
+          }
+          catch(const std::logic_error& e)
+          {
+             std::cout << e.what() << std::endl;
+          }
+       }
+   }
+
+   // Maximum Gauss-Kronrod intervals number
+   {
+       const tinyxml2::XMLElement* element = root_element->FirstChildElement("MaximumGaussKronrodIntervalsNumber");
+
+       if(element)
+       {
+          const size_t new_maximum_Gauss_Kronrod_intervals_number = atoi(element->GetText());
+
+          try
+          {
+             set_maximum_Gauss_Kronrod_intervals_number(new_maximum_Gauss_Kronrod_intervals_number);
+          }
+          catch(const std::logic_error& e)
+          {
+             std::cout << e.what() << std::endl;
+          }
+       }
+   }
+
    // Display
    {
        const tinyxml2::XMLElement* element = root_element->FirstChildElement("Display");
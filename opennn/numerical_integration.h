@@ -17,10 +17,13 @@
 // System includes
 
 #include<iostream>
+#include<cmath>
+#include<algorithm>
 
 // OpenNN includes
 
 #include "vector.h"
+#include "matrix.h"
 
 // TinyXml includes
 
@@ -32,6 +35,7 @@ namespace OpenNN
 
 /// This class contains methods for numerical integration of functions. 
 /// In particular it implements the trapezoid method and the Simpson's method.
+/// It also implements adaptive Gauss-Kronrod quadrature for integrands which can be evaluated at many abscissae at once.
 
 class NumericalIntegration 
 {
@@ -55,6 +59,9 @@ class NumericalIntegration
    const NumericalIntegrationMethod& get_numerical_integration_method(void) const;
    std::string write_numerical_integration_method(void) const;
    
+   const double& get_Gauss_Kronrod_tolerance(void) const;
+   const size_t& get_maximum_Gauss_Kronrod_intervals_number(void) const;
+
    const bool& get_display(void) const;
 
    void set(const NumericalIntegration&);
@@ -62,6 +69,9 @@ class NumericalIntegration
    void set_numerical_integration_method(const NumericalIntegrationMethod&);
    void set_numerical_integration_method(const std::string&);
 
+   void set_Gauss_Kronrod_tolerance(const double&);
+   void set_maximum_Gauss_Kronrod_intervals_number(const size_t&);
+
    void set_display(const bool&);
 
    void set_default(void);
@@ -73,6 +83,12 @@ class NumericalIntegration
 
    double calculate_integral(const Vector<double>&, const Vector<double>&) const;
 
+   // Gauss-Kronrod quadrature
+
+   static Matrix<double> calculate_Gauss_Kronrod_abscissae(const Vector<double>&, const Vector<double>&);
+
+   static Matrix<double> calculate_Gauss_Kronrod_integrals(const Matrix<double>&, const Vector<double>&, const Vector<double>&, Vector<double>&);
+
    // Serialization methods
 
    tinyxml2::XMLDocument* to_XML(void) const;   
@@ -309,12 +325,130 @@ class NumericalIntegration
    }
 
 
+   // Vector<double> calculate_Gauss_Kronrod_integral
+   // (const T&, Matrix<double> (T::*f)(const Matrix<double>&) const, const double&, const double&) const method
+
+   /// This method evaluates the integral of a vector function given as a class member method
+   /// using adaptive 7-15 points Gauss-Kronrod quadrature.
+   /// The member method is called with a column matrix of abscissae and must return a matrix with the integrand
+   /// values, one row for each abscissa and one column for each component.
+   /// All the abscissae of a refinement pass are evaluated in a single call.
+   /// Every interval whose error estimate exceeds its share of the tolerance is bisected,
+   /// until the total error is below the tolerance or the maximum number of intervals is reached.
+   /// @param t : Object constructor containing the member method to integrate.
+   /// @param f: Pointer to the member method.
+   /// @param a: Lower integration limit.
+   /// @param b: Upper integration limit.
+
+   template<class T>
+   Vector<double> calculate_Gauss_Kronrod_integral(const T& t, Matrix<double> (T::*f)(const Matrix<double>&) const, const double& a, const double& b) const
+   {
+      const double length = fabs(b-a);
+
+      Vector<double> lower_limits(1, a);
+      Vector<double> upper_limits(1, b);
+
+      Vector<double> errors;
+
+      Matrix<double> integrals = calculate_Gauss_Kronrod_integrals((t.*f)(calculate_Gauss_Kronrod_abscissae(lower_limits, upper_limits)), lower_limits, upper_limits, errors);
+
+      while(true)
+      {
+         const double tolerance = Gauss_Kronrod_tolerance*std::max(1.0, integrals.calculate_rows_sum().calculate_norm());
+
+         if(errors.calculate_sum() <= tolerance)
+         {
+            break;
+         }
+
+         // Intervals to be bisected
+
+         const size_t intervals_number = lower_limits.size();
+
+         Vector<size_t> kept_indices;
+
+         Vector<double> new_lower_limits;
+         Vector<double> new_upper_limits;
+
+         for(size_t i = 0; i < intervals_number; i++)
+         {
+            if(errors[i] > tolerance*fabs(upper_limits[i]-lower_limits[i])/length)
+            {
+               const double middle = (lower_limits[i] + upper_limits[i])/2.0;
+
+               new_lower_limits.push_back(lower_limits[i]);
+               new_upper_limits.push_back(middle);
+
+               new_lower_limits.push_back(middle);
+               new_upper_limits.push_back(upper_limits[i]);
+            }
+            else
+            {
+               kept_indices.push_back(i);
+            }
+         }
+
+         if(new_lower_limits.empty())
+         {
+            break;
+         }
+
+         if(kept_indices.size() + new_lower_limits.size() > maximum_Gauss_Kronrod_intervals_number)
+         {
+            if(display)
+            {
+               std::cout << "OpenNN Warning: NumericalIntegration class.\n"
+                         << "Vector<double> calculate_Gauss_Kronrod_integral(const T&, Matrix<double> (T::*f)(const Matrix<double>&) const, const double&, const double&) const method.\n"
+                         << "Maximum number of intervals reached (" << maximum_Gauss_Kronrod_intervals_number << ").\n"
+                         << "Error estimate: " << errors.calculate_sum() << std::endl;
+            }
+
+            break;
+         }
+
+         // Evaluate all the new intervals at once
+
+         Vector<double> new_errors;
+
+         const Matrix<double> new_integrals
+         = calculate_Gauss_Kronrod_integrals((t.*f)(calculate_Gauss_Kronrod_abscissae(new_lower_limits, new_upper_limits)), new_lower_limits, new_upper_limits, new_errors);
+
+         if(kept_indices.empty())
+         {
+            integrals = new_integrals;
+
+            lower_limits = new_lower_limits;
+            upper_limits = new_upper_limits;
+            errors = new_errors;
+         }
+         else
+         {
+            integrals = integrals.arrange_submatrix_rows(kept_indices).assemble_rows(new_integrals);
+
+            lower_limits = lower_limits.arrange_subvector(kept_indices).assemble(new_lower_limits);
+            upper_limits = upper_limits.arrange_subvector(kept_indices).assemble(new_upper_limits);
+            errors = errors.arrange_subvector(kept_indices).assemble(new_errors);
+         }
+      }
+
+      return(integrals.calculate_rows_sum());
+   }
+
+
 private:
 
    /// Numerical integration method variable. 
 
    NumericalIntegrationMethod numerical_integration_method;
 
+   /// Tolerance on the Gauss-Kronrod error estimate, relative to the norm of the integral when it is greater than one.
+
+   double Gauss_Kronrod_tolerance;
+
+   /// Maximum number of subintervals in adaptive Gauss-Kronrod quadrature.
+
+   size_t maximum_Gauss_Kronrod_intervals_number;
+
    /// Flag for displaying warning messages from this class. 
 
    bool display;
@@ -89,6 +89,7 @@
 #include "newton_method.h"
 #include "quasi_newton_method.h"
 #include "random_search.h"
+#include "ensemble_training.h"
 #include "training_algorithm.h"
 #include "training_rate_algorithm.h"
 
@@ -97,6 +98,7 @@
 #include "matrix.h"
 #include "numerical_differentiation.h"
 #include "numerical_integration.h"
+#include "instrumentation.h"
 #include "vector.h"
 #include "math.h"
 
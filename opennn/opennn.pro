@@ -23,6 +23,12 @@ CONFIG(debug, debug|release) {
     DEFINES += __OPENNN_DEBUG__
 }
 
+# Timers and counters in the hot paths (qmake CONFIG+=instrumentation)
+
+instrumentation {
+    DEFINES += __OPENNN_INSTRUMENTATION__
+}
+
 # TinyXML2 library
 
 win32:CONFIG(release, debug|release): LIBS += -L$$OUT_PWD/../tinyxml2/release/ -ltinyxml2
@@ -95,6 +101,7 @@ HEADERS += \
     training_algorithm.h \
     training_rate_algorithm.h \
     random_search.h \
+    ensemble_training.h \
     quasi_newton_method.h \
     newton_method.h \
     levenberg_marquardt_algorithm.h \
@@ -115,6 +122,7 @@ HEADERS += \
     matrix.h \
     numerical_integration.h \
     numerical_differentiation.h \
+    instrumentation.h \
     opennn.h
 
 SOURCES += \
@@ -155,6 +163,7 @@ SOURCES += \
     training_algorithm.cpp \
     training_rate_algorithm.cpp \
     random_search.cpp \
+    ensemble_training.cpp \
     quasi_newton_method.cpp \
     newton_method.cpp \
     levenberg_marquardt_algorithm.cpp \
@@ -172,4 +181,5 @@ SOURCES += \
     genetic_algorithm.cpp\
     testing_analysis.cpp \
     numerical_integration.cpp \
-    numerical_differentiation.cpp
+    numerical_differentiation.cpp \
+    instrumentation.cpp
@@ -531,7 +531,7 @@ Matrix<double> OrdinaryDifferentialEquations::calculate_Runge_Kutta_solution(con
 
       for(size_t j = 0; j < dependent_variables_number; j++)
       {
-         variables[1+j] = solution(i,1+j) + h*c[2][j]/2.0;
+         variables[1+j] = solution(i,1+j) + h*c[2][j];
       }
             
       c[3] = calculate_dependent_variables_dots(neural_network, variables);
@@ -575,15 +575,13 @@ Vector<double> OrdinaryDifferentialEquations::calculate_Runge_Kutta_final_soluti
 
    for(size_t j = 0; j < dependent_variables_number; j++)
    {
-      final_solution[0] = initial_dependent_variables[j];
+      final_solution[1+j] = initial_dependent_variables[j];
    }
 
    // Main loop
 
    for(size_t i = 0; i < points_number-1; i++)
    {
-      final_solution[0] = final_solution[0] + h;
-
       // First coefficient 
 
       variables[0] = final_solution[0]; 
@@ -619,11 +617,11 @@ Vector<double> OrdinaryDifferentialEquations::calculate_Runge_Kutta_final_soluti
 
       // Fourth coefficient
 
-      variables[0] = final_solution[0]; 
+      variables[0] = final_solution[0] + h; 
 
       for(size_t j = 0; j < dependent_variables_number; j++)
       {
-         variables[1+j] = final_solution[1+j] + h*c[2][j]/2.0; 
+         variables[1+j] = final_solution[1+j] + h*c[2][j]; 
       }
             
       c[3] = calculate_dependent_variables_dots(neural_network, variables);
@@ -634,8 +632,12 @@ Vector<double> OrdinaryDifferentialEquations::calculate_Runge_Kutta_final_soluti
       {
          final_solution[1+j] = final_solution[1+j] + h*(c[0][j] + 2.0*c[1][j] + 2.0*c[2][j] + c[3][j])/6.0;
       }
+
+      final_solution[0] = final_solution[0] + h;
    }
 
+   final_solution[0] = final_independent_variable;
+
    return(final_solution);
 }
 
@@ -643,6 +645,7 @@ Vector<double> OrdinaryDifferentialEquations::calculate_Runge_Kutta_final_soluti
 // Matrix<double> calculate_Runge_Kutta_Fehlberg_solution(const NeuralNetwork&) const method
 
 /// This method calculate the numerical solution of the ordinary differential equations model using the Runge-Kutta method.
+/// It throws an exception if the number of steps exceeds the error size. 
 /// @param neural_network Neural network which represents the external inputs to the mathematical model. 
 
 Matrix<double> OrdinaryDifferentialEquations::calculate_Runge_Kutta_Fehlberg_solution(const NeuralNetwork& neural_network) const
@@ -694,8 +697,6 @@ Matrix<double> OrdinaryDifferentialEquations::calculate_Runge_Kutta_Fehlberg_sol
 
    const size_t variables_number = count_variables_number();
 
-   size_t size = initial_size;
-
    Vector<double> errors(dependent_variables_number, 0.0);
 
    double error = 0.0;
@@ -707,26 +708,49 @@ Matrix<double> OrdinaryDifferentialEquations::calculate_Runge_Kutta_Fehlberg_sol
 
    Vector<double> variables(variables_number);
 
-   Matrix<double> solution(size, variables_number);
+   // The accepted points are stored row by row in a flat buffer, whose capacity grows geometrically. 
+   // The solution matrix is assembled only once at the end.
+
+   Vector<double> points;
+   points.reserve(initial_size*variables_number);
+
+   Vector<double> point(variables_number);
 
    size_t point_index = 0;
 
+   size_t steps_count = 0;
+
    // Initial values
 
-   solution(0,0) = initial_independent_variable;
+   point[0] = initial_independent_variable;
 
    for(size_t j = 0; j < dependent_variables_number; j++)
    {
-      solution(0,1+j) = initial_dependent_variables[j];
+      point[1+j] = initial_dependent_variables[j];
    } 
 
+   points.insert(points.end(), point.begin(), point.end());
+
    // Main loop
 
-   while(solution(point_index,0) < final_independent_variable)
+   while(point[0] < final_independent_variable)
    {   
+      steps_count++;
+
+      if(steps_count > error_size)
+      {
+         std::ostringstream buffer;
+
+         buffer << "OpenNN Exception: OrdinaryDifferentialEquations class.\n"
+                << "Matrix<double> calculate_Runge_Kutta_Fehlberg_solution(const NeuralNetwork&) const method.\n"
+                << "Number of steps is bigger than greatest allowable.\n";
+
+         throw std::logic_error(buffer.str());
+      }
+
       // Set smallest allowable stepsize
 
-      hmin = 32.0*epsilon*fabs(solution(point_index,0));
+      hmin = 32.0*epsilon*fabs(point[0]);
 
       if(h < hmin)
       {
@@ -740,73 +764,73 @@ Matrix<double> OrdinaryDifferentialEquations::calculate_Runge_Kutta_Fehlberg_sol
          h = hmin;
       }
 
-      if(solution(point_index,0) + h > final_independent_variable)
+      if(point[0] + h > final_independent_variable)
       {        
-         h = final_independent_variable - solution(point_index,0);
+         h = final_independent_variable - point[0];
       }
 
       // First coefficient
 
-      variables[0] = solution(point_index,0);
+      variables[0] = point[0];
 
       for(size_t j = 0; j < dependent_variables_number; j++)
       {
-         variables[1+j] = solution(point_index,1+j);
+         variables[1+j] = point[1+j];
       }
 
       c[0] = calculate_dependent_variables_dots(neural_network, variables)*h;
 
       // Second coefficient
 
-      variables[0] = solution(point_index,0) + a2*h;
+      variables[0] = point[0] + a2*h;
 
       for(size_t j = 0; j < dependent_variables_number; j++)
       {
-         variables[1+j] = solution(point_index,1+j)+ b21*c[0][j];
+         variables[1+j] = point[1+j]+ b21*c[0][j];
       }
 
       c[1] = calculate_dependent_variables_dots(neural_network, variables)*h;
 
       // Third coefficient
 
-      variables[0] = solution(point_index,0) + a3*h;
+      variables[0] = point[0] + a3*h;
 
       for(size_t j = 0; j < dependent_variables_number; j++)
       {
-         variables[1+j] =  solution(point_index,1+j) + b31*c[0][j] + b32*c[1][j];
+         variables[1+j] =  point[1+j] + b31*c[0][j] + b32*c[1][j];
       }
 
       c[2] = calculate_dependent_variables_dots(neural_network, variables)*h;
 
       // Fourth coefficient
 
-      variables[0] = solution(point_index,0) + a4*h;
+      variables[0] = point[0] + a4*h;
 
       for(size_t j = 0; j < dependent_variables_number; j++)
       {
-         variables[1+j] = solution(point_index,1+j) + b41*c[0][j] + b42*c[1][j] + b43*c[2][j];
+         variables[1+j] = point[1+j] + b41*c[0][j] + b42*c[1][j] + b43*c[2][j];
       }
 
       c[3] = calculate_dependent_variables_dots(neural_network, variables)*h; 
 
       // Fifth coefficient
 
-      variables[0] = solution(point_index,0) + a5*h;
+      variables[0] = point[0] + a5*h;
 
       for(size_t j = 0; j < dependent_variables_number; j++)
       {
-         variables[1+j] = solution(point_index,1+j) + b51*c[0][j] + b52*c[1][j] + b53*c[2][j] + b54*c[3][j];
+         variables[1+j] = point[1+j] + b51*c[0][j] + b52*c[1][j] + b53*c[2][j] + b54*c[3][j];
       }
       
       c[4] = calculate_dependent_variables_dots(neural_network, variables)*h;
             
       // Sixth coefficient
 
-      variables[0] = solution(point_index,0) + a6*h;
+      variables[0] = point[0] + a6*h;
             
       for(size_t j = 0; j < dependent_variables_number; j++)
       {
-         variables[1+j] = solution(point_index,1+j) +  b61*c[0][j] + b62*c[1][j] + b63*c[2][j] + b64*c[3][j] + b65*c[4][j];
+         variables[1+j] = point[1+j] +  b61*c[0][j] + b62*c[1][j] + b63*c[2][j] + b64*c[3][j] + b65*c[4][j];
       }
       
       c[5] = calculate_dependent_variables_dots(neural_network, variables)*h;
@@ -822,13 +846,15 @@ Matrix<double> OrdinaryDifferentialEquations::calculate_Runge_Kutta_Fehlberg_sol
    
       if(error <= tolerance)
       {
-         solution(point_index+1,0) = solution(point_index,0) + h;
+         point[0] += h;
 
          for(size_t j = 0; j < dependent_variables_number; j++)
          {
-            solution(point_index+1,1+j) = solution(point_index,1+j) + c51*c[0][j] + c52*c[1][j] + c53*c[2][j] + c54*c[3][j] + c55*c[4][j] + c56*c[5][j];
+            point[1+j] += c51*c[0][j] + c52*c[1][j] + c53*c[2][j] + c54*c[3][j] + c55*c[4][j] + c56*c[5][j];
          }
 
+         points.insert(points.end(), point.begin(), point.end());
+
          point_index++;
 
          if(error != 0.0)
@@ -836,30 +862,11 @@ Matrix<double> OrdinaryDifferentialEquations::calculate_Runge_Kutta_Fehlberg_sol
             h *= 0.9*pow(fabs(tolerance/error), 0.2);
          }
 
-         if(point_index >= size)
+         if(display && point_index == warning_size)
          {
-            size *= 2;
-
-            if(display && size > warning_size)
-            {
-               std::cout << "OpenNN Warning: OrdinaryDifferentialEquations class." << std::endl
-                         << "calculate_Runge_Kutta_Fehlberg_solution() method." << std::endl
-                         << "Solution size is " << size << std::endl;
-            }
-            else if(size > error_size)
-            {
-               std::ostringstream buffer;
-
-               buffer << "OpenNN Exception: OrdinaryDifferentialEquations class." << std::endl
+            std::cout << "OpenNN Warning: OrdinaryDifferentialEquations class." << std::endl
                       << "calculate_Runge_Kutta_Fehlberg_solution() method." << std::endl
-                      << "Solution size is bigger than greatest allowable." << std::endl;
-                            
-               throw std::logic_error(buffer.str());          
-            }
-
-            // @todo Substitute resize method
-
-            //solution.resize(size, variables_number);
+                      << "Solution size is " << point_index+1 << std::endl;
          }
       }
       else
@@ -868,9 +875,17 @@ Matrix<double> OrdinaryDifferentialEquations::calculate_Runge_Kutta_Fehlberg_sol
       }
    } // end while loop   
 
-   // @todo Substitute resize method
+   const size_t rows_number = point_index+1;
 
-   //solution.resize(point_index+1, variables_number);
+   Matrix<double> solution(rows_number, variables_number);
+
+   for(size_t i = 0; i < rows_number; i++)
+   {
+      for(size_t j = 0; j < variables_number; j++)
+      {
+         solution(i,j) = points[i*variables_number+j];
+      }
+   }
 
    return(solution);
 }
@@ -1077,6 +1092,256 @@ Vector<double> OrdinaryDifferentialEquations::calculate_Runge_Kutta_Fehlberg_fin
 }
 
 
+// Matrix<double> calculate_Runge_Kutta_Fehlberg_solution(const NeuralNetwork&, const Vector<double>&) const method
+
+/// This method calculates the numerical solution of the ordinary differential equations model at a given set of points,
+/// using the Runge-Kutta-Fehlberg method with dense output. 
+/// The adaptive steps are not stored. 
+/// Instead, the solution at each requested point is obtained by cubic Hermite interpolation within the step which contains it, 
+/// using the dependent variables and their derivatives at both ends of the step. 
+/// The derivatives at the end of an accepted step are reused as the first coefficient of the next step,
+/// so that the dense output does not require additional evaluations of the model. 
+/// The integration stops as soon as the last requested point has been reached. 
+/// An exception is thrown if the number of steps exceeds the error size, or if the error estimate is not a number. 
+/// @param neural_network Neural network which represents the external inputs to the mathematical model. 
+/// @param output_independent_variables Points of the independent variable at which the solution is required. 
+/// They must be sorted in ascending order and lie within the initial and final independent variables. 
+
+Matrix<double> OrdinaryDifferentialEquations::calculate_Runge_Kutta_Fehlberg_solution(const NeuralNetwork& neural_network, const Vector<double>& output_independent_variables) const
+{
+   const size_t outputs_number = output_independent_variables.size();
+
+   // Control sentence (if debug)
+
+   #ifdef __OPENNN_DEBUG__
+
+   for(size_t i = 0; i < outputs_number; i++)
+   {
+      if(output_independent_variables[i] < initial_independent_variable
+      || output_independent_variables[i] > final_independent_variable
+      || (i > 0 && output_independent_variables[i] < output_independent_variables[i-1]))
+      {
+         std::ostringstream buffer;
+
+         buffer << "OpenNN Exception: OrdinaryDifferentialEquations class.\n"
+                << "Matrix<double> calculate_Runge_Kutta_Fehlberg_solution(const NeuralNetwork&, const Vector<double>&) const method.\n"
+                << "Output independent variables must be sorted and lie within the integration interval.\n";
+
+         throw std::logic_error(buffer.str());
+      }
+   }
+
+   #endif
+
+   const double epsilon = 1.0e-12;
+
+   // Butcher tableau
+
+   const double a[6] = {0.0, 1.0/5.0, 3.0/10.0, 3.0/5.0, 1.0, 7.0/8.0};
+
+   const double b[6][5] = {{0.0, 0.0, 0.0, 0.0, 0.0},
+                           {1.0/5.0, 0.0, 0.0, 0.0, 0.0},
+                           {3.0/40.0, 9.0/40.0, 0.0, 0.0, 0.0},
+                           {3.0/10.0, -9.0/10.0, 6.0/5.0, 0.0, 0.0},
+                           {-11.0/54.0, 5.0/2.0, -70.0/27.0, 35.0/27.0, 0.0},
+                           {1631.0/55296.0, 175.0/512.0, 575.0/13824.0, 44275.0/110592.0, 253.0/4096.0}};
+
+   const double c4[6] = {37.0/378.0, 0.0, 250.0/621.0, 125.0/594.0, 0.0, 512.0/1771.0};
+
+   const double c5[6] = {2825.0/27648.0, 0.0, 18575.0/48384.0, 13525.0/55296.0, 277.0/14336.0, 1.0/4.0};
+
+   const size_t variables_number = count_variables_number();
+
+   Matrix<double> solution(outputs_number, variables_number);
+
+   size_t output_index = 0;
+
+   // Initial values
+
+   Vector<double> point(variables_number);
+   Vector<double> next_point(variables_number);
+
+   point[0] = initial_independent_variable;
+
+   for(size_t j = 0; j < dependent_variables_number; j++)
+   {
+      point[1+j] = initial_dependent_variables[j];
+   }
+
+   while(output_index < outputs_number && output_independent_variables[output_index] <= point[0])
+   {
+      solution(output_index,0) = output_independent_variables[output_index];
+
+      for(size_t j = 0; j < dependent_variables_number; j++)
+      {
+         solution(output_index,1+j) = point[1+j];
+      }
+
+      output_index++;
+   }
+
+   Vector<double> dots = calculate_dependent_variables_dots(neural_network, point);
+   Vector<double> next_dots;
+
+   Vector< Vector<double> > c(6);
+
+   Vector<double> variables(variables_number);
+
+   double hmin = 0.0;
+   double h = (final_independent_variable - initial_independent_variable)*1.0e-3;
+
+   double error = 0.0;
+
+   bool last_step = false;
+
+   size_t steps_count = 0;
+
+   // Main loop
+
+   while(output_index < outputs_number)
+   {
+      steps_count++;
+
+      if(steps_count > error_size)
+      {
+         std::ostringstream buffer;
+
+         buffer << "OpenNN Exception: OrdinaryDifferentialEquations class.\n"
+                << "Matrix<double> calculate_Runge_Kutta_Fehlberg_solution(const NeuralNetwork&, const Vector<double>&) const method.\n"
+                << "Number of steps is bigger than greatest allowable.\n";
+
+         throw std::logic_error(buffer.str());
+      }
+
+      // Set smallest allowable stepsize
+
+      hmin = 32.0*epsilon*fabs(point[0]);
+
+      if(h < hmin)
+      {
+         if(display)
+         {
+            std::cout << "OpenNN Warning: OrdinaryDifferentialEquations class.\n"
+                      << "calculate_Runge_Kutta_Fehlberg_solution() method.\n"
+                      << "Step size is less than smallest allowable." << std::endl;
+         }
+
+         h = hmin;
+      }
+
+      last_step = (point[0] + h >= final_independent_variable);
+
+      if(last_step)
+      {
+         h = final_independent_variable - point[0];
+      }
+
+      // Coefficients
+
+      c[0] = dots*h;
+
+      for(size_t stage = 1; stage < 6; stage++)
+      {
+         variables[0] = point[0] + a[stage]*h;
+
+         for(size_t j = 0; j < dependent_variables_number; j++)
+         {
+            variables[1+j] = point[1+j];
+
+            for(size_t l = 0; l < stage; l++)
+            {
+               variables[1+j] += b[stage][l]*c[l][j];
+            }
+         }
+
+         c[stage] = calculate_dependent_variables_dots(neural_network, variables)*h;
+      }
+
+      // Error estimate
+
+      error = 0.0;
+
+      for(size_t j = 0; j < dependent_variables_number; j++)
+      {
+         double difference = 0.0;
+
+         for(size_t stage = 0; stage < 6; stage++)
+         {
+            difference += (c4[stage] - c5[stage])*c[stage][j];
+         }
+
+         if(std::isnan(difference) || fabs(difference) > error)
+         {
+            error = fabs(difference);
+         }
+      }
+
+      if(std::isnan(error))
+      {
+         std::ostringstream buffer;
+
+         buffer << "OpenNN Exception: OrdinaryDifferentialEquations class.\n"
+                << "Matrix<double> calculate_Runge_Kutta_Fehlberg_solution(const NeuralNetwork&, const Vector<double>&) const method.\n"
+                << "Error estimate is not a number.\n";
+
+         throw std::logic_error(buffer.str());
+      }
+
+      if(error <= tolerance)
+      {
+         next_point[0] = last_step ? final_independent_variable : point[0] + h;
+
+         for(size_t j = 0; j < dependent_variables_number; j++)
+         {
+            next_point[1+j] = point[1+j];
+
+            for(size_t stage = 0; stage < 6; stage++)
+            {
+               next_point[1+j] += c5[stage]*c[stage][j];
+            }
+         }
+
+         next_dots = calculate_dependent_variables_dots(neural_network, next_point);
+
+         // Dense output
+
+         while(output_index < outputs_number && (last_step || output_independent_variables[output_index] <= next_point[0]))
+         {
+            const double t = (output_independent_variables[output_index] - point[0])/h;
+
+            const double h00 = (1.0 + 2.0*t)*(1.0 - t)*(1.0 - t);
+            const double h10 = t*(1.0 - t)*(1.0 - t);
+            const double h01 = t*t*(3.0 - 2.0*t);
+            const double h11 = t*t*(t - 1.0);
+
+            solution(output_index,0) = output_independent_variables[output_index];
+
+            for(size_t j = 0; j < dependent_variables_number; j++)
+            {
+               solution(output_index,1+j) = h00*point[1+j] + h10*h*dots[j] + h01*next_point[1+j] + h11*h*next_dots[j];
+            }
+
+            output_index++;
+         }
+
+         point = next_point;
+         dots = next_dots;
+
+         if(error != 0.0)
+         {
+            h *= 0.9*pow(fabs(tolerance/error), 0.2);
+         }
+      }
+      else
+      {
+         h *= 0.9*pow(fabs(tolerance/error), 0.25);
+      }
+   }
+
+   return(solution);
+}
+
+
 // Matrix<double> calculate_solutions(const NeuralNetwork&) const method
 
 Matrix<double> OrdinaryDifferentialEquations::calculate_solutions(const NeuralNetwork& neural_network) const
@@ -1143,6 +1408,553 @@ Vector<double> OrdinaryDifferentialEquations::calculate_final_solutions(const Ne
 }
 
 
+// Matrix<double> calculate_dense_solutions(const NeuralNetwork&, const Vector<double>&) const method
+
+/// Returns the solutions to the ordinary differential equations at a given set of points of the independent variable. 
+/// They are computed with the dense output of the Runge-Kutta-Fehlberg method, whatever the solution method is, 
+/// so that only the requested points are materialized. 
+/// @param neural_network Neural network which represents the external inputs to the mathematical model. 
+/// @param output_independent_variables Sorted points of the independent variable at which the solutions are required. 
+
+Matrix<double> OrdinaryDifferentialEquations::calculate_dense_solutions(const NeuralNetwork& neural_network, const Vector<double>& output_independent_variables) const
+{
+   return(calculate_Runge_Kutta_Fehlberg_solution(neural_network, output_independent_variables));
+}
+
+
+// Matrix<double> calculate_ensemble_dependent_variables_dots(const NeuralNetwork&, const Matrix<double>&) const method
+
+/// This method calculates the derivatives of the dependent variables for a whole ensemble of trajectories. 
+/// Each row of the variables matrix contains the independent variable and the dependent variables of one trajectory,
+/// and each row of the returned matrix contains the corresponding dependent variables dots.
+/// The default implementation evaluates the trajectories in parallel with calculate_dependent_variables_dots. 
+/// Derived classes can override it with a vectorized evaluation over the columns of the matrix. 
+/// @param neural_network Neural network which represents the external inputs to the mathematical model. 
+/// @param variables Matrix of variables, with one row per trajectory.
+
+Matrix<double> OrdinaryDifferentialEquations::calculate_ensemble_dependent_variables_dots(const NeuralNetwork& neural_network, const Matrix<double>& variables) const
+{
+   const size_t trajectories_number = variables.get_rows_number();
+   const size_t variables_number = variables.get_columns_number();
+
+   Matrix<double> dependent_variables_dots(trajectories_number, dependent_variables_number);
+
+   int i = 0;
+
+   #pragma omp parallel for private(i)
+
+   for(i = 0; i < (int)trajectories_number; i++)
+   {
+      Vector<double> trajectory_variables(variables_number);
+
+      for(size_t j = 0; j < variables_number; j++)
+      {
+         trajectory_variables[j] = variables(i,j);
+      }
+
+      const Vector<double> trajectory_dots = calculate_dependent_variables_dots(neural_network, trajectory_variables);
+
+      for(size_t j = 0; j < dependent_variables_number; j++)
+      {
+         dependent_variables_dots(i,j) = trajectory_dots[j];
+      }
+   }
+
+   return(dependent_variables_dots);
+}
+
+
+// Vector< Matrix<double> > calculate_Runge_Kutta_solutions(const NeuralNetwork&, const Matrix<double>&) const method
+
+/// This method calculates the numerical solutions of the ordinary differential equations model for an ensemble of initial conditions
+/// using the Runge-Kutta method. 
+/// All the trajectories are advanced in lockstep, so that each stage evaluates the dependent variables dots of the whole ensemble at once.
+/// It returns a vector with one solution matrix per trajectory, with the same format as calculate_Runge_Kutta_solution.
+/// @param neural_network Neural network which represents the external inputs to the mathematical model. 
+/// @param initial_dependent_variables_ensemble Matrix of initial dependent variables, with one row per trajectory.
+
+Vector< Matrix<double> > OrdinaryDifferentialEquations::calculate_Runge_Kutta_solutions(const NeuralNetwork& neural_network, const Matrix<double>& initial_dependent_variables_ensemble) const
+{
+   // Control sentence (if debug)
+
+   #ifdef __OPENNN_DEBUG__
+
+   if(initial_dependent_variables_ensemble.get_columns_number() != dependent_variables_number)
+   {
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: OrdinaryDifferentialEquations class.\n"
+             << "Vector< Matrix<double> > calculate_Runge_Kutta_solutions(const NeuralNetwork&, const Matrix<double>&) const method.\n"
+             << "Number of columns must be equal to number of dependent variables.\n";
+
+      throw std::logic_error(buffer.str());
+   }
+
+   #endif
+
+   const size_t trajectories_number = initial_dependent_variables_ensemble.get_rows_number();
+
+   const size_t variables_number = count_variables_number();
+
+   Vector< Matrix<double> > solutions(trajectories_number);
+
+   for(size_t k = 0; k < trajectories_number; k++)
+   {
+      solutions[k].set(points_number, variables_number);
+   }
+
+   Matrix<double> ensemble_solution(trajectories_number, variables_number);
+
+   for(size_t k = 0; k < trajectories_number; k++)
+   {
+      ensemble_solution(k,0) = initial_independent_variable;
+
+      for(size_t j = 0; j < dependent_variables_number; j++)
+      {
+         ensemble_solution(k,1+j) = initial_dependent_variables_ensemble(k,j);
+      }
+
+      for(size_t j = 0; j < variables_number; j++)
+      {
+         solutions[k](0,j) = ensemble_solution(k,j);
+      }
+   }
+
+   for(size_t i = 1; i < points_number; i++)
+   {
+      advance_Runge_Kutta(neural_network, ensemble_solution);
+
+      for(size_t k = 0; k < trajectories_number; k++)
+      {
+         for(size_t j = 0; j < variables_number; j++)
+         {
+            solutions[k](i,j) = ensemble_solution(k,j);
+         }
+      }
+   }
+
+   for(size_t k = 0; k < trajectories_number; k++)
+   {
+      solutions[k](points_number-1,0) = final_independent_variable;
+   }
+
+   return(solutions);
+}
+
+
+// Matrix<double> calculate_Runge_Kutta_final_solutions(const NeuralNetwork&, const Matrix<double>&) const method
+
+/// This method calculates the solutions at the final independent variable of the ordinary differential equations model 
+/// for an ensemble of initial conditions using the Runge-Kutta method. 
+/// Each row of the returned matrix contains the independent variable and the dependent variables of one trajectory. 
+/// @param neural_network Neural network which represents the external inputs to the mathematical model. 
+/// @param initial_dependent_variables_ensemble Matrix of initial dependent variables, with one row per trajectory.
+
+Matrix<double> OrdinaryDifferentialEquations::calculate_Runge_Kutta_final_solutions(const NeuralNetwork& neural_network, const Matrix<double>& initial_dependent_variables_ensemble) const
+{
+   // Control sentence (if debug)
+
+   #ifdef __OPENNN_DEBUG__
+
+   if(initial_dependent_variables_ensemble.get_columns_number() != dependent_variables_number)
+   {
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: OrdinaryDifferentialEquations class.\n"
+             << "Matrix<double> calculate_Runge_Kutta_final_solutions(const NeuralNetwork&, const Matrix<double>&) const method.\n"
+             << "Number of columns must be equal to number of dependent variables.\n";
+
+      throw std::logic_error(buffer.str());
+   }
+
+   #endif
+
+   const size_t trajectories_number = initial_dependent_variables_ensemble.get_rows_number();
+
+   const size_t variables_number = count_variables_number();
+
+   Matrix<double> final_solutions(trajectories_number, variables_number);
+
+   for(size_t k = 0; k < trajectories_number; k++)
+   {
+      final_solutions(k,0) = initial_independent_variable;
+
+      for(size_t j = 0; j < dependent_variables_number; j++)
+      {
+         final_solutions(k,1+j) = initial_dependent_variables_ensemble(k,j);
+      }
+   }
+
+   for(size_t i = 1; i < points_number; i++)
+   {
+      advance_Runge_Kutta(neural_network, final_solutions);
+   }
+
+   for(size_t k = 0; k < trajectories_number; k++)
+   {
+      final_solutions(k,0) = final_independent_variable;
+   }
+
+   return(final_solutions);
+}
+
+
+// Matrix<double> calculate_Runge_Kutta_Fehlberg_final_solutions(const NeuralNetwork&, const Matrix<double>&) const method
+
+/// This method calculates the solutions at the final independent variable of the ordinary differential equations model 
+/// for an ensemble of initial conditions using the Runge-Kutta-Fehlberg method. 
+/// Each trajectory keeps its own adaptive step size. 
+/// The trajectories which have not reached the final independent variable are gathered at every step, 
+/// and their stages are evaluated at once with calculate_ensemble_dependent_variables_dots.
+/// An exception is thrown if a trajectory takes more steps than the error size, or if its error estimate is not a number.
+/// Each row of the returned matrix contains the independent variable and the dependent variables of one trajectory. 
+/// @param neural_network Neural network which represents the external inputs to the mathematical model. 
+/// @param initial_dependent_variables_ensemble Matrix of initial dependent variables, with one row per trajectory.
+
+Matrix<double> OrdinaryDifferentialEquations::calculate_Runge_Kutta_Fehlberg_final_solutions(const NeuralNetwork& neural_network, const Matrix<double>& initial_dependent_variables_ensemble) const
+{
+   // Control sentence (if debug)
+
+   #ifdef __OPENNN_DEBUG__
+
+   if(initial_dependent_variables_ensemble.get_columns_number() != dependent_variables_number)
+   {
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: OrdinaryDifferentialEquations class.\n"
+             << "Matrix<double> calculate_Runge_Kutta_Fehlberg_final_solutions(const NeuralNetwork&, const Matrix<double>&) const method.\n"
+             << "Number of columns must be equal to number of dependent variables.\n";
+
+      throw std::logic_error(buffer.str());
+   }
+
+   #endif
+
+   const double epsilon = 1.0e-12;
+
+   // Butcher tableau
+
+   const double a[6] = {0.0, 1.0/5.0, 3.0/10.0, 3.0/5.0, 1.0, 7.0/8.0};
+
+   const double b[6][5] = {{0.0, 0.0, 0.0, 0.0, 0.0},
+                           {1.0/5.0, 0.0, 0.0, 0.0, 0.0},
+                           {3.0/40.0, 9.0/40.0, 0.0, 0.0, 0.0},
+                           {3.0/10.0, -9.0/10.0, 6.0/5.0, 0.0, 0.0},
+                           {-11.0/54.0, 5.0/2.0, -70.0/27.0, 35.0/27.0, 0.0},
+                           {1631.0/55296.0, 175.0/512.0, 575.0/13824.0, 44275.0/110592.0, 253.0/4096.0}};
+
+   const double c4[6] = {37.0/378.0, 0.0, 250.0/621.0, 125.0/594.0, 0.0, 512.0/1771.0};
+
+   const double c5[6] = {2825.0/27648.0, 0.0, 18575.0/48384.0, 13525.0/55296.0, 277.0/14336.0, 1.0/4.0};
+
+   const size_t trajectories_number = initial_dependent_variables_ensemble.get_rows_number();
+
+   const size_t variables_number = count_variables_number();
+
+   // Ensemble state
+
+   Matrix<double> final_solutions(trajectories_number, variables_number);
+
+   for(size_t k = 0; k < trajectories_number; k++)
+   {
+      final_solutions(k,0) = initial_independent_variable;
+
+      for(size_t j = 0; j < dependent_variables_number; j++)
+      {
+         final_solutions(k,1+j) = initial_dependent_variables_ensemble(k,j);
+      }
+   }
+
+   Vector<double> steps(trajectories_number, (final_independent_variable - initial_independent_variable)*1.0e-3);
+
+   // Accepted and rejected steps of each trajectory, bounded by the error size.
+
+   Vector<size_t> steps_count(trajectories_number, 0);
+
+   Vector<size_t> active_indices;
+   active_indices.reserve(trajectories_number);
+
+   for(size_t k = 0; k < trajectories_number; k++)
+   {
+      if(final_solutions(k,0) < final_independent_variable)
+      {
+         active_indices.push_back(k);
+      }
+   }
+
+   Vector< Matrix<double> > c(6);
+
+   Matrix<double> variables;
+
+   double hmin = 0.0;
+   double error = 0.0;
+
+   // Main loop
+
+   while(!active_indices.empty())
+   {
+      const size_t active_number = active_indices.size();
+
+      // Step sizes
+
+      for(size_t i = 0; i < active_number; i++)
+      {
+         const size_t k = active_indices[i];
+
+         steps_count[k]++;
+
+         if(steps_count[k] > error_size)
+         {
+            std::ostringstream buffer;
+
+            buffer << "OpenNN Exception: OrdinaryDifferentialEquations class.\n"
+                   << "calculate_Runge_Kutta_Fehlberg_final_solutions() method.\n"
+                   << "Number of steps of trajectory " << k << " is bigger than greatest allowable.\n";
+
+            throw std::logic_error(buffer.str());
+         }
+
+         hmin = 32.0*epsilon*fabs(final_solutions(k,0));
+
+         if(steps[k] < hmin)
+         {
+            if(display)
+            {
+               std::cout << "OpenNN Warning: OrdinaryDifferentialEquations class.\n"
+                         << "calculate_Runge_Kutta_Fehlberg_final_solutions() method.\n"
+                         << "Step size is less than smallest allowable." << std::endl;
+            }
+
+            steps[k] = hmin;
+         }
+
+         if(final_solutions(k,0) + steps[k] > final_independent_variable)
+         {
+            steps[k] = final_independent_variable - final_solutions(k,0);
+         }
+      }
+
+      // Coefficients
+
+      variables.set(active_number, variables_number);
+
+      for(size_t stage = 0; stage < 6; stage++)
+      {
+         for(size_t i = 0; i < active_number; i++)
+         {
+            const size_t k = active_indices[i];
+
+            variables(i,0) = final_solutions(k,0) + a[stage]*steps[k];
+
+            for(size_t j = 0; j < dependent_variables_number; j++)
+            {
+               double variable = final_solutions(k,1+j);
+
+               for(size_t l = 0; l < stage; l++)
+               {
+                  variable += b[stage][l]*c[l](i,j);
+               }
+
+               variables(i,1+j) = variable;
+            }
+         }
+
+         c[stage] = calculate_ensemble_dependent_variables_dots(neural_network, variables);
+
+         for(size_t i = 0; i < active_number; i++)
+         {
+            const double h = steps[active_indices[i]];
+
+            for(size_t j = 0; j < dependent_variables_number; j++)
+            {
+               c[stage](i,j) *= h;
+            }
+         }
+      }
+
+      // Error estimate and update
+
+      size_t remaining_number = 0;
+
+      for(size_t i = 0; i < active_number; i++)
+      {
+         const size_t k = active_indices[i];
+
+         error = 0.0;
+
+         for(size_t j = 0; j < dependent_variables_number; j++)
+         {
+            double difference = 0.0;
+
+            for(size_t stage = 0; stage < 6; stage++)
+            {
+               difference += (c4[stage] - c5[stage])*c[stage](i,j);
+            }
+
+            if(std::isnan(difference) || fabs(difference) > error)
+            {
+               error = fabs(difference);
+            }
+         }
+
+         if(std::isnan(error))
+         {
+            std::ostringstream buffer;
+
+            buffer << "OpenNN Exception: OrdinaryDifferentialEquations class.\n"
+                   << "calculate_Runge_Kutta_Fehlberg_final_solutions() method.\n"
+                   << "Error estimate of trajectory " << k << " is not a number.\n";
+
+            throw std::logic_error(buffer.str());
+         }
+
+         if(error <= tolerance)
+         {
+            final_solutions(k,0) += steps[k];
+
+            for(size_t j = 0; j < dependent_variables_number; j++)
+            {
+               for(size_t stage = 0; stage < 6; stage++)
+               {
+                  final_solutions(k,1+j) += c5[stage]*c[stage](i,j);
+               }
+            }
+
+            if(error != 0.0)
+            {
+               steps[k] *= 0.9*pow(fabs(tolerance/error), 0.2);
+            }
+         }
+         else
+         {
+            steps[k] *= 0.9*pow(fabs(tolerance/error), 0.25);
+         }
+
+         if(final_solutions(k,0) < final_independent_variable)
+         {
+            active_indices[remaining_number] = k;
+            remaining_number++;
+         }
+      }
+
+      active_indices.resize(remaining_number);
+   }
+
+   return(final_solutions);
+}
+
+
+// Matrix<double> calculate_ensemble_final_solutions(const NeuralNetwork&, const Matrix<double>&) const method
+
+/// Returns the solutions at the final independent variable for an ensemble of initial conditions, 
+/// using the current solution method. 
+/// @param neural_network Neural network which represents the external inputs to the mathematical model. 
+/// @param initial_dependent_variables_ensemble Matrix of initial dependent variables, with one row per trajectory.
+
+Matrix<double> OrdinaryDifferentialEquations::calculate_ensemble_final_solutions(const NeuralNetwork& neural_network, const Matrix<double>& initial_dependent_variables_ensemble) const
+{
+   switch(solution_method)
+   {
+      case RungeKutta:
+      {
+         return(calculate_Runge_Kutta_final_solutions(neural_network, initial_dependent_variables_ensemble));
+      }
+      break;
+
+      case RungeKuttaFehlberg:
+      {
+         return(calculate_Runge_Kutta_Fehlberg_final_solutions(neural_network, initial_dependent_variables_ensemble));
+      }
+      break;
+
+      default:
+      {
+         std::ostringstream buffer;
+
+         buffer << "OpenNN Exception: OrdinaryDifferentialEquations class\n"
+                << "Matrix<double> calculate_ensemble_final_solutions(const NeuralNetwork&, const Matrix<double>&) const method.\n"
+                << "Unknown solution method.\n";
+
+         throw std::logic_error(buffer.str());
+      }
+      break;
+   }
+}
+
+
+// void advance_Runge_Kutta(const NeuralNetwork&, Matrix<double>&) const method
+
+/// Advances every trajectory of an ensemble one fixed step of the fourth order Runge-Kutta method. 
+/// @param neural_network Neural network which represents the external inputs to the mathematical model. 
+/// @param ensemble_solution Matrix with the independent and dependent variables of each trajectory. 
+/// On output it contains the variables at the next point. 
+
+void OrdinaryDifferentialEquations::advance_Runge_Kutta(const NeuralNetwork& neural_network, Matrix<double>& ensemble_solution) const
+{
+   const size_t trajectories_number = ensemble_solution.get_rows_number();
+
+   const double h = (final_independent_variable - initial_independent_variable)/(points_number-1.0);
+
+   Matrix<double> variables(ensemble_solution);
+
+   // First coefficient
+
+   const Matrix<double> c1 = calculate_ensemble_dependent_variables_dots(neural_network, variables);
+
+   // Second coefficient
+
+   for(size_t k = 0; k < trajectories_number; k++)
+   {
+      variables(k,0) = ensemble_solution(k,0) + h/2.0;
+
+      for(size_t j = 0; j < dependent_variables_number; j++)
+      {
+         variables(k,1+j) = ensemble_solution(k,1+j) + h*c1(k,j)/2.0;
+      }
+   }
+
+   const Matrix<double> c2 = calculate_ensemble_dependent_variables_dots(neural_network, variables);
+
+   // Third coefficient
+
+   for(size_t k = 0; k < trajectories_number; k++)
+   {
+      for(size_t j = 0; j < dependent_variables_number; j++)
+      {
+         variables(k,1+j) = ensemble_solution(k,1+j) + h*c2(k,j)/2.0;
+      }
+   }
+
+   const Matrix<double> c3 = calculate_ensemble_dependent_variables_dots(neural_network, variables);
+
+   // Fourth coefficient
+
+   for(size_t k = 0; k < trajectories_number; k++)
+   {
+      variables(k,0) = ensemble_solution(k,0) + h;
+
+      for(size_t j = 0; j < dependent_variables_number; j++)
+      {
+         variables(k,1+j) = ensemble_solution(k,1+j) + h*c3(k,j);
+      }
+   }
+
+   const Matrix<double> c4 = calculate_ensemble_dependent_variables_dots(neural_network, variables);
+
+   // Dependent variables
+
+   for(size_t k = 0; k < trajectories_number; k++)
+   {
+      for(size_t j = 0; j < dependent_variables_number; j++)
+      {
+         ensemble_solution(k,1+j) += h*(c1(k,j) + 2.0*c2(k,j) + 2.0*c3(k,j) + c4(k,j))/6.0;
+      }
+
+      ensemble_solution(k,0) += h;
+   }
+}
+
+
 // std::string to_string(void) const method
 
 /// Returns a string representation of the current ordinary differential equations object. 
@@ -140,11 +140,25 @@ public:
    Vector<double> calculate_Runge_Kutta_final_solution(const NeuralNetwork&) const;
 
    Matrix<double> calculate_Runge_Kutta_Fehlberg_solution(const NeuralNetwork&) const;
+   Matrix<double> calculate_Runge_Kutta_Fehlberg_solution(const NeuralNetwork&, const Vector<double>&) const;
    Vector<double> calculate_Runge_Kutta_Fehlberg_final_solution(const NeuralNetwork&) const;
 
    virtual Matrix<double> calculate_solutions(const NeuralNetwork&) const;
    virtual Vector<double> calculate_final_solutions(const NeuralNetwork&) const;
 
+   virtual Matrix<double> calculate_dense_solutions(const NeuralNetwork&, const Vector<double>&) const;
+
+   // Ensemble solution methods
+
+   virtual Matrix<double> calculate_ensemble_dependent_variables_dots(const NeuralNetwork&, const Matrix<double>&) const;
+
+   Vector< Matrix<double> > calculate_Runge_Kutta_solutions(const NeuralNetwork&, const Matrix<double>&) const;
+   Matrix<double> calculate_Runge_Kutta_final_solutions(const NeuralNetwork&, const Matrix<double>&) const;
+
+   Matrix<double> calculate_Runge_Kutta_Fehlberg_final_solutions(const NeuralNetwork&, const Matrix<double>&) const;
+
+   Matrix<double> calculate_ensemble_final_solutions(const NeuralNetwork&, const Matrix<double>&) const;
+
    // Serialization methods
 
    std::string to_string(void) const;
@@ -156,6 +170,8 @@ public:
 
 protected: 
 
+   void advance_Runge_Kutta(const NeuralNetwork&, Matrix<double>&) const;
+
    /// Initial value for the only independent variable. 
 
    double initial_independent_variable;
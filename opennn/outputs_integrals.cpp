@@ -111,6 +111,26 @@ const double& OutputsIntegrals::get_output_integral_weight(const size_t& i) cons
 }
 
 
+// const double& get_lower_integration_limit(void) const method
+
+/// Returns the lower limit of the integrals of the outputs.
+
+const double& OutputsIntegrals::get_lower_integration_limit(void) const
+{
+   return(lower_integration_limit);
+}
+
+
+// const double& get_upper_integration_limit(void) const method
+
+/// Returns the upper limit of the integrals of the outputs.
+
+const double& OutputsIntegrals::get_upper_integration_limit(void) const
+{
+   return(upper_integration_limit);
+}
+
+
 // void set_numerical_integration(const NumericalIntegration&) method
 
 /// Sets a new numerical integration object inside the outputs integral object. 
@@ -145,11 +165,25 @@ void OutputsIntegrals::set_output_integral_weight(const size_t& i, const double&
 }
 
 
+// void set_integration_limits(const double&, const double&) method
+
+/// Sets the limits of the integrals of the neural network outputs. 
+/// @param new_lower_integration_limit Lower integration limit. 
+/// @param new_upper_integration_limit Upper integration limit. 
+
+void OutputsIntegrals::set_integration_limits(const double& new_lower_integration_limit, const double& new_upper_integration_limit)
+{
+   lower_integration_limit = new_lower_integration_limit;
+   upper_integration_limit = new_upper_integration_limit;
+}
+
+
 // void set_default(void) method
 
 /// Sets the default values for the outputs integrals object: 
 /// <ul>
 /// <li> Outputs integrals weights: 1 for each neural network output. 
+/// <li> Integration limits: 0 and 1. 
 /// <li> Display: true.
 /// </ul>
 
@@ -163,11 +197,14 @@ void OutputsIntegrals::set_default(void)
 	  {
          const MultilayerPerceptron* multilayer_perceptron_pointer = neural_network_pointer->get_multilayer_perceptron_pointer();
 
-         outputs_number = multilayer_perceptron_pointer->get_inputs_number();
+         outputs_number = multilayer_perceptron_pointer->get_outputs_number();
 	  }
    }
 
    outputs_integrals_weights.set(outputs_number, 1.0);
+
+   lower_integration_limit = 0.0;
+   upper_integration_limit = 1.0;
   
    display = true;
 }
@@ -233,20 +270,10 @@ void OutputsIntegrals::check(void) const
 
 // double calculate_performance(void) const method
 
-/// Returns the objective value of a multilayer perceptron according to the sum squared error on a data set.
-/// @todo
+/// Returns the weighted sum of the integrals of the neural network outputs between the integration limits.
 
 double OutputsIntegrals::calculate_performance(void) const
 {
-   std::ostringstream buffer;
-
-   buffer << "OpenNN Exception: OutputsIntegrals class.\n"
-          << "double calculate_performance(void) const method.\n"
-          << "This method is under development.\n";
-
-   throw std::logic_error(buffer.str());	  
-
-/*
    // Control sentence
 
    #ifdef __OPENNN_DEBUG__ 
@@ -255,23 +282,39 @@ double OutputsIntegrals::calculate_performance(void) const
 
    #endif
 
-   // Neural network stuff 
+   return(calculate_performance(*neural_network_pointer));
+}
 
-   const MultilayerPerceptron* multilayer_perceptron_pointer = neural_network_pointer->get_multilayer_perceptron_pointer();
 
-   const size_t outputs_number = multilayer_perceptron_pointer->get_outputs_number();
+// double calculate_performance(const NeuralNetwork&) const method
 
-   // Outputs integrals
+/// Returns the weighted sum of the integrals of the outputs of a given neural network.
+/// The integrals are computed with adaptive Gauss-Kronrod quadrature, 
+/// which evaluates the neural network on all the abscissae of each refinement pass at once. 
+/// The neural network must have a single input, which is the integration variable. 
+/// @param neural_network Neural network to be evaluated.
+
+double OutputsIntegrals::calculate_performance(const NeuralNetwork& neural_network) const
+{
+   // Control sentence
 
-   double performance = 0;
+   const size_t inputs_number = neural_network.get_inputs_number();
 
-   for(size_t i = 0; i < outputs_number; i++)
+   if(inputs_number != 1)
    {
-      performance += 0.0;
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: OutputsIntegrals class.\n"
+             << "double calculate_performance(const NeuralNetwork&) const method.\n"
+             << "Number of inputs (" << inputs_number << ") is not one.\n";
+
+      throw std::logic_error(buffer.str());
    }
 
-   return(performance);
-*/
+   const Vector<double> outputs_integrals 
+   = numerical_integration.calculate_Gauss_Kronrod_integral(neural_network, &NeuralNetwork::calculate_output_data, lower_integration_limit, upper_integration_limit);
+
+   return(outputs_integrals.dot(outputs_integrals_weights));
 }
 
 
@@ -279,28 +322,16 @@ double OutputsIntegrals::calculate_performance(void) const
 
 /// Returns which would be the performance of a neural network for an hypothetical vector of parameters. 
 /// It does not set that vector of parameters to the neural network. 
-// @param parameters Vector of potential parameters for the neural network associated to the performance functional.
+/// @param parameters Vector of potential parameters for the neural network associated to the performance functional.
 
-double OutputsIntegrals::calculate_performance(const Vector<double>&) const
+double OutputsIntegrals::calculate_performance(const Vector<double>& parameters) const
 {
-   std::ostringstream buffer;
-
-   buffer << "OpenNN Exception: OutputsIntegrals class.\n"
-          << "double calculate_performance(const Vector<double>&) const method.\n"
-          << "This method is under development.\n";
-
-   throw std::logic_error(buffer.str());	  
-/*  
- // Control sentence (if debug)
+   // Control sentence (if debug)
 
    #ifdef __OPENNN_DEBUG__ 
 
    check();
 
-   #endif
-
-   #ifdef __OPENNN_DEBUG__ 
-
    const size_t size = parameters.size();
 
    const size_t parameters_number = neural_network_pointer->count_parameters_number();
@@ -318,16 +349,9 @@ double OutputsIntegrals::calculate_performance(const Vector<double>&) const
 
    #endif
 
-   NeuralNetwork neural_network_copy(*neural_network_pointer);
-
-   neural_network_copy.set_parameters(parameters);
+   const NeuralNetwork neural_network(*neural_network_pointer, parameters);
 
-   OutputsIntegrals sum_squared_error_copy(*this);
-
-   sum_squared_error_copy.set_neural_network_pointer(&neural_network_copy);
-
-   return(sum_squared_error_copy.calculate_performance());
-*/
+   return(calculate_performance(neural_network));
 }
 
 
@@ -409,6 +433,20 @@ tinyxml2::XMLDocument* OutputsIntegrals::to_XML(void) const
       outputs_integrals_element->LinkEndChild(element);
    }
 
+   // Numerical integration
+   {
+      tinyxml2::XMLElement* element = document->NewElement("NumericalIntegration");
+      outputs_integrals_element->LinkEndChild(element);
+
+      const tinyxml2::XMLDocument* numerical_integration_document = numerical_integration.to_XML();
+
+      const tinyxml2::XMLElement* numerical_integration_element = numerical_integration_document->FirstChildElement("NumericalIntegration");
+
+      DeepClone(element, numerical_integration_element, document, NULL);
+
+      delete numerical_integration_document;
+   }
+
    // Outputs integrals weights
    {
       tinyxml2::XMLElement* element = document->NewElement("OutputsIntegralsWeights");
@@ -421,6 +459,30 @@ tinyxml2::XMLDocument* OutputsIntegrals::to_XML(void) const
       element->LinkEndChild(text);
    }
 
+   // Lower integration limit
+   {
+      tinyxml2::XMLElement* element = document->NewElement("LowerIntegrationLimit");
+      outputs_integrals_element->LinkEndChild(element);
+
+      buffer.str("");
+      buffer << lower_integration_limit;
+
+      tinyxml2::XMLText* text = document->NewText(buffer.str().c_str());
+      element->LinkEndChild(text);
+   }
+
+   // Upper integration limit
+   {
+      tinyxml2::XMLElement* element = document->NewElement("UpperIntegrationLimit");
+      outputs_integrals_element->LinkEndChild(element);
+
+      buffer.str("");
+      buffer << upper_integration_limit;
+
+      tinyxml2::XMLText* text = document->NewText(buffer.str().c_str());
+      element->LinkEndChild(text);
+   }
+
    // Display
    {
       tinyxml2::XMLElement* element = document->NewElement("Display");
@@ -457,6 +519,48 @@ void OutputsIntegrals::from_XML(const tinyxml2::XMLDocument& document)
         throw std::logic_error(buffer.str());
     }
 
+  // Numerical integration
+  {
+     const tinyxml2::XMLElement* numerical_integration_element = root_element->FirstChildElement("NumericalIntegration");
+
+     if(numerical_integration_element)
+     {
+        tinyxml2::XMLDocument numerical_integration_document;
+
+        tinyxml2::XMLElement* element_clone = numerical_integration_document.NewElement("NumericalIntegration");
+        numerical_integration_document.InsertFirstChild(element_clone);
+
+        DeepClone(element_clone, numerical_integration_element, &numerical_integration_document, NULL);
+
+        numerical_integration.from_XML(numerical_integration_document);
+     }
+  }
+
+  // Outputs integrals weights
+  {
+     const tinyxml2::XMLElement* element = root_element->FirstChildElement("OutputsIntegralsWeights");
+
+     if(element)
+     {
+        Vector<double> new_outputs_integrals_weights;
+
+        new_outputs_integrals_weights.parse(element->GetText());
+
+        set_outputs_integrals_weights(new_outputs_integrals_weights);
+     }
+  }
+
+  // Integration limits
+  {
+     const tinyxml2::XMLElement* lower_element = root_element->FirstChildElement("LowerIntegrationLimit");
+     const tinyxml2::XMLElement* upper_element = root_element->FirstChildElement("UpperIntegrationLimit");
+
+     if(lower_element && upper_element)
+     {
+        set_integration_limits(atof(lower_element->GetText()), atof(upper_element->GetText()));
+     }
+  }
+
   // Display
   {
      const tinyxml2::XMLElement* display_element = root_element->FirstChildElement("Display");
@@ -37,7 +37,8 @@ namespace OpenNN
 
 /// This class represents the outputs integrals performance term. 
 /// It is defined as the weighted sum of the integrals of the neural network outputs.
-/// The neural network here must have only one input. 
+/// The neural network here must have only one input, which is the integration variable. 
+/// Networks with several inputs are not supported, and the performance methods throw an exception for them. 
 /// This performance term might be used in optimal control as an objective or a regularization terms. 
 
 class OutputsIntegrals : public PerformanceTerm
@@ -71,6 +72,9 @@ public:
    const Vector<double>& get_outputs_integrals_weights(void) const;
    const double& get_output_integral_weight(const size_t&) const;
 
+   const double& get_lower_integration_limit(void) const;
+   const double& get_upper_integration_limit(void) const;
+
    // Set methods
 
    void set_numerical_integration(const NumericalIntegration&);
@@ -78,6 +82,8 @@ public:
    void set_outputs_integrals_weights(const Vector<double>&);
    void set_output_integral_weight(const size_t&, const double&);
 
+   void set_integration_limits(const double&, const double&);
+
    void set_default(void);
 
    // Checking methods
@@ -87,6 +93,7 @@ public:
    // Regularization methods
 
    double calculate_performance(void) const;   
+   double calculate_performance(const NeuralNetwork&) const;
    double calculate_performance(const Vector<double>&) const;
 
    Vector<double> calculate_gradient(void) const;
@@ -111,6 +118,14 @@ private:
 
    Vector<double> outputs_integrals_weights;
 
+   /// Lower limit of the integrals of the outputs.
+
+   double lower_integration_limit;
+
+   /// Upper limit of the integrals of the outputs.
+
+   double upper_integration_limit;
+
 };
 
 }
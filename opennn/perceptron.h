@@ -20,6 +20,9 @@
 #include <sstream>
 #include <cstdlib>
 #include <ctime>
+#include <cmath>
+#include <cstring>
+#include <stdint.h>
 
 // OpenNN includes
 
@@ -179,6 +182,45 @@ private:
 
 };
 
+
+// double calculate_fast_exponential(const double&) function
+
+/// Returns an approximation of the exponential function, with a relative error below 2e-7.
+/// The argument is reduced to x = k*log(2) + r, with |r| <= log(2)/2, 
+/// exp(r) is evaluated with a sixth order polynomial and 2^k is built directly into the exponent bits.
+/// The function has no branches other than the clamping to the double range, so that loops calling it can be vectorized.
+/// @param x Argument of the exponential. 
+
+inline double calculate_fast_exponential(const double& x)
+{
+   const double clamped = x < -708.0 ? -708.0 : (x > 709.0 ? 709.0 : x);
+
+   const double k = floor(clamped*1.4426950408889634 + 0.5);
+   const double r = clamped - k*0.6931471805599453;
+
+   const double polynomial = 1.0 + r*(1.0 + r*(0.5 + r*(1.0/6.0 + r*(1.0/24.0 + r*(1.0/120.0 + r*(1.0/720.0))))));
+
+   const int64_t bits = (int64_t)(k + 1023.0) << 52;
+
+   double scale;
+
+   memcpy(&scale, &bits, sizeof(double));
+
+   return(polynomial*scale);
+}
+
+
+// double calculate_fast_hyperbolic_tangent(const double&) function
+
+/// Returns an approximation of the hyperbolic tangent, with an absolute error below 1e-6.
+/// It is computed as 1-2/(exp(2x)+1) with the fast exponential approximation. 
+/// @param x Argument of the hyperbolic tangent. 
+
+inline double calculate_fast_hyperbolic_tangent(const double& x)
+{
+   return(1.0 - 2.0/(calculate_fast_exponential(2.0*x) + 1.0));
+}
+
 }
 
 #endif
@@ -79,6 +79,8 @@ PerceptronLayer& PerceptronLayer::operator = (const PerceptronLayer& other_perce
    {
       perceptrons = other_perceptron_layer.perceptrons; 
 
+      fast_activation = other_perceptron_layer.fast_activation;
+
       display = other_perceptron_layer.display;
    }
 
@@ -98,6 +100,7 @@ PerceptronLayer& PerceptronLayer::operator = (const PerceptronLayer& other_perce
 bool PerceptronLayer::operator == (const PerceptronLayer& other_perceptron_layer) const
 {
    if(perceptrons == other_perceptron_layer.perceptrons 
+   && fast_activation == other_perceptron_layer.fast_activation
    && display == other_perceptron_layer.display)
    {
       return(true);
@@ -447,6 +450,45 @@ std::string PerceptronLayer::write_activation_function(void) const
 }
 
 
+// bool has_uniform_activation_function(void) const method
+
+/// Returns true if all the perceptrons in the layer have the same activation function, and false otherwise.
+/// In that case the activations of the whole layer are computed with a single kernel.
+
+bool PerceptronLayer::has_uniform_activation_function(void) const
+{
+   const size_t perceptrons_number = get_perceptrons_number();
+
+   if(perceptrons_number == 0)
+   {
+      return(false);
+   }
+
+   const Perceptron::ActivationFunction& activation_function = perceptrons[0].get_activation_function();
+
+   for(size_t i = 1; i < perceptrons_number; i++)
+   {
+      if(perceptrons[i].get_activation_function() != activation_function)
+      {
+         return(false);
+      }
+   }
+
+   return(true);
+}
+
+
+// const bool& get_fast_activation(void) const method
+
+/// Returns true if the logistic and hyperbolic tangent activations are computed with the fast exponential approximation,
+/// and false if they are computed with the exact exponential.
+
+const bool& PerceptronLayer::get_fast_activation(void) const
+{
+   return(fast_activation);
+}
+
+
 // const bool& get_display(void) const method
 
 /// Returns true if messages from this class are to be displayed on the screen, 
@@ -512,6 +554,8 @@ void PerceptronLayer::set(const size_t& new_inputs_number, const size_t& new_per
 void PerceptronLayer::set(const PerceptronLayer& other_perceptron_layer)
 {
    perceptrons = other_perceptron_layer.perceptrons;
+
+   fast_activation = other_perceptron_layer.fast_activation;
    
    display = other_perceptron_layer.display;
 }
@@ -549,6 +593,8 @@ void PerceptronLayer::set_perceptron(const size_t& i, const Perceptron& new_perc
 
 void PerceptronLayer::set_default(void)
 {
+   fast_activation = false;
+
    display = true;
 }
 
@@ -767,6 +813,18 @@ void PerceptronLayer::set_activation_function(const std::string& new_activation_
 }
 
 
+// void set_fast_activation(const bool&) method
+
+/// Sets whether the logistic and hyperbolic tangent activations of the layer 
+/// are computed with the fast exponential approximation or with the exact exponential. 
+/// @param new_fast_activation True for the fast approximation, false for the exact function.
+
+void PerceptronLayer::set_fast_activation(const bool& new_fast_activation)
+{
+   fast_activation = new_fast_activation;
+}
+
+
 // void set_display(const bool&) method
 
 /// Sets a new display value. 
@@ -798,18 +856,20 @@ void PerceptronLayer::grow_input(void)
 // void grow_perceptron(void) method
 
 /// Makes the perceptron layer to have one more perceptron.
+/// The new perceptron takes the activation function of the layer, or the default one if the layer is empty.
 
 void PerceptronLayer::grow_perceptron(void)
 {
    const size_t inputs_number = get_inputs_number();
 
-   const Perceptron::ActivationFunction activation_function = get_activation_function();
-
    Perceptron perceptron(inputs_number);
 
    perceptron.initialize_parameters(0.0);
 
-   perceptron.set_activation_function(activation_function);
+   if(!is_empty())
+   {
+      perceptron.set_activation_function(get_activation_function());
+   }
 
    perceptrons.push_back(perceptron);
 }
@@ -898,8 +958,8 @@ void PerceptronLayer::prune_perceptron(const size_t& index)
 
 void PerceptronLayer::initialize_random(void)
 {
-   const size_t inputs_number = rand()%10 + 1;
-   const size_t perceptrons_number = rand()%10 + 1;
+   const size_t inputs_number = calculate_random_index(10) + 1;
+   const size_t perceptrons_number = calculate_random_index(10) + 1;
 
    set(inputs_number, perceptrons_number);
    
@@ -1348,6 +1408,13 @@ Vector<double> PerceptronLayer::calculate_activations(const Vector<double>& comb
 
    Vector<double> activations(perceptrons_number);
 
+   if(has_uniform_activation_function())
+   {
+      apply_activation_function(combinations, activations);
+
+      return(activations);
+   }
+
    for(size_t i = 0; i < perceptrons_number; i++)
    {
       activations[i] = perceptrons[i].calculate_activation(combinations[i]);
@@ -1389,6 +1456,20 @@ Vector<double> PerceptronLayer::calculate_activations_derivatives(const Vector<d
 
    Vector<double> activation_derivatives(perceptrons_number);
 
+   if(has_uniform_activation_function())
+   {
+      const Perceptron::ActivationFunction& activation_function = get_activation_function();
+
+      if(activation_function != Perceptron::Threshold && activation_function != Perceptron::SymmetricThreshold)
+      {
+         Vector<double> activations(perceptrons_number);
+
+         apply_activation_function_and_derivative(combination, activations, activation_derivatives);
+
+         return(activation_derivatives);
+      }
+   }
+
    for(size_t i = 0; i < perceptrons_number; i++)
    {          
       activation_derivatives[i] = perceptrons[i].calculate_activation_derivative(combination[i]);
@@ -1430,6 +1511,18 @@ Vector<double> PerceptronLayer::calculate_activations_second_derivatives(const V
 
    Vector<double> activation_second_derivatives(perceptrons_number);
 
+   if(has_uniform_activation_function())
+   {
+      const Perceptron::ActivationFunction& activation_function = get_activation_function();
+
+      if(activation_function != Perceptron::Threshold && activation_function != Perceptron::SymmetricThreshold)
+      {
+         apply_activation_second_derivative(combination, activation_second_derivatives);
+
+         return(activation_second_derivatives);
+      }
+   }
+
    for(size_t i = 0; i < perceptrons_number; i++)
    {          
       activation_second_derivatives[i] = perceptrons[i].calculate_activation_second_derivative(combination[i]);
@@ -1439,6 +1532,410 @@ Vector<double> PerceptronLayer::calculate_activations_second_derivatives(const V
 }
 
 
+// Vector< Vector<double> > calculate_activations_and_derivatives(const Vector<double>&) const method
+
+/// Returns the activations and the activation derivatives from every perceptron in the layer, 
+/// computed together so that the exponentials are evaluated only once. 
+/// The first element of the returned vector are the activations and the second one the activation derivatives.  
+/// @param combinations Combination to every neuron in the layer. 
+
+Vector< Vector<double> > PerceptronLayer::calculate_activations_and_derivatives(const Vector<double>& combinations) const
+{
+   const size_t perceptrons_number = get_perceptrons_number();
+
+   // Control sentence (if debug)
+
+   #ifdef __OPENNN_DEBUG__ 
+
+   const size_t combinations_size = combinations.size();
+
+   if(combinations_size != perceptrons_number) 
+   {
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: PerceptronLayer class.\n"
+             << "Vector< Vector<double> > calculate_activations_and_derivatives(const Vector<double>&) const method.\n"
+             << "Size of combinations must be equal to number of neurons.\n";
+
+	  throw std::logic_error(buffer.str());
+   }   
+
+   #endif
+
+   Vector< Vector<double> > activations_and_derivatives(2);
+
+   if(has_uniform_activation_function())
+   {
+      const Perceptron::ActivationFunction& activation_function = get_activation_function();
+
+      if(activation_function != Perceptron::Threshold && activation_function != Perceptron::SymmetricThreshold)
+      {
+         activations_and_derivatives[0].set(perceptrons_number);
+         activations_and_derivatives[1].set(perceptrons_number);
+
+         apply_activation_function_and_derivative(combinations, activations_and_derivatives[0], activations_and_derivatives[1]);
+
+         return(activations_and_derivatives);
+      }
+   }
+
+   activations_and_derivatives[0] = calculate_activations(combinations);
+   activations_and_derivatives[1] = calculate_activations_derivatives(combinations);
+
+   return(activations_and_derivatives);
+}
+
+
+// Matrix<double> calculate_activations(const Matrix<double>&) const method
+
+/// Returns the activations of the layer for a batch of combinations. 
+/// @param combinations Matrix of combinations, with the instances in the rows and the perceptrons in the columns. 
+
+Matrix<double> PerceptronLayer::calculate_activations(const Matrix<double>& combinations) const
+{
+   const size_t perceptrons_number = get_perceptrons_number();
+
+   const size_t rows_number = combinations.get_rows_number();
+
+   // Control sentence (if debug)
+
+   #ifdef __OPENNN_DEBUG__ 
+
+   const size_t columns_number = combinations.get_columns_number();
+
+   if(columns_number != perceptrons_number) 
+   {
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: PerceptronLayer class.\n"
+             << "Matrix<double> calculate_activations(const Matrix<double>&) const method.\n"
+             << "Number of columns of combinations must be equal to number of neurons.\n";
+
+	  throw std::logic_error(buffer.str());
+   }   
+
+   #endif
+
+   Matrix<double> activations(rows_number, perceptrons_number);
+
+   if(has_uniform_activation_function())
+   {
+      apply_activation_function(combinations, activations);
+
+      return(activations);
+   }
+
+   for(size_t j = 0; j < perceptrons_number; j++)
+   {
+      for(size_t i = 0; i < rows_number; i++)
+      {
+         activations(i,j) = perceptrons[j].calculate_activation(combinations(i,j));
+      }
+   }
+
+   return(activations);
+}
+
+
+// Matrix<double> calculate_activations_derivatives(const Matrix<double>&) const method
+
+/// Returns the activation derivatives of the layer for a batch of combinations. 
+/// @param combinations Matrix of combinations, with the instances in the rows and the perceptrons in the columns. 
+
+Matrix<double> PerceptronLayer::calculate_activations_derivatives(const Matrix<double>& combinations) const
+{
+   const size_t perceptrons_number = get_perceptrons_number();
+
+   const size_t rows_number = combinations.get_rows_number();
+
+   // Control sentence (if debug)
+
+   #ifdef __OPENNN_DEBUG__ 
+
+   const size_t columns_number = combinations.get_columns_number();
+
+   if(columns_number != perceptrons_number) 
+   {
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: PerceptronLayer class.\n"
+             << "Matrix<double> calculate_activations_derivatives(const Matrix<double>&) const method.\n"
+             << "Number of columns of combinations must be equal to number of neurons.\n";
+
+	  throw std::logic_error(buffer.str());
+   }   
+
+   #endif
+
+   Matrix<double> activations_derivatives(rows_number, perceptrons_number);
+
+   if(has_uniform_activation_function())
+   {
+      const Perceptron::ActivationFunction& activation_function = get_activation_function();
+
+      if(activation_function != Perceptron::Threshold && activation_function != Perceptron::SymmetricThreshold)
+      {
+         Matrix<double> activations(rows_number, perceptrons_number);
+
+         apply_activation_function_and_derivative(combinations, activations, activations_derivatives);
+
+         return(activations_derivatives);
+      }
+   }
+
+   for(size_t j = 0; j < perceptrons_number; j++)
+   {
+      for(size_t i = 0; i < rows_number; i++)
+      {
+         activations_derivatives(i,j) = perceptrons[j].calculate_activation_derivative(combinations(i,j));
+      }
+   }
+
+   return(activations_derivatives);
+}
+
+
+// void apply_activation_function(const std::vector<T>&, std::vector<T>&) const method
+
+/// Applies the activation function of the layer to a contiguous block of combinations.
+/// The switch on the activation function is done once for the whole block, 
+/// and each case is a plain loop which the compiler can vectorize. 
+/// The block can be in double or in single precision. 
+/// All the perceptrons in the layer must have the same activation function. 
+/// @param combinations Block of combinations.
+/// @param activations Block of activations, with the same size as the combinations. 
+
+template <class T>
+void PerceptronLayer::apply_activation_function(const std::vector<T>& combinations, std::vector<T>& activations) const
+{
+   const size_t size = activations.size();
+
+   const T* combinations_data = combinations.data();
+   T* activations_data = activations.data();
+
+   const T zero = 0;
+   const T one = 1;
+   const T two = 2;
+
+   switch(get_activation_function())
+   {
+      case Perceptron::Logistic:
+      {
+         if(fast_activation)
+         {
+            for(size_t i = 0; i < size; i++)
+            {
+               activations_data[i] = one/(one + (T)calculate_fast_exponential(-combinations_data[i]));
+            }
+         }
+         else
+         {
+            for(size_t i = 0; i < size; i++)
+            {
+               activations_data[i] = one/(one + std::exp(-combinations_data[i]));
+            }
+         }
+      }
+      break;
+
+      case Perceptron::HyperbolicTangent:
+      {
+         if(fast_activation)
+         {
+            for(size_t i = 0; i < size; i++)
+            {
+               activations_data[i] = (T)calculate_fast_hyperbolic_tangent(combinations_data[i]);
+            }
+         }
+         else
+         {
+            for(size_t i = 0; i < size; i++)
+            {
+               activations_data[i] = one - two/(std::exp(two*combinations_data[i]) + one);
+            }
+         }
+      }
+      break;
+
+      case Perceptron::Threshold:
+      {
+         for(size_t i = 0; i < size; i++)
+         {
+            activations_data[i] = combinations_data[i] < zero ? zero : one;
+         }
+      }
+      break;
+
+      case Perceptron::SymmetricThreshold:
+      {
+         for(size_t i = 0; i < size; i++)
+         {
+            activations_data[i] = combinations_data[i] < zero ? -one : one;
+         }
+      }
+      break;
+
+      case Perceptron::Linear:
+      {
+         for(size_t i = 0; i < size; i++)
+         {
+            activations_data[i] = combinations_data[i];
+         }
+      }
+      break;
+
+      default:
+      {
+         std::ostringstream buffer;
+
+         buffer << "OpenNN Exception: PerceptronLayer class.\n"
+                << "void apply_activation_function(const std::vector<T>&, std::vector<T>&) const method.\n"
+                << "Unknown activation function.\n";
+
+         throw std::logic_error(buffer.str());
+      }
+      break;
+   }
+}
+
+template void PerceptronLayer::apply_activation_function<double>(const std::vector<double>&, std::vector<double>&) const;
+template void PerceptronLayer::apply_activation_function<float>(const std::vector<float>&, std::vector<float>&) const;
+
+
+// void apply_activation_function_and_derivative(const std::vector<T>&, std::vector<T>&, std::vector<T>&) const method
+
+/// Applies the activation function of the layer and its derivative to a contiguous block of combinations.
+/// The derivatives are obtained from the activations, so that each exponential is computed only once. 
+/// The block can be in double or in single precision. 
+/// All the perceptrons in the layer must have the same activation function, which cannot be a threshold. 
+/// @param combinations Block of combinations.
+/// @param activations Block of activations, with the same size as the combinations. 
+/// @param activations_derivatives Block of activation derivatives, with the same size as the combinations. 
+
+template <class T>
+void PerceptronLayer::apply_activation_function_and_derivative(const std::vector<T>& combinations,
+                                                               std::vector<T>& activations,
+                                                               std::vector<T>& activations_derivatives) const
+{
+   const size_t size = activations_derivatives.size();
+
+   apply_activation_function(combinations, activations);
+
+   const T* activations_data = activations.data();
+   T* activations_derivatives_data = activations_derivatives.data();
+
+   const T one = 1;
+
+   switch(get_activation_function())
+   {
+      case Perceptron::Logistic:
+      {
+         for(size_t i = 0; i < size; i++)
+         {
+            activations_derivatives_data[i] = activations_data[i]*(one - activations_data[i]);
+         }
+      }
+      break;
+
+      case Perceptron::HyperbolicTangent:
+      {
+         for(size_t i = 0; i < size; i++)
+         {
+            activations_derivatives_data[i] = one - activations_data[i]*activations_data[i];
+         }
+      }
+      break;
+
+      case Perceptron::Linear:
+      {
+         for(size_t i = 0; i < size; i++)
+         {
+            activations_derivatives_data[i] = one;
+         }
+      }
+      break;
+
+      default:
+      {
+         std::ostringstream buffer;
+
+         buffer << "OpenNN Exception: PerceptronLayer class.\n"
+                << "void apply_activation_function_and_derivative(const std::vector<T>&, std::vector<T>&, std::vector<T>&) const method.\n"
+                << "Activation function is not derivable.\n";
+
+         throw std::logic_error(buffer.str());
+      }
+      break;
+   }
+}
+
+template void PerceptronLayer::apply_activation_function_and_derivative<double>(const std::vector<double>&, std::vector<double>&, std::vector<double>&) const;
+template void PerceptronLayer::apply_activation_function_and_derivative<float>(const std::vector<float>&, std::vector<float>&, std::vector<float>&) const;
+
+
+// void apply_activation_second_derivative(const std::vector<double>&, std::vector<double>&) const method
+
+/// Applies the second derivative of the activation function of the layer to a contiguous block of combinations.
+/// All the perceptrons in the layer must have the same activation function, which cannot be a threshold. 
+/// @param combinations Block of combinations.
+/// @param activations_second_derivatives Block of activation second derivatives, with the same size as the combinations. 
+
+void PerceptronLayer::apply_activation_second_derivative(const std::vector<double>& combinations, std::vector<double>& activations_second_derivatives) const
+{
+   const size_t size = activations_second_derivatives.size();
+
+   apply_activation_function(combinations, activations_second_derivatives);
+
+   double* activations_second_derivatives_data = activations_second_derivatives.data();
+
+   switch(get_activation_function())
+   {
+      case Perceptron::Logistic:
+      {
+         for(size_t i = 0; i < size; i++)
+         {
+            const double activation = activations_second_derivatives_data[i];
+
+            activations_second_derivatives_data[i] = activation*(1.0 - activation)*(1.0 - 2.0*activation);
+         }
+      }
+      break;
+
+      case Perceptron::HyperbolicTangent:
+      {
+         for(size_t i = 0; i < size; i++)
+         {
+            const double activation = activations_second_derivatives_data[i];
+
+            activations_second_derivatives_data[i] = -2.0*activation*(1.0 - activation*activation);
+         }
+      }
+      break;
+
+      case Perceptron::Linear:
+      {
+         for(size_t i = 0; i < size; i++)
+         {
+            activations_second_derivatives_data[i] = 0.0;
+         }
+      }
+      break;
+
+      default:
+      {
+         std::ostringstream buffer;
+
+         buffer << "OpenNN Exception: PerceptronLayer class.\n"
+                << "void apply_activation_second_derivative(const std::vector<double>&, std::vector<double>&) const method.\n"
+                << "Activation function is not derivable.\n";
+
+         throw std::logic_error(buffer.str());
+      }
+      break;
+   }
+}
+
+
 // Matrix<double> arrange_activations_Jacobian(const Vector<double>&) const method
 
 /// Arranges a "Jacobian" matrix from a vector of derivatives. 
@@ -1509,6 +2006,147 @@ Vector<double> PerceptronLayer::calculate_outputs(const Vector<double>& inputs)
 }
 
 
+// Matrix<float> calculate_combinations(const Matrix<float>&) const method
+
+/// Returns the combinations of the layer for a batch of inputs in single precision. 
+/// The biases and synaptic weights are converted to single precision once, 
+/// and the combinations are computed with a single matrix product.
+/// @param inputs Matrix of inputs, with the instances in the rows and the layer inputs in the columns. 
+
+Matrix<float> PerceptronLayer::calculate_combinations(const Matrix<float>& inputs) const
+{
+   const size_t inputs_number = get_inputs_number();
+   const size_t perceptrons_number = get_perceptrons_number();
+
+   const size_t rows_number = inputs.get_rows_number();
+
+   // Control sentence (if debug)
+
+   #ifdef __OPENNN_DEBUG__ 
+
+   const size_t columns_number = inputs.get_columns_number();
+
+   if(columns_number != inputs_number) 
+   {
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: PerceptronLayer class.\n"
+             << "Matrix<float> calculate_combinations(const Matrix<float>&) const method.\n"
+             << "Number of columns of inputs (" << columns_number << ") must be equal to number of inputs (" << inputs_number << ").\n";
+
+	  throw std::logic_error(buffer.str());
+   }   
+
+   #endif
+
+   const Matrix<float> synaptic_weights = arrange_synaptic_weights().to_float_matrix();
+   const Vector<double> biases = arrange_biases();
+
+   Matrix<float> combinations(rows_number, perceptrons_number);
+
+   const Eigen::Map<Eigen::MatrixXf> inputs_eigen((float*)inputs.data(), rows_number, inputs_number);
+   const Eigen::Map<Eigen::MatrixXf> synaptic_weights_eigen((float*)synaptic_weights.data(), perceptrons_number, inputs_number);
+   Eigen::Map<Eigen::MatrixXf> combinations_eigen(combinations.data(), rows_number, perceptrons_number);
+
+   combinations_eigen.noalias() = inputs_eigen*synaptic_weights_eigen.transpose();
+
+   for(size_t j = 0; j < perceptrons_number; j++)
+   {
+      const float bias = (float)biases[j];
+
+      for(size_t i = 0; i < rows_number; i++)
+      {
+         combinations(i,j) += bias;
+      }
+   }
+
+   return(combinations);
+}
+
+
+// Matrix<float> calculate_activations(const Matrix<float>&) const method
+
+/// Returns the activations of the layer for a batch of combinations in single precision. 
+/// @param combinations Matrix of combinations, with the instances in the rows and the perceptrons in the columns. 
+
+Matrix<float> PerceptronLayer::calculate_activations(const Matrix<float>& combinations) const
+{
+   const size_t perceptrons_number = get_perceptrons_number();
+
+   const size_t rows_number = combinations.get_rows_number();
+
+   Matrix<float> activations(rows_number, perceptrons_number);
+
+   if(has_uniform_activation_function())
+   {
+      apply_activation_function(combinations, activations);
+
+      return(activations);
+   }
+
+   for(size_t j = 0; j < perceptrons_number; j++)
+   {
+      for(size_t i = 0; i < rows_number; i++)
+      {
+         activations(i,j) = (float)perceptrons[j].calculate_activation(combinations(i,j));
+      }
+   }
+
+   return(activations);
+}
+
+
+// Matrix<float> calculate_outputs(const Matrix<float>&) const method
+
+/// Returns the outputs of the layer for a batch of inputs in single precision. 
+/// @param inputs Matrix of inputs, with the instances in the rows and the layer inputs in the columns. 
+
+Matrix<float> PerceptronLayer::calculate_outputs(const Matrix<float>& inputs) const
+{
+   return(calculate_activations(calculate_combinations(inputs)));
+}
+
+
+// Matrix<float> calculate_activations_derivatives(const Matrix<float>&) const method
+
+/// Returns the activation derivatives of the layer for a batch of combinations in single precision. 
+/// It is used by the single precision gradient of the sum squared error. 
+/// @param combinations Matrix of combinations, with the instances in the rows and the perceptrons in the columns. 
+
+Matrix<float> PerceptronLayer::calculate_activations_derivatives(const Matrix<float>& combinations) const
+{
+   const size_t perceptrons_number = get_perceptrons_number();
+
+   const size_t rows_number = combinations.get_rows_number();
+
+   Matrix<float> activations_derivatives(rows_number, perceptrons_number);
+
+   if(has_uniform_activation_function())
+   {
+      const Perceptron::ActivationFunction& activation_function = get_activation_function();
+
+      if(activation_function != Perceptron::Threshold && activation_function != Perceptron::SymmetricThreshold)
+      {
+         Matrix<float> activations(rows_number, perceptrons_number);
+
+         apply_activation_function_and_derivative(combinations, activations, activations_derivatives);
+
+         return(activations_derivatives);
+      }
+   }
+
+   for(size_t j = 0; j < perceptrons_number; j++)
+   {
+      for(size_t i = 0; i < rows_number; i++)
+      {
+         activations_derivatives(i,j) = (float)perceptrons[j].calculate_activation_derivative(combinations(i,j));
+      }
+   }
+
+   return(activations_derivatives);
+}
+
+
 // Matrix<double> calculate_Jacobian(const Vector<double>&) const method
 
 /// Returns the Jacobian matrix of a layer for a given inputs to that layer. 
@@ -1575,7 +2213,7 @@ Vector< Matrix<double> > PerceptronLayer::calculate_Hessian_form(const Vector<do
       activation_Hessian_form[i].set(perceptrons_number, perceptrons_number, 0.0);
       activation_Hessian_form[i](i,i) = activations_second_derivatives[i];
 
-	  Hessian_form[i] = synaptic_weights.calculate_transpose().dot(activation_Hessian_form[i]).dot(synaptic_weights);
+	  Hessian_form[i] = synaptic_weights.transpose_dot(activation_Hessian_form[i]).dot(synaptic_weights);
    }
 
    return(Hessian_form);
@@ -1719,7 +2357,7 @@ Vector< Matrix<double> > PerceptronLayer::calculate_Hessian_form(const Vector<do
 
    for(size_t i = 0; i < perceptrons_number; i++)
    {
-	  parameters_Hessian_form[i] = combination_parameters_Jacobian.calculate_transpose().dot(activation_Hessian_form[i]).dot(combination_parameters_Jacobian);
+	  parameters_Hessian_form[i] = combination_parameters_Jacobian.transpose_dot(activation_Hessian_form[i]).dot(combination_parameters_Jacobian);
    }
 
    return(parameters_Hessian_form);
@@ -94,6 +94,10 @@ public:
 
    std::string write_activation_function(void) const;
 
+   bool has_uniform_activation_function(void) const;
+
+   const bool& get_fast_activation(void) const;
+
    // Display messages
 
    const bool& get_display(void) const;
@@ -127,6 +131,8 @@ public:
    void set_activation_function(const Perceptron::ActivationFunction&);
    void set_activation_function(const std::string&);
 
+   void set_fast_activation(const bool&);
+
    // Display messages
 
    void set_display(const bool&);
@@ -182,6 +188,17 @@ public:
    Vector<double> calculate_activations_derivatives(const Vector<double>&) const;
    Vector<double> calculate_activations_second_derivatives(const Vector<double>&) const;
 
+   Vector< Vector<double> > calculate_activations_and_derivatives(const Vector<double>&) const;
+
+   Matrix<double> calculate_activations(const Matrix<double>&) const;
+   Matrix<double> calculate_activations_derivatives(const Matrix<double>&) const;
+
+   template <class T>
+   void apply_activation_function(const std::vector<T>&, std::vector<T>&) const;
+   template <class T>
+   void apply_activation_function_and_derivative(const std::vector<T>&, std::vector<T>&, std::vector<T>&) const;
+   void apply_activation_second_derivative(const std::vector<double>&, std::vector<double>&) const;
+
    Matrix<double> arrange_activations_Jacobian(const Vector<double>&) const;
    Vector< Matrix<double> > arrange_activations_Hessian_form(const Vector<double>&) const;
 
@@ -195,6 +212,13 @@ public:
    Matrix<double> calculate_Jacobian(const Vector<double>&, const Vector<double>&) const;
    Vector< Matrix<double> > calculate_Hessian_form(const Vector<double>&, const Vector<double>&) const;
 
+   // Single precision batch methods
+
+   Matrix<float> calculate_combinations(const Matrix<float>&) const;
+   Matrix<float> calculate_activations(const Matrix<float>&) const;
+   Matrix<float> calculate_activations_derivatives(const Matrix<float>&) const;
+   Matrix<float> calculate_outputs(const Matrix<float>&) const;
+
    // Expression methods
 
    std::string write_expression(const Vector<std::string>&, const Vector<std::string>&) const;
@@ -213,6 +237,10 @@ protected:
 
    Vector<Perceptron> perceptrons;
 
+   /// True if the activation kernels use the fast exponential approximation, false if they use the exact exponential.
+
+   bool fast_activation;
+
    /// Display messages to screen. 
 
    bool display;
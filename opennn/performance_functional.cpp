@@ -4971,6 +4971,8 @@ double PerformanceFunctional::calculate_performance(void) const
 
    #endif
 
+   OPENNN_SCOPED_TIMER("performance_functional.performance");
+
    return(calculate_objective() + calculate_regularization() + calculate_constraints());
 }
 
@@ -5008,6 +5010,8 @@ double PerformanceFunctional::calculate_performance(const Vector<double>& parame
 
    #endif
 
+   OPENNN_SCOPED_TIMER("performance_functional.performance");
+
    return(calculate_objective(parameters) + calculate_regularization(parameters) + calculate_constraints(parameters));
 }
 
@@ -5273,6 +5277,8 @@ Vector<double> PerformanceFunctional::calculate_gradient(void) const
 
    #endif
 
+   OPENNN_SCOPED_TIMER("performance_functional.gradient");
+
    return(calculate_objective_gradient() + calculate_regularization_gradient() + calculate_constraints_gradient());
 }
 
@@ -5312,6 +5318,8 @@ Vector<double> PerformanceFunctional::calculate_gradient(const Vector<double>& p
    
    #endif
     
+   OPENNN_SCOPED_TIMER("performance_functional.gradient");
+
    return(calculate_objective_gradient(parameters) + calculate_regularization_gradient(parameters) + calculate_constraints_gradient(parameters));
 }
 
@@ -5332,6 +5340,8 @@ Matrix<double> PerformanceFunctional::calculate_Hessian(void) const
 
     #endif
 
+    OPENNN_SCOPED_TIMER("performance_functional.Hessian");
+
     return(calculate_objective_Hessian() + calculate_regularization_Hessian() + calculate_constraints_Hessian());
 }
 
@@ -5370,6 +5380,8 @@ Matrix<double> PerformanceFunctional::calculate_Hessian(const Vector<double>& pa
 
    #endif
 
+   OPENNN_SCOPED_TIMER("performance_functional.Hessian");
+
    return(calculate_objective_Hessian(parameters) + calculate_regularization_Hessian(parameters) + calculate_constraints_Hessian(parameters));
 }
 
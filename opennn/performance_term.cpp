@@ -603,6 +603,25 @@ void PerformanceTerm::delete_numerical_differentiation_pointer(void)
 }
 
 
+// NumericalDifferentiation arrange_numerical_differentiation(void) const method
+
+/// Returns a copy of the numerical differentiation object used for the default derivatives of this performance term. 
+/// Parallel evaluation is switched off in the copy if the mathematical model is not thread safe, 
+/// such as a plug-in which runs a script. 
+
+NumericalDifferentiation PerformanceTerm::arrange_numerical_differentiation(void) const
+{
+   NumericalDifferentiation numerical_differentiation(*numerical_differentiation_pointer);
+
+   if(mathematical_model_pointer && !mathematical_model_pointer->is_thread_safe())
+   {
+      numerical_differentiation.set_parallel_evaluation(false);
+   }
+
+   return(numerical_differentiation);
+}
+
+
 // void check(void) const method
 
 /// Checks that there is a neural network associated to the performance term.
@@ -634,6 +653,8 @@ Vector< Vector<double> > PerformanceTerm::calculate_layers_delta
 (const Vector< Vector<double> >& layers_activation_derivative, 
  const Vector<double>& output_gradient) const
 {
+   OPENNN_SCOPED_TIMER("performance_term.layers_delta");
+
    // Neural network stuff
 
    #ifdef __OPENNN_DEBUG__
@@ -737,6 +758,8 @@ Vector< Vector<double> > PerformanceTerm::calculate_layers_delta
  const Vector<double>& homogeneous_solution,
  const Vector<double>& output_gradient) const
 {
+   OPENNN_SCOPED_TIMER("performance_term.layers_delta");
+
    const MultilayerPerceptron* multilayer_perceptron_pointer = neural_network_pointer->get_multilayer_perceptron_pointer();
 
    const size_t layers_number = multilayer_perceptron_pointer->get_layers_number();
@@ -820,6 +843,43 @@ Vector< Vector<double> > PerformanceTerm::calculate_layers_delta
 
 
 
+// Vector< Vector<double> > calculate_hidden_layers_delta(const Vector< Vector<double> >&, const Vector<double>&) method
+
+/// Returns the delta vector for all the layers in the multilayer perceptron, 
+/// when the delta of the output layer is already known.
+/// This is the case of loss functions fused with the activation of the output layer, 
+/// such as the cross entropy with logistic or softmax outputs, whose output delta is simply outputs minus targets. 
+/// @param layers_activation_derivative Forward propagation activation derivative. 
+/// @param output_layer_delta Partial derivatives of the performance with respect to the combinations of the output layer.
+
+Vector< Vector<double> > PerformanceTerm::calculate_hidden_layers_delta
+(const Vector< Vector<double> >& layers_activation_derivative, 
+ const Vector<double>& output_layer_delta) const
+{
+   const MultilayerPerceptron* multilayer_perceptron_pointer = neural_network_pointer->get_multilayer_perceptron_pointer();
+
+   const size_t layers_number = multilayer_perceptron_pointer->get_layers_number();
+
+   Matrix<double> layer_synaptic_weights;
+
+   Vector< Vector<double> > layers_delta(layers_number);
+
+   if(layers_number > 0)
+   {
+      layers_delta[layers_number-1] = output_layer_delta;
+
+      for(int i = (int)layers_number-2; i >= 0; i--)
+      {
+         layer_synaptic_weights = multilayer_perceptron_pointer->get_layer(i+1).arrange_synaptic_weights();
+
+         layers_delta[i] = layers_activation_derivative[i]*(layers_delta[i+1].dot(layer_synaptic_weights));
+      }
+   }
+
+   return(layers_delta);
+}
+
+
 // Vector<double> calculate_point_gradient(const Vector<double>&, const Vector< Vector<double> >&, const Vector<double>&) const method
 
 /// Returns the gradient of the performance term function at some input point.
@@ -832,6 +892,8 @@ Vector<double> PerformanceTerm::calculate_point_gradient
  const Vector< Vector<double> >& layers_activation, 
  const Vector< Vector<double> >& layers_delta) const
 {
+   OPENNN_SCOPED_TIMER("performance_term.point_gradient");
+
    // Control sentence (if debug)
 
    #ifdef __OPENNN_DEBUG__
@@ -988,6 +1050,8 @@ Vector<double> PerformanceTerm::calculate_point_gradient
 (const Vector< Matrix<double> >& layers_combination_parameters_Jacobian, 
  const Vector< Vector<double> >& layers_delta) const
 {
+   OPENNN_SCOPED_TIMER("performance_term.point_gradient");
+
    // Control sentence (if debug)
 
    #ifdef __OPENNN_DEBUG__
@@ -1597,7 +1661,7 @@ Vector<double> PerformanceTerm::calculate_gradient(void) const
 
    const Vector<double> parameters = neural_network_pointer->arrange_parameters();
 
-   return(numerical_differentiation_pointer->calculate_gradient(*this, &PerformanceTerm::calculate_performance, parameters));
+   return(arrange_numerical_differentiation().calculate_gradient(*this, &PerformanceTerm::calculate_performance, parameters));
 }
 
 
@@ -1633,7 +1697,7 @@ Vector<double> PerformanceTerm::calculate_gradient(const Vector<double>& paramet
 
    #endif
 
-   return(numerical_differentiation_pointer->calculate_gradient(*this, &PerformanceTerm::calculate_performance, parameters));
+   return(arrange_numerical_differentiation().calculate_gradient(*this, &PerformanceTerm::calculate_performance, parameters));
 }
 
 
@@ -1653,7 +1717,7 @@ Matrix<double> PerformanceTerm::calculate_Hessian(void) const
 
    const Vector<double> parameters = neural_network_pointer->arrange_parameters();
 
-   return(numerical_differentiation_pointer->calculate_Hessian(*this, &PerformanceTerm::calculate_performance, parameters));
+   return(arrange_numerical_differentiation().calculate_Hessian(*this, &PerformanceTerm::calculate_performance, parameters));
 }
 
 
@@ -1671,7 +1735,7 @@ Matrix<double> PerformanceTerm::calculate_Hessian(const Vector<double>& paramete
 
    #endif
 
-   return(numerical_differentiation_pointer->calculate_Hessian(*this, &PerformanceTerm::calculate_performance, parameters));
+   return(arrange_numerical_differentiation().calculate_Hessian(*this, &PerformanceTerm::calculate_performance, parameters));
 }
 
 
@@ -300,6 +300,8 @@ public:
    void construct_numerical_differentiation(void);
    void delete_numerical_differentiation_pointer(void);
 
+   NumericalDifferentiation arrange_numerical_differentiation(void) const;
+
    // Checking methods
 
    virtual void check(void) const;
@@ -309,6 +311,8 @@ public:
    Vector< Vector<double> > calculate_layers_delta(const Vector< Vector<double> >&, const Vector<double>&) const;
    Vector< Vector<double> > calculate_layers_delta(const Vector< Vector<double> >&, const Vector<double>&, const Vector<double>&) const;   
 
+   Vector< Vector<double> > calculate_hidden_layers_delta(const Vector< Vector<double> >&, const Vector<double>&) const;
+
    // Interlayers Delta methods
 
    double calculate_performance_output_combinations(const Vector<double>& combinations) const;
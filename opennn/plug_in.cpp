@@ -15,6 +15,15 @@
 
 #include "plug_in.h"
 
+// System includes
+
+#ifdef _WIN32
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <dlfcn.h>
+#endif
+
 namespace OpenNN
 {
 
@@ -24,6 +33,8 @@ namespace OpenNN
 /// It constructs a default plug-in object, with zero independent and dependent variables. 
 
 PlugIn::PlugIn(void) : MathematicalModel()
+ , library_handle(NULL)
+ , evaluation_function(NULL)
 {                                            
    set_default();
 }
@@ -37,17 +48,39 @@ PlugIn::PlugIn(void) : MathematicalModel()
 
 PlugIn::PlugIn(const tinyxml2::XMLDocument& plug_in_document)
 : MathematicalModel(plug_in_document)
+ , library_handle(NULL)
+ , evaluation_function(NULL)
 {                                            
+   set_default();
+
+   from_XML(plug_in_document);
+}
+
+
+// COPY CONSTRUCTOR
+
+/// Copy constructor.
+/// It creates a copy of an existing plug-in object. 
+/// If the other plug-in has loaded a shared library, this object loads it again, so that each object owns its own handle.
+/// @param other_plug_in Plug-in object to be copied.
+
+PlugIn::PlugIn(const PlugIn& other_plug_in)
+: MathematicalModel(other_plug_in)
+ , library_handle(NULL)
+ , evaluation_function(NULL)
+{
+   *this = other_plug_in;
 }
 
 
 // DESTRUCTOR
  
 /// Destructor. 
-/// It does not delete any object.  
+/// It unloads the shared library, if any.  
 
 PlugIn::~PlugIn(void)
 { 
+   unload_library();
 }
 
 
@@ -57,12 +90,24 @@ PlugIn::~PlugIn(void)
 
 /// Assignment operator. 
 /// It assigns to this object the members of an existing plug-in object.
+/// If the other plug-in has loaded a shared library, it is loaded again before any member is assigned, 
+/// so that this object is left unchanged if loading fails.
 /// @param other_plug_in Plug-in object to be assigned.
 
 PlugIn& PlugIn::operator = (const PlugIn& other_plug_in)
 {
    if(this != &other_plug_in) 
    {
+      PlugIn loaded_plug_in;
+
+      if(other_plug_in.library_handle)
+      {
+         loaded_plug_in.library_file_name = other_plug_in.library_file_name;
+         loaded_plug_in.evaluation_function_name = other_plug_in.evaluation_function_name;
+
+         loaded_plug_in.load_library();
+      }
+
       input_method = other_plug_in.input_method;
 
       template_file_name = other_plug_in.template_file_name;
@@ -76,6 +121,26 @@ PlugIn& PlugIn::operator = (const PlugIn& other_plug_in)
 
       output_rows_number = other_plug_in.output_rows_number;
       output_columns_number = other_plug_in.output_columns_number;
+
+      evaluation_method = other_plug_in.evaluation_method;
+
+      library_file_name = other_plug_in.library_file_name;
+      evaluation_function_name = other_plug_in.evaluation_function_name;
+
+      if(other_plug_in.library_handle)
+      {
+         unload_library();
+
+         library_handle = loaded_plug_in.library_handle;
+         evaluation_function = loaded_plug_in.evaluation_function;
+
+         loaded_plug_in.library_handle = NULL;
+         loaded_plug_in.evaluation_function = NULL;
+      }
+      else
+      {
+         set_evaluation_function(other_plug_in.evaluation_function);
+      }
    }
 
    return(*this);
@@ -100,7 +165,10 @@ bool PlugIn::operator == (const PlugIn& other_plug_in) const
    && output_file_name == other_plug_in.output_file_name
    && input_flags == other_plug_in.input_flags
    && output_rows_number == other_plug_in.output_rows_number
-   && output_columns_number == other_plug_in.output_columns_number)
+   && output_columns_number == other_plug_in.output_columns_number
+   && evaluation_method == other_plug_in.evaluation_method
+   && library_file_name == other_plug_in.library_file_name
+   && evaluation_function_name == other_plug_in.evaluation_function_name)
    {
       return(true);
    }
@@ -213,6 +281,129 @@ const std::string& PlugIn::get_input_flag(const size_t& i) const
 }
 
 
+// const EvaluationMethod& get_evaluation_method(void) const method
+
+/// Returns the method for evaluating the mathematical model. 
+
+const PlugIn::EvaluationMethod& PlugIn::get_evaluation_method(void) const
+{
+   return(evaluation_method);
+}
+
+
+// std::string write_evaluation_method(void) const method
+
+/// Returns a string with the name of the method for evaluating the mathematical model. 
+
+std::string PlugIn::write_evaluation_method(void) const
+{
+   switch(evaluation_method)
+   {
+      case ScriptEvaluation:
+      {
+         return("Script");
+      }
+      break;
+
+      case SharedLibraryEvaluation:
+      {
+         return("SharedLibrary");
+      }
+      break;
+
+      default:
+      {
+         std::ostringstream buffer;
+
+         buffer << "OpenNN Exception: PlugIn class.\n"
+                << "std::string write_evaluation_method(void) const method.\n"
+                << "Unknown evaluation method.\n";
+
+         throw std::logic_error(buffer.str());
+      }
+      break;
+   }
+}
+
+
+// const std::string& get_library_file_name(void) const method
+
+/// Returns the name of the shared library which evaluates the mathematical model. 
+
+const std::string& PlugIn::get_library_file_name(void) const
+{
+   return(library_file_name);
+}
+
+
+// const std::string& get_evaluation_function_name(void) const method
+
+/// Returns the name of the evaluation function exported by the shared library. 
+
+const std::string& PlugIn::get_evaluation_function_name(void) const
+{
+   return(evaluation_function_name);
+}
+
+
+// const size_t& get_output_rows_number(void) const method
+
+/// Returns the number of rows of the solutions matrix. 
+
+const size_t& PlugIn::get_output_rows_number(void) const
+{
+   return(output_rows_number);
+}
+
+
+// const size_t& get_output_columns_number(void) const method
+
+/// Returns the number of columns of the solutions matrix. 
+
+const size_t& PlugIn::get_output_columns_number(void) const
+{
+   return(output_columns_number);
+}
+
+
+// bool has_evaluation_function(void) const method
+
+/// Returns true if an in-process evaluation function is available, 
+/// either loaded from a shared library or set directly, and false otherwise. 
+
+bool PlugIn::has_evaluation_function(void) const
+{
+   if(evaluation_function)
+   {
+      return(true);
+   }
+   else
+   {
+      return(false);
+   }
+}
+
+
+// bool is_thread_safe(void) const method
+
+/// Returns false if the evaluation method is the script one, and true otherwise. 
+/// All the script evaluations share the same input file, output file and script, 
+/// so they cannot be run concurrently. 
+/// The evaluation function of a shared library is assumed to be reentrant. 
+
+bool PlugIn::is_thread_safe(void) const
+{
+   if(evaluation_method == ScriptEvaluation)
+   {
+      return(false);
+   }
+   else
+   {
+      return(true);
+   }
+}
+
+
 // void set_default(void) method
 
 /// Sets the following default values in this object:
@@ -221,6 +412,9 @@ const std::string& PlugIn::get_input_flag(const size_t& i) const
 /// <li> Input file_name: input.dat.
 /// <li> Script file_name: batch.bat.
 /// <li> Output file_name: output.dat.
+/// <li> Output rows and columns numbers: 0.
+/// <li> Evaluation method: Script.
+/// <li> Evaluation function name: evaluate.
 /// <li> Display: true. 
 /// </ul>
 
@@ -235,6 +429,14 @@ void PlugIn::set_default(void)
 
    output_file_name = "output.dat";
 
+   output_rows_number = 0;
+   output_columns_number = 0;
+
+   evaluation_method = ScriptEvaluation;
+
+   library_file_name = "";
+   evaluation_function_name = "evaluate";
+
    display = true;
 }
 
@@ -329,6 +531,105 @@ void PlugIn::set_input_flags(const Vector<std::string>& new_input_flags)
 }
 
 
+// void set_evaluation_method(const EvaluationMethod&) method
+
+/// Sets the method for evaluating the mathematical model. 
+/// @param new_evaluation_method Evaluation method (external script or shared library). 
+
+void PlugIn::set_evaluation_method(const EvaluationMethod& new_evaluation_method)
+{
+   evaluation_method = new_evaluation_method;
+}
+
+
+// void set_evaluation_method(const std::string&) method
+
+/// Sets the method for evaluating the mathematical model from a string. 
+/// @param new_evaluation_method String with the name of the evaluation method ("Script" or "SharedLibrary"). 
+
+void PlugIn::set_evaluation_method(const std::string& new_evaluation_method)
+{
+   if(new_evaluation_method == "Script")
+   {
+      set_evaluation_method(ScriptEvaluation);
+   }
+   else if(new_evaluation_method == "SharedLibrary")
+   {
+      set_evaluation_method(SharedLibraryEvaluation);
+   }
+   else
+   {
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: PlugIn class.\n"
+             << "void set_evaluation_method(const std::string&) method.\n"
+             << "Unknown evaluation method: " << new_evaluation_method << ".\n";
+
+      throw std::logic_error(buffer.str());
+   }
+}
+
+
+// void set_library_file_name(const std::string&) method
+
+/// Sets the name of the shared library which evaluates the mathematical model. 
+/// The library is not loaded until load_library is called. 
+/// @param new_library_file_name Name of shared library file.
+
+void PlugIn::set_library_file_name(const std::string& new_library_file_name)
+{
+   library_file_name = new_library_file_name;
+}
+
+
+// void set_evaluation_function_name(const std::string&) method
+
+/// Sets the name of the evaluation function exported by the shared library. 
+/// @param new_evaluation_function_name Name of the exported C function.
+
+void PlugIn::set_evaluation_function_name(const std::string& new_evaluation_function_name)
+{
+   evaluation_function_name = new_evaluation_function_name;
+}
+
+
+// void set_evaluation_function(EvaluationFunction) method
+
+/// Sets directly the function which evaluates the mathematical model in process, 
+/// for instance when the simulator is linked statically into the application. 
+/// Any loaded shared library is unloaded. 
+/// @param new_evaluation_function Pointer to the evaluation function. 
+
+void PlugIn::set_evaluation_function(EvaluationFunction new_evaluation_function)
+{
+   unload_library();
+
+   evaluation_function = new_evaluation_function;
+}
+
+
+// void set_output_rows_number(const size_t&) method
+
+/// Sets the number of rows of the solutions matrix. 
+/// @param new_output_rows_number Number of output rows. 
+
+void PlugIn::set_output_rows_number(const size_t& new_output_rows_number)
+{
+   output_rows_number = new_output_rows_number;
+}
+
+
+// void set_output_columns_number(const size_t&) method
+
+/// Sets the number of columns of the solutions matrix. 
+/// @param new_output_columns_number Number of output columns. 
+
+void PlugIn::set_output_columns_number(const size_t& new_output_columns_number)
+{
+   output_columns_number = new_output_columns_number;
+}
+
+
 // void write_input_file(const NeuralNetwork&) const method
 
 /// Thise method writes the input file with values obtained from the neural network. 
@@ -365,11 +666,9 @@ void PlugIn::write_input_file(const NeuralNetwork& neural_network) const
 
 void PlugIn::write_input_file_independent_parameters(const NeuralNetwork& neural_network) const
 {
-   const IndependentParameters* independent_parameters_pointer = neural_network.get_independent_parameters_pointer();
-
    #ifdef __OPENNN_DEBUG__ 
 
-   if(!independent_parameters_pointer)
+   if(!neural_network.has_independent_parameters())
    {
       std::ostringstream buffer;
 
@@ -382,7 +681,7 @@ void PlugIn::write_input_file_independent_parameters(const NeuralNetwork& neural
 
    #endif
 
-   const Vector<double> independent_parameters = independent_parameters_pointer->get_parameters();
+   const Vector<double> independent_parameters = neural_network.arrange_independent_parameters();
 
    //size_t input_flags_number = input_flags.size();
 
@@ -550,11 +849,240 @@ Matrix<double> PlugIn::read_output_file_header(void) const
 
 Matrix<double> PlugIn::calculate_solutions(const NeuralNetwork& neural_network) const
 {
-   write_input_file(neural_network);
+   switch(evaluation_method)
+   {
+      case ScriptEvaluation:
+      {
+         write_input_file(neural_network);
+
+         run_script();
+
+         return(read_output_file());
+      }
+      break;
+
+      case SharedLibraryEvaluation:
+      {
+         const Vector<double> independent_parameters = neural_network.arrange_independent_parameters();
+
+         const size_t independent_parameters_number = independent_parameters.size();
+
+         Matrix<double> parameters_batch(1, independent_parameters_number);
+
+         parameters_batch.set_row(0, independent_parameters);
+
+         return(calculate_batch_solutions(parameters_batch)[0]);
+      }
+      break;
+
+      default:
+      {
+         std::ostringstream buffer;
+
+         buffer << "OpenNN Exception: PlugIn class.\n"
+                << "Matrix<double> calculate_solutions(const NeuralNetwork&) const method.\n"
+                << "Unknown evaluation method.\n";
+
+         throw std::logic_error(buffer.str());
+      }
+      break;
+   }
+}
+
+
+// void load_library(void) method
+
+/// Loads the shared library and looks up its evaluation function. 
+/// The function must have C linkage and the signature given by EvaluationFunction. 
+/// Any previously loaded library is unloaded first. 
+
+void PlugIn::load_library(void)
+{
+   unload_library();
+
+   if(library_file_name.empty())
+   {
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: PlugIn class.\n"
+             << "void load_library(void) method.\n"
+             << "Library file name is empty.\n";
+
+      throw std::logic_error(buffer.str());
+   }
+
+   #ifdef _WIN32
+
+   HMODULE handle = LoadLibraryA(library_file_name.c_str());
+
+   if(!handle)
+   {
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: PlugIn class.\n"
+             << "void load_library(void) method.\n"
+             << "Cannot load library " << library_file_name << ".\n";
+
+      throw std::logic_error(buffer.str());
+   }
+
+   FARPROC function = GetProcAddress(handle, evaluation_function_name.c_str());
+
+   if(!function)
+   {
+      FreeLibrary(handle);
+
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: PlugIn class.\n"
+             << "void load_library(void) method.\n"
+             << "Cannot find function " << evaluation_function_name << " in library " << library_file_name << ".\n";
+
+      throw std::logic_error(buffer.str());
+   }
+
+   library_handle = (void*)handle;
+   evaluation_function = (EvaluationFunction)function;
+
+   #else
+
+   void* handle = dlopen(library_file_name.c_str(), RTLD_NOW | RTLD_LOCAL);
+
+   if(!handle)
+   {
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: PlugIn class.\n"
+             << "void load_library(void) method.\n"
+             << "Cannot load library " << library_file_name << ": " << dlerror() << ".\n";
+
+      throw std::logic_error(buffer.str());
+   }
+
+   void* function = dlsym(handle, evaluation_function_name.c_str());
+
+   if(!function)
+   {
+      dlclose(handle);
+
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: PlugIn class.\n"
+             << "void load_library(void) method.\n"
+             << "Cannot find function " << evaluation_function_name << " in library " << library_file_name << ".\n";
+
+      throw std::logic_error(buffer.str());
+   }
+
+   library_handle = handle;
+   evaluation_function = (EvaluationFunction)function;
+
+   #endif
+}
+
+
+// void unload_library(void) method
+
+/// Unloads the shared library, if any, and clears the evaluation function. 
+
+void PlugIn::unload_library(void)
+{
+   if(library_handle)
+   {
+      #ifdef _WIN32
+
+      FreeLibrary((HMODULE)library_handle);
+
+      #else
+
+      dlclose(library_handle);
+
+      #endif
+   }
+
+   library_handle = NULL;
+   evaluation_function = NULL;
+}
+
+
+// Vector< Matrix<double> > calculate_batch_solutions(const Matrix<double>&) const method
+
+/// Evaluates the mathematical model in process for a batch of parameter sets, with a single call to the evaluation function. 
+/// It returns one solutions matrix, of output rows number times output columns number, per parameter set. 
+/// @param parameters_batch Matrix of parameters, with one row per parameter set. 
+
+Vector< Matrix<double> > PlugIn::calculate_batch_solutions(const Matrix<double>& parameters_batch) const
+{
+   if(!evaluation_function)
+   {
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: PlugIn class.\n"
+             << "Vector< Matrix<double> > calculate_batch_solutions(const Matrix<double>&) const method.\n"
+             << "Evaluation function is not set. Load a library or set a function first.\n";
+
+      throw std::logic_error(buffer.str());
+   }
+
+   if(output_rows_number == 0 || output_columns_number == 0)
+   {
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: PlugIn class.\n"
+             << "Vector< Matrix<double> > calculate_batch_solutions(const Matrix<double>&) const method.\n"
+             << "Number of output rows and columns must be greater than zero.\n";
+
+      throw std::logic_error(buffer.str());
+   }
+
+   const size_t batch_size = parameters_batch.get_rows_number();
+   const size_t parameters_number = parameters_batch.get_columns_number();
+
+   const size_t output_size = output_rows_number*output_columns_number;
+
+   // Row-major parameters
+
+   Vector<double> parameters(batch_size*parameters_number);
+
+   for(size_t i = 0; i < batch_size; i++)
+   {
+      for(size_t j = 0; j < parameters_number; j++)
+      {
+         parameters[i*parameters_number+j] = parameters_batch(i,j);
+      }
+   }
+
+   Vector<double> outputs(batch_size*output_size, 0.0);
+
+   const int status = evaluation_function(parameters.data(), parameters_number, batch_size, outputs.data(), output_rows_number, output_columns_number);
+
+   if(status != 0)
+   {
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: PlugIn class.\n"
+             << "Vector< Matrix<double> > calculate_batch_solutions(const Matrix<double>&) const method.\n"
+             << "Evaluation function returned error code " << status << ".\n";
+
+      throw std::logic_error(buffer.str());
+   }
+
+   Vector< Matrix<double> > solutions(batch_size);
 
-   run_script();
+   for(size_t k = 0; k < batch_size; k++)
+   {
+      solutions[k].set(output_rows_number, output_columns_number);
 
-   return(read_output_file());
+      for(size_t i = 0; i < output_rows_number; i++)
+      {
+         for(size_t j = 0; j < output_columns_number; j++)
+         {
+            solutions[k](i,j) = outputs[k*output_size + i*output_columns_number + j];
+         }
+      }
+   }
+
+   return(solutions);
 }
 
 
@@ -577,6 +1105,9 @@ std::string PlugIn::to_string(void) const
           << "Input flags: " << input_flags << "\n"
           << "Output rows number: " << output_rows_number << "\n"
           << "Output columns number: " <<  output_columns_number << "\n"
+          << "Evaluation method: " << write_evaluation_method() << "\n"
+          << "Library file_name: " << library_file_name << "\n"
+          << "Evaluation function name: " << evaluation_function_name << "\n"
           << "Display: " << display << "\n";
 
    return(buffer.str());
@@ -715,6 +1246,36 @@ tinyxml2::XMLDocument* PlugIn::to_XML(void) const
       output_columns_number_element->LinkEndChild(output_columns_number_text);
    }
 
+   // Evaluation method
+
+   {
+      tinyxml2::XMLElement* evaluation_method_element = document->NewElement("EvaluationMethod");
+      plug_in_element->LinkEndChild(evaluation_method_element);
+
+      tinyxml2::XMLText* evaluation_method_text = document->NewText(write_evaluation_method().c_str());
+      evaluation_method_element->LinkEndChild(evaluation_method_text);
+   }
+
+   // Library file name
+
+   {
+      tinyxml2::XMLElement* library_file_name_element = document->NewElement("LibraryFileName");
+      plug_in_element->LinkEndChild(library_file_name_element);
+
+      tinyxml2::XMLText* library_file_name_text = document->NewText(library_file_name.c_str());
+      library_file_name_element->LinkEndChild(library_file_name_text);
+   }
+
+   // Evaluation function name
+
+   {
+      tinyxml2::XMLElement* evaluation_function_name_element = document->NewElement("EvaluationFunctionName");
+      plug_in_element->LinkEndChild(evaluation_function_name_element);
+
+      tinyxml2::XMLText* evaluation_function_name_text = document->NewText(evaluation_function_name.c_str());
+      evaluation_function_name_element->LinkEndChild(evaluation_function_name_text);
+   }
+
    // Display
 
    {
@@ -735,14 +1296,27 @@ tinyxml2::XMLDocument* PlugIn::to_XML(void) const
 // void from_XML(const tinyxml2::XMLDocument&) method
 
 /// Deserializes a TinyXML document into this plug-in object.
+/// If the evaluation method is the shared library one, the library is loaded. 
 /// @param document XML document containing the member data.
-/// @todo
 
 void PlugIn::from_XML(const tinyxml2::XMLDocument& document)
 {
+   const tinyxml2::XMLElement* root_element = document.FirstChildElement("PlugIn");
+
+   if(!root_element)
+   {
+       std::ostringstream buffer;
+
+       buffer << "OpenNN Exception: PlugIn class.\n"
+              << "void from_XML(const tinyxml2::XMLDocument&) method.\n"
+              << "Unknown root element.\n";
+
+       throw std::logic_error(buffer.str());
+   }
+
   // Independent variables number
   {
-     const tinyxml2::XMLElement* element = document.FirstChildElement("IndependentVariablesNumber");
+     const tinyxml2::XMLElement* element = root_element->FirstChildElement("IndependentVariablesNumber");
 
      if(element)
      {
@@ -764,7 +1338,7 @@ void PlugIn::from_XML(const tinyxml2::XMLDocument& document)
 
   // Dependent variables number
   {
-     const tinyxml2::XMLElement* element = document.FirstChildElement("DependentVariablesNumber");
+     const tinyxml2::XMLElement* element = root_element->FirstChildElement("DependentVariablesNumber");
 
      if(element)
      {
@@ -786,7 +1360,7 @@ void PlugIn::from_XML(const tinyxml2::XMLDocument& document)
 
   // Input method
   {
-     const tinyxml2::XMLElement* input_method_element = document.FirstChildElement("InputMethod");
+     const tinyxml2::XMLElement* input_method_element = root_element->FirstChildElement("InputMethod");
 
      if(input_method_element)
      {
@@ -808,7 +1382,7 @@ void PlugIn::from_XML(const tinyxml2::XMLDocument& document)
 
   // Template file_name
   {
-     const tinyxml2::XMLElement* template_file_name_element = document.FirstChildElement("TemplateFileName");
+     const tinyxml2::XMLElement* template_file_name_element = root_element->FirstChildElement("TemplateFileName");
 
      if(template_file_name_element)
      {
@@ -830,7 +1404,7 @@ void PlugIn::from_XML(const tinyxml2::XMLDocument& document)
 
   // Input file_name
   {
-     const tinyxml2::XMLElement* input_file_name_element = document.FirstChildElement("InputFileName");
+     const tinyxml2::XMLElement* input_file_name_element = root_element->FirstChildElement("InputFileName");
 
      if(input_file_name_element)
      {
@@ -852,7 +1426,7 @@ void PlugIn::from_XML(const tinyxml2::XMLDocument& document)
 
   // Batch file_name
   {
-     const tinyxml2::XMLElement* script_file_name_element = document.FirstChildElement("BatchFileName");
+     const tinyxml2::XMLElement* script_file_name_element = root_element->FirstChildElement("BatchFileName");
 
      if(script_file_name_element)
      {
@@ -874,7 +1448,7 @@ void PlugIn::from_XML(const tinyxml2::XMLDocument& document)
 
   // Output file_name
   {
-     const tinyxml2::XMLElement* output_file_name_element = document.FirstChildElement("OutputFileName");
+     const tinyxml2::XMLElement* output_file_name_element = root_element->FirstChildElement("OutputFileName");
 
      if(output_file_name_element)
      {
@@ -919,9 +1493,119 @@ void PlugIn::from_XML(const tinyxml2::XMLDocument& document)
      }
   }
 */
+  // Output rows number
+  {
+     const tinyxml2::XMLElement* output_rows_number_element = root_element->FirstChildElement("OutputRowsNumber");
+
+     if(output_rows_number_element)
+     {
+        const char* output_rows_number_text = output_rows_number_element->GetText();
+
+        if(output_rows_number_text)
+        {
+           try
+           {
+              set_output_rows_number(atoi(output_rows_number_text));
+           }
+           catch(const std::logic_error& e)
+           {
+              std::cout << e.what() << std::endl;
+           }
+        }
+     }
+  }
+
+  // Output columns number
+  {
+     const tinyxml2::XMLElement* output_columns_number_element = root_element->FirstChildElement("OutputColumnsNumber");
+
+     if(output_columns_number_element)
+     {
+        const char* output_columns_number_text = output_columns_number_element->GetText();
+
+        if(output_columns_number_text)
+        {
+           try
+           {
+              set_output_columns_number(atoi(output_columns_number_text));
+           }
+           catch(const std::logic_error& e)
+           {
+              std::cout << e.what() << std::endl;
+           }
+        }
+     }
+  }
+
+  // Evaluation method
+  {
+     const tinyxml2::XMLElement* evaluation_method_element = root_element->FirstChildElement("EvaluationMethod");
+
+     if(evaluation_method_element)
+     {
+        const char* evaluation_method_text = evaluation_method_element->GetText();
+
+        if(evaluation_method_text)
+        {
+           try
+           {
+              set_evaluation_method(std::string(evaluation_method_text));
+           }
+           catch(const std::logic_error& e)
+           {
+              std::cout << e.what() << std::endl;
+           }
+        }
+     }
+  }
+
+  // Library file_name
+  {
+     const tinyxml2::XMLElement* library_file_name_element = root_element->FirstChildElement("LibraryFileName");
+
+     if(library_file_name_element)
+     {
+        const char* library_file_name_text = library_file_name_element->GetText();
+
+        if(library_file_name_text)
+        {
+           try
+           {
+              set_library_file_name(library_file_name_text);
+           }
+           catch(const std::logic_error& e)
+           {
+              std::cout << e.what() << std::endl;
+           }
+        }
+     }
+  }
+
+  // Evaluation function name
+  {
+     const tinyxml2::XMLElement* evaluation_function_name_element = root_element->FirstChildElement("EvaluationFunctionName");
+
+     if(evaluation_function_name_element)
+     {
+        const char* evaluation_function_name_text = evaluation_function_name_element->GetText();
+
+        if(evaluation_function_name_text)
+        {
+           try
+           {
+              set_evaluation_function_name(evaluation_function_name_text);
+           }
+           catch(const std::logic_error& e)
+           {
+              std::cout << e.what() << std::endl;
+           }
+        }
+     }
+  }
+
   // Display
   {
-     const tinyxml2::XMLElement* display_element = document.FirstChildElement("Display");
+     const tinyxml2::XMLElement* display_element = root_element->FirstChildElement("Display");
 
      if(display_element)
      {
@@ -942,6 +1626,23 @@ void PlugIn::from_XML(const tinyxml2::XMLDocument& document)
         }
      }
   }
+
+  // Shared library
+
+  if(evaluation_method == SharedLibraryEvaluation && !library_file_name.empty())
+  {
+     try
+     {
+        load_library();
+     }
+     catch(const std::logic_error& e)
+     {
+        if(display)
+        {
+           std::cout << e.what() << std::endl;
+        }
+     }
+  }
 }
 
 }
@@ -50,6 +50,10 @@ public:
 
    explicit PlugIn(const tinyxml2::XMLDocument&);
 
+   // COPY CONSTRUCTOR
+
+   PlugIn(const PlugIn&);
+
    // DESTRUCTOR
 
    virtual ~PlugIn(void);
@@ -60,6 +64,18 @@ public:
 
    enum InputMethod{IndependentParametersInput};
 
+   /// Enumeration of available methods for evaluating the mathematical model. 
+
+   enum EvaluationMethod{ScriptEvaluation, SharedLibraryEvaluation};
+
+   /// Signature of the C function which evaluates the mathematical model in process. 
+   /// Its arguments are the parameter sets (batch size rows times parameters number columns, in row-major order), the parameters number, 
+   /// the batch size, the outputs (one output rows number times output columns number row-major matrix per parameter set), 
+   /// the output rows number and the output columns number. 
+   /// It must return zero on success. 
+
+   typedef int (*EvaluationFunction)(const double*, size_t, size_t, double*, size_t, size_t);
+
    // ASSIGNMENT OPERATOR
 
    PlugIn& operator = (const PlugIn&);
@@ -85,6 +101,19 @@ public:
    const Vector<std::string>& get_input_flags(void) const;
    const std::string& get_input_flag(const size_t&) const;
 
+   const EvaluationMethod& get_evaluation_method(void) const;
+   std::string write_evaluation_method(void) const;
+
+   const std::string& get_library_file_name(void) const;
+   const std::string& get_evaluation_function_name(void) const;
+
+   const size_t& get_output_rows_number(void) const;
+   const size_t& get_output_columns_number(void) const;
+
+   bool has_evaluation_function(void) const;
+
+   bool is_thread_safe(void) const;
+
    // Set methods
 
    void set_default(void);
@@ -101,6 +130,17 @@ public:
 
    void set_input_flags(const Vector<std::string>&);
 
+   void set_evaluation_method(const EvaluationMethod&);
+   void set_evaluation_method(const std::string&);
+
+   void set_library_file_name(const std::string&);
+   void set_evaluation_function_name(const std::string&);
+
+   void set_evaluation_function(EvaluationFunction);
+
+   void set_output_rows_number(const size_t&);
+   void set_output_columns_number(const size_t&);
+
    // Plug-In methods
 
    void write_input_file(const NeuralNetwork&) const;
@@ -114,6 +154,13 @@ public:
 
    Matrix<double> calculate_solutions(const NeuralNetwork&) const;
 
+   // Shared library methods
+
+   void load_library(void);
+   void unload_library(void);
+
+   Vector< Matrix<double> > calculate_batch_solutions(const Matrix<double>&) const;
+
    // Serialization methods
 
    std::string to_string(void) const;
@@ -157,6 +204,26 @@ private:
    /// Number of columns in the output file. 
 
    size_t output_columns_number;
+
+   /// Method for evaluating the mathematical model (external script or shared library). 
+
+   EvaluationMethod evaluation_method;
+
+   /// Name of the shared library which exports the evaluation function. 
+
+   std::string library_file_name;
+
+   /// Name of the evaluation function exported by the shared library. 
+
+   std::string evaluation_function_name;
+
+   /// Handle to the loaded shared library. 
+
+   void* library_handle;
+
+   /// Pointer to the function which evaluates the mathematical model in process. 
+
+   EvaluationFunction evaluation_function;
 };
 
 }
@@ -448,7 +448,7 @@ void ProbabilisticLayer::initialize_random(void)
 {
     // Probabilistic method
 
-    switch(rand()%5)
+    switch(calculate_random_index(5))
     {
         case 0:
         {
@@ -721,6 +721,79 @@ Vector< Matrix<double> > ProbabilisticLayer::calculate_Hessian_form(const Vector
 }
 
 
+// Matrix<float> calculate_outputs(const Matrix<float>&) const method
+
+/// Processes a batch of inputs to the probabilistic layer in single precision.
+/// The probability and no probabilistic methods are the identity.
+/// The binary method is applied elementwise, and the competitive and softmax methods are applied to each row
+/// with the double precision outputs, so that they normalize in the same way.
+/// @param inputs Matrix of inputs, with the instances in the rows and the probabilistic neurons in the columns. 
+
+Matrix<float> ProbabilisticLayer::calculate_outputs(const Matrix<float>& inputs) const
+{
+   const size_t rows_number = inputs.get_rows_number();
+   const size_t columns_number = inputs.get_columns_number();
+
+   // Control sentence (if debug)
+
+   #ifdef __OPENNN_DEBUG__ 
+
+   if(columns_number != probabilistic_neurons_number) 
+   {
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: ProbabilisticLayer class.\n"
+             << "Matrix<float> calculate_outputs(const Matrix<float>&) const method.\n"
+             << "Number of columns must be equal to number of probabilistic neurons.\n";
+
+	  throw std::logic_error(buffer.str());
+   }   
+
+   #endif
+
+   if(probabilistic_method == Probability || probabilistic_method == NoProbabilistic)
+   {
+      return(inputs);
+   }
+
+   Matrix<float> outputs(rows_number, columns_number);
+
+   if(probabilistic_method == Binary)
+   {
+      const float threshold = (float)decision_threshold;
+
+      for(size_t j = 0; j < columns_number; j++)
+      {
+         for(size_t i = 0; i < rows_number; i++)
+         {
+            outputs(i,j) = inputs(i,j) < threshold ? 0.0f : 1.0f;
+         }
+      }
+
+      return(outputs);
+   }
+
+   Vector<double> row(columns_number);
+
+   for(size_t i = 0; i < rows_number; i++)
+   {
+      for(size_t j = 0; j < columns_number; j++)
+      {
+         row[j] = inputs(i,j);
+      }
+
+      const Vector<double> row_outputs = calculate_outputs(row);
+
+      for(size_t j = 0; j < columns_number; j++)
+      {
+         outputs(i,j) = (float)row_outputs[j];
+      }
+   }
+
+   return(outputs);
+}
+
+
 // Vector<double> calculate_binary_output(const Vector<double>&) const method
 
 /// Returns the output value from this layer as a binary value (0 or 1).
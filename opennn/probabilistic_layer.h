@@ -117,6 +117,7 @@ public:
    // Probabilistic post-processing
 
    Vector<double> calculate_outputs(const Vector<double>&) const;
+   Matrix<float> calculate_outputs(const Matrix<float>&) const;
    Matrix<double> calculate_Jacobian(const Vector<double>&) const;
    Vector< Matrix<double> > calculate_Hessian_form(const Vector<double>&) const;
 
@@ -1504,6 +1504,84 @@ void QuasiNewtonMethod::QuasiNewtonMethodResults::resize_training_history(const
 }
 
 
+// void arrange_training_history(const size_t&) method
+
+/// Sorts the reserved training history variables in chronological order and removes their unused records,
+/// once the training process has finished.
+/// @param iteration Last iteration of the training process.
+
+void QuasiNewtonMethod::QuasiNewtonMethodResults::arrange_training_history(const size_t& iteration)
+{
+    // Control sentence (if debug)
+
+    #ifdef __OPENNN_DEBUG__
+
+    if(quasi_Newton_method_pointer == NULL)
+    {
+       std::ostringstream buffer;
+
+       buffer << "OpenNN Exception: QuasiNewtonMethodResults structure.\n"
+              << "void arrange_training_history(const size_t&) method.\n"
+              << "Quasi-Newton method pointer is NULL.\n";
+
+       throw std::logic_error(buffer.str());
+    }
+
+    #endif
+
+   if(quasi_Newton_method_pointer->get_reserve_parameters_history())
+   {
+      quasi_Newton_method_pointer->arrange_history(parameters_history, iteration);
+   }
+
+   if(quasi_Newton_method_pointer->get_reserve_parameters_norm_history())
+   {
+      quasi_Newton_method_pointer->arrange_history(parameters_norm_history, iteration);
+   }
+
+
+   if(quasi_Newton_method_pointer->get_reserve_performance_history())
+   {
+      quasi_Newton_method_pointer->arrange_history(performance_history, iteration);
+   }
+
+   if(quasi_Newton_method_pointer->get_reserve_selection_performance_history())
+   {
+      quasi_Newton_method_pointer->arrange_history(selection_performance_history, iteration);
+   }
+
+   if(quasi_Newton_method_pointer->get_reserve_gradient_history())
+   {
+      quasi_Newton_method_pointer->arrange_history(gradient_history, iteration);
+   }
+
+   if(quasi_Newton_method_pointer->get_reserve_gradient_norm_history())
+   {
+      quasi_Newton_method_pointer->arrange_history(gradient_norm_history, iteration);
+   }
+
+   if(quasi_Newton_method_pointer->get_reserve_inverse_Hessian_history())
+   {
+      quasi_Newton_method_pointer->arrange_history(inverse_Hessian_history, iteration);
+   }
+   
+   if(quasi_Newton_method_pointer->get_reserve_training_direction_history())
+   {
+      quasi_Newton_method_pointer->arrange_history(training_direction_history, iteration);
+   }
+
+   if(quasi_Newton_method_pointer->get_reserve_training_rate_history())
+   {
+      quasi_Newton_method_pointer->arrange_history(training_rate_history, iteration);
+   }
+
+   if(quasi_Newton_method_pointer->get_reserve_elapsed_time_history())
+   {
+      quasi_Newton_method_pointer->arrange_history(elapsed_time_history, iteration);
+   }
+}
+
+
 // std::string to_string(void) const method
 
 /// Returns a string representation of the current quasi-Newton method results structure. 
@@ -1723,7 +1801,9 @@ QuasiNewtonMethod::QuasiNewtonMethodResults* QuasiNewtonMethod::perform_training
 
    QuasiNewtonMethodResults* results_pointer = new QuasiNewtonMethodResults(this);
 
-   results_pointer->resize_training_history(1+maximum_iterations_number);
+   results_pointer->resize_training_history(calculate_history_size(1+maximum_iterations_number));
+
+   open_history_file();
 
    // Neural network stuff
 
@@ -1781,9 +1861,46 @@ QuasiNewtonMethod::QuasiNewtonMethodResults* QuasiNewtonMethod::perform_training
 
    size_t iteration;
 
+   // Resume from checkpoint
+
+   size_t first_iteration = 0;
+   double initial_elapsed_time = 0.0;
+
+   if(resume_checkpoint_pointer)
+   {
+      Vector<size_t> vectors_sizes(3, parameters_number);
+      vectors_sizes[2] = parameters_number*parameters_number;
+
+      check_resume_checkpoint(3, vectors_sizes);
+
+      first_iteration = resume_checkpoint_pointer->iteration;
+      initial_elapsed_time = resume_checkpoint_pointer->elapsed_time;
+
+      selection_failures = resume_checkpoint_pointer->selection_failures;
+      old_performance = resume_checkpoint_pointer->old_performance;
+      old_selection_performance = resume_checkpoint_pointer->old_selection_performance;
+
+      directional_point[0] = resume_checkpoint_pointer->scalars[0];
+      directional_point[1] = resume_checkpoint_pointer->scalars[1];
+      old_training_rate = resume_checkpoint_pointer->scalars[2];
+
+      old_parameters = resume_checkpoint_pointer->vectors[0];
+      old_gradient = resume_checkpoint_pointer->vectors[1];
+
+      std::copy(resume_checkpoint_pointer->vectors[2].begin(), resume_checkpoint_pointer->vectors[2].end(), old_inverse_Hessian.begin());
+
+      neural_network_pointer->set_parameters(resume_checkpoint_pointer->parameters);
+   }
+
+   history_first_iteration = first_iteration;
+
+   TrainingCheckpoint checkpoint;
+
+   checkpoint.training_algorithm_type = write_training_algorithm_type();
+
    // Main loop 
 
-   for(iteration = 0; iteration <= maximum_iterations_number; iteration++)
+   for(iteration = first_iteration; iteration <= maximum_iterations_number; iteration++)
    {
       // Neural network
 
@@ -1885,60 +2002,60 @@ QuasiNewtonMethod::QuasiNewtonMethodResults* QuasiNewtonMethod::perform_training
       // Elapsed time
 
       time(&current_time);
-      elapsed_time = difftime(current_time, beginning_time);
+      elapsed_time = difftime(current_time, beginning_time) + initial_elapsed_time;
 
       // Training history neural neural network
 
       if(reserve_parameters_history)
       {
-         results_pointer->parameters_history[iteration] = parameters;                                
+         record_history(results_pointer->parameters_history, "parameters", iteration, parameters);                                
       }
 
       if(reserve_parameters_norm_history)
       {
-         results_pointer->parameters_norm_history[iteration] = parameters_norm; 
+         record_history(results_pointer->parameters_norm_history, "parameters_norm", iteration, parameters_norm); 
       }
 
       if(reserve_performance_history)
       {
-         results_pointer->performance_history[iteration] = performance;
+         record_history(results_pointer->performance_history, "performance", iteration, performance);
       }
 
       if(reserve_selection_performance_history)
       {
-         results_pointer->selection_performance_history[iteration] = selection_performance;
+         record_history(results_pointer->selection_performance_history, "selection_performance", iteration, selection_performance);
       }
 
       if(reserve_gradient_history)
       {
-         results_pointer->gradient_history[iteration] = gradient;                                
+         record_history(results_pointer->gradient_history, "gradient", iteration, gradient);                                
       }
 
       if(reserve_gradient_norm_history)
       {
-         results_pointer->gradient_norm_history[iteration] = gradient_norm;
+         record_history(results_pointer->gradient_norm_history, "gradient_norm", iteration, gradient_norm);
       }
 
       if(reserve_inverse_Hessian_history)
       {
-         results_pointer->inverse_Hessian_history[iteration] = inverse_Hessian;
+         record_history(results_pointer->inverse_Hessian_history, "inverse_Hessian", iteration, inverse_Hessian);
       }
 
       // Training history training algorithm
 
       if(reserve_training_direction_history)
       {
-         results_pointer->training_direction_history[iteration] = training_direction;                                
+         record_history(results_pointer->training_direction_history, "training_direction", iteration, training_direction);                                
       }
 
       if(reserve_training_rate_history)
       {
-         results_pointer->training_rate_history[iteration] = training_rate;
+         record_history(results_pointer->training_rate_history, "training_rate", iteration, training_rate);
       }
 
       if(reserve_elapsed_time_history)
       {
-         results_pointer->elapsed_time_history[iteration] = elapsed_time;
+         record_history(results_pointer->elapsed_time_history, "elapsed_time", iteration, elapsed_time);
       }
 
       // Stopping Criteria
@@ -2038,8 +2155,6 @@ QuasiNewtonMethod::QuasiNewtonMethodResults* QuasiNewtonMethod::perform_training
 
          results_pointer->iterations_number = iteration;
 
-		 results_pointer->resize_training_history(iteration+1);
-
          if(display)
 		 {
             std::cout << "Parameters norm: " << parameters_norm << "\n"
@@ -2093,6 +2208,27 @@ QuasiNewtonMethod::QuasiNewtonMethodResults* QuasiNewtonMethod::perform_training
 
       neural_network_pointer->set_parameters(parameters);
 
+      // Checkpoint
+
+      if(checkpoint_period != 0 && (iteration+1) % checkpoint_period == 0)
+      {
+         checkpoint.iteration = iteration+1;
+         checkpoint.elapsed_time = elapsed_time;
+         checkpoint.selection_failures = selection_failures;
+         checkpoint.old_performance = old_performance;
+         checkpoint.old_selection_performance = old_selection_performance;
+         checkpoint.parameters = parameters;
+         checkpoint.scalars.set(3);
+         checkpoint.scalars[0] = directional_point[0];
+         checkpoint.scalars[1] = directional_point[1];
+         checkpoint.scalars[2] = old_training_rate;
+         checkpoint.vectors.set(3);
+         checkpoint.vectors[0] = old_parameters;
+         checkpoint.vectors[1] = old_gradient;
+         checkpoint.vectors[2] = old_inverse_Hessian.to_vector();
+
+         write_checkpoint(checkpoint);
+      }
    }
 
    results_pointer->final_parameters = parameters;
@@ -2110,7 +2246,7 @@ QuasiNewtonMethod::QuasiNewtonMethodResults* QuasiNewtonMethod::perform_training
 
    results_pointer->iterations_number = iteration;
 
-   results_pointer->resize_training_history(iteration+1);
+   results_pointer->arrange_training_history(iteration);
 
    if(display)
    {
@@ -2127,6 +2263,10 @@ QuasiNewtonMethod::QuasiNewtonMethodResults* QuasiNewtonMethod::perform_training
       }
    }
 
+   close_history_file();
+
+   wait_checkpoint();
+
    return(results_pointer);
 }
 
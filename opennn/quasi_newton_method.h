@@ -203,6 +203,7 @@ public:
       void set_quasi_Newton_method_pointer(QuasiNewtonMethod*);
 
       void resize_training_history(const size_t&);
+      void arrange_training_history(const size_t&);
 
       std::string to_string(void) const;
 
@@ -242,12 +242,23 @@ const size_t& RandomSearch::get_training_rate_reduction_period(void) const
 }
 
 
+// const size_t& get_candidates_number(void) const method
+
+/// Returns the number of random candidates which are evaluated together at each iteration.
+
+const size_t& RandomSearch::get_candidates_number(void) const
+{
+   return(candidates_number);
+}
+
+
 // void set_default(void) method
 
 /// Sets all the random search object members to their default values:
 /// <ul>
 /// <li> Training rate reduction factor: 0.9
 /// <li> Training rate reduction period: 10
+/// <li> Candidates number: 1
 /// <li> Warning parameters norm: 1.0e6
 /// <li> Error parameters norm: 1.0e9
 /// <li> Performance goal: -1.0e99
@@ -269,6 +280,8 @@ void RandomSearch::set_default(void)
    training_rate_reduction_factor = 0.9;
    training_rate_reduction_period = 10;
 
+   candidates_number = 1;
+
    // STOPPING CRITERIA
 
    performance_goal = -1.0e99;
@@ -334,6 +347,30 @@ void RandomSearch::set_training_rate_reduction_period(const size_t& new_training
 }
 
 
+// void set_candidates_number(const size_t&) method
+
+/// Sets the number of random candidates which are generated and evaluated together at each iteration.
+/// With more than one candidate, the performances of the candidates are computed in parallel,
+/// and the best candidate is the one compared with the current parameters.
+/// @param new_candidates_number Number of candidates per iteration. It must be greater than zero.
+
+void RandomSearch::set_candidates_number(const size_t& new_candidates_number)
+{
+   if(new_candidates_number == 0)
+   {
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: RandomSearch class.\n"
+             << "void set_candidates_number(const size_t&) method.\n"
+             << "Number of candidates must be greater than zero.\n";
+
+      throw std::logic_error(buffer.str());
+   }
+
+   candidates_number = new_candidates_number;
+}
+
+
 // void set_reserve_parameters_history(bool) method
 
 /// Makes the potential parameters history vector of vectors to be reseved or not in memory.
@@ -694,6 +731,40 @@ Vector<double> RandomSearch::calculate_training_direction(void) const
 }
 
 
+// Vector<double> calculate_candidates_performance(const Vector< Vector<double> >&) const method
+
+/// Returns the performance of a batch of candidate parameter vectors.
+/// The candidates are independent, so they are evaluated in parallel, each through its own parameters vector,
+/// and the parameters of the neural network are not modified.
+/// They are evaluated sequentially if the mathematical model is not thread safe, such as a plug-in which runs a script. 
+/// @param candidates Vector of candidate parameter vectors.
+
+Vector<double> RandomSearch::calculate_candidates_performance(const Vector< Vector<double> >& candidates) const
+{
+   const size_t candidates_size = candidates.size();
+
+   Vector<double> performances(candidates_size);
+
+   int i = 0;
+
+#ifdef _OPENMP
+
+   const bool thread_safe = !performance_functional_pointer->has_mathematical_model()
+                         || performance_functional_pointer->get_mathematical_model_pointer()->is_thread_safe();
+
+   #pragma omp parallel for private(i) if(thread_safe)
+
+#endif
+
+   for(i = 0; i < (int)candidates_size; i++)
+   {
+      performances[i] = performance_functional_pointer->calculate_performance(candidates[i]);
+   }
+
+   return(performances);
+}
+
+
 // void resize_training_history(const size_t&) method
 
 /// Resizes all the training history variables. 
@@ -952,6 +1023,10 @@ RandomSearch::RandomSearchResults* RandomSearch::perform_training(void)
    Vector<double> parameters_increment(parameters_number);
 //   double parameters_increment_norm;
 
+   Vector< Vector<double> > candidates_directions(candidates_number);
+   Vector< Vector<double> > candidates(candidates_number);
+   Vector<double> candidates_performance(candidates_number);
+
    bool stop_training = false;
 
    // Main loop 
@@ -981,21 +1056,44 @@ RandomSearch::RandomSearchResults* RandomSearch::perform_training(void)
          selection_failures++;
       }
 
-      potential_performance = performance_functional_pointer->calculate_performance(potential_parameters);
-
       // Training algorithm stuff
 
-      training_direction = calculate_training_direction();
-  
       if(iteration != 0 && iteration%training_rate_reduction_period == 0)
       {
          training_rate *= training_rate_reduction_factor; 
       }       
 
-      parameters_increment = training_direction*training_rate;
-//      parameters_increment_norm = parameters_increment.calculate_norm();
+      if(candidates_number == 1)
+      {
+         training_direction = calculate_training_direction();
+
+         parameters_increment = training_direction*training_rate;
+//         parameters_increment_norm = parameters_increment.calculate_norm();
+
+         potential_parameters = parameters + parameters_increment;
+
+         potential_performance = performance_functional_pointer->calculate_performance(potential_parameters);
+      }
+      else
+      {
+         for(size_t i = 0; i < candidates_number; i++)
+         {
+            candidates_directions[i] = calculate_training_direction();
+
+            candidates[i] = parameters + candidates_directions[i]*training_rate;
+         }
+
+         candidates_performance = calculate_candidates_performance(candidates);
+
+         const size_t best_candidate = candidates_performance.calculate_minimal_index();
+
+         training_direction = candidates_directions[best_candidate];
+
+         potential_parameters = candidates[best_candidate];
+
+         potential_performance = candidates_performance[best_candidate];
+      }
 
-      potential_parameters = parameters + parameters_increment;
       potential_parameters_norm = potential_parameters.calculate_norm();
 
       time(&current_time);
@@ -1178,6 +1276,15 @@ Matrix<std::string> RandomSearch::to_string_matrix(void) const
     Vector<std::string> labels;
     Vector<std::string> values;
 
+   // Candidates number
+
+   labels.push_back("Candidates number");
+
+   buffer.str("");
+   buffer << candidates_number;
+
+   values.push_back(buffer.str());
+
    // Performance goal
 
    labels.push_back("Performance goal");
@@ -1322,6 +1429,18 @@ tinyxml2::XMLDocument* RandomSearch::to_XML(void) const
    element->LinkEndChild(text);
    }
 
+   // Candidates number
+   {
+   element = document->NewElement("CandidatesNumber");
+   root_element->LinkEndChild(element);
+
+   buffer.str("");
+   buffer << candidates_number;
+
+   text = document->NewText(buffer.str().c_str());
+   element->LinkEndChild(text);
+   }
+
    // First training rate
    {
    element = document->NewElement("FirstTrainingRate");
@@ -1628,6 +1747,25 @@ void RandomSearch::from_XML(const tinyxml2::XMLDocument& document)
         }
     }
 
+    // Candidates number
+    {
+        const tinyxml2::XMLElement* element = root_element->FirstChildElement("CandidatesNumber");
+
+        if(element)
+        {
+           const size_t new_candidates_number = atoi(element->GetText());
+
+           try
+           {
+              set_candidates_number(new_candidates_number);
+           }
+           catch(const std::logic_error& e)
+           {
+              std::cout << e.what() << std::endl;
+           }
+        }
+    }
+
    // Warning parameters norm
    {
        const tinyxml2::XMLElement* element = root_element->FirstChildElement("WarningParametersNorm");
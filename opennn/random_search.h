@@ -184,6 +184,8 @@ public:
    const double& get_training_rate_reduction_factor(void) const;
    const size_t& get_training_rate_reduction_period(void) const;
 
+   const size_t& get_candidates_number(void) const;
+
    const bool& get_reserve_parameters_history(void) const;
    const bool& get_reserve_parameters_norm_history(void) const;
 
@@ -221,6 +223,8 @@ public:
    void set_training_rate_reduction_factor(const double&);
    void set_training_rate_reduction_period(const size_t&);
 
+   void set_candidates_number(const size_t&);
+
    void set_reserve_parameters_history(const bool&);
    void set_reserve_parameters_norm_history(const bool&);
 
@@ -263,6 +267,8 @@ public:
 
    Vector<double> calculate_training_direction(void) const;
 
+   Vector<double> calculate_candidates_performance(const Vector< Vector<double> >&) const;
+
    RandomSearchResults* perform_training(void);
 
    std::string write_training_algorithm_type(void) const;
@@ -293,6 +299,11 @@ private:
 
    size_t training_rate_reduction_period;
 
+   /// Number of random candidates generated and evaluated together at each iteration.
+   /// The best of them is compared with the current parameters.
+
+   size_t candidates_number;
+
    /// Value for the parameters norm at which a warning message is written to the screen. 
 
    double warning_parameters_norm;
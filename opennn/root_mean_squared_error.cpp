@@ -211,21 +211,10 @@ double RootMeanSquaredError::calculate_performance(void) const
 
    // Data set stuff
 
-   const Matrix<double>& data = data_set_pointer->get_data();
-
    const Instances& instances = data_set_pointer->get_instances();
 
    const size_t training_instances_number = instances.count_training_instances_number();
 
-   const Vector<size_t> training_indices = instances.arrange_training_indices();
-
-   size_t training_index;
-
-   const Variables& variables = data_set_pointer->get_variables();
-
-   const Vector<size_t> inputs_indices = variables.arrange_inputs_indices();
-   const Vector<size_t> targets_indices = variables.arrange_targets_indices();
-
    // Root mean squared error
 
    Vector<double> inputs(inputs_number);
@@ -236,15 +225,13 @@ double RootMeanSquaredError::calculate_performance(void) const
 
    int i = 0;
 
-   #pragma omp parallel for private(i, training_index, inputs, outputs, targets) reduction(+:sum_squared_error)
+   #pragma omp parallel for private(i, inputs, outputs, targets) reduction(+:sum_squared_error)
 
    for(i = 0; i < (int)training_instances_number; i++)
    {
-       training_index = training_indices[i];
-
       // Input vector
 
-      inputs = data_set_pointer->get_instance(training_index, inputs_indices);
+      data_set_pointer->get_training_inputs(i, inputs);
 
       // Output vector
 
@@ -252,12 +239,11 @@ double RootMeanSquaredError::calculate_performance(void) const
 
       // Target vector
 
-//      targets = data_set_pointer->get_instance(training_index, targets_indices);
+      data_set_pointer->get_training_targets(i, targets);
 
       // Sum squaresd error
 
-//	  sum_squared_error += outputs.calculate_sum_squared_error(targets);
-      sum_squared_error += outputs.calculate_sum_squared_error(data, training_index, targets_indices);
+      sum_squared_error += outputs.calculate_sum_squared_error(targets);
 
    }
 
@@ -314,15 +300,6 @@ double RootMeanSquaredError::calculate_performance(const Vector<double>& paramet
 
    const size_t training_instances_number = instances.count_training_instances_number();
 
-   const Vector<size_t> training_indices = instances.arrange_training_indices();
-
-   size_t training_index;
-
-   const Variables& variables = data_set_pointer->get_variables();
-
-   const Vector<size_t> inputs_indices = variables.arrange_inputs_indices();
-   const Vector<size_t> targets_indices = variables.arrange_targets_indices();
-
    // Root mean squared error
 
    Vector<double> inputs(inputs_number);
@@ -333,15 +310,13 @@ double RootMeanSquaredError::calculate_performance(const Vector<double>& paramet
 
    int i = 0;
 
-   #pragma omp parallel for private(i, training_index, inputs, outputs, targets) reduction(+:sum_squared_error)
+   #pragma omp parallel for private(i, inputs, outputs, targets) reduction(+:sum_squared_error)
 
    for(i = 0; i < (int)training_instances_number; i++)
    {
-       training_index = training_indices[i];
-
       // Input vector
 
-      inputs = data_set_pointer->get_instance(training_index, inputs_indices);
+      data_set_pointer->get_training_inputs(i, inputs);
 
       // Output vector
 
@@ -349,7 +324,7 @@ double RootMeanSquaredError::calculate_performance(const Vector<double>& paramet
 
       // Target vector
 
-      targets = data_set_pointer->get_instance(training_index, targets_indices);
+      data_set_pointer->get_training_targets(i, targets);
 
       // Sum squaresd error
 
@@ -402,15 +377,6 @@ Vector<double> RootMeanSquaredError::calculate_gradient(void) const
 
    const size_t training_instances_number = instances.count_training_instances_number();
 
-   const Vector<size_t> training_indices = instances.arrange_training_indices();
-
-   size_t training_index;
-
-   const Variables& variables = data_set_pointer->get_variables();
-
-   const Vector<size_t> inputs_indices = variables.arrange_inputs_indices();
-   const Vector<size_t> targets_indices = variables.arrange_targets_indices();
-
    Vector<double> inputs(inputs_number);
    Vector<double> targets(outputs_number);
 
@@ -430,16 +396,14 @@ Vector<double> RootMeanSquaredError::calculate_gradient(void) const
 
    int i = 0;
 
-   #pragma omp parallel for private(i, training_index, inputs, targets, first_order_forward_propagation, output_gradient, \
+   #pragma omp parallel for private(i, inputs, targets, first_order_forward_propagation, output_gradient, \
     layers_delta, particular_solution, homogeneous_solution, point_gradient)
 
    for(i = 0; i < (int)training_instances_number; i++)
    {
-       training_index = training_indices[i];
-
-      inputs = data_set_pointer->get_instance(training_index, inputs_indices);
+      data_set_pointer->get_training_inputs(i, inputs);
 
-      targets = data_set_pointer->get_instance(training_index, targets_indices);
+      data_set_pointer->get_training_targets(i, targets);
 
       first_order_forward_propagation = multilayer_perceptron_pointer->calculate_first_order_forward_propagation(inputs);
 
@@ -504,15 +468,6 @@ double RootMeanSquaredError::calculate_selection_performance(void) const
       return(0.0);
    }
 
-   const Vector<size_t> selection_indices = instances.arrange_selection_indices();
-
-   size_t selection_index;
-
-   const Variables& variables = data_set_pointer->get_variables();
-
-   const Vector<size_t> inputs_indices = variables.arrange_inputs_indices();
-   const Vector<size_t> targets_indices = variables.arrange_targets_indices();
-
    Vector<double> inputs(inputs_number);
    Vector<double> outputs(outputs_number);
    Vector<double> targets(outputs_number);
@@ -521,15 +476,13 @@ double RootMeanSquaredError::calculate_selection_performance(void) const
 
    double selection_performance = 0.0;
 
-   #pragma omp parallel for private(i, selection_index, inputs, outputs, targets) reduction(+ : selection_performance)
+   #pragma omp parallel for private(i, inputs, outputs, targets) reduction(+ : selection_performance)
 
    for(i = 0; i < (int)selection_instances_number; i++)
    {
-       selection_index = selection_indices[i];
-
       // Input vector
 
-      inputs = data_set_pointer->get_instance(selection_index, inputs_indices);
+      data_set_pointer->get_selection_inputs(i, inputs);
 
       // Output vector
 
@@ -537,7 +490,7 @@ double RootMeanSquaredError::calculate_selection_performance(void) const
 
       // Target vector
 
-      targets = data_set_pointer->get_instance(selection_index, targets_indices);
+      data_set_pointer->get_selection_targets(i, targets);
 
       // Sum of squares error
 
@@ -670,7 +670,7 @@ void ScalingLayer::initialize_random(void)
 
     // Unscaling method
 
-    switch(rand()%2)
+    switch(calculate_random_index(2))
     {
       case 0:
       {
@@ -766,6 +766,80 @@ Vector<double> ScalingLayer::calculate_outputs(const Vector<double>& inputs) con
 }  
 
 
+// Matrix<float> calculate_outputs(const Matrix<float>&) const method
+
+/// Scales a batch of inputs in single precision with the scaling method of the layer.
+/// Each column is scaled with the same statistics and the same rule for constant variables as the double precision outputs. 
+/// @param inputs Matrix of inputs, with the instances in the rows and the scaling neurons in the columns. 
+
+Matrix<float> ScalingLayer::calculate_outputs(const Matrix<float>& inputs) const
+{
+   const size_t rows_number = inputs.get_rows_number();
+   const size_t scaling_neurons_number = get_scaling_neurons_number();
+
+   // Control sentence (if debug)
+
+   #ifdef __OPENNN_DEBUG__ 
+
+   if(inputs.get_columns_number() != scaling_neurons_number) 
+   {
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: ScalingLayer class.\n"
+             << "Matrix<float> calculate_outputs(const Matrix<float>&) const method.\n"
+             << "Number of columns of inputs must be equal to number of scaling neurons.\n";
+
+	  throw std::logic_error(buffer.str());
+   }   
+
+   #endif
+
+   if(scaling_method == NoScaling)
+   {
+      return(inputs);
+   }
+
+   if(scaling_method != MinimumMaximum && scaling_method != MeanStandardDeviation)
+   {
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: ScalingLayer class\n"
+             << "Matrix<float> calculate_outputs(const Matrix<float>&) const method.\n"
+             << "Unknown scaling and unscaling method.\n";
+
+      throw std::logic_error(buffer.str());
+   }
+
+   Matrix<float> outputs(inputs);
+
+   for(size_t j = 0; j < scaling_neurons_number; j++)
+   {
+      float offset = 0.0f;
+      float factor = 1.0f;
+      float shift = 0.0f;
+
+      if(scaling_method == MinimumMaximum && statistics[j].maximum-statistics[j].minimum >= 1e-99)
+      {
+         offset = (float)statistics[j].minimum;
+         factor = (float)(2.0/(statistics[j].maximum-statistics[j].minimum));
+         shift = -1.0f;
+      }
+      else if(scaling_method == MeanStandardDeviation && statistics[j].standard_deviation >= 1e-99)
+      {
+         offset = (float)statistics[j].mean;
+         factor = (float)(1.0/statistics[j].standard_deviation);
+      }
+
+      for(size_t i = 0; i < rows_number; i++)
+      {
+         outputs(i,j) = (inputs(i,j) - offset)*factor + shift;
+      }
+   }
+
+   return(outputs);
+}
+
+
 // Vector<double> calculate_derivatives(const Vector<double>&) const method
 
 /// This method retuns the derivatives of the scaled inputs with respect to the raw inputs.
@@ -149,6 +149,7 @@ public:
    void check_range(const Vector<double>&) const;
 
    Vector<double> calculate_outputs(const Vector<double>&) const;
+   Matrix<float> calculate_outputs(const Matrix<float>&) const;
    Vector<double> calculate_derivatives(const Vector<double>&) const;
    Vector<double> calculate_second_derivatives(const Vector<double>&) const;
 
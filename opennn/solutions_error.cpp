@@ -126,6 +126,7 @@ SolutionsError::SolutionsError(const SolutionsError& other_solutions_error)
 
     solutions_errors_weights = other_solutions_error.solutions_errors_weights;
 
+    evaluation_independent_variables = other_solutions_error.evaluation_independent_variables;
 }
 
 
@@ -160,6 +161,7 @@ SolutionsError& SolutionsError::operator = (const SolutionsError& other_solution
 
 	  solutions_error_method = other_solutions_error.solutions_error_method;
       solutions_errors_weights = other_solutions_error.solutions_errors_weights;
+      evaluation_independent_variables = other_solutions_error.evaluation_independent_variables;
    }
 
    return(*this);
@@ -179,7 +181,8 @@ bool SolutionsError::operator == (const SolutionsError& other_solutions_error) c
    && *mathematical_model_pointer == *other_solutions_error.mathematical_model_pointer
    && *numerical_differentiation_pointer == *other_solutions_error.numerical_differentiation_pointer
    && display == other_solutions_error.display    
-   && solutions_errors_weights == other_solutions_error.solutions_errors_weights)
+   && solutions_errors_weights == other_solutions_error.solutions_errors_weights
+   && evaluation_independent_variables == other_solutions_error.evaluation_independent_variables)
    {
       return(true);
    }
@@ -249,6 +252,17 @@ const double& SolutionsError::get_solution_error_weight(const size_t& i) const
 }
 
 
+// const Vector<double>& get_evaluation_independent_variables(void) const method
+
+/// Returns the points of the independent variable at which the solutions error is evaluated. 
+/// If it is empty, all the points of the solution are used. 
+
+const Vector<double>& SolutionsError::get_evaluation_independent_variables(void) const
+{
+   return(evaluation_independent_variables);
+}
+
+
 // void set(const SolutionsError&) method
 
 // Sets to this object the data from another object of the same class.
@@ -335,6 +349,19 @@ void SolutionsError::set_solution_error_weight(const size_t& i, const double& ne
 }
 
 
+// void set_evaluation_independent_variables(const Vector<double>&) method
+
+/// Sets the points of the independent variable at which the solutions error is evaluated. 
+/// The mathematical model is then asked only for the solutions at those points, instead of at every integration step. 
+/// @param new_evaluation_independent_variables Sorted points of the independent variable. 
+/// An empty vector means that all the points of the solution are used. 
+
+void SolutionsError::set_evaluation_independent_variables(const Vector<double>& new_evaluation_independent_variables)
+{
+   evaluation_independent_variables = new_evaluation_independent_variables;
+}
+
+
 // void set_default(void) method
 
 /// Sets the default values for an object of the solutions error class:
@@ -488,12 +515,33 @@ double SolutionsError::calculate_solutions_error_sum(void) const
 
    #endif
 
+   return(calculate_solutions_error_sum(*neural_network_pointer));
+}
+
+
+// double calculate_solutions_error_sum(const NeuralNetwork&) const method
+
+/// Calculates the solutions error performance of a given neural network as the weighted mean squared error between 
+/// the solutions to the mathematical model and the target solutions. 
+/// @param neural_network Neural network whose solutions are evaluated.
+
+double SolutionsError::calculate_solutions_error_sum(const NeuralNetwork& neural_network) const   
+{
    const size_t independent_variables_number = mathematical_model_pointer->get_independent_variables_number();
    const size_t dependent_variables_number = mathematical_model_pointer->get_dependent_variables_number();
 
    const size_t variables_number = mathematical_model_pointer->count_variables_number();
 
-   const Matrix<double> solution = mathematical_model_pointer->calculate_solutions(*neural_network_pointer);    
+   Matrix<double> solution;
+
+   if(evaluation_independent_variables.empty())
+   {
+      solution = mathematical_model_pointer->calculate_solutions(neural_network);    
+   }
+   else
+   {
+      solution = mathematical_model_pointer->calculate_dense_solutions(neural_network, evaluation_independent_variables);
+   }
 
    const Vector<size_t> independent_variables_indices(0, 1, independent_variables_number-1);
    const Vector<size_t> dependent_variables_indices(independent_variables_number, 1, variables_number-1);
@@ -546,11 +594,22 @@ double SolutionsError::calculate_performance(void) const
 
    #endif
 
+   return(calculate_performance(*neural_network_pointer));
+}
+
+
+// double calculate_performance(const NeuralNetwork&) const method
+
+/// Returns the objective value of a given neural network according to the solutions error on a mathematical model.
+/// @param neural_network Neural network to be evaluated.
+
+double SolutionsError::calculate_performance(const NeuralNetwork& neural_network) const
+{
    switch(solutions_error_method)
    {
       case SolutionsErrorSum:
       {
-         return(calculate_solutions_error_sum());
+         return(calculate_solutions_error_sum(neural_network));
       }            
       break;
 
@@ -565,7 +624,7 @@ double SolutionsError::calculate_performance(void) const
          std::ostringstream buffer;
 
          buffer << "OpenNN Exception: SolutionsError class\n"
-                << "double calculate_performance(void) const method.\n"               
+                << "double calculate_performance(const NeuralNetwork&) const method.\n"               
                 << "Unknown solutions error method.\n";
 
 	     throw std::logic_error(buffer.str());
@@ -590,16 +649,9 @@ double SolutionsError::calculate_performance(const Vector<double>& parameters) c
 
    #endif
 
-   NeuralNetwork neural_network_copy(*neural_network_pointer);
+   const NeuralNetwork neural_network(*neural_network_pointer, parameters);
 
-   neural_network_copy.set_parameters(parameters);
-
-   SolutionsError solutions_error_copy(*this);
-
-   solutions_error_copy.set_neural_network_pointer(&neural_network_copy);
-   solutions_error_copy.set_mathematical_model_pointer(mathematical_model_pointer);
-
-   return(solutions_error_copy.calculate_performance());
+   return(calculate_performance(neural_network));
 }
 
 
@@ -663,14 +715,33 @@ tinyxml2::XMLDocument* SolutionsError::to_XML(void) const
    
    if(numerical_differentiation_pointer)
    {
-	  element = numerical_differentiation_pointer->to_XML()->FirstChildElement();
-      root_element->LinkEndChild(element);
+      const tinyxml2::XMLDocument* numerical_differentiation_document = numerical_differentiation_pointer->to_XML();
+
+      const tinyxml2::XMLElement* numerical_differentiation_element = numerical_differentiation_document->FirstChildElement("NumericalDifferentiation");
+
+      if(numerical_differentiation_element)
+      {
+         element = document->NewElement("NumericalDifferentiation");
+         root_element->LinkEndChild(element);
+
+         DeepClone(element, numerical_differentiation_element, document, NULL);
+      }
+
+      delete numerical_differentiation_document;
    }
 
    // Numerical integration
    {
-      element = numerical_integration.to_XML()->FirstChildElement();
+      element = document->NewElement("NumericalIntegration");
       root_element->LinkEndChild(element);
+
+      const tinyxml2::XMLDocument* numerical_integration_document = numerical_integration.to_XML();
+
+      const tinyxml2::XMLElement* numerical_integration_element = numerical_integration_document->FirstChildElement("NumericalIntegration");
+
+      DeepClone(element, numerical_integration_element, document, NULL);
+
+      delete numerical_integration_document;
    }
 
    // Solutions error method
@@ -694,6 +765,20 @@ tinyxml2::XMLDocument* SolutionsError::to_XML(void) const
       element->LinkEndChild(text);
    }
 
+   // Evaluation independent variables
+
+   if(!evaluation_independent_variables.empty())
+   {
+      element = document->NewElement("EvaluationIndependentVariables");
+      root_element->LinkEndChild(element);
+
+      buffer.str("");
+      buffer << evaluation_independent_variables;
+
+      text = document->NewText(buffer.str().c_str());
+      element->LinkEndChild(text);
+   }
+
    // Display
    {
       element = document->NewElement("Display");
@@ -717,9 +802,36 @@ tinyxml2::XMLDocument* SolutionsError::to_XML(void) const
 
 void SolutionsError::from_XML(const tinyxml2::XMLDocument& document)
 {
+    const tinyxml2::XMLElement* root_element = document.FirstChildElement("SolutionsError");
+
+    if(!root_element)
+    {
+        std::ostringstream buffer;
+
+        buffer << "OpenNN Exception: SolutionsError class.\n"
+               << "void from_XML(const tinyxml2::XMLDocument&) method.\n"
+               << "Solutions error element is NULL.\n";
+
+        throw std::logic_error(buffer.str());
+    }
+
+  // Evaluation independent variables
+  {
+     const tinyxml2::XMLElement* element = root_element->FirstChildElement("EvaluationIndependentVariables");
+
+     if(element && element->GetText())
+     {
+        Vector<double> new_evaluation_independent_variables;
+
+        new_evaluation_independent_variables.parse(element->GetText());
+
+        set_evaluation_independent_variables(new_evaluation_independent_variables);
+     }
+  }
+
   // Display
   {
-     const tinyxml2::XMLElement* display_element = document.FirstChildElement("Display");
+     const tinyxml2::XMLElement* display_element = root_element->FirstChildElement("Display");
 
      if(display_element)
      {
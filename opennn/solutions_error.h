@@ -99,6 +99,8 @@ public:
    const Vector<double>& get_solutions_errors_weights(void) const;
    const double& get_solution_error_weight(const size_t&) const;
 
+   const Vector<double>& get_evaluation_independent_variables(void) const;
+
    // Set methods
 
 //   void set(const SolutionsError&);
@@ -109,6 +111,8 @@ public:
    void set_solutions_errors_weights(const Vector<double>&);
    void set_solution_error_weight(const size_t&, const double&);
 
+   void set_evaluation_independent_variables(const Vector<double>&);
+
    void set_default(void);
 
    // Target trajectories methods 
@@ -122,10 +126,12 @@ public:
    // Constraints methods
 
    double calculate_solutions_error_sum(void) const;   
+   double calculate_solutions_error_sum(const NeuralNetwork&) const;   
    double calculate_solutions_error_integral(void) const;   
 
    virtual double calculate_performance(void) const;   
    virtual double calculate_performance(const Vector<double>&) const;   
+   double calculate_performance(const NeuralNetwork&) const;   
 
    std::string write_performance_term_type(void) const;
 
@@ -152,6 +158,11 @@ protected:
 
    Vector<double> solutions_errors_weights;
 
+   /// Points of the independent variable at which the solutions are compared with the target solutions. 
+   /// If it is empty, all the points of the solution are used. 
+
+   Vector<double> evaluation_independent_variables;
+
 };
 
 }
@@ -19,6 +19,8 @@
 namespace OpenNN
 {
 
+const size_t SumSquaredError::single_precision_batch_size;
+
 // DEFAULT CONSTRUCTOR
 
 /// Default constructor. 
@@ -27,6 +29,7 @@ namespace OpenNN
 
 SumSquaredError::SumSquaredError(void) : PerformanceTerm()
 {
+   set_default();
 }
 
 
@@ -40,6 +43,7 @@ SumSquaredError::SumSquaredError(void) : PerformanceTerm()
 SumSquaredError::SumSquaredError(NeuralNetwork* new_neural_network_pointer) 
 : PerformanceTerm(new_neural_network_pointer)
 {
+   set_default();
 }
 
 
@@ -53,6 +57,7 @@ SumSquaredError::SumSquaredError(NeuralNetwork* new_neural_network_pointer)
 SumSquaredError::SumSquaredError(DataSet* new_data_set_pointer)
 : PerformanceTerm(new_data_set_pointer)
 {
+   set_default();
 }
 
 
@@ -67,6 +72,7 @@ SumSquaredError::SumSquaredError(DataSet* new_data_set_pointer)
 SumSquaredError::SumSquaredError(NeuralNetwork* new_neural_network_pointer, DataSet* new_data_set_pointer)
  : PerformanceTerm(new_neural_network_pointer, new_data_set_pointer)
 {
+   set_default();
 }
 
 
@@ -80,6 +86,9 @@ SumSquaredError::SumSquaredError(NeuralNetwork* new_neural_network_pointer, Data
 SumSquaredError::SumSquaredError(const tinyxml2::XMLDocument& sum_squared_error_document)
  : PerformanceTerm(sum_squared_error_document)
 {
+   set_default();
+
+   from_XML(sum_squared_error_document);
 }
 
 
@@ -94,7 +103,7 @@ SumSquaredError::SumSquaredError(const tinyxml2::XMLDocument& sum_squared_error_
 SumSquaredError::SumSquaredError(const SumSquaredError& new_sum_squared_error)
  : PerformanceTerm(new_sum_squared_error)
 {
-
+   single_precision = new_sum_squared_error.single_precision;
 }
 
 
@@ -109,6 +118,49 @@ SumSquaredError::~SumSquaredError(void)
 
 // METHODS
 
+// const bool& get_single_precision(void) const method
+
+/// Returns true if the performance and the gradient on the training instances are computed in single precision,
+/// and false if they are computed in double precision. 
+
+const bool& SumSquaredError::get_single_precision(void) const
+{
+   return(single_precision);
+}
+
+
+// void set_default(void) method
+
+/// Sets the default values to a sum squared error object:
+/// <ul>
+/// <li> Single precision: false.
+/// <li> Display: true.
+/// </ul>
+
+void SumSquaredError::set_default(void)
+{
+   single_precision = false;
+
+   display = true;
+}
+
+
+// void set_single_precision(const bool&) method
+
+/// Sets whether the performance and the gradient on the training instances are computed in single precision.
+/// In single precision, the training data is converted once to the single precision blocks of the data set,
+/// and the neural network is evaluated on batches of instances with single precision matrix products.
+/// The errors and the gradient are accumulated in double precision, so that the training algorithms work as usual. 
+/// The Hessian, the terms and the selection performance are always computed in double precision,
+/// and so is the gradient of a neural network with a conditions layer. 
+/// @param new_single_precision True for single precision, false for double precision. 
+
+void SumSquaredError::set_single_precision(const bool& new_single_precision)
+{
+   single_precision = new_single_precision;
+}
+
+
 // void check(void) const method
 
 /// Checks that there are a neural network and a data set associated to the sum squared error, 
@@ -194,6 +246,11 @@ double SumSquaredError::calculate_performance(void) const
 
    #endif
 
+   if(single_precision)
+   {
+      return(calculate_single_precision_performance());
+   }
+
    // Neural network stuff
 
    const MultilayerPerceptron* multilayer_perceptron_pointer = neural_network_pointer->get_multilayer_perceptron_pointer();
@@ -207,15 +264,6 @@ double SumSquaredError::calculate_performance(void) const
 
    const size_t training_instances_number = instances.count_training_instances_number();
 
-   const Vector<size_t> training_indices = instances.arrange_training_indices();
-
-   size_t training_index;
-
-   const Variables& variables = data_set_pointer->get_variables();
-
-   const Vector<size_t> inputs_indices = variables.arrange_inputs_indices();
-   const Vector<size_t> targets_indices = variables.arrange_targets_indices();
-
    // Sum squared error stuff
 
    Vector<double> inputs(inputs_number);
@@ -225,19 +273,17 @@ double SumSquaredError::calculate_performance(void) const
    int i = 0;
    double sum_squared_error = 0.0;
 
-   #pragma omp parallel for private(i, training_index, inputs, outputs, targets) reduction(+ : sum_squared_error)
+   #pragma omp parallel for private(i, inputs, outputs, targets) reduction(+ : sum_squared_error)
 
    for(i = 0; i < (int)training_instances_number; i++)
    {
-       training_index = training_indices[i];
-
       // Input vector
 
-      inputs = data_set_pointer->get_instance(training_index, inputs_indices);
+      data_set_pointer->get_training_inputs(i, inputs);
 
       // Target vector
 
-      targets = data_set_pointer->get_instance(training_index, targets_indices);
+      data_set_pointer->get_training_targets(i, targets);
 
       // Output vector
 
@@ -289,6 +335,11 @@ double SumSquaredError::calculate_performance(const Vector<double>& parameters)
 
    #endif
 
+   if(single_precision)
+   {
+      return(calculate_single_precision_performance(parameters));
+   }
+
    // Neural network stuff
 
    const MultilayerPerceptron* multilayer_perceptron_pointer = neural_network_pointer->get_multilayer_perceptron_pointer();
@@ -302,15 +353,6 @@ double SumSquaredError::calculate_performance(const Vector<double>& parameters)
 
    const size_t training_instances_number = instances.count_training_instances_number();
 
-   const Vector<size_t> training_indices = instances.arrange_training_indices();
-
-   size_t training_index;
-
-   const Variables& variables = data_set_pointer->get_variables();
-
-   const Vector<size_t> inputs_indices = variables.arrange_inputs_indices();
-   const Vector<size_t> targets_indices = variables.arrange_targets_indices();
-
    // Sum squared error stuff
 
    Vector<double> inputs(inputs_number);
@@ -321,15 +363,13 @@ double SumSquaredError::calculate_performance(const Vector<double>& parameters)
 
    double sum_squared_error = 0.0;
 
-   #pragma omp parallel for private(i, training_index, inputs, outputs, targets) reduction(+ : sum_squared_error)
+   #pragma omp parallel for private(i, inputs, outputs, targets) reduction(+ : sum_squared_error)
 
    for(i = 0; i < (int)training_instances_number; i++)
    {
-       training_index = training_indices[i];
-
        // Input vector
 
-      inputs = data_set_pointer->get_instance(training_index, inputs_indices);
+      data_set_pointer->get_training_inputs(i, inputs);
 
       // Output vector
 
@@ -337,7 +377,7 @@ double SumSquaredError::calculate_performance(const Vector<double>& parameters)
 
       // Target vector
 
-      targets = data_set_pointer->get_instance(training_index, targets_indices);
+      data_set_pointer->get_training_targets(i, targets);
 
       // Sum squared error
 
@@ -354,7 +394,7 @@ double SumSquaredError::calculate_performance_combinations(const size_t& index,
 {
     const Variables& variables = data_set_pointer->get_variables();
 
-    const Vector<size_t> targets_indices = variables.arrange_targets_indices();
+    const Vector<size_t>& targets_indices = variables.get_targets_indices();
 
     const Vector<double> targets = data_set_pointer->get_instance(0, targets_indices);
 
@@ -372,7 +412,7 @@ double SumSquaredError::calculate_performance_combinations(const size_t& index_1
 
     const size_t layers_number = neural_network_pointer->get_multilayer_perceptron_pointer()->get_layers_number();
 
-    const Vector<size_t> targets_indices = variables.arrange_targets_indices();
+    const Vector<size_t>& targets_indices = variables.get_targets_indices();
 
     const Vector<double> targets = data_set_pointer->get_instance(0, targets_indices);
 
@@ -414,15 +454,6 @@ double SumSquaredError::calculate_selection_performance(void) const
    const Instances& instances = data_set_pointer->get_instances();
    const size_t selection_instances_number = instances.count_selection_instances_number();
 
-   const Vector<size_t> selection_indices = instances.arrange_selection_indices();
-
-   size_t selection_index;
-
-   const Variables& variables = data_set_pointer->get_variables();
-
-   const Vector<size_t> inputs_indices = variables.arrange_inputs_indices();
-   const Vector<size_t> targets_indices = variables.arrange_targets_indices();
-
    // Sum squared error stuff
 
    Vector<double> inputs(inputs_number);
@@ -433,15 +464,13 @@ double SumSquaredError::calculate_selection_performance(void) const
 
    int i = 0;
 
-   #pragma omp parallel for private(i, selection_index, inputs, outputs, targets) reduction(+ : selection_performance)
+   #pragma omp parallel for private(i, inputs, outputs, targets) reduction(+ : selection_performance)
 
    for(i = 0; i < (int)selection_instances_number; i++)
    {
-       selection_index = selection_indices[i];
-
       // Input vector
 
-      inputs = data_set_pointer->get_instance(selection_index, inputs_indices);
+      data_set_pointer->get_selection_inputs(i, inputs);
 
       // Output vector
 
@@ -449,7 +478,7 @@ double SumSquaredError::calculate_selection_performance(void) const
 
       // Target vector
 
-      targets = data_set_pointer->get_instance(selection_index, targets_indices);
+      data_set_pointer->get_selection_targets(i, targets);
 
       // Sum of squares error
 
@@ -491,6 +520,11 @@ Vector<double> SumSquaredError::calculate_gradient(void) const
 
    const bool has_conditions_layer = neural_network_pointer->has_conditions_layer();
 
+   if(single_precision && !has_conditions_layer)
+   {
+      return(calculate_single_precision_gradient());
+   }
+
    const ConditionsLayer* conditions_layer_pointer = has_conditions_layer ? neural_network_pointer->get_conditions_layer_pointer() : NULL;
 
    const size_t inputs_number = multilayer_perceptron_pointer->get_inputs_number();
@@ -511,15 +545,6 @@ Vector<double> SumSquaredError::calculate_gradient(void) const
 
    const size_t training_instances_number = instances.count_training_instances_number();
 
-   const Vector<size_t> training_indices = instances.arrange_training_indices();
-
-   size_t training_index;
-
-   const Variables& variables = data_set_pointer->get_variables();
-
-   const Vector<size_t> inputs_indices = variables.arrange_inputs_indices();
-   const Vector<size_t> targets_indices = variables.arrange_targets_indices();
-
    Vector<double> inputs(inputs_number);
    Vector<double> targets(outputs_number);
 
@@ -538,16 +563,14 @@ Vector<double> SumSquaredError::calculate_gradient(void) const
 
    int i;
 
-   #pragma omp parallel for private(i, training_index, inputs, targets, first_order_forward_propagation, layers_inputs, layers_combination_parameters_Jacobian,\
+   #pragma omp parallel for private(i, inputs, targets, first_order_forward_propagation, layers_inputs, layers_combination_parameters_Jacobian,\
     output_gradient, layers_delta, particular_solution, homogeneous_solution, point_gradient)
 
    for(i = 0; i < (int)training_instances_number; i++)
    {
-       training_index = training_indices[i];
-
-      inputs = data_set_pointer->get_instance(training_index, inputs_indices);
+      data_set_pointer->get_training_inputs(i, inputs);
 
-      targets = data_set_pointer->get_instance(training_index, targets_indices);
+      data_set_pointer->get_training_targets(i, targets);
 
       first_order_forward_propagation = multilayer_perceptron_pointer->calculate_first_order_forward_propagation(inputs);
 
@@ -584,6 +607,142 @@ Vector<double> SumSquaredError::calculate_gradient(void) const
 }
 
 
+// Vector<PerformanceTerm::FirstOrderPerformance> calculate_first_order_performances(const Vector<NeuralNetwork*>&) const method
+
+/// Calculates the sum squared error and its gradient for several neural networks in a single pass over the training instances.
+/// The inputs and targets of each instance are loaded once and propagated through all the neural networks,
+/// which must have the same number of inputs and outputs as the data set.
+/// The performance is computed from the same forward propagation as the gradient, so conditions layers are taken into account.
+/// @param neural_networks_pointers Pointers to the neural networks to be evaluated on the data set of this performance term.
+
+Vector<PerformanceTerm::FirstOrderPerformance> SumSquaredError::calculate_first_order_performances(const Vector<NeuralNetwork*>& neural_networks_pointers) const
+{
+   #ifdef __OPENNN_DEBUG__
+
+   check();
+
+   #endif
+
+   const size_t neural_networks_number = neural_networks_pointers.size();
+
+   // Performance functional stuff
+
+   Vector<SumSquaredError> sum_squared_errors(neural_networks_number);
+
+   Vector<FirstOrderPerformance> first_order_performances(neural_networks_number);
+
+   for(size_t j = 0; j < neural_networks_number; j++)
+   {
+      sum_squared_errors[j].set(neural_networks_pointers[j], data_set_pointer);
+
+      #ifdef __OPENNN_DEBUG__
+
+      sum_squared_errors[j].check();
+
+      #endif
+
+      first_order_performances[j].performance = 0.0;
+      first_order_performances[j].gradient.set(neural_networks_pointers[j]->get_multilayer_perceptron_pointer()->count_parameters_number(), 0.0);
+   }
+
+   // Data set stuff
+
+   const Variables& variables = data_set_pointer->get_variables();
+
+   const size_t inputs_number = variables.count_inputs_number();
+   const size_t targets_number = variables.count_targets_number();
+
+   const Instances& instances = data_set_pointer->get_instances();
+
+   const size_t training_instances_number = instances.count_training_instances_number();
+
+   Vector<double> inputs(inputs_number);
+   Vector<double> targets(targets_number);
+
+   // Sum squared error stuff
+
+   Vector< Vector< Vector<double> > > first_order_forward_propagation(2);
+
+   Vector<double> particular_solution;
+   Vector<double> homogeneous_solution;
+
+   Vector<double> outputs;
+
+   Vector<double> output_gradient;
+
+   Vector< Matrix<double> > layers_combination_parameters_Jacobian;
+
+   Vector< Vector<double> > layers_inputs;
+   Vector< Vector<double> > layers_delta;
+
+   Vector<double> point_gradient;
+
+   int i;
+
+   #pragma omp parallel for private(i, inputs, targets, first_order_forward_propagation, particular_solution, homogeneous_solution, outputs,\
+    output_gradient, layers_combination_parameters_Jacobian, layers_inputs, layers_delta, point_gradient)
+
+   for(i = 0; i < (int)training_instances_number; i++)
+   {
+      data_set_pointer->get_training_inputs(i, inputs);
+
+      data_set_pointer->get_training_targets(i, targets);
+
+      for(size_t j = 0; j < neural_networks_number; j++)
+      {
+         const SumSquaredError& sum_squared_error = sum_squared_errors[j];
+
+         const NeuralNetwork* neural_network_pointer = neural_networks_pointers[j];
+
+         const MultilayerPerceptron* multilayer_perceptron_pointer = neural_network_pointer->get_multilayer_perceptron_pointer();
+
+         const size_t layers_number = multilayer_perceptron_pointer->get_layers_number();
+
+         first_order_forward_propagation = multilayer_perceptron_pointer->calculate_first_order_forward_propagation(inputs);
+
+         const Vector< Vector<double> >& layers_activation = first_order_forward_propagation[0];
+         const Vector< Vector<double> >& layers_activation_derivative = first_order_forward_propagation[1];
+
+         layers_inputs = multilayer_perceptron_pointer->arrange_layers_input(inputs, layers_activation);
+
+         layers_combination_parameters_Jacobian = multilayer_perceptron_pointer->calculate_layers_combination_parameters_Jacobian(layers_inputs);
+
+         if(!neural_network_pointer->has_conditions_layer())
+         {
+            outputs = layers_activation[layers_number-1];
+
+            output_gradient = (outputs-targets)*2.0;
+
+            layers_delta = sum_squared_error.calculate_layers_delta(layers_activation_derivative, output_gradient);
+         }
+         else
+         {
+            const ConditionsLayer* conditions_layer_pointer = neural_network_pointer->get_conditions_layer_pointer();
+
+            particular_solution = conditions_layer_pointer->calculate_particular_solution(inputs);
+            homogeneous_solution = conditions_layer_pointer->calculate_homogeneous_solution(inputs);
+
+            outputs = particular_solution+homogeneous_solution*layers_activation[layers_number-1];
+
+            output_gradient = (outputs-targets)*2.0;
+
+            layers_delta = sum_squared_error.calculate_layers_delta(layers_activation_derivative, homogeneous_solution, output_gradient);
+         }
+
+         point_gradient = sum_squared_error.calculate_point_gradient(layers_combination_parameters_Jacobian, layers_delta);
+
+         #pragma omp critical
+         {
+            first_order_performances[j].performance += outputs.calculate_sum_squared_error(targets);
+            first_order_performances[j].gradient += point_gradient;
+         }
+      }
+   }
+
+   return(first_order_performances);
+}
+
+
 // Matrix<double> calculate_output_Hessian(const Vector<double>&, const Vector<double>&) const method
 
 Matrix<double> SumSquaredError::calculate_output_Hessian(const Vector<double>&, const Vector<double>&) const
@@ -641,15 +800,6 @@ Matrix<double> SumSquaredError::calculate_Hessian(void) const
 
    const size_t training_instances_number = instances.count_training_instances_number();
 
-   const Vector<size_t> training_indices = instances.arrange_training_indices();
-
-   size_t training_index;
-
-   const Variables& variables = data_set_pointer->get_variables();
-
-   const Vector<size_t> inputs_indices = variables.arrange_inputs_indices();
-   const Vector<size_t> targets_indices = variables.arrange_targets_indices();
-
    Vector<double> inputs(inputs_number);
    Vector<double> targets(outputs_number);
 
@@ -665,11 +815,9 @@ Matrix<double> SumSquaredError::calculate_Hessian(void) const
 
    for(size_t i = 0; i < training_instances_number; i++)
    {
-       training_index = training_indices[i];
-
-      inputs = data_set_pointer->get_instance(training_index, inputs_indices);
+      data_set_pointer->get_training_inputs(i, inputs);
 
-      targets = data_set_pointer->get_instance(training_index, targets_indices);
+      data_set_pointer->get_training_targets(i, targets);
 
       second_order_forward_propagation = multilayer_perceptron_pointer->calculate_second_order_forward_propagation(inputs);
 	  
@@ -751,21 +899,8 @@ Matrix<double> SumSquaredError::calculate_single_hidden_layer_Hessian(void) cons
 
     // Data set stuff
 
-    const Instances& instances = data_set_pointer->get_instances();
-
-    //const size_t training_instances_number = instances.count_training_instances_number();
-
-    const Vector<size_t> training_indices = instances.arrange_training_indices();
-
-    size_t training_index;
-
     //const MissingValues& missing_values = data_set_pointer->get_missing_values();
 
-    const Variables& variables = data_set_pointer->get_variables();
-
-    const Vector<size_t> inputs_indices = variables.arrange_inputs_indices();
-    const Vector<size_t> targets_indices = variables.arrange_targets_indices();
-
     Vector<double> inputs(inputs_number);
     Vector<double> targets(outputs_number);
 
@@ -780,11 +915,9 @@ Matrix<double> SumSquaredError::calculate_single_hidden_layer_Hessian(void) cons
 
     const size_t i = 0;
 
-    training_index = training_indices[i];
-
-    inputs = data_set_pointer->get_instance(training_index, inputs_indices);
+    data_set_pointer->get_training_inputs(i, inputs);
 
-    targets = data_set_pointer->get_instance(training_index, targets_indices);
+    data_set_pointer->get_training_targets(i, targets);
 
     second_order_forward_propagation = multilayer_perceptron_pointer->calculate_second_order_forward_propagation(inputs);
 
@@ -997,15 +1130,6 @@ Vector<double> SumSquaredError::calculate_terms(void) const
 
    const size_t training_instances_number = instances.count_training_instances_number();
 
-   const Vector<size_t> training_indices = instances.arrange_training_indices();
-
-   size_t training_index;
-
-   const Variables& variables = data_set_pointer->get_variables();
-
-   const Vector<size_t> inputs_indices = variables.arrange_inputs_indices();
-   const Vector<size_t> targets_indices = variables.arrange_targets_indices();
-
    // Performance functional stuff
 
    Vector<double> performance_terms(training_instances_number);
@@ -1016,15 +1140,13 @@ Vector<double> SumSquaredError::calculate_terms(void) const
 
    int i = 0;
 
-   #pragma omp parallel for private(i, training_index, inputs, outputs, targets)
+   #pragma omp parallel for private(i, inputs, outputs, targets)
 
    for(i = 0; i < (int)training_instances_number; i++)
    {
-       training_index = training_indices[i];
-
       // Input vector
 
-      inputs = data_set_pointer->get_instance(training_index, inputs_indices);
+      data_set_pointer->get_training_inputs(i, inputs);
 
       // Output vector
 
@@ -1032,7 +1154,7 @@ Vector<double> SumSquaredError::calculate_terms(void) const
 
       // Target vector
 
-      targets = data_set_pointer->get_instance(training_index, targets_indices);
+      data_set_pointer->get_training_targets(i, targets);
 
       // Error
 
@@ -1130,15 +1252,6 @@ Matrix<double> SumSquaredError::calculate_terms_Jacobian(void) const
 
    const size_t training_instances_number = instances.count_training_instances_number();
 
-   const Vector<size_t> training_indices = instances.arrange_training_indices();
-
-   size_t training_index;
-
-   const Variables& variables = data_set_pointer->get_variables();
-
-   const Vector<size_t> inputs_indices = variables.arrange_inputs_indices();
-   const Vector<size_t> targets_indices = variables.arrange_targets_indices();
-
    const MissingValues missing_values = data_set_pointer->get_missing_values();
 
    Vector<double> inputs(inputs_number);
@@ -1160,16 +1273,14 @@ Matrix<double> SumSquaredError::calculate_terms_Jacobian(void) const
 
    int i = 0;
 
-   #pragma omp parallel for private(i, training_index, inputs, targets, first_order_forward_propagation, layers_inputs, \
+   #pragma omp parallel for private(i, inputs, targets, first_order_forward_propagation, layers_inputs, \
     layers_combination_parameters_Jacobian, term, term_norm, output_gradient, layers_delta, particular_solution, homogeneous_solution, point_gradient)
 
    for(i = 0; i < (int)training_instances_number; i++)
    {
-       training_index = training_indices[i];
-
-      inputs = data_set_pointer->get_instance(training_index, inputs_indices);
+      data_set_pointer->get_training_inputs(i, inputs);
 
-      targets = data_set_pointer->get_instance(training_index, targets_indices);
+      data_set_pointer->get_training_targets(i, targets);
 
       first_order_forward_propagation = multilayer_perceptron_pointer->calculate_first_order_forward_propagation(inputs);
 
@@ -1199,7 +1310,6 @@ Matrix<double> SumSquaredError::calculate_terms_Jacobian(void) const
       }
       else
       {
-
          particular_solution = conditions_layer_pointer->calculate_particular_solution(inputs);
          homogeneous_solution = conditions_layer_pointer->calculate_homogeneous_solution(inputs);
 
@@ -1272,15 +1382,6 @@ Vector<double> SumSquaredError::calculate_squared_errors(void) const
 
    const size_t training_instances_number = instances.count_training_instances_number();
 
-   const Vector<size_t> training_indices = instances.arrange_training_indices();
-
-   size_t training_index;
-
-   const Variables& variables = data_set_pointer->get_variables();
-
-   const Vector<size_t> inputs_indices = variables.arrange_inputs_indices();
-   const Vector<size_t> targets_indices = variables.arrange_targets_indices();
-
    const MissingValues missing_values = data_set_pointer->get_missing_values();
 
    // Performance functional
@@ -1293,15 +1394,13 @@ Vector<double> SumSquaredError::calculate_squared_errors(void) const
 
    int i = 0;
 
-   #pragma omp parallel for private(i, training_index, inputs, outputs, targets)
+   #pragma omp parallel for private(i, inputs, outputs, targets)
 
    for(i = 0; i < (int)training_instances_number; i++)
    {
-       training_index = training_indices[i];
-
       // Input vector
 
-      inputs = data_set_pointer->get_instance(training_index, inputs_indices);
+      data_set_pointer->get_training_inputs(i, inputs);
 
       // Output vector
 
@@ -1309,7 +1408,7 @@ Vector<double> SumSquaredError::calculate_squared_errors(void) const
 
       // Target vector
 
-      targets = data_set_pointer->get_instance(training_index, targets_indices);
+      data_set_pointer->get_training_targets(i, targets);
 
       // Error
 
@@ -1345,6 +1444,305 @@ Matrix<double> SumSquaredError::calculate_Hessian(const Vector<double>&) const
 }
 
 
+// double calculate_single_precision_performance(void) const method
+
+/// Returns the sum squared error of the neural network on the training instances, computed in single precision.
+/// The outputs are computed in batches from the single precision training blocks of the data set,
+/// and the squared errors are accumulated in double precision. 
+
+double SumSquaredError::calculate_single_precision_performance(void) const
+{
+   #ifdef __OPENNN_DEBUG__
+
+   check();
+
+   #endif
+
+   const MultilayerPerceptron* multilayer_perceptron_pointer = neural_network_pointer->get_multilayer_perceptron_pointer();
+
+   return(calculate_single_precision_performance(*multilayer_perceptron_pointer));
+}
+
+
+// double calculate_single_precision_performance(const Vector<double>&) const method
+
+/// Returns which would be the sum squared error of the neural network for an hypothetical vector of parameters,
+/// computed in single precision. 
+/// It does not set that vector of parameters to the neural network. 
+/// @param parameters Vector of potential parameters for the neural network associated to the performance term.
+
+double SumSquaredError::calculate_single_precision_performance(const Vector<double>& parameters) const
+{
+   #ifdef __OPENNN_DEBUG__
+
+   check();
+
+   #endif
+
+   MultilayerPerceptron multilayer_perceptron(*neural_network_pointer->get_multilayer_perceptron_pointer());
+
+   multilayer_perceptron.set_parameters(parameters);
+
+   return(calculate_single_precision_performance(multilayer_perceptron));
+}
+
+
+// Vector<double> calculate_single_precision_gradient(void) const method
+
+/// Returns the gradient of the sum squared error on the training instances, computed in single precision.
+/// The forward and the backward propagations are performed in batches of training instances,
+/// with single precision matrix products for the combinations, the deltas and the parameter derivatives.
+/// The gradient of each batch is accumulated in double precision. 
+/// The parameters are in the same order as in the double precision gradient.
+/// Conditions layers are not supported. 
+
+Vector<double> SumSquaredError::calculate_single_precision_gradient(void) const
+{
+   #ifdef __OPENNN_DEBUG__
+
+   check();
+
+   #endif
+
+   // Neural network stuff
+
+   const MultilayerPerceptron* multilayer_perceptron_pointer = neural_network_pointer->get_multilayer_perceptron_pointer();
+
+   if(neural_network_pointer->has_conditions_layer())
+   {
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: SumSquaredError class.\n"
+             << "Vector<double> calculate_single_precision_gradient(void) const method.\n"
+             << "Conditions layer is not supported in single precision.\n";
+
+      throw std::logic_error(buffer.str());
+   }
+
+   const Vector<PerceptronLayer>& layers = multilayer_perceptron_pointer->get_layers();
+
+   const size_t layers_number = layers.size();
+
+   const size_t neural_parameters_number = multilayer_perceptron_pointer->count_parameters_number();
+
+   Vector< Matrix<float> > layers_synaptic_weights(layers_number);
+
+   for(size_t l = 0; l < layers_number; l++)
+   {
+      layers_synaptic_weights[l] = layers[l].arrange_synaptic_weights().to_float_matrix();
+   }
+
+   // Data set stuff
+
+   const Matrix<float>& inputs_block = data_set_pointer->get_training_float_inputs_block();
+   const Matrix<float>& targets_block = data_set_pointer->get_training_float_targets_block();
+
+   const size_t training_instances_number = inputs_block.get_rows_number();
+
+   const size_t batches_number = (training_instances_number + single_precision_batch_size - 1)/single_precision_batch_size;
+
+   // Sum squared error stuff
+
+   Vector<double> gradient(neural_parameters_number, 0.0);
+
+   Matrix<float> inputs;
+   Matrix<float> targets;
+
+   Vector< Matrix<float> > layers_activations(layers_number);
+   Vector< Matrix<float> > layers_activations_derivatives(layers_number);
+   Vector< Matrix<float> > layers_delta(layers_number);
+
+   Vector< Matrix<float> > layers_synaptic_weights_derivatives(layers_number);
+
+   int b;
+
+   #pragma omp parallel for private(b, inputs, targets, layers_activations, layers_activations_derivatives, layers_delta, layers_synaptic_weights_derivatives)
+
+   for(b = 0; b < (int)batches_number; b++)
+   {
+      const size_t first_instance = b*single_precision_batch_size;
+
+      const size_t batch_instances_number = training_instances_number - first_instance < single_precision_batch_size
+                                          ? training_instances_number - first_instance
+                                          : single_precision_batch_size;
+
+      inputs = arrange_batch(inputs_block, first_instance, batch_instances_number);
+      targets = arrange_batch(targets_block, first_instance, batch_instances_number);
+
+      // Forward propagation
+
+      for(size_t l = 0; l < layers_number; l++)
+      {
+         const Matrix<float> combinations = layers[l].calculate_combinations(l == 0 ? inputs : layers_activations[l-1]);
+
+         layers_activations[l] = layers[l].calculate_activations(combinations);
+         layers_activations_derivatives[l] = layers[l].calculate_activations_derivatives(combinations);
+      }
+
+      // Output delta
+
+      const size_t outputs_number = targets.get_columns_number();
+
+      layers_delta[layers_number-1].set(batch_instances_number, outputs_number);
+
+      for(size_t j = 0; j < outputs_number; j++)
+      {
+         for(size_t i = 0; i < batch_instances_number; i++)
+         {
+            layers_delta[layers_number-1](i,j) = 2.0f*(layers_activations[layers_number-1](i,j) - targets(i,j))
+                                               *layers_activations_derivatives[layers_number-1](i,j);
+         }
+      }
+
+      // Back propagation
+
+      for(size_t l = layers_number-1; l > 0; l--)
+      {
+         const size_t perceptrons_number = layers_synaptic_weights[l].get_rows_number();
+         const size_t inputs_number = layers_synaptic_weights[l].get_columns_number();
+
+         layers_delta[l-1].set(batch_instances_number, inputs_number);
+
+         const Eigen::Map<Eigen::MatrixXf> delta_eigen(layers_delta[l].data(), batch_instances_number, perceptrons_number);
+         const Eigen::Map<Eigen::MatrixXf> synaptic_weights_eigen(layers_synaptic_weights[l].data(), perceptrons_number, inputs_number);
+         Eigen::Map<Eigen::MatrixXf> previous_delta_eigen(layers_delta[l-1].data(), batch_instances_number, inputs_number);
+
+         previous_delta_eigen.noalias() = delta_eigen*synaptic_weights_eigen;
+
+         const size_t size = layers_delta[l-1].size();
+
+         for(size_t k = 0; k < size; k++)
+         {
+            layers_delta[l-1][k] *= layers_activations_derivatives[l-1][k];
+         }
+      }
+
+      // Synaptic weights derivatives
+
+      for(size_t l = 0; l < layers_number; l++)
+      {
+         const Matrix<float>& layer_inputs = l == 0 ? inputs : layers_activations[l-1];
+
+         const size_t perceptrons_number = layers_synaptic_weights[l].get_rows_number();
+         const size_t inputs_number = layers_synaptic_weights[l].get_columns_number();
+
+         layers_synaptic_weights_derivatives[l].set(perceptrons_number, inputs_number);
+
+         const Eigen::Map<Eigen::MatrixXf> delta_eigen(layers_delta[l].data(), batch_instances_number, perceptrons_number);
+         const Eigen::Map<Eigen::MatrixXf> layer_inputs_eigen((float*)layer_inputs.data(), batch_instances_number, inputs_number);
+         Eigen::Map<Eigen::MatrixXf> synaptic_weights_derivatives_eigen(layers_synaptic_weights_derivatives[l].data(), perceptrons_number, inputs_number);
+
+         synaptic_weights_derivatives_eigen.noalias() = delta_eigen.transpose()*layer_inputs_eigen;
+      }
+
+      // Gradient
+
+      #pragma omp critical
+      {
+         size_t position = 0;
+
+         for(size_t l = 0; l < layers_number; l++)
+         {
+            const size_t perceptrons_number = layers_synaptic_weights[l].get_rows_number();
+            const size_t inputs_number = layers_synaptic_weights[l].get_columns_number();
+
+            for(size_t j = 0; j < perceptrons_number; j++)
+            {
+               double bias_derivative = 0.0;
+
+               for(size_t i = 0; i < batch_instances_number; i++)
+               {
+                  bias_derivative += layers_delta[l](i,j);
+               }
+
+               gradient[position] += bias_derivative;
+
+               position++;
+
+               for(size_t k = 0; k < inputs_number; k++)
+               {
+                  gradient[position] += layers_synaptic_weights_derivatives[l](j,k);
+
+                  position++;
+               }
+            }
+         }
+      }
+   }
+
+   return(gradient);
+}
+
+
+// double calculate_single_precision_performance(const MultilayerPerceptron&) const method
+
+/// Returns the sum squared error of a multilayer perceptron on the training instances, computed in single precision.
+/// @param multilayer_perceptron Multilayer perceptron to be evaluated.
+
+double SumSquaredError::calculate_single_precision_performance(const MultilayerPerceptron& multilayer_perceptron) const
+{
+   const Matrix<float>& inputs_block = data_set_pointer->get_training_float_inputs_block();
+   const Matrix<float>& targets_block = data_set_pointer->get_training_float_targets_block();
+
+   const size_t training_instances_number = inputs_block.get_rows_number();
+
+   const size_t batches_number = (training_instances_number + single_precision_batch_size - 1)/single_precision_batch_size;
+
+   Matrix<float> inputs;
+   Matrix<float> targets;
+   Matrix<float> outputs;
+
+   int b;
+
+   double sum_squared_error = 0.0;
+
+   #pragma omp parallel for private(b, inputs, targets, outputs) reduction(+ : sum_squared_error)
+
+   for(b = 0; b < (int)batches_number; b++)
+   {
+      const size_t first_instance = b*single_precision_batch_size;
+
+      const size_t batch_instances_number = training_instances_number - first_instance < single_precision_batch_size
+                                          ? training_instances_number - first_instance
+                                          : single_precision_batch_size;
+
+      inputs = arrange_batch(inputs_block, first_instance, batch_instances_number);
+      targets = arrange_batch(targets_block, first_instance, batch_instances_number);
+
+      outputs = multilayer_perceptron.calculate_outputs(inputs);
+
+      sum_squared_error += outputs.calculate_sum_squared_error(targets);
+   }
+
+   return(sum_squared_error);
+}
+
+
+// static Matrix<float> arrange_batch(const Matrix<float>&, const size_t&, const size_t&) method
+
+/// Returns a batch of consecutive rows of a single precision block. 
+/// @param block Single precision block, with the instances in the rows.
+/// @param first_row Index of the first row of the batch.
+/// @param rows_number Number of rows in the batch.
+
+Matrix<float> SumSquaredError::arrange_batch(const Matrix<float>& block, const size_t& first_row, const size_t& rows_number)
+{
+   const size_t columns_number = block.get_columns_number();
+
+   Matrix<float> batch(rows_number, columns_number);
+
+   for(size_t j = 0; j < columns_number; j++)
+   {
+      for(size_t i = 0; i < rows_number; i++)
+      {
+         batch(i,j) = block(first_row+i, j);
+      }
+   }
+
+   return(batch);
+}
+
+
 // std::string write_performance_term_type(void) const method
 
 /// Returns a string with the name of the sum squared error performance type, "SUM_SQUARED_ERROR".
@@ -1384,6 +1782,19 @@ tinyxml2::XMLDocument* SumSquaredError::to_XML(void) const
       display_element->LinkEndChild(display_text);
    }
 
+   // Single precision
+
+   {
+      tinyxml2::XMLElement* single_precision_element = document->NewElement("SinglePrecision");
+      root_element->LinkEndChild(single_precision_element);
+
+      buffer.str("");
+      buffer << single_precision;
+
+      tinyxml2::XMLText* single_precision_text = document->NewText(buffer.str().c_str());
+      single_precision_element->LinkEndChild(single_precision_text);
+   }
+
    return(document);
 }
 
@@ -1426,6 +1837,25 @@ void SumSquaredError::from_XML(const tinyxml2::XMLDocument& document)
         }
      }
   }
+
+  // Single precision
+  {
+     const tinyxml2::XMLElement* element = root_element->FirstChildElement("SinglePrecision");
+
+     if(element)
+     {
+        const std::string new_single_precision_string = element->GetText();
+
+        try
+        {
+           set_single_precision(new_single_precision_string != "0");
+        }
+        catch(const std::logic_error& e)
+        {
+           std::cout << e.what() << std::endl;
+        }
+     }
+  }
 }
 
 }
@@ -76,8 +76,14 @@ public:
 
    // Get methods
 
+   const bool& get_single_precision(void) const;
+
    // Set methods
 
+   void set_default(void);
+
+   void set_single_precision(const bool&);
+
    // Checking methods
 
    void check(void) const;
@@ -92,6 +98,8 @@ public:
 
    Vector<double> calculate_gradient(void) const;
 
+   Vector<PerformanceTerm::FirstOrderPerformance> calculate_first_order_performances(const Vector<NeuralNetwork*>&) const;
+
    Matrix<double> calculate_Hessian(void) const;
 
    Matrix<double> calculate_single_hidden_layer_Hessian(void) const;
@@ -107,6 +115,13 @@ public:
 
    Matrix<double> calculate_Hessian(const Vector<double>&) const;
 
+   // Single precision methods
+
+   double calculate_single_precision_performance(void) const;
+   double calculate_single_precision_performance(const Vector<double>&) const;
+
+   Vector<double> calculate_single_precision_gradient(void) const;
+
    // Objective terms methods
 
    Vector<double> calculate_terms(void) const;
@@ -128,6 +143,26 @@ public:
 
    void from_XML(const tinyxml2::XMLDocument&);
 
+private:
+
+   // PRIVATE METHODS
+
+   double calculate_single_precision_performance(const MultilayerPerceptron&) const;
+
+   static Matrix<float> arrange_batch(const Matrix<float>&, const size_t&, const size_t&);
+
+   // MEMBERS
+
+   /// True if the performance and the gradient on the training instances are computed in single precision, false otherwise.
+   /// The data is read from the single precision training blocks of the data set,
+   /// the instances are processed in batches with single precision matrix products,
+   /// and the performance and the gradient are accumulated in double precision. 
+
+   bool single_precision;
+
+   /// Number of training instances in each single precision batch.
+
+   static const size_t single_precision_batch_size = 256;
 };
 
 }
@@ -703,7 +703,11 @@ Vector< Histogram<double> > TestingAnalysis::calculate_error_data_histograms(con
 
    Vector< Histogram<double> > histograms(outputs_number);
 
-   for(size_t i = 0; i < outputs_number; i++)
+   int i = 0;
+
+   #pragma omp parallel for private(i)
+
+   for(i = 0; i < (int)outputs_number; i++)
    {
        histograms[i] = error_data[i].arrange_column(0).calculate_histogram(bins_number);
    }
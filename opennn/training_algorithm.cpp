@@ -25,7 +25,9 @@ namespace OpenNN
 /// It creates a training algorithm object not associated to any performance functional object.  
 
 TrainingAlgorithm::TrainingAlgorithm(void)
- : performance_functional_pointer(NULL)
+ : performance_functional_pointer(NULL),
+   resume_checkpoint_pointer(NULL),
+   history_first_iteration(0)
 { 
    set_default();
 }
@@ -38,7 +40,9 @@ TrainingAlgorithm::TrainingAlgorithm(void)
 /// @param new_performance_functional_pointer Pointer to a performance functional object.
 
 TrainingAlgorithm::TrainingAlgorithm(PerformanceFunctional* new_performance_functional_pointer)
- : performance_functional_pointer(new_performance_functional_pointer)
+ : performance_functional_pointer(new_performance_functional_pointer),
+   resume_checkpoint_pointer(NULL),
+   history_first_iteration(0)
 {
    set_default();
 }
@@ -51,7 +55,12 @@ TrainingAlgorithm::TrainingAlgorithm(PerformanceFunctional* new_performance_func
 /// It also loads the other members from a XML document.
 
 TrainingAlgorithm::TrainingAlgorithm(const tinyxml2::XMLDocument& document)
- : performance_functional_pointer(NULL)
+ : performance_functional_pointer(NULL),
+   checkpoint_period(0),
+   resume_checkpoint_pointer(NULL),
+   history_capacity(0),
+   history_stride(1),
+   history_first_iteration(0)
 { 
    from_XML(document);
 }
@@ -59,10 +68,21 @@ TrainingAlgorithm::TrainingAlgorithm(const tinyxml2::XMLDocument& document)
 
 // DESTRUCTOR 
 
-/// Destructor
+/// Destructor.
+/// It waits for any checkpoint being written on a background thread.
+/// Errors from that thread are discarded, since a destructor cannot report them.
 
 TrainingAlgorithm::~TrainingAlgorithm(void)
 { 
+   try
+   {
+      wait_checkpoint();
+   }
+   catch(const std::logic_error&)
+   {
+   }
+
+   delete resume_checkpoint_pointer;
 }
 
 
@@ -191,6 +211,59 @@ const std::string& TrainingAlgorithm::get_neural_network_file_name(void) const
 }
 
 
+// const size_t& get_checkpoint_period(void) const method
+
+/// Returns the number of iterations between training checkpoints.
+/// Zero means that no checkpoints are written.
+
+const size_t& TrainingAlgorithm::get_checkpoint_period(void) const
+{
+   return(checkpoint_period);
+}
+
+
+// const std::string& get_checkpoint_file_name(void) const method
+
+/// Returns the file name where the training checkpoints are saved.
+
+const std::string& TrainingAlgorithm::get_checkpoint_file_name(void) const
+{
+   return(checkpoint_file_name);
+}
+
+
+// const size_t& get_history_capacity(void) const method
+
+/// Returns the maximum number of records kept in memory for each training history.
+/// Zero means no limit.
+
+const size_t& TrainingAlgorithm::get_history_capacity(void) const
+{
+   return(history_capacity);
+}
+
+
+// const size_t& get_history_stride(void) const method
+
+/// Returns the number of iterations between training history records.
+
+const size_t& TrainingAlgorithm::get_history_stride(void) const
+{
+   return(history_stride);
+}
+
+
+// const std::string& get_history_file_name(void) const method
+
+/// Returns the file name where the training history records are appended.
+/// An empty name means that no history file is written.
+
+const std::string& TrainingAlgorithm::get_history_file_name(void) const
+{
+   return(history_file_name);
+}
+
+
 // void set(void) method
 
 /// Sets the performance functional pointer to NULL.
@@ -312,6 +385,77 @@ void TrainingAlgorithm::set_neural_network_file_name(const std::string& new_neur
 }
 
 
+// void set_checkpoint_period(const size_t&) method
+
+/// Sets a new number of iterations between training checkpoints.
+/// @param new_checkpoint_period Number of iterations between checkpoints. Zero disables the checkpoints.
+
+void TrainingAlgorithm::set_checkpoint_period(const size_t& new_checkpoint_period)
+{
+   checkpoint_period = new_checkpoint_period;
+}
+
+
+// void set_checkpoint_file_name(const std::string&) method
+
+/// Sets a new file name where the training checkpoints will be saved.
+/// @param new_checkpoint_file_name File name for the training checkpoints.
+
+void TrainingAlgorithm::set_checkpoint_file_name(const std::string& new_checkpoint_file_name)
+{
+   checkpoint_file_name = new_checkpoint_file_name;
+}
+
+
+// void set_history_capacity(const size_t&) method
+
+/// Sets the maximum number of records kept in memory for each training history.
+/// Once a history is full, each new record overwrites the oldest one. 
+/// @param new_history_capacity Maximum number of records. Zero means no limit.
+
+void TrainingAlgorithm::set_history_capacity(const size_t& new_history_capacity)
+{
+   history_capacity = new_history_capacity;
+}
+
+
+// void set_history_stride(const size_t&) method
+
+/// Sets the number of iterations between training history records.
+/// Record i of a history then corresponds to iteration i times the stride. 
+/// @param new_history_stride Number of iterations between records.
+
+void TrainingAlgorithm::set_history_stride(const size_t& new_history_stride)
+{
+   // Control sentence
+
+   if(new_history_stride == 0)
+   {
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: TrainingAlgorithm class.\n"
+             << "void set_history_stride(const size_t&) method.\n"
+             << "History stride must be greater than zero.\n";
+
+      throw std::logic_error(buffer.str());
+   }
+
+   history_stride = new_history_stride;
+}
+
+
+// void set_history_file_name(const std::string&) method
+
+/// Sets the file name where the training history records will be appended, 
+/// so that the whole history can be kept on disk while only a few records are kept in memory.
+/// @param new_history_file_name File name for the training history. An empty name writes no history file.
+
+void TrainingAlgorithm::set_history_file_name(const std::string& new_history_file_name)
+{
+   history_file_name = new_history_file_name;
+}
+
+
 // void set_default(void) method 
 
 /// Sets the members of the training algorithm object to their default values.
@@ -325,6 +469,588 @@ void TrainingAlgorithm::set_default(void)
    save_period = UINT_MAX;
 
    neural_network_file_name = "neural_network.xml";
+
+   checkpoint_period = 0;
+
+   checkpoint_file_name = "training_checkpoint.bin";
+
+   history_capacity = 0;
+
+   history_stride = 1;
+
+   history_file_name = "";
+}
+
+
+// TrainingAlgorithmResults* resume_training(const std::string&) method
+
+/// Resumes a training process from a checkpoint file written by this type of training algorithm.
+/// The neural network parameters, the iteration counter, the elapsed time and the optimizer state
+/// are restored, so that the process continues exactly as if it had not been interrupted. 
+/// The training history of the results only contains the iterations performed after resuming. 
+/// @param file_name Name of checkpoint file.
+
+TrainingAlgorithm::TrainingAlgorithmResults* TrainingAlgorithm::resume_training(const std::string& file_name)
+{
+   const TrainingCheckpoint checkpoint = load_checkpoint(file_name);
+
+   const NeuralNetwork* neural_network_pointer = performance_functional_pointer->get_neural_network_pointer();
+
+   if(checkpoint.training_algorithm_type != write_training_algorithm_type()
+   || checkpoint.parameters.size() != neural_network_pointer->count_parameters_number())
+   {
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: TrainingAlgorithm class.\n"
+             << "TrainingAlgorithmResults* resume_training(const std::string&) method.\n"
+             << "Checkpoint of " << checkpoint.training_algorithm_type << " with " << checkpoint.parameters.size() << " parameters "
+             << "does not match this training algorithm and neural network.\n";
+
+      throw std::logic_error(buffer.str());
+   }
+
+   delete resume_checkpoint_pointer;
+
+   resume_checkpoint_pointer = new TrainingCheckpoint(checkpoint);
+
+   TrainingAlgorithmResults* results_pointer = NULL;
+
+   try
+   {
+      results_pointer = perform_training();
+   }
+   catch(...)
+   {
+      delete resume_checkpoint_pointer;
+      resume_checkpoint_pointer = NULL;
+
+      throw;
+   }
+
+   delete resume_checkpoint_pointer;
+   resume_checkpoint_pointer = NULL;
+
+   return(results_pointer);
+}
+
+
+// void save_checkpoint(const TrainingCheckpoint&, const std::string&) method
+
+/// Saves a training checkpoint to a binary file.
+/// The checkpoint is first written to a temporary file, which then replaces the previous checkpoint,
+/// so that an interruption while writing never leaves a corrupted checkpoint.
+/// @param checkpoint Training checkpoint.
+/// @param file_name Name of checkpoint file.
+
+void TrainingAlgorithm::save_checkpoint(const TrainingCheckpoint& checkpoint, const std::string& file_name)
+{
+   const std::string temporary_file_name = file_name + ".tmp";
+
+   std::ofstream file(temporary_file_name.c_str(), std::ios::binary);
+
+   if(!file.is_open())
+   {
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: TrainingAlgorithm class.\n"
+             << "void save_checkpoint(const TrainingCheckpoint&, const std::string&) method.\n"
+             << "Cannot open checkpoint file: " << temporary_file_name << "\n";
+
+      throw std::logic_error(buffer.str());
+   }
+
+   const uint32_t version = 1;
+
+   const uint64_t type_size = checkpoint.training_algorithm_type.size();
+   const uint64_t iteration = checkpoint.iteration;
+   const uint64_t selection_failures = checkpoint.selection_failures;
+   const uint64_t parameters_number = checkpoint.parameters.size();
+   const uint64_t scalars_number = checkpoint.scalars.size();
+   const uint64_t vectors_number = checkpoint.vectors.size();
+
+   file.write("OPENNNC", 8);
+   file.write(reinterpret_cast<const char*>(&version), sizeof(uint32_t));
+
+   file.write(reinterpret_cast<const char*>(&type_size), sizeof(uint64_t));
+   file.write(checkpoint.training_algorithm_type.data(), type_size);
+
+   file.write(reinterpret_cast<const char*>(&iteration), sizeof(uint64_t));
+   file.write(reinterpret_cast<const char*>(&checkpoint.elapsed_time), sizeof(double));
+   file.write(reinterpret_cast<const char*>(&selection_failures), sizeof(uint64_t));
+   file.write(reinterpret_cast<const char*>(&checkpoint.old_performance), sizeof(double));
+   file.write(reinterpret_cast<const char*>(&checkpoint.old_selection_performance), sizeof(double));
+
+   file.write(reinterpret_cast<const char*>(&parameters_number), sizeof(uint64_t));
+   file.write(reinterpret_cast<const char*>(checkpoint.parameters.data()), parameters_number*sizeof(double));
+
+   file.write(reinterpret_cast<const char*>(&scalars_number), sizeof(uint64_t));
+   file.write(reinterpret_cast<const char*>(checkpoint.scalars.data()), scalars_number*sizeof(double));
+
+   file.write(reinterpret_cast<const char*>(&vectors_number), sizeof(uint64_t));
+
+   for(size_t i = 0; i < vectors_number; i++)
+   {
+      const uint64_t size = checkpoint.vectors[i].size();
+
+      file.write(reinterpret_cast<const char*>(&size), sizeof(uint64_t));
+      file.write(reinterpret_cast<const char*>(checkpoint.vectors[i].data()), size*sizeof(double));
+   }
+
+   file.close();
+
+   if(!file)
+   {
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: TrainingAlgorithm class.\n"
+             << "void save_checkpoint(const TrainingCheckpoint&, const std::string&) method.\n"
+             << "Cannot write checkpoint file: " << temporary_file_name << "\n";
+
+      throw std::logic_error(buffer.str());
+   }
+
+   #ifdef _WIN32
+
+   remove(file_name.c_str());
+
+   #endif
+
+   if(rename(temporary_file_name.c_str(), file_name.c_str()) != 0)
+   {
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: TrainingAlgorithm class.\n"
+             << "void save_checkpoint(const TrainingCheckpoint&, const std::string&) method.\n"
+             << "Cannot replace checkpoint file: " << file_name << "\n";
+
+      throw std::logic_error(buffer.str());
+   }
+}
+
+
+// TrainingCheckpoint load_checkpoint(const std::string&) method
+
+/// Loads a training checkpoint from a binary file written by save_checkpoint.
+/// @param file_name Name of checkpoint file.
+
+TrainingAlgorithm::TrainingCheckpoint TrainingAlgorithm::load_checkpoint(const std::string& file_name)
+{
+   std::ifstream file(file_name.c_str(), std::ios::binary);
+
+   if(!file.is_open())
+   {
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: TrainingAlgorithm class.\n"
+             << "TrainingCheckpoint load_checkpoint(const std::string&) method.\n"
+             << "Cannot open checkpoint file: " << file_name << "\n";
+
+      throw std::logic_error(buffer.str());
+   }
+
+   TrainingCheckpoint checkpoint;
+
+   char magic[8];
+   uint32_t version = 0;
+
+   uint64_t type_size = 0;
+   uint64_t iteration = 0;
+   uint64_t selection_failures = 0;
+   uint64_t parameters_number = 0;
+   uint64_t scalars_number = 0;
+   uint64_t vectors_number = 0;
+
+   file.read(magic, 8);
+   file.read(reinterpret_cast<char*>(&version), sizeof(uint32_t));
+
+   if(!file || memcmp(magic, "OPENNNC", 8) != 0 || version != 1)
+   {
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: TrainingAlgorithm class.\n"
+             << "TrainingCheckpoint load_checkpoint(const std::string&) method.\n"
+             << "Unknown checkpoint file format or version.\n";
+
+      throw std::logic_error(buffer.str());
+   }
+
+   // The stored sizes are checked against the rest of the file before anything is allocated
+
+   std::ostringstream buffer;
+
+   buffer << "OpenNN Exception: TrainingAlgorithm class.\n"
+          << "TrainingCheckpoint load_checkpoint(const std::string&) method.\n"
+          << "Unexpected end of checkpoint file.\n";
+
+   file.read(reinterpret_cast<char*>(&type_size), sizeof(uint64_t));
+
+   if(!file || type_size > count_remaining_bytes(file))
+   {
+      throw std::logic_error(buffer.str());
+   }
+
+   checkpoint.training_algorithm_type.resize((size_t)type_size);
+   file.read(&checkpoint.training_algorithm_type[0], type_size);
+
+   file.read(reinterpret_cast<char*>(&iteration), sizeof(uint64_t));
+   file.read(reinterpret_cast<char*>(&checkpoint.elapsed_time), sizeof(double));
+   file.read(reinterpret_cast<char*>(&selection_failures), sizeof(uint64_t));
+   file.read(reinterpret_cast<char*>(&checkpoint.old_performance), sizeof(double));
+   file.read(reinterpret_cast<char*>(&checkpoint.old_selection_performance), sizeof(double));
+
+   checkpoint.iteration = (size_t)iteration;
+   checkpoint.selection_failures = (size_t)selection_failures;
+
+   file.read(reinterpret_cast<char*>(&parameters_number), sizeof(uint64_t));
+
+   if(!file || parameters_number > count_remaining_bytes(file)/sizeof(double))
+   {
+      throw std::logic_error(buffer.str());
+   }
+
+   checkpoint.parameters.set((size_t)parameters_number);
+   file.read(reinterpret_cast<char*>(checkpoint.parameters.data()), parameters_number*sizeof(double));
+
+   file.read(reinterpret_cast<char*>(&scalars_number), sizeof(uint64_t));
+
+   if(!file || scalars_number > count_remaining_bytes(file)/sizeof(double))
+   {
+      throw std::logic_error(buffer.str());
+   }
+
+   checkpoint.scalars.set((size_t)scalars_number);
+   file.read(reinterpret_cast<char*>(checkpoint.scalars.data()), scalars_number*sizeof(double));
+
+   file.read(reinterpret_cast<char*>(&vectors_number), sizeof(uint64_t));
+
+   if(!file || vectors_number > count_remaining_bytes(file)/sizeof(uint64_t))
+   {
+      throw std::logic_error(buffer.str());
+   }
+
+   checkpoint.vectors.set((size_t)vectors_number);
+
+   for(size_t i = 0; i < vectors_number; i++)
+   {
+      uint64_t size = 0;
+
+      file.read(reinterpret_cast<char*>(&size), sizeof(uint64_t));
+
+      if(!file || size > count_remaining_bytes(file)/sizeof(double))
+      {
+         throw std::logic_error(buffer.str());
+      }
+
+      checkpoint.vectors[i].set((size_t)size);
+      file.read(reinterpret_cast<char*>(checkpoint.vectors[i].data()), size*sizeof(double));
+   }
+
+   if(!file)
+   {
+      throw std::logic_error(buffer.str());
+   }
+
+   return(checkpoint);
+}
+
+
+// uint64_t count_remaining_bytes(std::ifstream&) method
+
+/// Returns the number of bytes between the current position of a binary file and its end. 
+/// It is used to bound the sizes read from checkpoint and history files before allocating them. 
+/// @param file Binary input file stream.
+
+uint64_t TrainingAlgorithm::count_remaining_bytes(std::ifstream& file)
+{
+   const std::streampos position = file.tellg();
+
+   if(position < 0)
+   {
+      return(0);
+   }
+
+   file.seekg(0, std::ios::end);
+
+   const std::streampos end = file.tellg();
+
+   file.seekg(position);
+
+   if(end < position)
+   {
+      return(0);
+   }
+
+   return((uint64_t)(end - position));
+}
+
+
+// void wait_checkpoint(void) method
+
+/// Waits until the checkpoint being written on a background thread, if any, is complete.
+/// Errors from the background thread are rethrown here.
+
+void TrainingAlgorithm::wait_checkpoint(void)
+{
+   if(checkpoint_future.valid())
+   {
+      checkpoint_future.get();
+   }
+}
+
+
+// void write_checkpoint(const TrainingCheckpoint&) method
+
+/// Writes a training checkpoint on a background thread, so that training does not wait for the disk.
+/// Only one checkpoint is written at a time; if the previous one is still being written, this method waits for it first.
+/// @param checkpoint Training checkpoint.
+
+void TrainingAlgorithm::write_checkpoint(const TrainingCheckpoint& checkpoint)
+{
+   wait_checkpoint();
+
+   checkpoint_future = std::async(std::launch::async, &TrainingAlgorithm::save_checkpoint, checkpoint, checkpoint_file_name);
+}
+
+
+// void check_resume_checkpoint(const size_t&, const Vector<size_t>&) const method
+
+/// Checks that the checkpoint being resumed holds the optimizer state written by this training algorithm.
+/// If the number of scalars or the number or sizes of the vectors differ, the method throws an exception.
+/// @param scalars_number Number of scalars of the optimizer state.
+/// @param vectors_sizes Sizes of the vectors of the optimizer state.
+
+void TrainingAlgorithm::check_resume_checkpoint(const size_t& scalars_number, const Vector<size_t>& vectors_sizes) const
+{
+   bool valid = resume_checkpoint_pointer
+             && resume_checkpoint_pointer->scalars.size() == scalars_number
+             && resume_checkpoint_pointer->vectors.size() == vectors_sizes.size();
+
+   for(size_t i = 0; valid && i < vectors_sizes.size(); i++)
+   {
+      valid = (resume_checkpoint_pointer->vectors[i].size() == vectors_sizes[i]);
+   }
+
+   if(!valid)
+   {
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: TrainingAlgorithm class.\n"
+             << "void check_resume_checkpoint(const size_t&, const Vector<size_t>&) const method.\n"
+             << "Optimizer state of checkpoint does not match " << write_training_algorithm_type() << ".\n";
+
+      throw std::logic_error(buffer.str());
+   }
+}
+
+
+// size_t calculate_history_size(const size_t&) const method
+
+/// Returns the number of records to be allocated for each training history. 
+/// @param iterations_number Maximum number of iterations of the training process, including the initial one.
+
+size_t TrainingAlgorithm::calculate_history_size(const size_t& iterations_number) const
+{
+   const size_t records_number = (iterations_number + history_stride - 1)/history_stride;
+
+   if(history_capacity == 0 || records_number <= history_capacity)
+   {
+      return(records_number);
+   }
+   else
+   {
+      return(history_capacity);
+   }
+}
+
+
+// Matrix<double> load_history(const std::string&, const std::string&) method
+
+/// Loads the records of a training history from a history file.
+/// Each row of the returned matrix contains the iteration number followed by the recorded values.
+/// Vector histories give one column per element, and matrix histories give their elements by columns.
+/// @param file_name Name of training history file.
+/// @param name Name of training history, such as "parameters" or "performance".
+
+Matrix<double> TrainingAlgorithm::load_history(const std::string& file_name, const std::string& name)
+{
+   std::ifstream file(file_name.c_str(), std::ios::binary);
+
+   if(!file.is_open())
+   {
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: TrainingAlgorithm class.\n"
+             << "Matrix<double> load_history(const std::string&, const std::string&) method.\n"
+             << "Cannot open history file: " << file_name << "\n";
+
+      throw std::logic_error(buffer.str());
+   }
+
+   char magic[8];
+   uint32_t version = 0;
+
+   file.read(magic, 8);
+   file.read(reinterpret_cast<char*>(&version), sizeof(uint32_t));
+
+   if(!file || memcmp(magic, "OPENNNH", 8) != 0 || version != 1)
+   {
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: TrainingAlgorithm class.\n"
+             << "Matrix<double> load_history(const std::string&, const std::string&) method.\n"
+             << "Unknown history file format or version.\n";
+
+      throw std::logic_error(buffer.str());
+   }
+
+   Vector< Vector<double> > records;
+
+   std::string record_name;
+
+   uint64_t iteration;
+   uint64_t name_size;
+   uint64_t values_number;
+
+   while(file.read(reinterpret_cast<char*>(&iteration), sizeof(uint64_t)))
+   {
+      file.read(reinterpret_cast<char*>(&name_size), sizeof(uint64_t));
+
+      // A record cut short by an interrupted training process ends the history
+
+      if(!file || name_size > count_remaining_bytes(file))
+      {
+         break;
+      }
+
+      record_name.resize((size_t)name_size);
+      file.read(&record_name[0], name_size);
+
+      file.read(reinterpret_cast<char*>(&values_number), sizeof(uint64_t));
+
+      if(!file || values_number > count_remaining_bytes(file)/sizeof(double))
+      {
+         break;
+      }
+
+      if(record_name == name)
+      {
+         Vector<double> record((size_t)values_number+1);
+
+         record[0] = (double)iteration;
+
+         file.read(reinterpret_cast<char*>(record.data()+1), values_number*sizeof(double));
+
+         if(file)
+         {
+            records.push_back(record);
+         }
+      }
+      else
+      {
+         file.seekg(values_number*sizeof(double), std::ios::cur);
+      }
+   }
+
+   Matrix<double> history;
+
+   if(records.empty())
+   {
+      return(history);
+   }
+
+   history.set(records.size(), records[0].size());
+
+   for(size_t i = 0; i < records.size(); i++)
+   {
+      if(records[i].size() != history.get_columns_number())
+      {
+         std::ostringstream buffer;
+
+         buffer << "OpenNN Exception: TrainingAlgorithm class.\n"
+                << "Matrix<double> load_history(const std::string&, const std::string&) method.\n"
+                << "Records of " << name << " history have different sizes.\n";
+
+         throw std::logic_error(buffer.str());
+      }
+
+      history.set_row(i, records[i]);
+   }
+
+   return(history);
+}
+
+
+// void open_history_file(void) method
+
+/// Opens the history file for appending, if a history file name has been set.
+/// A new file starts with a header which identifies the format.
+
+void TrainingAlgorithm::open_history_file(void)
+{
+   close_history_file();
+
+   if(history_file_name.empty())
+   {
+      return;
+   }
+
+   history_file.open(history_file_name.c_str(), std::ios::binary | std::ios::app);
+
+   if(!history_file.is_open())
+   {
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: TrainingAlgorithm class.\n"
+             << "void open_history_file(void) method.\n"
+             << "Cannot open history file: " << history_file_name << "\n";
+
+      throw std::logic_error(buffer.str());
+   }
+
+   history_file.seekp(0, std::ios::end);
+
+   if(history_file.tellp() == std::streampos(0))
+   {
+      const uint32_t version = 1;
+
+      history_file.write("OPENNNH", 8);
+      history_file.write(reinterpret_cast<const char*>(&version), sizeof(uint32_t));
+   }
+}
+
+
+// void close_history_file(void) method
+
+/// Closes the history file, if it is open.
+
+void TrainingAlgorithm::close_history_file(void)
+{
+   if(history_file.is_open())
+   {
+      history_file.close();
+   }
+}
+
+
+// void write_history_record(const std::string&, const size_t&, const double*, const size_t&) method
+
+/// Appends a training history record to the history file.
+/// @param name Name of training history.
+/// @param iteration Iteration of the record.
+/// @param values Pointer to the recorded values.
+/// @param values_number Number of recorded values.
+
+void TrainingAlgorithm::write_history_record(const std::string& name, const size_t& iteration, const double* values, const size_t& values_number)
+{
+   const uint64_t record_iteration = iteration;
+   const uint64_t name_size = name.size();
+   const uint64_t record_values_number = values_number;
+
+   history_file.write(reinterpret_cast<const char*>(&record_iteration), sizeof(uint64_t));
+   history_file.write(reinterpret_cast<const char*>(&name_size), sizeof(uint64_t));
+   history_file.write(name.data(), name_size);
+   history_file.write(reinterpret_cast<const char*>(&record_values_number), sizeof(uint64_t));
+   history_file.write(reinterpret_cast<const char*>(values), values_number*sizeof(double));
 }
 
 
@@ -533,7 +1259,7 @@ void TrainingAlgorithm::load(const std::string& file_name)
 
 void TrainingAlgorithm::initialize_random(void)
 {
-   switch(rand()%2)
+   switch(calculate_random_index(2))
    {
       case 0:
       {
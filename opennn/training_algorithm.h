@@ -23,6 +23,10 @@
 #include <limits>
 #include <cmath>
 #include <ctime>
+#include <cstdio>
+#include <cstring>
+#include <future>
+#include <stdint.h>
 
 // OpenNN includes
 
@@ -106,6 +110,58 @@ public:
    };
 
 
+   ///
+   /// This structure contains the state of a training process at the beginning of an iteration,
+   /// which is enough to resume that process exactly from there. 
+   ///
+
+   struct TrainingCheckpoint
+   {
+       /// Default constructor.
+
+       explicit TrainingCheckpoint(void)
+        : iteration(0), elapsed_time(0.0), selection_failures(0), old_performance(0.0), old_selection_performance(0.0)
+       {
+       }
+
+       /// Type of training algorithm which wrote the checkpoint.
+
+       std::string training_algorithm_type;
+
+       /// Index of the next iteration to be performed.
+
+       size_t iteration;
+
+       /// Training time until the checkpoint.
+
+       double elapsed_time;
+
+       /// Number of selection failures until the checkpoint.
+
+       size_t selection_failures;
+
+       /// Performance in the previous iteration.
+
+       double old_performance;
+
+       /// Selection performance in the previous iteration.
+
+       double old_selection_performance;
+
+       /// Neural network parameters at the beginning of the next iteration.
+
+       Vector<double> parameters;
+
+       /// Scalars of the optimizer state, specific to each training algorithm.
+
+       Vector<double> scalars;
+
+       /// Vectors of the optimizer state, specific to each training algorithm.
+
+       Vector< Vector<double> > vectors;
+   };
+
+
    // METHODS
 
    // Get methods
@@ -124,6 +180,13 @@ public:
 
    const std::string& get_neural_network_file_name(void) const;
 
+   const size_t& get_checkpoint_period(void) const;
+   const std::string& get_checkpoint_file_name(void) const;
+
+   const size_t& get_history_capacity(void) const;
+   const size_t& get_history_stride(void) const;
+   const std::string& get_history_file_name(void) const;
+
    // Set methods
 
    void set(void);
@@ -139,6 +202,13 @@ public:
    void set_save_period(const size_t&);
    void set_neural_network_file_name(const std::string&);
 
+   void set_checkpoint_period(const size_t&);
+   void set_checkpoint_file_name(const std::string&);
+
+   void set_history_capacity(const size_t&);
+   void set_history_stride(const size_t&);
+   void set_history_file_name(const std::string&);
+
    // Training methods
 
    virtual void check(void) const;
@@ -147,6 +217,24 @@ public:
 
    virtual TrainingAlgorithmResults* perform_training(void) = 0;
 
+   TrainingAlgorithmResults* resume_training(const std::string&);
+
+   // Checkpoint methods
+
+   static void save_checkpoint(const TrainingCheckpoint&, const std::string&);
+   static TrainingCheckpoint load_checkpoint(const std::string&);
+
+   void wait_checkpoint(void);
+
+   // History methods
+
+   size_t calculate_history_size(const size_t&) const;
+
+   template<class T>
+   void arrange_history(Vector<T>&, const size_t&) const;
+
+   static Matrix<double> load_history(const std::string&, const std::string&);
+
    virtual std::string write_training_algorithm_type(void) const;
 
    // Serialization methods
@@ -166,6 +254,40 @@ public:
 
 protected:
 
+   void write_checkpoint(const TrainingCheckpoint&);
+   void check_resume_checkpoint(const size_t&, const Vector<size_t>&) const;
+
+   static uint64_t count_remaining_bytes(std::ifstream&);
+
+   void open_history_file(void);
+   void close_history_file(void);
+
+   template<class T>
+   void record_history(Vector<T>&, const std::string&, const size_t&, const T&);
+
+   void write_history_record(const std::string&, const size_t&, const double*, const size_t&);
+
+   /// Writes a scalar history record to the history file.
+
+   void write_history_record(const std::string& name, const size_t& iteration, const double& value)
+   {
+      write_history_record(name, iteration, &value, 1);
+   }
+
+   /// Writes a vector history record to the history file.
+
+   void write_history_record(const std::string& name, const size_t& iteration, const Vector<double>& value)
+   {
+      write_history_record(name, iteration, value.data(), value.size());
+   }
+
+   /// Writes a matrix history record to the history file.
+
+   void write_history_record(const std::string& name, const size_t& iteration, const Matrix<double>& value)
+   {
+      write_history_record(name, iteration, value.data(), value.size());
+   }
+
    // FIELDS
 
    /// Pointer to a performance functional for a multilayer perceptron object.
@@ -189,8 +311,103 @@ protected:
    /// Display messages to screen.
 
    bool display;
+
+   // CHECKPOINTS
+
+   /// Number of iterations between training checkpoints. Zero means that no checkpoints are written.
+
+   size_t checkpoint_period;
+
+   /// Path where the training checkpoints are saved.
+
+   std::string checkpoint_file_name;
+
+   /// Checkpoint from which the next training process is resumed, or NULL for a new training process.
+
+   TrainingCheckpoint* resume_checkpoint_pointer;
+
+   /// Checkpoint being written on a background thread.
+
+   std::future<void> checkpoint_future;
+
+   // HISTORY
+
+   /// Maximum number of records kept in memory for each training history.
+   /// When it is exceeded, the oldest records are overwritten. Zero means no limit.
+
+   size_t history_capacity;
+
+   /// Number of iterations between training history records.
+
+   size_t history_stride;
+
+   /// Iteration at which the current training process started, which is not zero when it is resumed from a checkpoint.
+   /// The training history records are counted from it.
+
+   size_t history_first_iteration;
+
+   /// Path of a binary file where the training history records are also appended. Empty means no file.
+
+   std::string history_file_name;
+
+   /// Stream to the training history file.
+
+   std::ofstream history_file;
 };
 
+
+// void arrange_history(Vector<T>&, const size_t&) const method
+
+/// Sorts the records of a training history in chronological order and removes the unused ones,
+/// once the last iteration of a training process is known.
+/// Only the iterations from the first iteration of the training process are kept. 
+/// @param history Training history.
+/// @param iteration Last iteration of the training process.
+
+template<class T>
+void TrainingAlgorithm::arrange_history(Vector<T>& history, const size_t& iteration) const
+{
+   const size_t records_number = (iteration - history_first_iteration)/history_stride + 1;
+
+   if(history_capacity == 0 || records_number <= history_capacity)
+   {
+      history.resize(records_number);
+   }
+   else
+   {
+      std::rotate(history.begin(), history.begin() + records_number%history_capacity, history.end());
+   }
+}
+
+
+// void record_history(Vector<T>&, const std::string&, const size_t&, const T&) method
+
+/// Records a value in a training history, every history stride iterations from the first iteration of the training process.
+/// When the history capacity is reached, the oldest record is overwritten.
+/// The record is also appended to the history file, if it is open.
+/// @param history Training history, sized with calculate_history_size.
+/// @param name Name of the training history in the history file.
+/// @param iteration Current iteration.
+/// @param value Value to be recorded.
+
+template<class T>
+void TrainingAlgorithm::record_history(Vector<T>& history, const std::string& name, const size_t& iteration, const T& value)
+{
+   if((iteration - history_first_iteration)%history_stride != 0)
+   {
+      return;
+   }
+
+   const size_t record_index = (iteration - history_first_iteration)/history_stride;
+
+   history[history_capacity == 0 ? record_index : record_index%history_capacity] = value;
+
+   if(history_file.is_open())
+   {
+      write_history_record(name, iteration, value);
+   }
+}
+
 }
 
 #endif
@@ -466,6 +466,8 @@ void TrainingRateAlgorithm::set_display(const bool& new_display)
 
 Vector<double> TrainingRateAlgorithm::calculate_directional_point(const double& performance, const Vector<double>& training_direction, const double& initial_training_rate) const 
 {
+   OPENNN_SCOPED_TIMER("training_rate_algorithm.line_search");
+
    #ifdef __OPENNN_DEBUG__ 
 
    if(performance_functional_pointer == NULL)
@@ -32,6 +32,7 @@ TrainingStrategy::TrainingStrategy(void)
  , conjugate_gradient_pointer(NULL)
  , quasi_Newton_method_pointer(NULL)
  , Levenberg_Marquardt_algorithm_pointer(NULL)
+ , ensemble_training_pointer(NULL)
  , Newton_method_pointer(NULL)
 {
     set_initialization_type(NO_INITIALIZATION);
@@ -57,6 +58,7 @@ TrainingStrategy::TrainingStrategy(PerformanceFunctional* new_performance_functi
  , conjugate_gradient_pointer(NULL)
  , quasi_Newton_method_pointer(NULL)
  , Levenberg_Marquardt_algorithm_pointer(NULL)
+ , ensemble_training_pointer(NULL)
  , Newton_method_pointer(NULL)
 {
     set_initialization_type(NO_INITIALIZATION);
@@ -82,6 +84,7 @@ TrainingStrategy::TrainingStrategy(const tinyxml2::XMLDocument& document)
  , conjugate_gradient_pointer(NULL)
  , quasi_Newton_method_pointer(NULL)
  , Levenberg_Marquardt_algorithm_pointer(NULL)
+ , ensemble_training_pointer(NULL)
  , Newton_method_pointer(NULL)
 {
     set_initialization_type(NO_INITIALIZATION);
@@ -109,6 +112,7 @@ TrainingStrategy::TrainingStrategy(const std::string& file_name)
  , conjugate_gradient_pointer(NULL)
  , quasi_Newton_method_pointer(NULL)
  , Levenberg_Marquardt_algorithm_pointer(NULL)
+ , ensemble_training_pointer(NULL)
  , Newton_method_pointer(NULL)
 {
     set_initialization_type(NO_INITIALIZATION);
@@ -135,6 +139,7 @@ TrainingStrategy::~TrainingStrategy(void)
     delete conjugate_gradient_pointer;
     delete quasi_Newton_method_pointer;
     delete Levenberg_Marquardt_algorithm_pointer;
+    delete ensemble_training_pointer;
 
     delete Newton_method_pointer;
 }
@@ -193,7 +198,7 @@ void TrainingStrategy::initialize_random(void)
 {
     // Initialization training algorithm
 
-    switch(rand()%2)
+    switch(calculate_random_index(2))
     {
       case 0:
       {
@@ -396,6 +401,28 @@ LevenbergMarquardtAlgorithm* TrainingStrategy::get_Levenberg_Marquardt_algorithm
 }
 
 
+// EnsembleTraining* get_ensemble_training_pointer(void) const method
+
+/// Returns a pointer to the ensemble training main algorithm.
+/// It also throws an exception if that pointer is NULL.
+
+EnsembleTraining* TrainingStrategy::get_ensemble_training_pointer(void) const
+{
+    if(!ensemble_training_pointer)
+    {
+        std::ostringstream buffer;
+
+        buffer << "OpenNN Exception: TrainingStrategy class.\n"
+               << "EnsembleTraining* get_ensemble_training_pointer(void) const method.\n"
+               << "Ensemble training pointer is NULL.\n";
+
+        throw std::logic_error(buffer.str());
+    }
+
+    return(ensemble_training_pointer);
+}
+
+
 // NewtonMethod* get_Newton_method_pointer(void) const method
 
 /// Returns a pointer to the Newton method refinement algorithm.
@@ -509,6 +536,10 @@ std::string TrainingStrategy::write_main_type(void) const
    {
       return("LEVENBERG_MARQUARDT_ALGORITHM");
    }
+   else if(main_type == ENSEMBLE_TRAINING)
+   {
+      return("ENSEMBLE_TRAINING");
+   }
    else if(main_type == USER_MAIN)
    {
       return("USER_MAIN");
@@ -618,6 +649,10 @@ std::string TrainingStrategy::write_main_type_text(void) const
    {
       return("Levenberg-Marquardt algorithm");
    }
+   else if(main_type == ENSEMBLE_TRAINING)
+   {
+      return("ensemble training");
+   }
    else if(main_type == USER_MAIN)
    {
       return("user defined");
@@ -809,6 +844,12 @@ void TrainingStrategy::set_main_type(const MainType& new_main_type)
       }
       break;
 
+      case ENSEMBLE_TRAINING:
+      {
+         ensemble_training_pointer = new EnsembleTraining(performance_functional_pointer);
+      }
+      break;
+
       case USER_MAIN:
       {
          // do nothing
@@ -940,6 +981,10 @@ void TrainingStrategy::set_main_type(const std::string& new_main_type)
    {
       set_main_type(LEVENBERG_MARQUARDT_ALGORITHM);
    }
+   else if(new_main_type == "ENSEMBLE_TRAINING")
+   {
+      set_main_type(ENSEMBLE_TRAINING);
+   }
    else if(new_main_type == "USER_MAIN")
    {
       set_main_type(USER_MAIN);
@@ -1074,6 +1119,12 @@ void TrainingStrategy::set_performance_functional_pointer(PerformanceFunctional*
       }
       break;
 
+      case ENSEMBLE_TRAINING:
+      {
+         ensemble_training_pointer->set_performance_functional_pointer(new_performance_functional_pointer);
+      }
+      break;
+
       case USER_MAIN:
       {
          // do nothing
@@ -1214,6 +1265,12 @@ void TrainingStrategy::set_display(const bool& new_display)
       }
       break;
 
+      case ENSEMBLE_TRAINING:
+      {
+           ensemble_training_pointer->set_display(display);
+      }
+      break;
+
       case USER_MAIN:
       {
          // do nothing
@@ -1312,11 +1369,13 @@ void TrainingStrategy::destruct_main(void)
     delete conjugate_gradient_pointer;
     delete quasi_Newton_method_pointer;
     delete Levenberg_Marquardt_algorithm_pointer;
+    delete ensemble_training_pointer;
 
     gradient_descent_pointer = NULL;
     conjugate_gradient_pointer = NULL;
     quasi_Newton_method_pointer = NULL;
     Levenberg_Marquardt_algorithm_pointer = NULL;
+    ensemble_training_pointer = NULL;
 
    main_type = NO_MAIN;
 }
@@ -1440,6 +1499,8 @@ TrainingStrategy::Results TrainingStrategy::perform_training(void)
 
    Results training_strategy_results;
 
+   const Vector<Instrumentation::Record> beginning_instrumentation_records = Instrumentation::get_records();
+
    // Initialization
 
    switch(initialization_type)
@@ -1534,6 +1595,15 @@ TrainingStrategy::Results TrainingStrategy::perform_training(void)
       }
       break;
 
+      case ENSEMBLE_TRAINING:
+      {
+           ensemble_training_pointer->set_display(display);
+
+           training_strategy_results.ensemble_training_results_pointer
+           = ensemble_training_pointer->perform_training();
+      }
+      break;
+
       case USER_MAIN:
       {
          // do nothing
@@ -1591,6 +1661,9 @@ TrainingStrategy::Results TrainingStrategy::perform_training(void)
       break;
    }
 
+   training_strategy_results.instrumentation_records
+   = Instrumentation::calculate_records_difference(Instrumentation::get_records(), beginning_instrumentation_records);
+
    return(training_strategy_results);
 }
 
@@ -1686,6 +1759,12 @@ std::string TrainingStrategy::to_string(void) const
       }
       break;
 
+      case ENSEMBLE_TRAINING:
+      {
+           buffer << ensemble_training_pointer->to_string();
+      }
+      break;
+
       case USER_MAIN:
       {
          // do nothing
@@ -1923,6 +2002,23 @@ tinyxml2::XMLDocument* TrainingStrategy::to_XML(void) const
       }
       break;
 
+      case ENSEMBLE_TRAINING:
+      {
+           tinyxml2::XMLElement* main_element = document->NewElement("Main");
+           training_strategy_element->LinkEndChild(main_element);
+
+           main_element->SetAttribute("Type", "ENSEMBLE_TRAINING");
+
+           const tinyxml2::XMLDocument* ensemble_training_document = ensemble_training_pointer->to_XML();
+
+           const tinyxml2::XMLElement* ensemble_training_element = ensemble_training_document->FirstChildElement("EnsembleTraining");
+
+           DeepClone(main_element, ensemble_training_element, document, NULL);
+
+           delete ensemble_training_document;
+      }
+      break;
+
       case USER_MAIN:
       {
          // do nothing
@@ -2157,6 +2253,19 @@ void TrainingStrategy::from_XML(const tinyxml2::XMLDocument& document)
              }
              break;
 
+             case ENSEMBLE_TRAINING:
+             {
+                  tinyxml2::XMLDocument new_document;
+
+                  tinyxml2::XMLElement* element_clone = new_document.NewElement("EnsembleTraining");
+                  new_document.InsertFirstChild(element_clone);
+
+                  DeepClone(element_clone, element, &new_document, NULL);
+
+                  ensemble_training_pointer->from_XML(new_document);
+             }
+             break;
+
              case USER_MAIN:
              {
                 // do nothing
@@ -2310,6 +2419,8 @@ TrainingStrategy::Results::Results(void)
 
     Levenberg_Marquardt_algorithm_results_pointer = NULL;
 
+    ensemble_training_results_pointer = NULL;
+
     Newton_method_results_pointer = NULL;
 }
 
@@ -2330,6 +2441,8 @@ TrainingStrategy::Results::~Results(void)
 
 //    delete Levenberg_Marquardt_algorithm_results_pointer;
 
+//    delete ensemble_training_results_pointer;
+
 //    delete Newton_method_results_pointer;
 
 }
@@ -2374,11 +2487,22 @@ void TrainingStrategy::Results::save(const std::string& file_name) const
       file << Levenberg_Marquardt_algorithm_results_pointer->to_string();
    }
 
+   if(ensemble_training_results_pointer)
+   {
+      file << ensemble_training_results_pointer->to_string();
+   }
+
    if(Newton_method_results_pointer)
    {
       file << Newton_method_results_pointer->to_string();
    }
 
+   if(!instrumentation_records.empty())
+   {
+      file << "% Instrumentation:\n"
+           << Instrumentation::to_CSV(instrumentation_records);
+   }
+
    file.close();
 }
 
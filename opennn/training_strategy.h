@@ -37,9 +37,12 @@
 #include "conjugate_gradient.h"
 #include "quasi_newton_method.h"
 #include "levenberg_marquardt_algorithm.h"
+#include "ensemble_training.h"
 
 #include "newton_method.h"
 
+#include "instrumentation.h"
+
 // TinyXml includes
 
 #include "../tinyxml2/tinyxml2.h"
@@ -101,6 +104,7 @@ public:
        CONJUGATE_GRADIENT,
        QUASI_NEWTON_METHOD,
        LEVENBERG_MARQUARDT_ALGORITHM,
+       ENSEMBLE_TRAINING,
        USER_MAIN
     };
 
@@ -155,10 +159,19 @@ public:
 
         LevenbergMarquardtAlgorithm::LevenbergMarquardtAlgorithmResults* Levenberg_Marquardt_algorithm_results_pointer;
 
+        /// Pointer to a structure with the results from the ensemble training algorithm.
+
+        EnsembleTraining::EnsembleTrainingResults* ensemble_training_results_pointer;
+
         /// Pointer to a structure with results from the Newton method training algorithm.
 
         NewtonMethod::NewtonMethodResults* Newton_method_results_pointer;
 
+        /// Timers and counters accumulated during the training process.
+        /// It is empty unless the library is compiled with instrumentation.
+
+        Vector<Instrumentation::Record> instrumentation_records;
+
   };
 
    // METHODS
@@ -185,6 +198,7 @@ public:
    ConjugateGradient* get_conjugate_gradient_pointer(void) const;
    QuasiNewtonMethod* get_quasi_Newton_method_pointer(void) const;
    LevenbergMarquardtAlgorithm* get_Levenberg_Marquardt_algorithm_pointer(void) const;
+   EnsembleTraining* get_ensemble_training_pointer(void) const;
 
    NewtonMethod* get_Newton_method_pointer(void) const;
 
@@ -276,6 +290,10 @@ protected:
 
     LevenbergMarquardtAlgorithm* Levenberg_Marquardt_algorithm_pointer;
 
+    /// Pointer to an ensemble training object to be used as a main training algorithm.
+
+    EnsembleTraining* ensemble_training_pointer;
+
     /// Pointer to a Newton method object to be used for refinement in the training strategy.
 
     NewtonMethod* Newton_method_pointer;
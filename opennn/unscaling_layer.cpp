@@ -650,7 +650,7 @@ void UnscalingLayer::initialize_random(void)
 
     // Unscaling method
 
-    switch(rand()%2)
+    switch(calculate_random_index(2))
     {
       case 0:
       {
@@ -744,6 +744,80 @@ Vector<double> UnscalingLayer::calculate_outputs(const Vector<double>& inputs) c
 }  
 
 
+// Matrix<float> calculate_outputs(const Matrix<float>&) const method
+
+/// Unscales a batch of outputs in single precision with the unscaling method of the layer.
+/// Each column is unscaled with the same statistics and the same rule for constant variables as the double precision outputs. 
+/// @param inputs Matrix of inputs, with the instances in the rows and the unscaling neurons in the columns. 
+
+Matrix<float> UnscalingLayer::calculate_outputs(const Matrix<float>& inputs) const
+{
+   const size_t rows_number = inputs.get_rows_number();
+   const size_t unscaling_neurons_number = get_unscaling_neurons_number();
+
+   // Control sentence (if debug)
+
+   #ifdef __OPENNN_DEBUG__ 
+
+   if(inputs.get_columns_number() != unscaling_neurons_number) 
+   {
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: UnscalingLayer class.\n"
+             << "Matrix<float> calculate_outputs(const Matrix<float>&) const method.\n"
+             << "Number of columns must be equal to number of unscaling neurons.\n";
+
+	  throw std::logic_error(buffer.str());
+   }   
+
+   #endif
+
+   if(unscaling_method == NoUnscaling)
+   {
+      return(inputs);
+   }
+
+   if(unscaling_method != MinimumMaximum && unscaling_method != MeanStandardDeviation)
+   {
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: UnscalingLayer class.\n"
+             << "Matrix<float> calculate_outputs(const Matrix<float>&) const method.\n"
+             << "Unknown unscaling method.\n";
+
+      throw std::logic_error(buffer.str());
+   }
+
+   Matrix<float> outputs(inputs);
+
+   for(size_t j = 0; j < unscaling_neurons_number; j++)
+   {
+      float offset = 0.0f;
+      float factor = 1.0f;
+      float shift = 0.0f;
+
+      if(unscaling_method == MinimumMaximum && statistics[j].maximum-statistics[j].minimum >= 1e-99)
+      {
+         offset = -1.0f;
+         factor = (float)(0.5*(statistics[j].maximum-statistics[j].minimum));
+         shift = (float)statistics[j].minimum;
+      }
+      else if(unscaling_method == MeanStandardDeviation && statistics[j].standard_deviation >= 1e-99)
+      {
+         factor = (float)statistics[j].standard_deviation;
+         shift = (float)statistics[j].mean;
+      }
+
+      for(size_t i = 0; i < rows_number; i++)
+      {
+         outputs(i,j) = (inputs(i,j) - offset)*factor + shift;
+      }
+   }
+
+   return(outputs);
+}
+
+
 // Vector<double> calculate_derivatives(const Vector<double>&) const method
 
 /// This method retuns the derivatives of the unscaled outputs with respect to the scaled outputs.
@@ -150,6 +150,7 @@ public:
    void initialize_random(void);
 
    Vector<double> calculate_outputs(const Vector<double>&) const;
+   Matrix<float> calculate_outputs(const Matrix<float>&) const;
    Vector<double> calculate_derivatives(const Vector<double>&) const;
    Vector<double> calculate_second_derivatives(const Vector<double>&) const;
 
@@ -89,6 +89,8 @@ Variables::Variables(const Variables& other_variables)
    // Utilities
 
    display = other_variables.display;
+
+   reset_indices();
 }
 
 
@@ -118,6 +120,8 @@ Variables& Variables::operator=(const Variables& other_variables)
       // Utilities
 
       display = other_variables.display;
+
+      reset_indices();
    }
 
    return(*this);
@@ -212,11 +216,7 @@ bool Variables::empty(void) const
 
 size_t Variables::count_used_variables_number(void) const
 {
-    const size_t variables_number = get_variables_number();
-
-    const size_t unused_variables_number = count_unused_variables_number();
-
-    return(variables_number - unused_variables_number);
+    return(get_used_indices().size());
 }
 
 
@@ -226,19 +226,7 @@ size_t Variables::count_used_variables_number(void) const
 
 size_t Variables::count_unused_variables_number(void) const
 {
-   const size_t variables_number = get_variables_number();
-
-   size_t count = 0;
-
-   for(size_t i = 0; i < variables_number; i++)
-   {
-      if(items[i].use == Unused)
-	  {
-	     count++;
-	  }
-   }
-
-   return(count);
+   return(get_unused_indices().size());
 }
 
 
@@ -248,19 +236,7 @@ size_t Variables::count_unused_variables_number(void) const
 
 size_t Variables::count_inputs_number(void) const
 {
-   const size_t variables_number = get_variables_number();
-
-   size_t count = 0;
-
-   for(size_t i = 0; i < variables_number; i++)
-   {
-      if(items[i].use == Input)
-	  {
-	     count++;
-	  }
-   }
-
-   return(count);
+   return(get_inputs_indices().size());
 }
 
 
@@ -270,19 +246,7 @@ size_t Variables::count_inputs_number(void) const
 
 size_t Variables::count_targets_number(void) const
 {
-   const size_t variables_number = get_variables_number();
-
-   size_t count = 0;
-
-   for(size_t i = 0; i < variables_number; i++)
-   {
-      if(items[i].use == Target)
-	  {
-	     count++;
-	  }
-   }
-
-   return(count);
+   return(get_targets_indices().size());
 }
 
 
@@ -294,25 +258,13 @@ size_t Variables::count_targets_number(void) const
 
 Vector<size_t> Variables::count_uses(void) const
 {
-    Vector<size_t> count(3, 0);
+    update_indices();
 
-    const size_t variables_number = get_variables_number();
+    Vector<size_t> count(3);
 
-    for(size_t i = 0; i < variables_number; i++)
-    {
-        if(items[i].use == Input)
-        {
-           count[0]++;
-        }
-        else if(items[i].use == Target)
-        {
-           count[1]++;
-        }
-        else
-        {
-           count[2]++;
-        }
-    }
+    count[0] = inputs_indices.size();
+    count[1] = targets_indices.size();
+    count[2] = unused_indices.size();
 
     return(count);
 }
@@ -492,103 +444,101 @@ Matrix<std::string> Variables::arrange_information(void) const
 
 Vector<size_t> Variables::arrange_used_indices(void) const
 {
-    const size_t variables_number = get_variables_number();
+   return(get_used_indices());
+}
 
-    const size_t used_variables_number = count_used_variables_number();
 
-    Vector<size_t> used_indices(used_variables_number);
+// Vector<size_t> arrange_inputs_indices(void) const method
 
-    size_t index = 0;
+/// Returns the indices of the input variables.
 
-    for(size_t i = 0; i < variables_number; i++)
-    {
-        if(items[i].use == Input
-        || items[i].use == Target)
-        {
-            used_indices[index] = i;
-            index++;
-        }
-    }
+Vector<size_t> Variables::arrange_inputs_indices(void) const
+{
+   return(get_inputs_indices());
+}
+
+
+// Vector<size_t> arrange_targets_indices(void) const method
+
+/// Returns the indices of the target variables.
 
-    return(used_indices);
+Vector<size_t> Variables::arrange_targets_indices(void) const
+{
+   return(get_targets_indices());
 }
 
 
-// Vector<size_t> arrange_inputs_indices(void) const method
+// Vector<size_t> arrange_unused_indices(void) const method
 
-/// Returns the indices of the input variables.
+/// Returns the indices of the unused variables.
 
-Vector<size_t> Variables::arrange_inputs_indices(void) const
+Vector<size_t> Variables::arrange_unused_indices(void) const
 {
-   const size_t variables_number = get_variables_number();
-   const size_t inputs_number = count_inputs_number();
+   return(get_unused_indices());
+}
 
-   Vector<size_t> inputs_indices(inputs_number);
 
-   size_t index = 0;
+// const Vector<size_t>& get_used_indices(void) const method
 
-   for(size_t i = 0; i < variables_number; i++)
-   {
-      if(items[i].use == Input)
-	  {
-	     inputs_indices[index] = i;
-		 index++;
-	  }
-   }
+/// Returns a reference to the indices of the used variables.
+/// The indices are only computed again when the uses of the variables change.
 
-   return(inputs_indices);
+const Vector<size_t>& Variables::get_used_indices(void) const
+{
+   update_indices();
+
+   return(used_indices);
 }
 
 
-// Vector<size_t> arrange_targets_indices(void) const method
+// const Vector<size_t>& get_inputs_indices(void) const method
 
-/// Returns the indices of the target variables.
+/// Returns a reference to the indices of the input variables.
+/// The indices are only computed again when the uses of the variables change.
 
-Vector<size_t> Variables::arrange_targets_indices(void) const
+const Vector<size_t>& Variables::get_inputs_indices(void) const
 {
-   const size_t variables_number = get_variables_number();
-   const size_t targets_number = count_targets_number();
+   update_indices();
 
-   Vector<size_t> targets_indices(targets_number);
+   return(inputs_indices);
+}
 
-   size_t index = 0;
 
-   for(size_t i = 0; i < variables_number; i++)
-   {
-      if(items[i].use == Target)
-	  {
-	     targets_indices[index] = i;
-		 index++;
-	  }
-   }
+// const Vector<size_t>& get_targets_indices(void) const method
+
+/// Returns a reference to the indices of the target variables.
+/// The indices are only computed again when the uses of the variables change.
+
+const Vector<size_t>& Variables::get_targets_indices(void) const
+{
+   update_indices();
 
    return(targets_indices);
 }
 
 
-// Vector<size_t> arrange_unused_indices(void) const method
+// const Vector<size_t>& get_unused_indices(void) const method
 
-/// Returns the indices of the unused variables.
+/// Returns a reference to the indices of the unused variables.
+/// The indices are only computed again when the uses of the variables change.
 
-Vector<size_t> Variables::arrange_unused_indices(void) const
+const Vector<size_t>& Variables::get_unused_indices(void) const
 {
-   const size_t variables_number = get_variables_number();
-   const size_t unused_number = count_unused_variables_number();
+   update_indices();
 
-   Vector<size_t> unused_indices(unused_number);
+   return(unused_indices);
+}
 
-   size_t index = 0;
 
-   for(size_t i = 0; i < variables_number; i++)
-   {
-      if(items[i].use == Unused)
-      {
-         unused_indices[index] = i;
-         index++;
-      }
-   }
+// const size_t& get_generation(void) const method
 
-   return(unused_indices);
+/// Returns a number which changes every time that the uses of the variables change. 
+/// Objects which keep data derived from the variables uses can compare it with the generation at the time they computed that data,
+/// to know when it must be computed again.
+
+const size_t& Variables::get_generation(void) const
+{
+   return(generation);
 }
 
 
@@ -1057,6 +1007,8 @@ void Variables::set(const size_t& inputs_number, const size_t& targets_number)
       items[i].use = Target;
    }
 
+   reset_indices();
+
    set_default();
 }
 
@@ -1068,6 +1020,8 @@ void Variables::set(const size_t& inputs_number, const size_t& targets_number)
 
 void Variables::set(const tinyxml2::XMLDocument& variables_document)
 {
+    reset_indices();
+
     set_default();
 
    from_XML(variables_document);
@@ -1095,6 +1049,8 @@ void Variables::set_default(void)
 void Variables::set_items(const Vector<Item>& new_items)
 {
     items = new_items;
+
+    reset_indices();
 }
 
 
@@ -1112,6 +1068,8 @@ void Variables::set_uses(const Vector<Variables::Use>& new_uses)
     {
         items[i].use = new_uses[i];
     }
+
+    reset_indices();
 }
 
 
@@ -1149,7 +1107,9 @@ void Variables::set_uses(const Vector<std::string>& new_uses)
  
 	     throw std::logic_error(buffer.str());
 	  }
-   }   
+   }
+
+   reset_indices();
 }
 
 
@@ -1181,6 +1141,8 @@ void Variables::set_use(const size_t& i, const Use& new_use)
     #endif
 
     items[i].use = new_use;
+
+    reset_indices();
 }
 
 
@@ -1234,6 +1196,8 @@ void Variables::set_use(const size_t& i, const std::string& new_use)
 
        throw std::logic_error(buffer.str());
     }
+
+    reset_indices();
 }
 
 
@@ -1249,6 +1213,8 @@ void Variables::set_input(void)
     {
         items[i].use = Input;
     }
+
+    reset_indices();
 }
 
 
@@ -1264,6 +1230,8 @@ void Variables::set_target(void)
     {
         items[i].use = Target;
     }
+
+    reset_indices();
 }
 
 
@@ -1293,6 +1261,8 @@ void Variables::set_default_uses(void)
 
        items[variables_number-1].use = Target;
    }
+
+   reset_indices();
 }
 
 
@@ -1700,10 +1670,80 @@ void Variables::convert_autoassociation(void)
 void Variables::set_variables_number(const size_t& new_variables_number)
 {
    items.set(new_variables_number);
+
+   reset_indices();
+
    set_default_uses();
 }
 
 
+// void update_indices(void) const method
+
+/// Computes again the cached indices of the used, input, target and unused variables,
+/// if the uses of the variables have changed since they were last computed.
+/// It can be called from several threads at the same time.
+/// Once the indices are built, the flag is read without taking the lock, as in DataSet::update_blocks.
+
+void Variables::update_indices(void) const
+{
+   if(indices_updated.load(std::memory_order_acquire))
+   {
+      return;
+   }
+
+   std::lock_guard<std::mutex> lock(indices_mutex);
+
+   if(indices_updated.load(std::memory_order_relaxed))
+   {
+      return;
+   }
+
+   const size_t variables_number = get_variables_number();
+
+   used_indices.clear();
+   inputs_indices.clear();
+   targets_indices.clear();
+   unused_indices.clear();
+
+   for(size_t i = 0; i < variables_number; i++)
+   {
+      if(items[i].use == Input)
+      {
+         inputs_indices.push_back(i);
+         used_indices.push_back(i);
+      }
+      else if(items[i].use == Target)
+      {
+         targets_indices.push_back(i);
+         used_indices.push_back(i);
+      }
+      else
+      {
+         unused_indices.push_back(i);
+      }
+   }
+
+   indices_updated.store(true, std::memory_order_release);
+}
+
+
+// void reset_indices(void) method
+
+/// Marks the cached indices as out of date and moves to a new generation.
+/// It must be called by every method which modifies the uses of the variables.
+
+void Variables::reset_indices(void)
+{
+   static std::atomic<size_t> generations_number(0);
+
+   std::lock_guard<std::mutex> lock(indices_mutex);
+
+   generation = ++generations_number;
+
+   indices_updated = false;
+}
+
+
 // std::string to_string(void) const method
 
 /// Returns a string representation of the current variables object.
@@ -26,6 +26,8 @@
 #include <stdexcept>
 #include <ctime>
 #include <exception>
+#include <atomic>
+#include <mutex>
 
 // OpenNN includes
 
@@ -152,6 +154,13 @@ public:
    Vector<size_t> arrange_targets_indices(void) const;
    Vector<size_t> arrange_unused_indices(void) const;
 
+   const Vector<size_t>& get_used_indices(void) const;
+   const Vector<size_t>& get_inputs_indices(void) const;
+   const Vector<size_t>& get_targets_indices(void) const;
+   const Vector<size_t>& get_unused_indices(void) const;
+
+   const size_t& get_generation(void) const;
+
    // Information methods
 
    Vector<std::string> arrange_names(void) const;
@@ -240,6 +249,9 @@ private:
    static std::string unsigned_to_string(const size_t&);
    static std::string prepend(const std::string&, const std::string&);
 
+   void update_indices(void) const;
+   void reset_indices(void);
+
 
    // MEMBERS
 
@@ -251,6 +263,37 @@ private:
    /// Display messages to screen.
    
    bool display;
+
+   // INDICES
+
+   /// Number which changes every time that the uses of the variables change.
+   /// Objects which keep data derived from the uses compare it to know when that data is out of date.
+
+   size_t generation;
+
+   /// True if the cached indices correspond to the current uses of the variables.
+
+   mutable std::atomic<bool> indices_updated;
+
+   /// Cached indices of the used variables.
+
+   mutable Vector<size_t> used_indices;
+
+   /// Cached indices of the input variables.
+
+   mutable Vector<size_t> inputs_indices;
+
+   /// Cached indices of the target variables.
+
+   mutable Vector<size_t> targets_indices;
+
+   /// Cached indices of the unused variables.
+
+   mutable Vector<size_t> unused_indices;
+
+   /// Lock for building the cached indices from concurrent const methods.
+
+   mutable std::mutex indices_mutex;
 };
 
 }
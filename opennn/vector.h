@@ -35,6 +35,14 @@
 #include <vector>
 #include <limits>
 #include <climits>
+#include <complex>
+#include <random>
+#include <atomic>
+#include <stdint.h>
+#include <cstdio>
+#include <cstring>
+#include <clocale>
+#include <type_traits>
 
 // Eigen includes
 
@@ -44,12 +52,43 @@ namespace OpenNN {
 
 // Forward declarations
 
+template <class T> class Vector;
 template <class T> class Matrix;
 
+/// Engine of the random number streams.
+
+typedef std::mt19937 RandomEngine;
+
+inline void set_random_seed(const unsigned long &);
+
+inline void set_random_stream(const size_t &);
+
+inline RandomEngine &get_random_engine(void);
+
+inline size_t calculate_random_index(const size_t &);
+
 template <class T> T calculate_random_uniform(const T & = -1, const T & = 1);
 
 template <class T> T calculate_random_normal(const T & = 0.0, const T & = 1.0);
 
+template <class T> void perform_fast_Fourier_transform(Vector< std::complex<T> > &, const bool & = false);
+
+template <class T> Vector<double> calculate_spectral_correlation(const Vector< std::complex<T> > &, const Vector< std::complex<T> > &, const size_t &);
+
+inline size_t calculate_correlation_transform_size(const size_t &);
+
+inline std::string read_text_file(std::ifstream &);
+
+inline uint64_t count_remaining_binary_bytes(std::ifstream &);
+
+inline bool is_text_space(const char &);
+
+template <class T> bool parse_text_token(const char *&, const char *, T &);
+
+template <class T> bool parse_text_value(const char *&, const char *, T &);
+
+template <class T> void append_text_value(std::string &, const T &);
+
 template <class T> struct Histogram;
 template <class T> struct Statistics;
 template <class T> struct LinearRegressionParameters;
@@ -191,6 +230,8 @@ public:
 
   Histogram<T> calculate_histogram(const size_t & = 10) const;
 
+  Histogram<T> calculate_histogram(const Vector<T> &) const;
+
   Histogram<T> calculate_histogram_missing_values(const Vector<size_t> &,
                                                   const size_t & = 10) const;
 
@@ -210,6 +251,8 @@ public:
 
   Vector<T> calculate_softmax(void) const;
 
+  T calculate_log_sum_exp(void) const;
+
   Matrix<T> calculate_softmax_Jacobian(void) const;
 
   Vector<bool> calculate_binary(void) const;
@@ -302,6 +345,9 @@ public:
   Vector<double> calculate_cross_correlation(const Vector<double> &,
                                              const size_t & = 10) const;
 
+  Vector< std::complex<double> >
+  calculate_centered_spectrum(const size_t &) const;
+
   LinearRegressionParameters<T>
   calculate_linear_regression_parameters(const Vector<T> &) const;
 
@@ -444,8 +490,12 @@ public:
 
   void load(const std::string &);
 
+  void load_binary(const std::string &);
+
   void save(const std::string &) const;
 
+  void save_binary(const std::string &) const;
+
   void tuck_in(const size_t &, const Vector<T> &);
 
   Vector<T> take_out(const size_t &, const size_t &) const;
@@ -1427,15 +1477,8 @@ Histogram<T> Vector<T>::calculate_histogram(const size_t &bins_number) const {
   const size_t this_size = this->size();
 
   for (size_t i = 0; i < this_size; i++) {
-    for (size_t j = 0; j < bins_number - 1; j++) {
-      if ((*this)[i] >= minimums[j] && (*this)[i] < maximums[j]) {
-        frequencies[j]++;
-      }
-    }
-
-    if ((*this)[i] >= minimums[bins_number - 1]) {
-      frequencies[bins_number - 1]++;
-    }
+    frequencies[Histogram<T>::calculate_uniform_bin(
+        (double)(*this)[i], (double)minimum, length, bins_number)]++;
   }
 
   Histogram<T> histogram(bins_number);
@@ -1445,6 +1488,55 @@ Histogram<T> Vector<T>::calculate_histogram(const size_t &bins_number) const {
   return (histogram);
 }
 
+// Histogram<T> calculate_histogram(const Vector<T>&) const method
+
+/// This method bins the elements of the vector into containers with given
+/// edges, which need not be equally spaced.
+/// Bin i contains the elements between edges i and i+1, including the first
+/// one. The elements below the second edge are placed in the first bin, and the
+/// elements above the last but one edge in the last bin.
+/// The center of each bin is the midpoint of its edges.
+/// @param edges Edges of the bins, in increasing order. Its size is the number
+/// of bins plus one.
+
+template <class T>
+Histogram<T> Vector<T>::calculate_histogram(const Vector<T> &edges) const {
+  const size_t bins_number = edges.size() - 1;
+
+// Control sentence (if debug)
+
+#ifdef __OPENNN_DEBUG__
+
+  if (edges.size() < 2) {
+    std::ostringstream buffer;
+
+    buffer << "OpenNN Exception: Vector Template.\n"
+           << "Histogram<T> calculate_histogram(const Vector<T>&) const method.\n"
+           << "Number of edges is less than two.\n";
+
+    throw std::logic_error(buffer.str());
+  }
+
+#endif
+
+  Histogram<T> histogram(bins_number);
+
+  histogram.frequencies.initialize(0);
+
+  for (size_t i = 0; i < bins_number; i++) {
+    histogram.centers[i] = (edges[i] + edges[i + 1]) / 2.0;
+  }
+
+  const size_t this_size = this->size();
+
+  for (size_t i = 0; i < this_size; i++) {
+    histogram.frequencies[Histogram<T>::calculate_edges_bin((*this)[i],
+                                                            edges)]++;
+  }
+
+  return (histogram);
+}
+
 // Histogram<T> calculate_histogram_missing_values(const size_t&) const method
 
 /// This method bins the elements of the vector into a given number of equally
@@ -1505,17 +1597,16 @@ Histogram<T> Vector<T>::calculate_histogram_missing_values(
 
   const size_t this_size = this->size();
 
-  for (int i = 0; i < (int)this_size; i++) {
-    if (!missing_indices.contains(i)) {
-      for (int j = 0; j < (int)bins_number - 1; j++) {
-        if ((*this)[i] >= minimums[j] && (*this)[i] < maximums[j]) {
-          frequencies[j]++;
-        }
-      }
+  Vector<bool> missing(this_size, false);
 
-      if ((*this)[i] >= minimums[bins_number - 1]) {
-        frequencies[bins_number - 1]++;
-      }
+  for (size_t i = 0; i < missing_indices.size(); i++) {
+    missing[missing_indices[i]] = true;
+  }
+
+  for (size_t i = 0; i < this_size; i++) {
+    if (!missing[i]) {
+      frequencies[Histogram<T>::calculate_uniform_bin(
+          (double)(*this)[i], (double)minimum, length, bins_number)]++;
     }
   }
 
@@ -1695,19 +1786,53 @@ template <class T> Vector<T> Vector<T>::calculate_softmax(void) const {
 
   Vector<T> softmax(this_size);
 
+  if (this_size == 0) {
+    return (softmax);
+  }
+
+  // The maximum is subtracted so that the exponentials do not overflow
+
+  const T maximum = calculate_maximum();
+
   T sum = 0;
 
   for (size_t i = 0; i < this_size; i++) {
-    sum += exp((*this)[i]);
+    softmax[i] = exp((*this)[i] - maximum);
+    sum += softmax[i];
   }
 
   for (size_t i = 0; i < this_size; i++) {
-    softmax[i] = exp((*this)[i]) / sum;
+    softmax[i] /= sum;
   }
 
   return (softmax);
 }
 
+// T calculate_log_sum_exp(void) const method
+
+/// Returns the logarithm of the sum of the exponentials of the elements of
+/// this vector.
+/// It is computed shifting the elements by their maximum, so that it does not
+/// overflow for large values.
+
+template <class T> T Vector<T>::calculate_log_sum_exp(void) const {
+  const size_t this_size = this->size();
+
+  if (this_size == 0) {
+    return (-std::numeric_limits<T>::infinity());
+  }
+
+  const T maximum = calculate_maximum();
+
+  T sum = 0;
+
+  for (size_t i = 0; i < this_size; i++) {
+    sum += exp((*this)[i] - maximum);
+  }
+
+  return (maximum + log(sum));
+}
+
 // Matrix<T> calculate_softmax_Jacobian(void) const method
 
 /// Returns the softmax Jacobian of this vector.
@@ -3063,37 +3188,35 @@ T Vector<T>::calculate_linear_correlation_missing_values(
 // Vector<double> calculate_autocorrelation(const size_t&) const
 
 /// Calculates autocorrelation for a given number of maximum lags.
+/// The lagged products for all the lags are obtained at once from the power
+/// spectrum of the centered vector, which takes O(n log n) operations.
 /// @param lags_number Maximum lags number.
 
 template <class T>
 Vector<double>
 Vector<T>::calculate_autocorrelation(const size_t &lags_number) const {
-  Vector<double> autocorrelation(lags_number);
-
-  const double mean = calculate_mean();
+  Vector<double> autocorrelation(lags_number, 0.0);
 
   const size_t this_size = this->size();
 
-  double numerator = 0;
-  double denominator = 0;
+  if (this_size == 0) {
+    return autocorrelation;
+  }
 
-  for (size_t i = 0; i < lags_number; i++) {
-    for (size_t j = 0; j < this_size - i; j++) {
-      numerator +=
-          (((*this)[j] - mean) * ((*this)[j + i] - mean)) / (this_size - i);
-    }
-    for (size_t j = 0; j < this_size; j++) {
-      denominator += ((*this)[j] - mean) * ((*this)[j] - mean) / this_size;
-    }
+  const Vector< std::complex<double> > spectrum =
+      calculate_centered_spectrum(calculate_correlation_transform_size(this_size));
+
+  const Vector<double> lagged_products =
+      calculate_spectral_correlation(spectrum, spectrum, lags_number);
 
+  const double denominator = lagged_products[0] / this_size;
+
+  for (size_t i = 0; i < lags_number && i < this_size; i++) {
     if (denominator == 0.0) {
       autocorrelation[i] = 1.0;
     } else {
-      autocorrelation[i] = numerator / denominator;
+      autocorrelation[i] = lagged_products[i] / (this_size - i) / denominator;
     }
-
-    numerator = 0;
-    denominator = 0;
   }
 
   return autocorrelation;
@@ -3104,6 +3227,8 @@ Vector<T>::calculate_autocorrelation(const size_t &lags_number) const {
 
 /// Calculates the cross-correlation between this vector and another given
 /// vector.
+/// The lagged products for all the lags are obtained at once from the cross
+/// spectrum of both centered vectors, which takes O(n log n) operations.
 /// @param other Other vector.
 /// @param maximum_lags_number Maximum lags for which cross-correlation is
 /// calculated.
@@ -3122,45 +3247,93 @@ Vector<double> Vector<T>::calculate_cross_correlation(
     throw std::logic_error(buffer.str());
   }
 
-  Vector<double> cross_correlation(maximum_lags_number);
-
-  const double this_mean = calculate_mean();
-  const double other_mean = other.calculate_mean();
+  Vector<double> cross_correlation(maximum_lags_number, 0.0);
 
   const size_t this_size = this->size();
 
-  double numerator = 0;
+  if (this_size == 0) {
+    return (cross_correlation);
+  }
+
+  const double this_mean = calculate_mean();
+  const double other_mean = other.calculate_mean();
 
   double this_denominator = 0;
   double other_denominator = 0;
-  double denominator = 0;
 
-  for (size_t i = 0; i < maximum_lags_number; i++) {
-    numerator = 0;
-    this_denominator = 0;
-    other_denominator = 0;
+  for (size_t j = 0; j < this_size; j++) {
+    this_denominator += ((*this)[j] - this_mean) * ((*this)[j] - this_mean);
+    other_denominator += (other[j] - other_mean) * (other[j] - other_mean);
+  }
 
-    for (size_t j = 0; j < this_size; j++) {
-      this_denominator += ((*this)[j] - this_mean) * ((*this)[j] - this_mean);
-      other_denominator += (other[j] - other_mean) * (other[j] - other_mean);
-    }
+  const double denominator = sqrt(this_denominator * other_denominator);
 
-    denominator = sqrt(this_denominator * other_denominator);
+  if (denominator == 0.0) {
+    return (cross_correlation);
+  }
 
-    for (size_t j = 0; j < this_size - i; j++) {
-      numerator += ((*this)[j] - this_mean) * (other[j + i] - other_mean);
-    }
+  const size_t transform_size = calculate_correlation_transform_size(this_size);
 
-    if (denominator == 0.0) {
-      cross_correlation[i] = 0.0;
-    } else {
-      cross_correlation[i] = numerator / denominator;
-    }
+  const Vector<double> lagged_products = calculate_spectral_correlation(
+      calculate_centered_spectrum(transform_size),
+      other.calculate_centered_spectrum(transform_size), maximum_lags_number);
+
+  for (size_t i = 0; i < maximum_lags_number && i < this_size; i++) {
+    cross_correlation[i] = lagged_products[i] / denominator;
   }
 
   return (cross_correlation);
 }
 
+// Vector< std::complex<double> > calculate_centered_spectrum(const size_t&) const method
+
+/// Returns the discrete Fourier transform of this vector minus its mean,
+/// zero padded up to a given transform size.
+/// It is the building block of the spectral autocorrelation and
+/// cross-correlation methods, and can be reused when a vector is correlated
+/// against many others.
+/// @param transform_size Size of the transform. It must be a power of two
+/// not smaller than the size of this vector.
+
+template <class T>
+Vector< std::complex<double> >
+Vector<T>::calculate_centered_spectrum(const size_t &transform_size) const {
+  const size_t this_size = this->size();
+
+  // Control sentence (if debug)
+
+#ifdef __OPENNN_DEBUG__
+
+  if (transform_size < this_size ||
+      (transform_size & (transform_size - 1)) != 0) {
+    std::ostringstream buffer;
+
+    buffer << "OpenNN Exception: Vector Template.\n"
+           << "Vector< std::complex<double> > calculate_centered_spectrum(const "
+              "size_t&) const method.\n"
+           << "Transform size (" << transform_size
+           << ") must be a power of two greater or equal than size ("
+           << this_size << ").\n";
+
+    throw std::logic_error(buffer.str());
+  }
+
+#endif
+
+  const double mean = this_size == 0 ? 0.0 : (double)calculate_mean();
+
+  Vector< std::complex<double> > spectrum(transform_size,
+                                          std::complex<double>(0.0, 0.0));
+
+  for (size_t i = 0; i < this_size; i++) {
+    spectrum[i] = std::complex<double>((double)(*this)[i] - mean, 0.0);
+  }
+
+  perform_fast_Fourier_transform(spectrum);
+
+  return (spectrum);
+}
+
 // LinearRegressionParameters<T> calculate_linear_regression_parameters(const
 // Vector<T>&) const method
 
@@ -5026,40 +5199,122 @@ Vector<T>::arrange_subvector_last(const size_t &elements_number) const {
 /// Loads the members of a vector from an data file.
 /// Please be careful with the file format, which is specified in the OpenNN
 /// manual.
+/// The file is read with a single bulk read and parsed in one pass,
+/// independently of the global locale.
 /// @param file_name Name of vector file.
 
 template <class T> void Vector<T>::load(const std::string &file_name) {
-  std::ifstream file(file_name.c_str());
+  std::ifstream file(file_name.c_str(), std::ios::binary);
+
+  if (!file.is_open()) {
+    this->clear();
+
+    return;
+  }
+
+  const std::string content = read_text_file(file);
+
+  file.close();
+
+  const char *position = content.data();
+  const char *end = position + content.size();
+
+  std::vector<T> values;
+
+  T value;
+
+  while (position != end) {
+    if (is_text_space(*position)) {
+      position++;
+
+      continue;
+    }
+
+    if (!parse_text_value(position, end, value)) {
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: Vector template.\n"
+             << "void load(const std::string&) method.\n"
+             << "Cannot read element " << values.size() << " of vector data file: "
+             << file_name << "\n";
+
+      throw std::logic_error(buffer.str());
+    }
+
+    values.push_back(value);
+  }
 
-  std::stringstream buffer;
+  this->assign(values.begin(), values.end());
+}
 
-  std::string line;
+// void load_binary(const std::string&) method
+
+/// Loads the members of a vector from a binary file written by save_binary.
+/// The size in the header is checked against the length of the file before any
+/// memory is allocated.
+/// @param file_name Name of vector binary file.
+
+template <class T>
+void Vector<T>::load_binary(const std::string &file_name) {
+  static_assert(std::is_trivially_copyable<T>::value,
+                "Binary vector files need trivially copyable elements.");
+
+  std::ifstream file(file_name.c_str(), std::ios::binary);
+
+  if (!file.is_open()) {
+    std::ostringstream buffer;
 
-  while (file.good()) {
-    getline(file, line);
+    buffer << "OpenNN Exception: Vector template.\n"
+           << "void load_binary(const std::string&) method.\n"
+           << "Cannot open binary file: " << file_name << "\n";
 
-    buffer << line;
+    throw std::logic_error(buffer.str());
   }
 
-  std::istream_iterator<std::string> it(buffer);
-  std::istream_iterator<std::string> end;
+  char magic[8];
+  uint32_t version = 0;
+  uint32_t element_size = 0;
+  uint64_t new_size = 0;
 
-  const std::vector<std::string> results(it, end);
+  file.read(magic, 8);
+  file.read(reinterpret_cast<char *>(&version), sizeof(uint32_t));
+  file.read(reinterpret_cast<char *>(&element_size), sizeof(uint32_t));
+  file.read(reinterpret_cast<char *>(&new_size), sizeof(uint64_t));
 
-  const size_t new_size = (size_t)results.size();
+  if (!file || memcmp(magic, "OPENNNV", 8) != 0 || version != 1 ||
+      element_size != sizeof(T)) {
+    std::ostringstream buffer;
 
-  this->resize(new_size);
+    buffer << "OpenNN Exception: Vector template.\n"
+           << "void load_binary(const std::string&) method.\n"
+           << "Unknown binary vector format in file: " << file_name << "\n";
 
-  file.clear();
-  file.seekg(0, std::ios::beg);
+    throw std::logic_error(buffer.str());
+  }
 
-  // Read data
+  if (new_size > count_remaining_binary_bytes(file) / sizeof(T)) {
+    std::ostringstream buffer;
 
-  for (size_t i = 0; i < new_size; i++) {
-    file >> (*this)[i];
+    buffer << "OpenNN Exception: Vector template.\n"
+           << "void load_binary(const std::string&) method.\n"
+           << "Binary file is truncated: " << file_name << "\n";
+
+    throw std::logic_error(buffer.str());
   }
 
-  file.close();
+  this->resize((size_t)new_size);
+
+  file.read(reinterpret_cast<char *>(this->data()), new_size * sizeof(T));
+
+  if (!file) {
+    std::ostringstream buffer;
+
+    buffer << "OpenNN Exception: Vector template.\n"
+           << "void load_binary(const std::string&) method.\n"
+           << "Binary file is truncated: " << file_name << "\n";
+
+    throw std::logic_error(buffer.str());
+  }
 }
 
 // void save(const std::string&) const method
@@ -5067,6 +5322,7 @@ template <class T> void Vector<T>::load(const std::string &file_name) {
 /// Saves to a data file the elements of the vector.
 /// The file format is as follows:
 /// element_0 element_1 ... element_N-1
+/// The text is formatted in memory and written with a single bulk write.
 /// @param file_name Name of vector data file.
 
 template <class T> void Vector<T>::save(const std::string &file_name) const {
@@ -5087,15 +5343,21 @@ template <class T> void Vector<T>::save(const std::string &file_name) const {
   const size_t this_size = this->size();
 
   if (this_size > 0) {
-    file << (*this)[0];
+    std::string content;
 
-    const char space = ' ';
+    content.reserve(this_size * 12);
+
+    append_text_value(content, (*this)[0]);
 
     for (size_t i = 1; i < this_size; i++) {
-      file << space << (*this)[i];
+      content += ' ';
+
+      append_text_value(content, (*this)[i]);
     }
 
-    file << std::endl;
+    content += '\n';
+
+    file.write(content.data(), content.size());
   }
 
   // Close file
@@ -5103,6 +5365,45 @@ template <class T> void Vector<T>::save(const std::string &file_name) const {
   file.close();
 }
 
+// void save_binary(const std::string&) const method
+
+/// Saves the elements of the vector to a binary file.
+/// The file contains the characters "OPENNNV" followed by a null character,
+/// the format version, the size in bytes of an element and the number of
+/// elements, followed by the elements in memory order.
+/// The type of the elements must be trivially copyable.
+/// @param file_name Name of vector binary file.
+
+template <class T>
+void Vector<T>::save_binary(const std::string &file_name) const {
+  static_assert(std::is_trivially_copyable<T>::value,
+                "Binary vector files need trivially copyable elements.");
+
+  std::ofstream file(file_name.c_str(), std::ios::binary);
+
+  if (!file.is_open()) {
+    std::ostringstream buffer;
+
+    buffer << "OpenNN Exception: Vector template.\n"
+           << "void save_binary(const std::string&) const method.\n"
+           << "Cannot open binary file: " << file_name << "\n";
+
+    throw std::logic_error(buffer.str());
+  }
+
+  const uint32_t version = 1;
+  const uint32_t element_size = sizeof(T);
+  const uint64_t this_size = this->size();
+
+  file.write("OPENNNV", 8);
+  file.write(reinterpret_cast<const char *>(&version), sizeof(uint32_t));
+  file.write(reinterpret_cast<const char *>(&element_size), sizeof(uint32_t));
+  file.write(reinterpret_cast<const char *>(&this_size), sizeof(uint64_t));
+  file.write(reinterpret_cast<const char *>(this->data()), this_size * sizeof(T));
+
+  file.close();
+}
+
 // void tuck_in(const size_t&, const Vector<T>&) const method
 
 /// Insert another vector starting from a given position.
@@ -5597,6 +5898,172 @@ std::ostream &operator<<(std::ostream &os, const Vector< Matrix<T> > &v) {
   return (os);
 }
 
+// Random number streams
+
+// Every thread draws its random numbers from its own stream, so that no lock is
+// needed. A stream is determined by the global seed and the stream index of the
+// thread. Threads get consecutive stream indices the first time they draw a random
+// number, and the main thread normally gets index 0. Parallel code that must be
+// reproducible regardless of thread scheduling sets the stream index of each task
+// explicitly with set_random_stream.
+
+/// State of the random number stream of a thread.
+
+struct RandomStream {
+  /// Default constructor. It assigns the next stream index to the thread.
+
+  RandomStream(void);
+
+  /// Index of the stream.
+
+  size_t stream_index;
+
+  /// Seed generation for which the engine was seeded.
+
+  size_t generation;
+
+  /// Random number engine.
+
+  RandomEngine engine;
+};
+
+// std::atomic<unsigned long>& get_random_seed_state(void) function
+
+/// Returns the global seed shared by all the random number streams.
+
+inline std::atomic<unsigned long> &get_random_seed_state(void) {
+  static std::atomic<unsigned long> seed(5489UL);
+
+  return (seed);
+}
+
+// std::atomic<size_t>& get_random_generation(void) function
+
+/// Returns the number of times that the global seed has been set.
+/// A stream reseeds its engine when this changes.
+
+inline std::atomic<size_t> &get_random_generation(void) {
+  static std::atomic<size_t> generation(0);
+
+  return (generation);
+}
+
+// std::atomic<size_t>& get_random_streams_number(void) function
+
+/// Returns the number of stream indices assigned so far to threads.
+
+inline std::atomic<size_t> &get_random_streams_number(void) {
+  static std::atomic<size_t> streams_number(0);
+
+  return (streams_number);
+}
+
+inline RandomStream::RandomStream(void)
+    : stream_index(get_random_streams_number()++),
+      generation(std::numeric_limits<size_t>::max()) {}
+
+// RandomStream& get_random_stream(void) function
+
+/// Returns the random number stream of the calling thread.
+
+inline RandomStream &get_random_stream(void) {
+  thread_local RandomStream random_stream;
+
+  return (random_stream);
+}
+
+// void set_random_seed(const unsigned long&) function
+
+/// Sets the global seed, so that all the random number streams start again from
+/// a sequence determined by this seed and their stream index.
+/// This must not be called while other threads are drawing random numbers.
+/// The seed alone makes the random numbers of a thread reproducible only if its stream
+/// index is: the main thread normally gets index 0, but OpenMP threads get their indices
+/// in the order in which they first draw a number, which depends on the scheduling.
+/// Random numbers drawn inside a parallel loop are therefore only reproducible if each task
+/// calls set_random_stream with its own index. The parallel loops of OpenNN do not draw
+/// random numbers; candidates, populations and initial parameters are drawn by the calling thread.
+/// @param seed Global seed.
+
+inline void set_random_seed(const unsigned long &seed) {
+  get_random_seed_state() = seed;
+
+  get_random_generation()++;
+}
+
+// void set_random_stream(const size_t&) function
+
+/// Sets the stream index of the calling thread, and restarts its stream.
+/// Parallel tasks which set their own index, for instance the task number,
+/// produce the same random numbers for a given seed whichever thread runs them.
+/// @param stream_index Index of the stream.
+
+inline void set_random_stream(const size_t &stream_index) {
+  RandomStream &random_stream = get_random_stream();
+
+  random_stream.stream_index = stream_index;
+  random_stream.generation = std::numeric_limits<size_t>::max();
+}
+
+// RandomEngine& get_random_engine(void) function
+
+/// Returns the random number engine of the calling thread,
+/// seeded from the global seed and the stream index of the thread.
+
+inline RandomEngine &get_random_engine(void) {
+  RandomStream &random_stream = get_random_stream();
+
+  const size_t generation = get_random_generation();
+
+  if (random_stream.generation != generation) {
+    const uint64_t seed = get_random_seed_state();
+    const uint64_t stream_index = random_stream.stream_index;
+
+    std::seed_seq sequence{(uint32_t)seed, (uint32_t)(seed >> 32),
+                           (uint32_t)stream_index,
+                           (uint32_t)(stream_index >> 32)};
+
+    random_stream.engine.seed(sequence);
+    random_stream.generation = generation;
+  }
+
+  return (random_stream.engine);
+}
+
+// double calculate_random_canonical(void) function
+
+/// Returns a random number uniformly distributed in [0, 1) with 53 random bits.
+
+inline double calculate_random_canonical(void) {
+  RandomEngine &engine = get_random_engine();
+
+  const uint32_t high = engine() >> 5;
+  const uint32_t low = engine() >> 6;
+
+  return ((high * 67108864.0 + low) / 9007199254740992.0);
+}
+
+// size_t calculate_random_index(const size_t&) function
+
+/// Returns a random integer uniformly distributed between 0 and size-1, without
+/// the bias of taking the remainder of a random number.
+/// @param size Number of possible values. It must be greater than zero.
+
+inline size_t calculate_random_index(const size_t &size) {
+  RandomEngine &engine = get_random_engine();
+
+  const uint64_t range = size;
+  const uint64_t threshold = (0 - range) % range;
+
+  uint64_t random;
+
+  do {
+    random = ((uint64_t)engine() << 32) | (uint64_t)engine();
+  } while (random < threshold);
+
+  return ((size_t)(random % range));
+}
+
 // double calculate_random_uniform(const double&, const double&) method
 
 /// Returns a random number chosen from a uniform distribution.
@@ -5605,7 +6072,7 @@ std::ostream &operator<<(std::ostream &os, const Vector< Matrix<T> > &v) {
 
 template <class T>
 T calculate_random_uniform(const T &minimum, const T &maximum) {
-  const T random = (T)rand() / (RAND_MAX + 1.0);
+  const T random = (T)calculate_random_canonical();
 
   const T random_uniform = minimum + (maximum - minimum) * random;
 
@@ -5625,11 +6092,11 @@ T calculate_random_normal(const T &mean, const T &standard_deviation) {
   T random_uniform_1;
 
   do {
-    random_uniform_1 = (T)rand() / (RAND_MAX + 1.0);
+    random_uniform_1 = (T)calculate_random_canonical();
 
   } while (random_uniform_1 == 0.0);
 
-  const T random_uniform_2 = (T)rand() / (RAND_MAX + 1.0);
+  const T random_uniform_2 = (T)calculate_random_canonical();
 
   // Box-Muller transformation
 
@@ -5641,6 +6108,398 @@ T calculate_random_normal(const T &mean, const T &standard_deviation) {
   return (random_normal);
 }
 
+// void perform_fast_Fourier_transform(Vector< std::complex<T> >&, const bool&) method
+
+/// Computes in place the discrete Fourier transform of a complex sequence with
+/// the iterative radix-2 Cooley-Tukey algorithm.
+/// @param data Sequence to be transformed. Its size must be a power of two.
+/// @param inverse True to compute the inverse transform, which is scaled by
+/// the reciprocal of the size.
+
+template <class T>
+void perform_fast_Fourier_transform(Vector< std::complex<T> > &data,
+                                    const bool &inverse) {
+  const size_t size = data.size();
+
+  if (size < 2) {
+    return;
+  }
+
+  // Control sentence (if debug)
+
+#ifdef __OPENNN_DEBUG__
+
+  if ((size & (size - 1)) != 0) {
+    std::ostringstream buffer;
+
+    buffer << "OpenNN Exception: Vector Template.\n"
+           << "void perform_fast_Fourier_transform(Vector< std::complex<T> "
+              ">&, const bool&) method.\n"
+           << "Size (" << size << ") must be a power of two.\n";
+
+    throw std::logic_error(buffer.str());
+  }
+
+#endif
+
+  // Bit reversal permutation
+
+  for (size_t i = 1, j = 0; i < size; i++) {
+    size_t bit = size >> 1;
+
+    for (; j & bit; bit >>= 1) {
+      j ^= bit;
+    }
+
+    j ^= bit;
+
+    if (i < j) {
+      std::swap(data[i], data[j]);
+    }
+  }
+
+  // Butterflies
+
+  const T pi = (T)(4.0 * atan(1.0));
+
+  for (size_t length = 2; length <= size; length <<= 1) {
+    const T angle = (inverse ? 2 : -2) * pi / (T)length;
+
+    const std::complex<T> root(cos(angle), sin(angle));
+
+    const size_t half_length = length / 2;
+
+    for (size_t i = 0; i < size; i += length) {
+      std::complex<T> twiddle(1, 0);
+
+      for (size_t j = 0; j < half_length; j++) {
+        const std::complex<T> even = data[i + j];
+        const std::complex<T> odd = data[i + j + half_length] * twiddle;
+
+        data[i + j] = even + odd;
+        data[i + j + half_length] = even - odd;
+
+        twiddle *= root;
+      }
+    }
+  }
+
+  if (inverse) {
+    const T scale = (T)1 / (T)size;
+
+    for (size_t i = 0; i < size; i++) {
+      data[i] *= scale;
+    }
+  }
+}
+
+// Vector<double> calculate_spectral_correlation(const Vector< std::complex<T> >&, const Vector< std::complex<T> >&, const size_t&) method
+
+/// Returns the sums of lagged products between two real sequences, given
+/// their zero padded discrete Fourier transforms.
+/// The element i of the result is the sum over j of x[j]*y[j+i], for i
+/// lower than the number of lags.
+/// @param this_spectrum Transform of the first sequence.
+/// @param other_spectrum Transform of the second sequence.
+/// @param lags_number Number of lags to be returned.
+
+template <class T>
+Vector<double>
+calculate_spectral_correlation(const Vector< std::complex<T> > &this_spectrum,
+                               const Vector< std::complex<T> > &other_spectrum,
+                               const size_t &lags_number) {
+  const size_t transform_size = this_spectrum.size();
+
+  Vector< std::complex<T> > cross_spectrum(transform_size);
+
+  for (size_t i = 0; i < transform_size; i++) {
+    cross_spectrum[i] = std::conj(this_spectrum[i]) * other_spectrum[i];
+  }
+
+  perform_fast_Fourier_transform(cross_spectrum, true);
+
+  Vector<double> lagged_products(lags_number, 0.0);
+
+  for (size_t i = 0; i < lags_number && i < transform_size; i++) {
+    lagged_products[i] = (double)cross_spectrum[i].real();
+  }
+
+  return (lagged_products);
+}
+
+// size_t calculate_correlation_transform_size(const size_t&) method
+
+/// Returns the smallest power of two which allows to compute all the lagged
+/// products of a sequence of a given size without circular wrap-around.
+/// @param size Size of the sequences to be correlated.
+
+inline size_t calculate_correlation_transform_size(const size_t &size) {
+  size_t transform_size = 1;
+
+  while (transform_size < 2 * size) {
+    transform_size <<= 1;
+  }
+
+  return (transform_size);
+}
+
+// std::string read_text_file(std::ifstream&) function
+
+/// Returns the whole content of an open file, read with a single bulk read
+/// instead of line by line.
+/// @param file Input file stream. It should be opened in binary mode.
+
+inline std::string read_text_file(std::ifstream &file) {
+  file.seekg(0, std::ios::end);
+
+  const std::streamoff size = file.tellg();
+
+  file.seekg(0, std::ios::beg);
+
+  std::string content;
+
+  if (size > 0) {
+    content.resize((size_t)size);
+
+    file.read(&content[0], size);
+
+    content.resize((size_t)file.gcount());
+  }
+
+  return (content);
+}
+
+// uint64_t count_remaining_binary_bytes(std::ifstream&) function
+
+/// Returns the number of bytes between the current read position of a file and
+/// its end, so that sizes read from a binary header can be checked before any
+/// memory is allocated. The read position is not changed.
+/// @param file Input file stream. It should be opened in binary mode.
+
+inline uint64_t count_remaining_binary_bytes(std::ifstream &file) {
+  if (!file) {
+    return (0);
+  }
+
+  const std::streampos position = file.tellg();
+
+  file.seekg(0, std::ios::end);
+
+  const std::streamoff remaining_bytes = file.tellg() - position;
+
+  file.seekg(position);
+
+  return (remaining_bytes > 0 ? (uint64_t)remaining_bytes : 0);
+}
+
+// bool is_text_space(const char&) function
+
+/// Returns true if the character separates values in a text data file, that is,
+/// if it is a space, a tab or an end of line character.
+/// @param character Character to be checked.
+
+inline bool is_text_space(const char &character) {
+  return (character == ' ' || character == '\t' || character == '\n' ||
+          character == '\r' || character == '\v' || character == '\f');
+}
+
+// bool parse_text_token(const char*&, const char*, T&) function
+
+/// Reads a value from a text buffer with a string stream in the classic locale.
+/// The position must point to the first character of the value, and it is
+/// moved to the first space after it.
+/// Returns false if the characters do not form a value of the given type.
+/// @param position Position of the value in the buffer.
+/// @param end End of the buffer.
+/// @param value Value read.
+
+template <class T>
+bool parse_text_token(const char *&position, const char *end, T &value) {
+  const char *begin = position;
+
+  while (position != end && !is_text_space(*position)) {
+    position++;
+  }
+
+  std::istringstream buffer(std::string(begin, position));
+
+  buffer.imbue(std::locale::classic());
+
+  buffer >> value;
+
+  return (!buffer.fail());
+}
+
+// bool parse_text_value(const char*&, const char*, T&) function
+
+/// Reads a value from a text buffer, independently of the global locale.
+/// The position must point to the first character of the value, and it is
+/// moved to the first space after it.
+/// Returns false if the characters do not form a value of the given type.
+/// @param position Position of the value in the buffer.
+/// @param end End of the buffer.
+/// @param value Value read.
+
+template <class T>
+bool parse_text_value(const char *&position, const char *end, T &value) {
+  return (parse_text_token(position, end, value));
+}
+
+/// Reads a double precision value from a text buffer.
+/// Values with at most 15 significant digits and a decimal exponent of at most
+/// 22 in absolute value, which are most of the values in data files, are
+/// converted with a single correctly rounded operation.
+/// Other values, such as long mantissas, nan or inf, are read by the standard
+/// library with the classic locale.
+
+template <>
+inline bool parse_text_value<double>(const char *&position, const char *end,
+                                     double &value) {
+  static const double powers_of_ten[] = {
+      1.0e0,  1.0e1,  1.0e2,  1.0e3,  1.0e4,  1.0e5,  1.0e6,  1.0e7,
+      1.0e8,  1.0e9,  1.0e10, 1.0e11, 1.0e12, 1.0e13, 1.0e14, 1.0e15,
+      1.0e16, 1.0e17, 1.0e18, 1.0e19, 1.0e20, 1.0e21, 1.0e22};
+
+  const char *begin = position;
+  const char *current = position;
+
+  bool negative = false;
+
+  if (current != end && (*current == '-' || *current == '+')) {
+    negative = (*current == '-');
+    current++;
+  }
+
+  uint64_t mantissa = 0;
+  int significant_digits = 0;
+  int digits_number = 0;
+  int exponent = 0;
+
+  while (current != end && *current >= '0' && *current <= '9') {
+    if (mantissa != 0 || *current != '0') {
+      mantissa = mantissa * 10 + (uint64_t)(*current - '0');
+      significant_digits++;
+    }
+
+    digits_number++;
+    current++;
+
+    if (significant_digits > 15) {
+      break;
+    }
+  }
+
+  if (current != end && *current == '.' && significant_digits <= 15) {
+    current++;
+
+    while (current != end && *current >= '0' && *current <= '9') {
+      if (mantissa != 0 || *current != '0') {
+        mantissa = mantissa * 10 + (uint64_t)(*current - '0');
+        significant_digits++;
+      }
+
+      exponent--;
+      digits_number++;
+      current++;
+
+      if (significant_digits > 15) {
+        break;
+      }
+    }
+  }
+
+  if (digits_number != 0 && current != end &&
+      (*current == 'e' || *current == 'E')) {
+    current++;
+
+    bool negative_exponent = false;
+
+    if (current != end && (*current == '-' || *current == '+')) {
+      negative_exponent = (*current == '-');
+      current++;
+    }
+
+    if (current == end || *current < '0' || *current > '9') {
+      digits_number = 0;
+    }
+
+    int explicit_exponent = 0;
+
+    while (current != end && *current >= '0' && *current <= '9') {
+      if (explicit_exponent < 1000) {
+        explicit_exponent = explicit_exponent * 10 + (*current - '0');
+      }
+
+      current++;
+    }
+
+    exponent += negative_exponent ? -explicit_exponent : explicit_exponent;
+  }
+
+  if (digits_number == 0 || significant_digits > 15 || exponent < -22 ||
+      exponent > 22 || (current != end && !is_text_space(*current))) {
+    position = begin;
+
+    return (parse_text_token(position, end, value));
+  }
+
+  value = (double)mantissa;
+
+  if (exponent < 0) {
+    value /= powers_of_ten[-exponent];
+  } else {
+    value *= powers_of_ten[exponent];
+  }
+
+  if (negative) {
+    value = -value;
+  }
+
+  position = current;
+
+  return (true);
+}
+
+// void append_text_value(std::string&, const T&) function
+
+/// Appends the text representation of a value to a buffer, independently of
+/// the global locale.
+/// The representation is the same as the one written by the output operator
+/// of the standard streams.
+/// @param buffer Text buffer.
+/// @param value Value to be written.
+
+template <class T>
+void append_text_value(std::string &buffer, const T &value) {
+  std::ostringstream stream;
+
+  stream.imbue(std::locale::classic());
+
+  stream << value;
+
+  buffer += stream.str();
+}
+
+/// Appends the text representation of a double precision value to a buffer,
+/// with the six significant digits of the standard streams but without their
+/// overhead.
+
+template <>
+inline void append_text_value<double>(std::string &buffer,
+                                      const double &value) {
+  char characters[32];
+
+  const int length = snprintf(characters, sizeof(characters), "%g", value);
+
+  const char decimal_point = *localeconv()->decimal_point;
+
+  if (decimal_point != '.') {
+    std::replace(characters, characters + length, decimal_point, '.');
+  }
+
+  buffer.append(characters, (size_t)length);
+}
+
 /// This structure contains the simplest statistics for a set, variable, etc.
 /// It includes the minimum, maximum, mean and standard deviation variables.
 
@@ -5880,6 +6739,11 @@ template <class T> struct Histogram {
 
   size_t calculate_bin(const T &) const;
 
+  static size_t calculate_uniform_bin(const double &, const double &,
+                                      const double &, const size_t &);
+
+  static size_t calculate_edges_bin(const T &, const Vector<T> &);
+
   size_t calculate_frequency(const T &) const;
 
   // Vector<size_t> calculate_total_frequencies(const Vector< Histogram<T> >&)
@@ -5981,44 +6845,80 @@ Vector<T> Histogram<T>::calculate_maximal_centers(void) const {
 // Vector<size_t> Histogram<T>::calculate_bin(const T&) const
 
 /// Returns the number of the bin to which a given value belongs to.
+/// The bins are assumed to be equally spaced, so the bin is computed in constant
+/// time from the distance to the first center.
 /// @param value Value for which we want to get the bin.
 
 template <class T> size_t Histogram<T>::calculate_bin(const T &value) const {
   const size_t bins_number = get_bins_number();
 
+  if (bins_number == 1) {
+    return (0);
+  }
+
   const double minimum_center = centers[0];
   const double maximum_center = centers[bins_number - 1];
 
   const double length =
       (double)(maximum_center - minimum_center) / (double)(bins_number - 1);
 
-  double minimum_value = centers[0] - length / 2;
-  double maximum_value = minimum_value + length;
+  return (calculate_uniform_bin((double)value, minimum_center - length / 2,
+                                length, bins_number));
+}
 
-  if (value < maximum_value) {
-    return (0);
+// size_t Histogram<T>::calculate_uniform_bin(const double&, const double&, const double&, const size_t&)
+
+/// Returns the bin to which a value belongs in a histogram of equally spaced
+/// bins, with one division instead of a search.
+/// The values below the first bin belong to it, and the values above the last
+/// bin belong to it.
+/// If the length of the bins is zero, all the values belong to the last bin.
+/// @param value Value for which we want to get the bin.
+/// @param minimum Lower edge of the first bin.
+/// @param length Length of each bin.
+/// @param bins_number Number of bins.
+
+template <class T>
+size_t Histogram<T>::calculate_uniform_bin(const double &value,
+                                           const double &minimum,
+                                           const double &length,
+                                           const size_t &bins_number) {
+  if (!(length > 0.0)) {
+    return (bins_number - 1);
   }
 
-  for (size_t j = 1; j < bins_number - 1; j++) {
-    minimum_value = minimum_value + length;
-    maximum_value = maximum_value + length;
+  const double position = (value - minimum) / length;
 
-    if (value >= minimum_value && value < maximum_value) {
-      return (j);
-    }
+  if (!(position >= 1.0)) {
+    return (0);
   }
 
-  if (value >= maximum_value) {
+  if (position >= (double)bins_number) {
     return (bins_number - 1);
-  } else {
-    std::ostringstream buffer;
+  }
 
-    buffer << "OpenNN Exception: Vector Template.\n"
-           << "Vector<size_t> Histogram<T>::calculate_bin(const T&) const.\n"
-           << "Unknown return value.\n";
+  return ((size_t)position);
+}
 
-    throw std::logic_error(buffer.str());
+// size_t Histogram<T>::calculate_edges_bin(const T&, const Vector<T>&)
+
+/// Returns the bin to which a value belongs in a histogram with given edges,
+/// with a binary search over the edges.
+/// Bin i contains the values between edges i and i+1, including the first one.
+/// The values below the first bin belong to it, and the values above the last
+/// bin belong to it.
+/// @param value Value for which we want to get the bin.
+/// @param edges Edges of the bins, in increasing order.
+
+template <class T>
+size_t Histogram<T>::calculate_edges_bin(const T &value,
+                                         const Vector<T> &edges) {
+  if (edges.size() < 3) {
+    return (0);
   }
+
+  return ((size_t)(std::upper_bound(edges.begin() + 1, edges.end() - 1, value) -
+                   (edges.begin() + 1)));
 }
 
 // size_t Histogram<T>::calculate_frequency(const T&) const
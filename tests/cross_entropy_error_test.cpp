@@ -117,6 +117,82 @@ void CrossEntropyErrorTest::test_calculate_performance(void)
    ds.randomize_data_normal();
 
    assert_true(cee.calculate_performance() > 0, LOG);
+
+   // Test
+
+   nn.set(2, 3, 2);
+
+   mlpp = nn.get_multilayer_perceptron_pointer();
+
+   mlpp->get_layer_pointer(1)->set_activation_function(Perceptron::Logistic);
+
+   nn.randomize_parameters_normal();
+
+   ds.set(10, 2, 2);
+   ds.randomize_data_uniform(0.0, 1.0);
+   ds.get_instances_pointer()->set_training();
+
+   assert_true(cee.get_evaluation_method() == CrossEntropyError::FusedLogistic, LOG);
+
+   Matrix<double> inputs = ds.arrange_input_data();
+   Matrix<double> targets = ds.arrange_target_data();
+
+   Vector<double> outputs;
+
+   double binary_cross_entropy_error = 0.0;
+
+   for(size_t i = 0; i < 10; i++)
+   {
+      outputs = mlpp->calculate_outputs(inputs.arrange_row(i));
+
+      for(size_t j = 0; j < 2; j++)
+      {
+         binary_cross_entropy_error -= targets(i,j)*log(outputs[j]) + (1.0 - targets(i,j))*log(1.0 - outputs[j]);
+      }
+   }
+
+   assert_true(fabs(cee.calculate_performance() - binary_cross_entropy_error) < 1.0e-9, LOG);
+
+   // Test
+
+   nn.set(2, 3, 3);
+
+   mlpp = nn.get_multilayer_perceptron_pointer();
+
+   mlpp->get_layer_pointer(1)->set_activation_function(Perceptron::Linear);
+
+   nn.construct_probabilistic_layer();
+   nn.get_probabilistic_layer_pointer()->set_probabilistic_method(ProbabilisticLayer::Softmax);
+
+   nn.randomize_parameters_normal();
+
+   ds.set(10, 2, 3);
+   ds.randomize_data_uniform(0.0, 1.0);
+   ds.get_instances_pointer()->set_training();
+
+   assert_true(!cee.get_fused_softmax(), LOG);
+   assert_true(cee.get_evaluation_method() == CrossEntropyError::Generic, LOG);
+
+   cee.set_fused_softmax(true);
+
+   assert_true(cee.get_evaluation_method() == CrossEntropyError::FusedSoftmax, LOG);
+
+   inputs = ds.arrange_input_data();
+   targets = ds.arrange_target_data();
+
+   double categorical_cross_entropy_error = 0.0;
+
+   for(size_t i = 0; i < 10; i++)
+   {
+      outputs = nn.calculate_outputs(inputs.arrange_row(i));
+
+      for(size_t j = 0; j < 3; j++)
+      {
+         categorical_cross_entropy_error -= targets(i,j)*log(outputs[j]);
+      }
+   }
+
+   assert_true(fabs(cee.calculate_performance() - categorical_cross_entropy_error) < 1.0e-9, LOG);
 }
 
 
@@ -347,6 +423,49 @@ void CrossEntropyErrorTest::test_calculate_gradient(void)
    numerical_gradient = nd.calculate_gradient(cee, &CrossEntropyError::calculate_performance, parameters);
 
    assert_true((gradient - numerical_gradient).calculate_absolute_value() < 1.0e-3, LOG);
+
+   // Test
+
+   nn.set(2, 3, 2);
+
+   nn.get_multilayer_perceptron_pointer()->set_layer_activation_function(1, Perceptron::Logistic);
+
+   nn.randomize_parameters_normal();
+   parameters = nn.arrange_parameters();
+
+   ds.set(3,2,2);
+   ds.randomize_data_uniform(0.0, 1.0);
+
+   assert_true(cee.get_evaluation_method() == CrossEntropyError::FusedLogistic, LOG);
+
+   gradient = cee.calculate_gradient();
+   numerical_gradient = nd.calculate_gradient(cee, &CrossEntropyError::calculate_performance, parameters);
+
+   assert_true((gradient - numerical_gradient).calculate_absolute_value() < 1.0e-3, LOG);
+
+   // Test
+
+   nn.set(2, 3, 3);
+
+   nn.get_multilayer_perceptron_pointer()->set_layer_activation_function(1, Perceptron::Linear);
+
+   nn.construct_probabilistic_layer();
+   nn.get_probabilistic_layer_pointer()->set_probabilistic_method(ProbabilisticLayer::Softmax);
+
+   nn.randomize_parameters_normal();
+   parameters = nn.arrange_parameters();
+
+   ds.set(3,2,3);
+   ds.randomize_data_uniform(0.0, 1.0);
+
+   cee.set_fused_softmax(true);
+
+   assert_true(cee.get_evaluation_method() == CrossEntropyError::FusedSoftmax, LOG);
+
+   gradient = cee.calculate_gradient();
+   numerical_gradient = nd.calculate_gradient(cee, &CrossEntropyError::calculate_performance, parameters);
+
+   assert_true((gradient - numerical_gradient).calculate_absolute_value() < 1.0e-3, LOG);
 }
 
 
@@ -365,6 +484,23 @@ void CrossEntropyErrorTest::test_to_XML(void)
 void CrossEntropyErrorTest::test_from_XML(void)
 {
 	message += "test_from_XML\n"; 
+
+   CrossEntropyError cee1;
+   CrossEntropyError cee2;
+
+   tinyxml2::XMLDocument* document;
+
+   // Test
+
+   cee1.set_fused_softmax(true);
+
+   document = cee1.to_XML();
+
+   cee2.from_XML(*document);
+
+   delete document;
+
+   assert_true(cee2.get_fused_softmax(), LOG);
 }
 
 
@@ -252,6 +252,110 @@ void DataSetTest::test_get_instance(void)
 }
 
 
+void DataSetTest::test_get_training_inputs(void)
+{
+   message += "test_get_training_inputs\n";
+
+   DataSet ds(4, 2, 1);
+
+   Instances* instances_pointer = ds.get_instances_pointer();
+
+   const Vector<size_t> inputs_indices(0, 1, 1);
+   const Vector<size_t> targets_indices(1, 2);
+
+   Vector<double> inputs;
+   Vector<double> targets;
+
+   ds.randomize_data_normal();
+
+   instances_pointer->set_use(1, Instances::Selection);
+
+   // Test
+
+   ds.set_packed_blocks(true);
+
+   assert_true(ds.get_training_inputs_block().get_rows_number() == 2, LOG);
+   assert_true(ds.get_training_inputs_block().get_columns_number() == 3, LOG);
+   assert_true(ds.get_selection_targets_block().get_columns_number() == 1, LOG);
+
+   ds.get_training_inputs(1, inputs);
+
+   assert_true(inputs == ds.get_instance(2, inputs_indices), LOG);
+
+   ds.get_selection_targets(0, targets);
+
+   assert_true(targets == ds.get_instance(1, targets_indices), LOG);
+
+   // Test
+
+   instances_pointer->set_use(2, Instances::Testing);
+
+   ds.get_training_inputs(1, inputs);
+
+   assert_true(ds.get_training_inputs_block().get_columns_number() == 2, LOG);
+   assert_true(inputs == ds.get_instance(3, inputs_indices), LOG);
+
+   // Test
+
+   ds.initialize_data(1.0);
+
+   ds.get_training_targets(0, targets);
+
+   assert_true(targets.size() == 1, LOG);
+   assert_true(targets == 1.0, LOG);
+
+   // Test
+
+   ds.randomize_data_normal();
+
+   ds.set_packed_blocks(false);
+
+   ds.get_training_inputs(1, inputs);
+
+   assert_true(inputs == ds.get_instance(3, inputs_indices), LOG);
+}
+
+
+void DataSetTest::test_get_training_float_inputs_block(void)
+{
+   message += "test_get_training_float_inputs_block\n";
+
+   DataSet ds(5, 3, 2);
+
+   Instances* instances_pointer = ds.get_instances_pointer();
+
+   const Vector<size_t> inputs_indices(0, 1, 2);
+   const Vector<size_t> targets_indices(3, 1, 4);
+
+   ds.randomize_data_normal();
+
+   instances_pointer->set_training();
+   instances_pointer->set_use(1, Instances::Selection);
+
+   // Test
+
+   assert_true(ds.get_training_float_inputs_block().get_rows_number() == 4, LOG);
+   assert_true(ds.get_training_float_inputs_block().get_columns_number() == 3, LOG);
+   assert_true(ds.get_training_float_targets_block().get_columns_number() == 2, LOG);
+
+   assert_true(ds.get_training_float_inputs_block() == ds.arrange_training_input_data().to_float_matrix(), LOG);
+   assert_true(ds.get_training_float_targets_block() == ds.arrange_training_target_data().to_float_matrix(), LOG);
+
+   // Test
+
+   instances_pointer->set_use(2, Instances::Testing);
+
+   assert_true(ds.get_training_float_inputs_block().get_rows_number() == 3, LOG);
+   assert_true(ds.get_training_float_inputs_block() == ds.arrange_float_data(instances_pointer->arrange_training_indices(), inputs_indices), LOG);
+
+   // Test
+
+   ds.initialize_data(1.0);
+
+   assert_true(ds.get_training_float_targets_block() == 1.0f, LOG);
+}
+
+
 void DataSetTest::test_set(void) 
 {
    message += "test_set\n";
@@ -2293,6 +2397,144 @@ void DataSetTest::test_convert_time_series(void)
 //   assert_true(ds.get_variables().get_name(1) == "y", LOG);
 //   assert_true(ds.get_variables().get_name(2) == "lag_1_x", LOG);
 //   assert_true(ds.get_variables().get_name(3) == "lag_1_y", LOG);
+
+   // Test
+
+   DataSet materialized_ds;
+
+   data.set(10, 3);
+   data.randomize_normal();
+
+   materialized_ds.set_data(data);
+   materialized_ds.set_lags_number(2);
+   materialized_ds.convert_time_series();
+
+   ds.set_data(data);
+   ds.set_lags_number(2);
+   ds.set_time_series_view(true);
+   ds.convert_time_series();
+
+   assert_true(ds.has_time_series_view(), LOG);
+   assert_true(ds.get_data().empty(), LOG);
+   assert_true(!ds.empty(), LOG);
+
+   assert_true(ds.get_instances().get_instances_number() == 8, LOG);
+   assert_true(ds.get_variables().get_variables_number() == 9, LOG);
+
+   for(size_t i = 0; i < 8; i++)
+   {
+       assert_true(ds.get_instance(i) == materialized_ds.get_instance(i), LOG);
+   }
+
+   assert_true(ds.get_variable(4) == materialized_ds.get_variable(4), LOG);
+   assert_true(ds.arrange_input_data() == materialized_ds.arrange_input_data(), LOG);
+   assert_true(ds.arrange_target_data() == materialized_ds.arrange_target_data(), LOG);
+
+   // Test
+
+   ds.get_instances_pointer()->set_training();
+   materialized_ds.get_instances_pointer()->set_training();
+
+   assert_true((ds.calculate_training_target_data_mean() - materialized_ds.calculate_training_target_data_mean()).calculate_absolute_value().calculate_maximum() < 1.0e-9, LOG);
+   assert_true((ds.calculate_linear_correlations() - materialized_ds.calculate_linear_correlations()).calculate_absolute_value().calculate_maximum() < 1.0e-9, LOG);
+   assert_true(ds.calculate_box_and_whiskers() == materialized_ds.calculate_box_and_whiskers(), LOG);
+   assert_true(ds.calculate_targets_histograms(5)[0].frequencies == materialized_ds.calculate_targets_histograms(5)[0].frequencies, LOG);
+   assert_true(fabs(ds.calculate_training_instances_statistics()[4].mean - materialized_ds.calculate_training_instances_statistics()[4].mean) < 1.0e-9, LOG);
+   assert_true(ds.unuse_constant_variables().empty(), LOG);
+
+   NeuralNetwork nn(6, 3);
+   nn.randomize_parameters_normal();
+
+   const NormalizedSquaredError nse(&nn, &ds);
+   const NormalizedSquaredError materialized_nse(&nn, &materialized_ds);
+
+   assert_true(fabs(nse.calculate_performance() - materialized_nse.calculate_performance()) < 1.0e-9, LOG);
+
+   // Test
+
+   const Vector<double> instance = ds.get_instance(3);
+
+   const Vector< Statistics<double> > data_statistics = ds.scale_data_minimum_maximum();
+
+   assert_true(data_statistics.size() == 9, LOG);
+   assert_true(ds.get_instance(3) != instance, LOG);
+   assert_true(ds.get_variable(8).calculate_minimum() >= -1.0 - 1.0e-6, LOG);
+   assert_true(ds.get_variable(8).calculate_maximum() <= 1.0 + 1.0e-6, LOG);
+
+   ds.unscale_data_minimum_maximum(data_statistics);
+
+   assert_true((ds.get_instance(3) - instance).calculate_absolute_value().calculate_maximum() < 1.0e-9, LOG);
+
+   // Test
+
+   const Vector< Statistics<double> > materialized_data_statistics = materialized_ds.scale_data_minimum_maximum();
+
+   ds.scale_data_minimum_maximum();
+
+   for(size_t i = 0; i < 9; i++)
+   {
+      assert_true(fabs(data_statistics[i].minimum - materialized_data_statistics[i].minimum) < 1.0e-9, LOG);
+      assert_true(fabs(ds.get_variable(i).calculate_minimum() + 1.0) < 1.0e-9, LOG);
+      assert_true(fabs(ds.get_variable(i).calculate_maximum() - 1.0) < 1.0e-9, LOG);
+   }
+
+   assert_true((ds.arrange_input_data() - materialized_ds.arrange_input_data()).calculate_absolute_value().calculate_maximum() < 1.0e-9, LOG);
+
+   ds.unscale_data_minimum_maximum(data_statistics);
+   materialized_ds.unscale_data_minimum_maximum(materialized_data_statistics);
+
+   // Test
+
+   const Vector< Statistics<double> > inputs_statistics = ds.scale_inputs_mean_standard_deviation();
+   const Vector< Statistics<double> > targets_statistics = ds.scale_targets_minimum_maximum();
+
+   materialized_ds.scale_inputs_mean_standard_deviation();
+   materialized_ds.scale_targets_minimum_maximum();
+
+   assert_true((ds.arrange_input_data() - materialized_ds.arrange_input_data()).calculate_absolute_value().calculate_maximum() < 1.0e-9, LOG);
+   assert_true((ds.arrange_target_data() - materialized_ds.arrange_target_data()).calculate_absolute_value().calculate_maximum() < 1.0e-9, LOG);
+   assert_true(ds.get_time_series_data() == data, LOG);
+
+   const Vector< Statistics<double> > variables_statistics = inputs_statistics.assemble(targets_statistics);
+
+   ds.unscale_inputs_mean_standard_deviation(variables_statistics);
+   ds.unscale_targets_minimum_maximum(variables_statistics);
+
+   assert_true((ds.get_instance(3) - instance).calculate_absolute_value().calculate_maximum() < 1.0e-9, LOG);
+
+   // Test
+
+   ds.convert_autoassociation();
+
+   assert_true(ds.get_variables().get_variables_number() == 18, LOG);
+   assert_true((ds.get_instance(3) - instance.assemble(instance)).calculate_absolute_value().calculate_maximum() < 1.0e-9, LOG);
+
+   // Test
+
+   data.randomize_normal();
+
+   materialized_ds.set_data(data);
+   materialized_ds.get_missing_values_pointer()->append(4, 1);
+   materialized_ds.set_lags_number(2);
+   materialized_ds.set_time_series_view(false);
+   materialized_ds.convert_time_series();
+
+   ds.set_data(data);
+   ds.get_missing_values_pointer()->append(4, 1);
+   ds.set_lags_number(2);
+   ds.set_time_series_view(true);
+   ds.convert_time_series();
+
+   assert_true(ds.get_missing_values().get_missing_values_number() == 3, LOG);
+   assert_true(ds.get_missing_values().get_items() == materialized_ds.get_missing_values().get_items(), LOG);
+   assert_true(fabs(ds.calculate_data_statistics()[7].mean - materialized_ds.calculate_data_statistics()[7].mean) < 1.0e-9, LOG);
+
+   ds.scrub_missing_values_mean();
+
+   const double mean = data.arrange_column(1).calculate_mean_missing_values(Vector<size_t>(1, 4));
+
+   assert_true(fabs(ds.get_instance(4)[1] - mean) < 1.0e-9, LOG);
+   assert_true(fabs(ds.get_instance(2)[7] - mean) < 1.0e-9, LOG);
 }
 
 
@@ -2856,6 +3098,9 @@ void DataSetTest::run_test_case(void)
 
    test_get_instance();
 
+   test_get_training_inputs();
+   test_get_training_float_inputs_block();
+
    // Set methods
 
    test_set();
@@ -3000,8 +3245,8 @@ void DataSetTest::run_test_case(void)
    test_print_instances_statistics();
    test_save_instances_statistics();
 */
-/*
    test_convert_time_series();
+/*
    test_convert_autoassociation();
 
    test_convert_angular_variable_degrees();
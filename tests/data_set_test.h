@@ -73,6 +73,9 @@ public:
 
    void test_get_instance(void);
 
+   void test_get_training_inputs(void);
+   void test_get_training_float_inputs_block(void);
+
    // Set methods
 
    void test_set(void);
@@ -0,0 +1,442 @@
+/****************************************************************************************************************/
+/*                                                                                                              */
+/*   OpenNN: Open Neural Networks Library                                                                       */
+/*   www.opennn.net                                                                                             */
+/*                                                                                                              */
+/*   E N S E M B L E   T R A I N I N G   T E S T   C L A S S                                                    */
+/*                                                                                                              */
+/*   Roberto Lopez                                                                                              */
+/*   Artelnics - Making intelligent use of data                                                                 */
+/*   robertolopez@artelnics.com                                                                                 */
+/*                                                                                                              */
+/****************************************************************************************************************/
+
+// Unit testing includes
+
+#include "ensemble_training_test.h"
+
+using namespace OpenNN;
+
+
+// GENERAL CONSTRUCTOR
+
+EnsembleTrainingTest::EnsembleTrainingTest(void) : UnitTesting()
+{
+}
+
+
+// DESTRUCTOR
+
+/// Destructor.
+
+EnsembleTrainingTest::~EnsembleTrainingTest(void)
+{
+}
+
+// METHODS
+
+void EnsembleTrainingTest::test_constructor(void)
+{
+   message += "test_constructor\n";
+
+   PerformanceFunctional pf;
+
+   // Default constructor
+
+   EnsembleTraining et1;
+   assert_true(et1.has_performance_functional() == false, LOG);
+
+   // Performance functional constructor
+
+   EnsembleTraining et2(&pf);
+   assert_true(et2.has_performance_functional() == true, LOG);
+   assert_true(et2.get_neural_networks_pointers().empty(), LOG);
+}
+
+
+void EnsembleTrainingTest::test_destructor(void)
+{
+   message += "test_destructor\n";
+}
+
+
+void EnsembleTrainingTest::test_arrange_neural_networks_pointers(void)
+{
+   message += "test_arrange_neural_networks_pointers\n";
+
+   NeuralNetwork nn;
+   NeuralNetwork nn1;
+   NeuralNetwork nn2;
+
+   PerformanceFunctional pf(&nn);
+
+   EnsembleTraining et(&pf);
+
+   Vector<NeuralNetwork*> neural_networks_pointers;
+
+   // Test
+
+   neural_networks_pointers = et.arrange_neural_networks_pointers();
+
+   assert_true(neural_networks_pointers.size() == 1, LOG);
+   assert_true(neural_networks_pointers[0] == &nn, LOG);
+
+   // Test
+
+   neural_networks_pointers.set(2);
+   neural_networks_pointers[0] = &nn1;
+   neural_networks_pointers[1] = &nn2;
+
+   et.set_neural_networks_pointers(neural_networks_pointers);
+
+   assert_true(et.arrange_neural_networks_pointers() == neural_networks_pointers, LOG);
+}
+
+
+void EnsembleTrainingTest::test_set_training_rate_decrease_factor(void)
+{
+   message += "test_set_training_rate_decrease_factor\n";
+
+   EnsembleTraining et;
+
+   et.set_training_rate_decrease_factor(0.25);
+
+   assert_true(et.get_training_rate_decrease_factor() == 0.25, LOG);
+
+   try
+   {
+      et.set_training_rate_decrease_factor(1.0);
+
+      assert_true(false, LOG);
+   }
+   catch(const std::logic_error&)
+   {
+      assert_true(et.get_training_rate_decrease_factor() == 0.25, LOG);
+   }
+}
+
+
+void EnsembleTrainingTest::test_check(void)
+{
+   message += "test_check\n";
+
+   NeuralNetwork nn(2, 3, 1);
+   NeuralNetwork nn1(2, 1);
+   NeuralNetwork nn2(3, 1);
+
+   DataSet ds(5, 2, 1);
+
+   PerformanceFunctional pf(&nn, &ds);
+
+   EnsembleTraining et(&pf);
+
+   Vector<NeuralNetwork*> neural_networks_pointers(1, &nn1);
+
+   // Test
+
+   try
+   {
+      et.check();
+
+      assert_true(false, LOG);
+   }
+   catch(const std::logic_error&)
+   {
+      assert_true(true, LOG);
+   }
+
+   // Test
+
+   pf.set_objective_type(PerformanceFunctional::SUM_SQUARED_ERROR_OBJECTIVE);
+
+   et.set_neural_networks_pointers(neural_networks_pointers);
+
+   et.check();
+
+   assert_true(true, LOG);
+
+   // Test
+
+   neural_networks_pointers.push_back(&nn2);
+
+   et.set_neural_networks_pointers(neural_networks_pointers);
+
+   try
+   {
+      et.check();
+
+      assert_true(false, LOG);
+   }
+   catch(const std::logic_error&)
+   {
+      assert_true(true, LOG);
+   }
+}
+
+
+void EnsembleTrainingTest::test_calculate_first_order_performances(void)
+{
+   message += "test_calculate_first_order_performances\n";
+
+   NeuralNetwork nn1(2, 3, 1);
+   NeuralNetwork nn2(2, 1);
+   NeuralNetwork nn3(2, 4, 1);
+
+   DataSet ds(10, 2, 1);
+
+   PerformanceFunctional pf(&nn1, &ds);
+
+   EnsembleTraining et(&pf);
+
+   Vector<NeuralNetwork*> neural_networks_pointers(3);
+
+   Vector<PerformanceTerm::FirstOrderPerformance> first_order_performances;
+
+   // Test
+
+   ds.randomize_data_normal();
+
+   nn1.randomize_parameters_normal();
+   nn2.randomize_parameters_normal();
+   nn3.randomize_parameters_normal();
+
+   neural_networks_pointers[0] = &nn1;
+   neural_networks_pointers[1] = &nn2;
+   neural_networks_pointers[2] = &nn3;
+
+   pf.set_objective_type(PerformanceFunctional::SUM_SQUARED_ERROR_OBJECTIVE);
+
+   first_order_performances = et.calculate_first_order_performances(neural_networks_pointers);
+
+   assert_true(first_order_performances.size() == 3, LOG);
+
+   for(size_t i = 0; i < 3; i++)
+   {
+      const SumSquaredError sse(neural_networks_pointers[i], &ds);
+
+      assert_true(fabs(first_order_performances[i].performance - sse.calculate_performance()) < 1.0e-9, LOG);
+      assert_true((first_order_performances[i].gradient - sse.calculate_gradient()).calculate_absolute_value() < 1.0e-9, LOG);
+   }
+}
+
+
+void EnsembleTrainingTest::test_perform_training(void)
+{
+   message += "test_perform_training\n";
+
+   NeuralNetwork nn1(1, 2, 1);
+   NeuralNetwork nn2(1, 2, 1);
+
+   DataSet ds(10, 1, 1);
+
+   PerformanceFunctional pf(&nn1, &ds);
+
+   EnsembleTraining et(&pf);
+
+   EnsembleTraining::EnsembleTrainingResults* etr;
+
+   Vector<NeuralNetwork*> neural_networks_pointers(2);
+
+   double old_performance_1;
+   double old_performance_2;
+
+   // Test
+
+   ds.randomize_data_normal();
+
+   nn1.randomize_parameters_normal();
+   nn2.randomize_parameters_normal();
+
+   neural_networks_pointers[0] = &nn1;
+   neural_networks_pointers[1] = &nn2;
+
+   pf.set_objective_type(PerformanceFunctional::SUM_SQUARED_ERROR_OBJECTIVE);
+
+   const SumSquaredError sse1(&nn1, &ds);
+   const SumSquaredError sse2(&nn2, &ds);
+
+   old_performance_1 = sse1.calculate_performance();
+   old_performance_2 = sse2.calculate_performance();
+
+   et.set_neural_networks_pointers(neural_networks_pointers);
+   et.set_maximum_iterations_number(10);
+   et.set_reserve_performance_history(true);
+   et.set_display(false);
+
+   etr = et.perform_training();
+
+   assert_true(etr->final_performances.size() == 2, LOG);
+   assert_true(etr->performance_history.size() == 11, LOG);
+
+   assert_true(etr->final_performances[0] <= old_performance_1, LOG);
+   assert_true(etr->final_performances[1] <= old_performance_2, LOG);
+
+   assert_true(fabs(etr->final_performances[0] - sse1.calculate_performance()) < 1.0e-9, LOG);
+   assert_true(fabs(etr->final_performances[1] - sse2.calculate_performance()) < 1.0e-9, LOG);
+
+   delete etr;
+}
+
+
+// void test_perform_training_strategy(void) method
+
+void EnsembleTrainingTest::test_perform_training_strategy(void)
+{
+   message += "test_perform_training_strategy\n";
+
+   NeuralNetwork nn(1, 2, 1);
+
+   DataSet ds(10, 1, 1);
+
+   PerformanceFunctional pf(&nn, &ds);
+
+   TrainingStrategy ts(&pf);
+
+   TrainingStrategy::Results results;
+
+   tinyxml2::XMLDocument* document;
+
+   double old_performance;
+
+   // Test
+
+   ds.randomize_data_normal();
+
+   nn.randomize_parameters_normal();
+
+   pf.set_objective_type(PerformanceFunctional::SUM_SQUARED_ERROR_OBJECTIVE);
+
+   old_performance = pf.calculate_performance();
+
+   ts.set_main_type(TrainingStrategy::ENSEMBLE_TRAINING);
+   ts.get_ensemble_training_pointer()->set_maximum_iterations_number(10);
+   ts.set_display(false);
+
+   results = ts.perform_training();
+
+   assert_true(results.ensemble_training_results_pointer != NULL, LOG);
+   assert_true(results.ensemble_training_results_pointer->final_performances.size() == 1, LOG);
+   assert_true(results.ensemble_training_results_pointer->final_selection_performances.size() == 1, LOG);
+   assert_true(pf.calculate_performance() <= old_performance, LOG);
+
+   delete results.ensemble_training_results_pointer;
+   results.ensemble_training_results_pointer = NULL;
+
+   // Test
+
+   ts.get_ensemble_training_pointer()->set_maximum_iterations_number(7);
+
+   document = ts.to_XML();
+
+   TrainingStrategy ts2(&pf);
+
+   ts2.from_XML(*document);
+
+   delete document;
+
+   assert_true(ts2.get_main_type() == TrainingStrategy::ENSEMBLE_TRAINING, LOG);
+   assert_true(ts2.get_ensemble_training_pointer()->get_maximum_iterations_number() == 7, LOG);
+}
+
+
+void EnsembleTrainingTest::test_to_XML(void)
+{
+   message += "test_to_XML\n";
+
+   EnsembleTraining et;
+
+   tinyxml2::XMLDocument* document;
+
+   // Test
+
+   document = et.to_XML();
+
+   assert_true(document != NULL, LOG);
+
+   delete document;
+}
+
+
+void EnsembleTrainingTest::test_from_XML(void)
+{
+   message += "test_from_XML\n";
+
+   EnsembleTraining et1;
+   EnsembleTraining et2;
+
+   tinyxml2::XMLDocument* document;
+
+   // Test
+
+   et1.set_first_training_rate(0.5);
+   et1.set_training_rate_decrease_factor(0.25);
+   et1.set_maximum_iterations_number(7);
+   et1.set_reserve_performance_history(true);
+
+   document = et1.to_XML();
+
+   et2.from_XML(*document);
+
+   delete document;
+
+   assert_true(et2.get_first_training_rate() == 0.5, LOG);
+   assert_true(et2.get_training_rate_decrease_factor() == 0.25, LOG);
+   assert_true(et2.get_maximum_iterations_number() == 7, LOG);
+   assert_true(et2.get_reserve_performance_history() == true, LOG);
+}
+
+
+void EnsembleTrainingTest::run_test_case(void)
+{
+   message += "Running ensemble training test case...\n";
+
+   // Constructor and destructor methods
+
+   test_constructor();
+   test_destructor();
+
+   // Get methods
+
+   test_arrange_neural_networks_pointers();
+
+   // Set methods
+
+   test_set_training_rate_decrease_factor();
+
+   // Checking methods
+
+   test_check();
+
+   // Training methods
+
+   test_calculate_first_order_performances();
+
+   test_perform_training();
+
+   test_perform_training_strategy();
+
+   // Serialization methods
+
+   test_to_XML();
+   test_from_XML();
+
+   message += "End of ensemble training test case.\n";
+}
+
+
+// OpenNN: Open Neural Networks Library.
+// Copyright (C) 2005-2016 Roberto Lopez.
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
@@ -0,0 +1,101 @@
+/****************************************************************************************************************/
+/*                                                                                                              */
+/*   OpenNN: Open Neural Networks Library                                                                       */
+/*   www.opennn.net                                                                                             */
+/*                                                                                                              */
+/*   E N S E M B L E   T R A I N I N G   T E S T   C L A S S   H E A D E R                                      */
+/*                                                                                                              */
+/*   Roberto Lopez                                                                                              */
+/*   Artelnics - Making intelligent use of data                                                                 */
+/*   robertolopez@artelnics.com                                                                                 */
+/*                                                                                                              */
+/****************************************************************************************************************/
+
+#ifndef __ENSEMBLETRAININGTEST_H__
+#define __ENSEMBLETRAININGTEST_H__
+
+// Unit testing includes
+
+#include "unit_testing.h"
+
+
+using namespace OpenNN;
+
+
+class EnsembleTrainingTest : public UnitTesting
+{
+
+#define	STRING(x) #x
+#define TOSTRING(x) STRING(x)
+#define LOG __FILE__ ":" TOSTRING(__LINE__)"\n"
+
+public:
+
+   // GENERAL CONSTRUCTOR
+
+   explicit EnsembleTrainingTest(void);
+
+
+   // DESTRUCTOR
+
+   virtual ~EnsembleTrainingTest(void);
+
+
+   // METHODS
+
+   // Constructor and destructor methods
+
+   void test_constructor(void);
+   void test_destructor(void);
+
+   // Get methods
+
+   void test_arrange_neural_networks_pointers(void);
+
+   // Set methods
+
+   void test_set_training_rate_decrease_factor(void);
+
+   // Checking methods
+
+   void test_check(void);
+
+   // Training methods
+
+   void test_calculate_first_order_performances(void);
+
+   void test_perform_training(void);
+
+   void test_perform_training_strategy(void);
+
+   // Serialization methods
+
+   void test_to_XML(void);
+
+   void test_from_XML(void);
+
+   // Unit testing methods
+
+   void run_test_case(void);
+};
+
+
+#endif
+
+
+// OpenNN: Open Neural Networks Library.
+// Copyright (C) 2005-2016 Roberto Lopez.
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
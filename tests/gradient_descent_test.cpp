@@ -201,6 +201,110 @@ void GradientDescentTest::test_resize_training_history(void)
 }
 
 
+void GradientDescentTest::test_arrange_training_history(void)
+{
+   message += "test_arrange_training_history\n";
+
+   DataSet ds(10, 1, 1);
+   ds.randomize_data_normal();
+   NeuralNetwork nn(1, 3, 1);
+   PerformanceFunctional pf(&nn, &ds);
+   GradientDescent gd(&pf);
+
+   GradientDescent::GradientDescentResults* results_pointer;
+
+   const std::string file_name = "../data/training_history.bin";
+
+   Vector<double> initial_parameters;
+
+   Vector< Vector<double> > parameters_history;
+   Vector<double> performance_history;
+
+   Matrix<double> history;
+
+   size_t iterations_number;
+   size_t records_number;
+
+   gd.set_display(false);
+   gd.set_minimum_parameters_increment_norm(0.0);
+   gd.set_performance_goal(0.0);
+   gd.set_minimum_performance_increase(0.0);
+   gd.set_gradient_norm_goal(0.0);
+   gd.set_maximum_selection_performance_decreases(1000);
+   gd.set_maximum_iterations_number(9);
+   gd.set_maximum_time(1000.0);
+
+   gd.set_reserve_parameters_history(true);
+   gd.set_reserve_performance_history(true);
+
+   // Test
+
+   nn.randomize_parameters_normal();
+
+   initial_parameters = nn.arrange_parameters();
+
+   results_pointer = gd.perform_training();
+
+   iterations_number = results_pointer->iterations_number;
+   parameters_history = results_pointer->parameters_history;
+   performance_history = results_pointer->performance_history;
+
+   delete results_pointer;
+
+   assert_true(parameters_history.size() == iterations_number+1, LOG);
+
+   // Test
+
+   nn.set_parameters(initial_parameters);
+
+   gd.set_history_stride(2);
+   gd.set_history_capacity(3);
+   gd.set_history_file_name(file_name);
+
+   results_pointer = gd.perform_training();
+
+   records_number = iterations_number/2 + 1;
+
+   assert_true(results_pointer->parameters_history.size() == std::min((size_t)3, records_number), LOG);
+
+   for(size_t i = 0; i < results_pointer->parameters_history.size(); i++)
+   {
+      assert_true(results_pointer->parameters_history[i] == parameters_history[2*(records_number - results_pointer->parameters_history.size() + i)], LOG);
+   }
+
+   delete results_pointer;
+
+   history = GradientDescent::load_history(file_name, "performance");
+
+   assert_true(history.get_rows_number() == records_number, LOG);
+   assert_true(history.get_columns_number() == 2, LOG);
+
+   for(size_t i = 0; i < history.get_rows_number(); i++)
+   {
+      assert_true(history(i,0) == 2.0*i, LOG);
+      assert_true(history(i,1) == performance_history[2*i], LOG);
+   }
+
+   // Test
+
+   std::ofstream history_file(file_name.c_str(), std::ios::binary | std::ios::app);
+
+   const uint64_t iteration = 1000;
+   const uint64_t name_size = (uint64_t)1 << 62;
+
+   history_file.write(reinterpret_cast<const char*>(&iteration), sizeof(uint64_t));
+   history_file.write(reinterpret_cast<const char*>(&name_size), sizeof(uint64_t));
+
+   history_file.close();
+
+   history = GradientDescent::load_history(file_name, "performance");
+
+   assert_true(history.get_rows_number() == records_number, LOG);
+
+   remove(file_name.c_str());
+}
+
+
 void GradientDescentTest::test_to_XML(void)
 {
    message += "test_to_XML\n";
@@ -262,6 +366,7 @@ void GradientDescentTest::run_test_case(void)
    // Training history methods
 
    test_resize_training_history();
+   test_arrange_training_history();
 
    // Serialization methods
 
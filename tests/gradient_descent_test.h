@@ -58,6 +58,7 @@ public:
    // Training history methods
 
    void test_resize_training_history(void);
+   void test_arrange_training_history(void);
 
    // Serialization methods
 
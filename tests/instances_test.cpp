@@ -146,6 +146,46 @@ void InstancesTest::test_arrange_training_indices(void)
 }
 
 
+void InstancesTest::test_get_generation(void)
+{
+   message += "test_get_generation\n";
+
+   Instances i(4);
+
+   size_t generation;
+
+   i.set_training();
+
+   // Test
+
+   generation = i.get_generation();
+
+   assert_true(i.get_training_indices().size() == 4, LOG);
+   assert_true(i.get_generation() == generation, LOG);
+
+   // Test
+
+   i.set_use(1, Instances::Selection);
+   i.set_use(3, Instances::Testing);
+
+   assert_true(i.get_generation() != generation, LOG);
+
+   assert_true(i.get_training_indices().size() == 2, LOG);
+   assert_true(i.get_training_indices()[0] == 0, LOG);
+   assert_true(i.get_training_indices()[1] == 2, LOG);
+   assert_true(i.get_selection_indices().size() == 1, LOG);
+   assert_true(i.get_testing_indices()[0] == 3, LOG);
+   assert_true(i.count_used_instances_number() == 4, LOG);
+
+   // Test
+
+   Instances other_instances(i);
+
+   assert_true(other_instances.get_generation() != i.get_generation(), LOG);
+   assert_true(other_instances.get_training_indices() == i.get_training_indices(), LOG);
+}
+
+
 void InstancesTest::test_count_selection_instances_number(void) 
 {
    message += "test_count_selection_instances_number\n";
@@ -615,6 +655,8 @@ void InstancesTest::run_test_case(void)
 
    test_arrange_used_indices();
 
+   test_get_generation();
+
    test_get_display();
 
    // Set methods
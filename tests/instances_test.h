@@ -65,6 +65,8 @@ public:
    void test_arrange_testing_indices(void);
    void test_arrange_used_indices(void);
 
+   void test_get_generation(void);
+
    void test_get_display(void);
 
    // Set methods
@@ -0,0 +1,255 @@
+/****************************************************************************************************************/
+/*                                                                                                              */
+/*   OpenNN: Open Neural Networks Library                                                                       */
+/*   www.opennn.net                                                                                             */
+/*                                                                                                              */
+/*   I N S T R U M E N T A T I O N   T E S T   C L A S S                                                        */
+/*                                                                                                              */
+/*   Roberto Lopez                                                                                              */
+/*   Artelnics - Making intelligent use of data                                                                 */
+/*   robertolopez@artelnics.com                                                                                 */
+/*                                                                                                              */
+/****************************************************************************************************************/
+
+// Unit testing includes
+
+#include "instrumentation_test.h"
+
+using namespace OpenNN;
+
+
+// GENERAL CONSTRUCTOR
+
+InstrumentationTest::InstrumentationTest(void) : UnitTesting()
+{
+}
+
+
+// DESTRUCTOR
+
+InstrumentationTest::~InstrumentationTest(void)
+{
+}
+
+
+// METHODS
+
+void InstrumentationTest::test_get_entry(void)
+{
+   message += "test_get_entry\n";
+
+   Instrumentation::Entry& entry_1 = Instrumentation::get_entry("instrumentation_test.entry");
+   Instrumentation::Entry& entry_2 = Instrumentation::get_entry("instrumentation_test.entry");
+   Instrumentation::Entry& entry_3 = Instrumentation::get_entry("instrumentation_test.other_entry");
+
+   assert_true(&entry_1 == &entry_2, LOG);
+   assert_true(&entry_1 != &entry_3, LOG);
+   assert_true(entry_1.name == "instrumentation_test.entry", LOG);
+}
+
+
+void InstrumentationTest::test_scoped_timer(void)
+{
+   message += "test_scoped_timer\n";
+
+   Instrumentation::Entry& entry = Instrumentation::get_entry("instrumentation_test.timer");
+
+   const unsigned long long calls = entry.calls;
+
+   // Test
+
+   {
+      const Instrumentation::ScopedTimer timer(entry);
+
+      assert_true(entry.calls == calls, LOG);
+   }
+
+   assert_true(entry.calls == calls + 1, LOG);
+}
+
+
+void InstrumentationTest::test_instrumentation_macros(void)
+{
+   message += "test_instrumentation_macros\n";
+
+   const Vector<Instrumentation::Record> beginning_records = Instrumentation::get_records();
+
+   Vector<Instrumentation::Record> records;
+
+   // Test
+
+   for(size_t i = 0; i < 2; i++)
+   {
+      OPENNN_SCOPED_TIMER("instrumentation_test.macros");
+
+      if(i < 2)
+         OPENNN_COUNT("instrumentation_test.macros", 3);
+      else
+         OPENNN_COUNT("instrumentation_test.macros", 1);
+   }
+
+   records = Instrumentation::calculate_records_difference(Instrumentation::get_records(), beginning_records);
+
+   if(Instrumentation::is_enabled())
+   {
+      assert_true(records.size() == 1, LOG);
+      assert_true(records[0].name == "instrumentation_test.macros", LOG);
+      assert_true(records[0].calls == 2, LOG);
+      assert_true(records[0].count == 6, LOG);
+   }
+   else
+   {
+      assert_true(records.empty(), LOG);
+   }
+}
+
+
+void InstrumentationTest::test_get_records(void)
+{
+   message += "test_get_records\n";
+
+   Vector<Instrumentation::Record> records;
+
+   // Test
+
+   Instrumentation::get_entry("instrumentation_test.b").count += 2;
+   Instrumentation::get_entry("instrumentation_test.a").count += 1;
+
+   records = Instrumentation::get_records();
+
+   assert_true(!records.empty(), LOG);
+
+   for(size_t i = 1; i < records.size(); i++)
+   {
+      assert_true(records[i-1].name < records[i].name, LOG);
+   }
+}
+
+
+void InstrumentationTest::test_calculate_records_difference(void)
+{
+   message += "test_calculate_records_difference\n";
+
+   Vector<Instrumentation::Record> beginning_records(2);
+   Vector<Instrumentation::Record> records(3);
+   Vector<Instrumentation::Record> difference;
+
+   // Test
+
+   beginning_records[0].name = "a";
+   beginning_records[0].calls = 1;
+   beginning_records[1].name = "c";
+   beginning_records[1].count = 5;
+
+   records[0].name = "a";
+   records[0].calls = 1;
+   records[1].name = "b";
+   records[1].calls = 2;
+   records[1].time = 0.5;
+   records[2].name = "c";
+   records[2].count = 8;
+
+   difference = Instrumentation::calculate_records_difference(records, beginning_records);
+
+   assert_true(difference.size() == 2, LOG);
+   assert_true(difference[0].name == "b", LOG);
+   assert_true(difference[0].calls == 2, LOG);
+   assert_true(difference[0].time == 0.5, LOG);
+   assert_true(difference[1].name == "c", LOG);
+   assert_true(difference[1].count == 3, LOG);
+
+   // Test
+
+   records[2].count = 2;
+   records[2].calls = 1;
+
+   difference = Instrumentation::calculate_records_difference(records, beginning_records);
+
+   assert_true(difference.size() == 2, LOG);
+   assert_true(difference[1].name == "c", LOG);
+   assert_true(difference[1].calls == 1, LOG);
+   assert_true(difference[1].count == 0, LOG);
+}
+
+
+void InstrumentationTest::test_to_JSON(void)
+{
+   message += "test_to_JSON\n";
+
+   Vector<Instrumentation::Record> records(1);
+
+   // Test
+
+   assert_true(Instrumentation::to_JSON(Vector<Instrumentation::Record>()) == "[\n]\n", LOG);
+
+   // Test
+
+   records[0].name = "matrix.dot";
+   records[0].calls = 2;
+   records[0].time = 0.25;
+   records[0].count = 16;
+
+   assert_true(Instrumentation::to_JSON(records) == "[\n  {\"name\": \"matrix.dot\", \"calls\": 2, \"time\": 0.25, \"count\": 16}\n]\n", LOG);
+}
+
+
+void InstrumentationTest::test_to_CSV(void)
+{
+   message += "test_to_CSV\n";
+
+   Vector<Instrumentation::Record> records(1);
+
+   // Test
+
+   records[0].name = "matrix.dot";
+   records[0].calls = 2;
+   records[0].time = 0.25;
+   records[0].count = 16;
+
+   assert_true(Instrumentation::to_CSV(records) == "name,calls,time,count\nmatrix.dot,2,0.25,16\n", LOG);
+}
+
+
+void InstrumentationTest::run_test_case(void)
+{
+   message += "Running instrumentation test case...\n";
+
+   // Entries methods
+
+   test_get_entry();
+
+   test_scoped_timer();
+
+   test_instrumentation_macros();
+
+   // Records methods
+
+   test_get_records();
+
+   test_calculate_records_difference();
+
+   // Serialization methods
+
+   test_to_JSON();
+   test_to_CSV();
+
+   message += "End of instrumentation test case.\n";
+}
+
+
+// OpenNN: Open Neural Networks Library.
+// Copyright (C) 2005-2016 Roberto Lopez.
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
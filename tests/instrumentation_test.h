@@ -0,0 +1,89 @@
+/****************************************************************************************************************/
+/*                                                                                                              */
+/*   OpenNN: Open Neural Networks Library                                                                       */
+/*   www.opennn.net                                                                                             */
+/*                                                                                                              */
+/*   I N S T R U M E N T A T I O N   T E S T   C L A S S   H E A D E R                                          */
+/*                                                                                                              */
+/*   Roberto Lopez                                                                                              */
+/*   Artelnics - Making intelligent use of data                                                                 */
+/*   robertolopez@artelnics.com                                                                                 */
+/*                                                                                                              */
+/****************************************************************************************************************/
+
+#ifndef __INSTRUMENTATIONTEST_H__
+#define __INSTRUMENTATIONTEST_H__
+
+// Unit testing includes
+
+#include "unit_testing.h"
+
+
+using namespace OpenNN;
+
+
+class InstrumentationTest : public UnitTesting
+{
+
+#define	STRING(x) #x
+#define TOSTRING(x) STRING(x)
+#define LOG __FILE__ ":" TOSTRING(__LINE__)"\n"
+
+public:
+
+   // GENERAL CONSTRUCTOR
+
+   explicit InstrumentationTest(void);
+
+
+   // DESTRUCTOR
+
+   virtual ~InstrumentationTest(void);
+
+
+   // METHODS
+
+   // Entries methods
+
+   void test_get_entry(void);
+
+   void test_scoped_timer(void);
+
+   void test_instrumentation_macros(void);
+
+   // Records methods
+
+   void test_get_records(void);
+
+   void test_calculate_records_difference(void);
+
+   // Serialization methods
+
+   void test_to_JSON(void);
+   void test_to_CSV(void);
+
+   // Unit testing methods
+
+   void run_test_case(void);
+};
+
+
+#endif
+
+
+// OpenNN: Open Neural Networks Library.
+// Copyright (C) 2005-2016 Roberto Lopez.
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
@@ -67,6 +67,7 @@ int main(void)
    "training_rate_algorithm\n"
    "training_algorithm\n"
    "random_search\n"
+   "ensemble_training\n"
    "quasi_newton_method\n"
    "newton_method\n"
    "levenberg_marquardt_algorithm\n"
@@ -77,6 +78,7 @@ int main(void)
    "vector\n"
    "numerical_integration\n"
    "numerical_differentiation\n"
+   "instrumentation\n"
    "matrix\n"
    "model_selection\n"
    "order_selection_algorithm\n"
@@ -106,7 +108,7 @@ int main(void)
 
    try
    {
-      srand((unsigned)time(NULL));
+      set_random_seed((unsigned long)time(NULL));
 
       std::string message;
 
@@ -147,6 +149,15 @@ int main(void)
          tests_passed_count += test_numerical_differentiation.get_tests_passed_count();
          tests_failed_count += test_numerical_differentiation.get_tests_failed_count();
       }
+      else if(test == "instrumentation")
+      {
+         InstrumentationTest instrumentation_test;
+         instrumentation_test.run_test_case();
+         message += instrumentation_test.get_message();
+         tests_count += instrumentation_test.get_tests_count();
+         tests_passed_count += instrumentation_test.get_tests_passed_count();
+         tests_failed_count += instrumentation_test.get_tests_failed_count();
+      }
       else if(test == "numerical_integration")
       {
          NumericalIntegrationTest test_numerical_integration;
@@ -505,6 +516,15 @@ int main(void)
         tests_passed_count += random_search_test.get_tests_passed_count();
         tests_failed_count += random_search_test.get_tests_failed_count();
       }
+      else if(test == "ensemble_training")
+      {
+        EnsembleTrainingTest ensemble_training_test;
+        ensemble_training_test.run_test_case();
+        message += ensemble_training_test.get_message();
+        tests_count += ensemble_training_test.get_tests_count();
+        tests_passed_count += ensemble_training_test.get_tests_passed_count();
+        tests_failed_count += ensemble_training_test.get_tests_failed_count();
+      }
       else if(test == "evolutionary_algorithm")
       {
         EvolutionaryAlgorithmTest evolutionary_algorithm_test;
@@ -706,6 +726,15 @@ int main(void)
           tests_passed_count += test_numerical_differentiation.get_tests_passed_count();
           tests_failed_count += test_numerical_differentiation.get_tests_failed_count();
 
+          // instrumentation
+
+          InstrumentationTest instrumentation_test;
+          instrumentation_test.run_test_case();
+          message += instrumentation_test.get_message();
+          tests_count += instrumentation_test.get_tests_count();
+          tests_passed_count += instrumentation_test.get_tests_passed_count();
+          tests_failed_count += instrumentation_test.get_tests_failed_count();
+
           // numerical integration
 
           NumericalIntegrationTest test_numerical_integration;
@@ -1039,6 +1068,15 @@ int main(void)
           tests_passed_count += random_search_test.get_tests_passed_count();
           tests_failed_count += random_search_test.get_tests_failed_count();
 
+          // ensemble training
+
+          EnsembleTrainingTest ensemble_training_test;
+          ensemble_training_test.run_test_case();
+          message += ensemble_training_test.get_message();
+          tests_count += ensemble_training_test.get_tests_count();
+          tests_passed_count += ensemble_training_test.get_tests_passed_count();
+          tests_failed_count += ensemble_training_test.get_tests_failed_count();
+
           // evolutionary algorithm
 
           EvolutionaryAlgorithmTest evolutionary_algorithm_test;
@@ -971,6 +971,93 @@ void MatrixTest::test_dot_vector(void)
 }
 
 
+void MatrixTest::test_transpose_dot_vector(void)
+{
+   message += "test_transpose_dot_vector\n";
+
+   Matrix<double> a;
+   Vector<double> b;
+
+   Vector<double> c;
+
+   // Test
+
+   a.set(2, 3, 1.0);
+   b.set(2, 1.0);
+
+   c = a.transpose_dot(b);
+
+   assert_true(c.size() == 3, LOG);
+   assert_true(c == 2.0, LOG);
+
+   // Test
+
+   a.set(5, 2);
+   a.randomize_normal();
+
+   b.set(5);
+   b.randomize_normal();
+
+   c = a.transpose_dot(b);
+
+   assert_true((c - a.calculate_transpose().dot(b)).calculate_absolute_value() < 1.0e-12, LOG);
+}
+
+
+void MatrixTest::test_transpose_dot_matrix(void)
+{
+   message += "test_transpose_dot_matrix\n";
+
+   Matrix<double> a;
+   Matrix<double> b;
+
+   Matrix<double> c;
+
+   // Test
+
+   a.set(4, 3);
+   a.randomize_normal();
+
+   b.set(4, 6);
+   b.randomize_normal();
+
+   c = a.transpose_dot(b);
+
+   assert_true(c.get_rows_number() == 3, LOG);
+   assert_true(c.get_columns_number() == 6, LOG);
+   assert_true((c - a.calculate_transpose().dot(b)).calculate_absolute_value() < 1.0e-12, LOG);
+}
+
+
+void MatrixTest::test_calculate_rank_k_update(void)
+{
+   message += "test_calculate_rank_k_update\n";
+
+   Matrix<double> a;
+
+   Matrix<double> c;
+
+   // Test
+
+   a.set(3, 2, 1.0);
+
+   c = a.calculate_rank_k_update();
+
+   assert_true(c.get_rows_number() == 2, LOG);
+   assert_true(c == 3.0, LOG);
+
+   // Test
+
+   a.set(10, 4);
+   a.randomize_normal();
+
+   c = a.calculate_rank_k_update();
+
+   assert_true(c.is_symmetric(), LOG);
+   assert_true((c - a.calculate_transpose().dot(a)).calculate_absolute_value() < 1.0e-12, LOG);
+}
+
+
 void MatrixTest::test_dot_matrix(void)
 {
    message += "test_dot_matrix\n";
@@ -1106,6 +1193,23 @@ void MatrixTest::test_calculate_histogram(void)
 
    assert_true(histograms.size() == m.get_columns_number(), LOG);
    assert_true(histograms[0].get_bins_number() == bins_number, LOG);
+
+   // Test
+
+   m.set(10000, 3);
+   m.randomize_normal();
+
+   const Vector<size_t> rows_indices(1, 2, 9999);
+   const Vector<size_t> columns_indices(1, 2);
+
+   histograms = m.calculate_histograms(rows_indices, columns_indices, 10);
+
+   const Histogram<double> histogram = m.arrange_column(2, rows_indices).calculate_histogram(10);
+
+   assert_true(histograms.size() == 1, LOG);
+   assert_true(histograms[0].frequencies.calculate_sum() == rows_indices.size(), LOG);
+   assert_true(histograms[0].frequencies == histogram.frequencies, LOG);
+   assert_true(histograms[0].centers == histogram.centers, LOG);
 }
 
 
@@ -1220,6 +1324,26 @@ void MatrixTest::test_calculate_transpose(void)
    Matrix<int> transpose = m.calculate_transpose();
 
    assert_true(transpose == m, LOG);
+
+   // Test
+
+   m.set(70, 45);
+
+   for(size_t i = 0; i < 70; i++)
+   {
+      for(size_t j = 0; j < 45; j++)
+      {
+         m(i,j) = (int)(100*i + j);
+      }
+   }
+
+   transpose = m.calculate_transpose();
+
+   assert_true(transpose.get_rows_number() == 45, LOG);
+   assert_true(transpose.get_columns_number() == 70, LOG);
+   assert_true(transpose(44,69) == 6944, LOG);
+   assert_true(transpose(33,40) == 4033, LOG);
+   assert_true(transpose.calculate_transpose() == m, LOG);
 }
 
 
@@ -1626,6 +1750,164 @@ void MatrixTest::test_load(void)
    assert_true(m(0,0) == 3, LOG); assert_true(m(0,1) == 5, LOG);
    assert_true(m(1,0) == 7, LOG); assert_true(m(1,1) == 9, LOG);
    assert_true(m(2,0) == 2, LOG); assert_true(m(2,1) == 4, LOG);
+
+   // Test
+
+   Matrix<double> d;
+
+   std::ofstream file(file_name.c_str());
+
+   file << "0.1 -2.5e-3 7\r\n"
+        << "\n"
+        << "1e22 123456789012345678 -0.000001\n";
+
+   file.close();
+
+   d.load(file_name);
+
+   assert_true(d.get_rows_number() == 2, LOG);
+   assert_true(d.get_columns_number() == 3, LOG);
+   assert_true(d(0,0) == 0.1, LOG);
+   assert_true(d(0,1) == -2.5e-3, LOG);
+   assert_true(d(0,2) == 7.0, LOG);
+   assert_true(d(1,0) == 1.0e22, LOG);
+   assert_true(d(1,1) == 123456789012345678.0, LOG);
+   assert_true(d(1,2) == -1.0e-6, LOG);
+
+   // Test
+
+   d.set(2, 2);
+
+   d(0,0) = 0.125; d(0,1) = -3.5;
+   d(1,0) = 1.0e-5; d(1,1) = 250000.0;
+
+   d.save(file_name);
+   d.load(file_name);
+
+   assert_true(d(0,0) == 0.125, LOG); assert_true(d(0,1) == -3.5, LOG);
+   assert_true(d(1,0) == 1.0e-5, LOG); assert_true(d(1,1) == 250000.0, LOG);
+}
+
+
+void MatrixTest::test_load_binary(void)
+{
+   message += "test_load_binary\n";
+
+#ifdef __APPLE__
+   std::string file_name = "../../../../data/matrix.bin";
+#else
+   std::string file_name = "../data/matrix.bin";
+#endif
+
+   Matrix<double> m;
+   Matrix<double> n;
+
+   // Test
+
+   m.set(3, 5);
+   m.randomize_normal();
+
+   m.save_binary(file_name);
+   n.load_binary(file_name);
+
+   assert_true(n == m, LOG);
+
+   // Test
+
+   m.set(3, 2, 1.5);
+
+   std::ofstream file(file_name.c_str(), std::ios::binary);
+
+   const size_t columns_number = 2;
+   const size_t rows_number = 3;
+
+   file.write(reinterpret_cast<const char*>(&columns_number), sizeof(size_t));
+   file.write(reinterpret_cast<const char*>(&rows_number), sizeof(size_t));
+   file.write(reinterpret_cast<const char*>(m.data()), 6*sizeof(double));
+
+   file.close();
+
+   n.load_binary(file_name);
+
+   assert_true(n.get_rows_number() == 3, LOG);
+   assert_true(n.get_columns_number() == 2, LOG);
+   assert_true(n == 1.5, LOG);
+
+   // Test
+
+   const uint32_t version = 1;
+   const uint32_t element_size = sizeof(double);
+   const uint64_t huge_rows_number = (uint64_t)1 << 60;
+   const uint64_t huge_columns_number = 16;
+
+   file.open(file_name.c_str(), std::ios::binary);
+
+   file.write("OPENNNM", 8);
+   file.write(reinterpret_cast<const char*>(&version), sizeof(uint32_t));
+   file.write(reinterpret_cast<const char*>(&element_size), sizeof(uint32_t));
+   file.write(reinterpret_cast<const char*>(&huge_rows_number), sizeof(uint64_t));
+   file.write(reinterpret_cast<const char*>(&huge_columns_number), sizeof(uint64_t));
+   file.write(reinterpret_cast<const char*>(m.data()), 6*sizeof(double));
+
+   file.close();
+
+   try
+   {
+      n.load_binary(file_name);
+
+      assert_true(false, LOG);
+   }
+   catch(const std::logic_error&)
+   {
+      assert_true(n.get_rows_number() == 3, LOG);
+   }
+
+   // Test
+
+   const uint64_t rows_number_header = 3;
+   const uint64_t columns_number_header = 5;
+
+   file.open(file_name.c_str(), std::ios::binary);
+
+   file.write("OPENNNM", 8);
+   file.write(reinterpret_cast<const char*>(&version), sizeof(uint32_t));
+   file.write(reinterpret_cast<const char*>(&element_size), sizeof(uint32_t));
+   file.write(reinterpret_cast<const char*>(&rows_number_header), sizeof(uint64_t));
+   file.write(reinterpret_cast<const char*>(&columns_number_header), sizeof(uint64_t));
+   file.write(reinterpret_cast<const char*>(m.data()), 6*sizeof(double));
+
+   file.close();
+
+   try
+   {
+      n.load_binary(file_name);
+
+      assert_true(false, LOG);
+   }
+   catch(const std::logic_error&)
+   {
+   }
+
+   // Test
+
+   const size_t huge_legacy_rows_number = (size_t)1 << 60;
+
+   file.open(file_name.c_str(), std::ios::binary);
+
+   file.write(reinterpret_cast<const char*>(&columns_number), sizeof(size_t));
+   file.write(reinterpret_cast<const char*>(&huge_legacy_rows_number), sizeof(size_t));
+
+   file.close();
+
+   try
+   {
+      n.load_binary(file_name);
+
+      assert_true(false, LOG);
+   }
+   catch(const std::logic_error&)
+   {
+   }
 }
 
 
@@ -1770,6 +2052,11 @@ void MatrixTest::run_test_case(void)
    test_dot_vector();
    test_dot_matrix();
 
+   test_transpose_dot_vector();
+   test_transpose_dot_matrix();
+
+   test_calculate_rank_k_update();
+
    test_direct();
 
    test_calculate_minimum_maximum();
@@ -1828,6 +2115,7 @@ void MatrixTest::run_test_case(void)
    test_print();
 
    test_load();
+   test_load_binary();
 
    test_save();
 
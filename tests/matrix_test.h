@@ -138,6 +138,11 @@ public:
    void test_dot_vector(void);
    void test_dot_matrix(void);
 
+   void test_transpose_dot_vector(void);
+   void test_transpose_dot_matrix(void);
+
+   void test_calculate_rank_k_update(void);
+
    void test_direct(void);
 
    void test_calculate_minimum_maximum(void);
@@ -197,6 +202,7 @@ public:
    void test_print(void);
 
    void test_load(void);
+   void test_load_binary(void);
 
    void test_save(void);
 
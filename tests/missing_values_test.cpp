@@ -172,7 +172,23 @@ void MissingValuesTest::test_convert_time_series(void)
 
     mv.convert_time_series(1);
 
-//    assert_true(mv.get_missing_values_number() == 2, LOG);
+    assert_true(mv.get_missing_values_number() == 0, LOG);
+
+    // Test
+
+    mv.set(3, 2);
+
+    mv.append(1, 0);
+    mv.append(2, 1);
+
+    mv.convert_time_series(1);
+
+    assert_true(mv.get_instances_number() == 2, LOG);
+    assert_true(mv.get_variables_number() == 4, LOG);
+    assert_true(mv.get_missing_values_number() == 3, LOG);
+    assert_true(mv.get_item(0) == MissingValues::Item(1, 0), LOG);
+    assert_true(mv.get_item(1) == MissingValues::Item(0, 2), LOG);
+    assert_true(mv.get_item(2) == MissingValues::Item(1, 3), LOG);
 }
 
 
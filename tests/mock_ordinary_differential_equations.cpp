@@ -51,9 +51,16 @@ void MockOrdinaryDifferentialEquations::set_default(void)
 
 // Vector<double> calculate_dependent_variables_dots(const NeuralNetwork&, const Vector<double>&) const method
 
-Vector<double> MockOrdinaryDifferentialEquations::calculate_dependent_variables_dots(const NeuralNetwork&, const Vector<double>&) const
+/// Returns the derivatives of the exponential decay model, y' = -y, for each dependent variable.
+
+Vector<double> MockOrdinaryDifferentialEquations::calculate_dependent_variables_dots(const NeuralNetwork&, const Vector<double>& variables) const
 {
-   Vector<double> dependent_variables_dots(dependent_variables_number, 0.0);
+   Vector<double> dependent_variables_dots(dependent_variables_number);
+
+   for(size_t j = 0; j < dependent_variables_number; j++)
+   {
+      dependent_variables_dots[j] = -variables[1+j];
+   }
 
    return(dependent_variables_dots);
 }
@@ -1208,6 +1208,31 @@ void MultilayerPerceptronTest::test_calculate_outputs(void)
    parameters = mlp.arrange_parameters();
 
    assert_true(mlp.calculate_outputs(inputs) == mlp.calculate_outputs(inputs, parameters), LOG);
+
+   // Test
+
+   mlp.set(3, 5, 2);
+
+   mlp.set_layer_activation_function(0, Perceptron::Logistic);
+
+   mlp.randomize_parameters_normal();
+
+   Matrix<double> inputs_batch(4, 3);
+   inputs_batch.randomize_normal();
+
+   const Matrix<float> float_outputs = mlp.calculate_outputs(inputs_batch.to_float_matrix());
+
+   assert_true(float_outputs.get_rows_number() == 4, LOG);
+   assert_true(float_outputs.get_columns_number() == 2, LOG);
+
+   Matrix<double> double_outputs(4, 2);
+
+   for(size_t i = 0; i < 4; i++)
+   {
+      double_outputs.set_row(i, mlp.calculate_outputs(inputs_batch.arrange_row(i)));
+   }
+
+   assert_true(double_outputs.calculate_sum_squared_error(float_outputs) < 1.0e-8, LOG);
 }
 
 
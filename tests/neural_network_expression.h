@@ -0,0 +1,117 @@
+// Neural network generated by OpenNN.
+
+#ifndef __NEURAL_NETWORK_EXPRESSION_H__
+#define __NEURAL_NETWORK_EXPRESSION_H__
+
+#include <cmath>
+#include <cstddef>
+
+namespace neural_network_expression
+{
+
+constexpr std::size_t inputs_number = 2;
+constexpr std::size_t outputs_number = 1;
+
+constexpr double scaling_slopes[2] = {0.5, 1};
+
+constexpr double scaling_intercepts[2] = {-0.5, -1};
+
+constexpr double layer_0_synaptic_weights[6] = {-0.5, -0.25, 0.25, 0.5, -0.75, -0.5};
+
+constexpr double layer_0_biases[3] = {-0.75, 0, 0.75};
+
+constexpr double layer_1_synaptic_weights[3] = {0, 0.25, 0.5};
+
+constexpr double layer_1_biases[1] = {-0.25};
+
+constexpr double unscaling_slopes[1] = {2};
+
+constexpr double unscaling_intercepts[1] = {10};
+
+constexpr double lower_bounds[1] = {8};
+
+constexpr double upper_bounds[1] = {12};
+
+/// Computes the outputs of the neural network for a single row of inputs.
+
+inline void calculate_outputs(const double* inputs, double* outputs)
+{
+   // Scaling layer
+
+   double scaled_inputs[2];
+
+   for(std::size_t i = 0; i < 2; i++)
+   {
+      scaled_inputs[i] = scaling_slopes[i]*inputs[i] + scaling_intercepts[i];
+   }
+
+   // Perceptron layer 0
+
+   double layer_0_outputs[3];
+
+   for(std::size_t i = 0; i < 3; i++)
+   {
+      const double* synaptic_weights = layer_0_synaptic_weights + i*2;
+
+      double combination = layer_0_biases[i];
+
+      for(std::size_t j = 0; j < 2; j++)
+      {
+         combination += synaptic_weights[j]*scaled_inputs[j];
+      }
+
+      layer_0_outputs[i] = std::tanh(combination);
+   }
+
+   // Perceptron layer 1
+
+   double layer_1_outputs[1];
+
+   for(std::size_t i = 0; i < 1; i++)
+   {
+      const double* synaptic_weights = layer_1_synaptic_weights + i*3;
+
+      double combination = layer_1_biases[i];
+
+      for(std::size_t j = 0; j < 3; j++)
+      {
+         combination += synaptic_weights[j]*layer_0_outputs[j];
+      }
+
+      layer_1_outputs[i] = combination;
+   }
+
+   for(std::size_t i = 0; i < 1; i++)
+   {
+      outputs[i] = layer_1_outputs[i];
+   }
+
+   // Unscaling layer
+
+   for(std::size_t i = 0; i < 1; i++)
+   {
+      outputs[i] = unscaling_slopes[i]*outputs[i] + unscaling_intercepts[i];
+   }
+
+   // Bounding layer
+
+   for(std::size_t i = 0; i < 1; i++)
+   {
+      outputs[i] = outputs[i] < lower_bounds[i] ? lower_bounds[i] : (outputs[i] > upper_bounds[i] ? upper_bounds[i] : outputs[i]);
+   }
+}
+
+/// Computes the outputs of the neural network for a batch of rows.
+/// The inputs and the outputs are stored row by row.
+
+inline void calculate_outputs(const double* inputs, double* outputs, const std::size_t rows_number)
+{
+   for(std::size_t i = 0; i < rows_number; i++)
+   {
+      calculate_outputs(inputs + i*inputs_number, outputs + i*outputs_number);
+   }
+}
+
+}
+
+#endif
@@ -16,6 +16,10 @@
 
 #include "neural_network_test.h"
 
+// Header generated by write_expression_cpp from the network built in test_calculate_expression_cpp_outputs
+
+#include "neural_network_expression.h"
+
 
 using namespace OpenNN;
 
@@ -93,6 +97,48 @@ void NeuralNetworkTest::test_constructor(void)
 
    // Copy constructor
 
+   // Parameters override constructor
+
+   NeuralNetwork nn7(2, 3, 1);
+   nn7.construct_scaling_layer();
+
+   const Vector<double> parameters = nn7.arrange_parameters();
+
+   Vector<double> new_parameters(parameters.size());
+   new_parameters.randomize_normal();
+
+   const Vector<double> inputs(2, 0.5);
+
+   {
+      const NeuralNetwork nn8(nn7, new_parameters);
+
+      assert_true(nn8.get_scaling_layer_pointer() == nn7.get_scaling_layer_pointer(), LOG);
+      assert_true(nn8.get_multilayer_perceptron_pointer() == nn7.get_multilayer_perceptron_pointer(), LOG);
+      assert_true(nn8.arrange_parameters() == new_parameters, LOG);
+      assert_true((nn8.calculate_outputs(inputs) - nn7.calculate_outputs(inputs, new_parameters)).calculate_absolute_value() < 1.0e-12, LOG);
+   }
+
+   assert_true(nn7.arrange_parameters() == parameters, LOG);
+   assert_true(nn7.get_scaling_layer_pointer() != NULL, LOG);
+
+   NeuralNetwork nn9(2, 3, 1);
+   nn9.construct_independent_parameters();
+   nn9.get_independent_parameters_pointer()->set_parameters_number(2);
+   nn9.get_independent_parameters_pointer()->set_scaling_method(IndependentParameters::MinimumMaximum);
+
+   new_parameters.set(nn9.count_parameters_number());
+   new_parameters.randomize_normal();
+
+   {
+      const NeuralNetwork nn10(nn9, new_parameters);
+
+      assert_true(nn10.get_independent_parameters_pointer() == nn9.get_independent_parameters_pointer(), LOG);
+      assert_true((nn10.arrange_independent_parameters() - new_parameters.take_out(new_parameters.size()-2, 2)).calculate_absolute_value() < 1.0e-12, LOG);
+      assert_true((nn10.calculate_outputs(inputs) - nn9.calculate_outputs(inputs, new_parameters)).calculate_absolute_value() < 1.0e-12, LOG);
+   }
+
+   assert_true(nn9.get_multilayer_perceptron_pointer() != NULL, LOG);
+   assert_true(nn9.get_independent_parameters_pointer() != NULL, LOG);
 }
 
 
@@ -662,6 +708,105 @@ void NeuralNetworkTest::test_calculate_output_data(void)
 }
 
 
+void NeuralNetworkTest::test_calculate_float_outputs(void)
+{
+   message += "test_calculate_float_outputs\n";
+
+   NeuralNetwork nn;
+
+   Vector< Statistics<double> > inputs_statistics(3);
+   Vector< Statistics<double> > outputs_statistics(2);
+
+   Matrix<double> input_data;
+   Matrix<float> float_outputs;
+
+   Vector<double> outputs;
+
+   bool equal;
+
+   // Test
+
+   nn.set(3, 4, 2);
+   nn.randomize_parameters_normal();
+
+   inputs_statistics[0] = Statistics<double>(-1.0, 3.0, 1.0, 2.0);
+   inputs_statistics[1] = Statistics<double>(0.0, 10.0, 5.0, 4.0);
+   inputs_statistics[2] = Statistics<double>(2.0, 2.0, 2.0, 0.0);
+
+   outputs_statistics[0] = Statistics<double>(-5.0, 5.0, 0.0, 3.0);
+   outputs_statistics[1] = Statistics<double>(1.0, 100.0, 50.0, 20.0);
+
+   nn.construct_scaling_layer();
+   nn.get_scaling_layer_pointer()->set_statistics(inputs_statistics);
+   nn.get_scaling_layer_pointer()->set_display(false);
+
+   nn.construct_unscaling_layer();
+   nn.get_unscaling_layer_pointer()->set_statistics(outputs_statistics);
+   nn.get_unscaling_layer_pointer()->set_display(false);
+
+   input_data.set(20, 3);
+   input_data.randomize_normal();
+
+   for(size_t k = 0; k < 2; k++)
+   {
+      nn.get_scaling_layer_pointer()->set_scaling_method(k == 0 ? ScalingLayer::MinimumMaximum : ScalingLayer::MeanStandardDeviation);
+      nn.get_unscaling_layer_pointer()->set_unscaling_method(k == 0 ? UnscalingLayer::MinimumMaximum : UnscalingLayer::MeanStandardDeviation);
+
+      float_outputs = nn.calculate_outputs(input_data.to_float_matrix());
+
+      assert_true(float_outputs.get_rows_number() == 20, LOG);
+      assert_true(float_outputs.get_columns_number() == 2, LOG);
+
+      equal = true;
+
+      for(size_t i = 0; i < 20; i++)
+      {
+         outputs = nn.calculate_outputs(input_data.arrange_row(i));
+
+         for(size_t j = 0; j < 2; j++)
+         {
+            if(fabs(float_outputs(i,j) - outputs[j]) > 1.0e-4*(1.0 + fabs(outputs[j])))
+            {
+               equal = false;
+            }
+         }
+      }
+
+      assert_true(equal, LOG);
+   }
+
+   // Test
+
+   nn.construct_probabilistic_layer();
+   nn.get_probabilistic_layer_pointer()->set_probabilistic_method(ProbabilisticLayer::Softmax);
+
+   nn.construct_bounding_layer();
+   nn.get_bounding_layer_pointer()->set_lower_bounds(Vector<double>(2, 0.1));
+   nn.get_bounding_layer_pointer()->set_upper_bounds(Vector<double>(2, 0.8));
+
+   float_outputs = nn.calculate_outputs(input_data.to_float_matrix());
+
+   equal = true;
+
+   for(size_t i = 0; i < 20; i++)
+   {
+      outputs = nn.calculate_outputs(input_data.arrange_row(i));
+
+      for(size_t j = 0; j < 2; j++)
+      {
+         if(fabs(float_outputs(i,j) - outputs[j]) > 1.0e-5)
+         {
+            equal = false;
+         }
+      }
+   }
+
+   assert_true(equal, LOG);
+   assert_true(float_outputs.calculate_minimum() >= 0.1f, LOG);
+   assert_true(float_outputs.calculate_maximum() <= 0.8f, LOG);
+}
+
+
 // @todo
 
 void NeuralNetworkTest::test_calculate_Jacobian(void)
@@ -1151,6 +1296,152 @@ void NeuralNetworkTest::test_load(void)
 }
 
 
+void NeuralNetworkTest::test_load_binary(void)
+{
+   message += "test_load_binary\n";
+
+#ifdef __APPLE__
+   std::string file_name = "../../../../data/neural_network.bin";
+#else
+   std::string file_name = "../data/neural_network.bin";
+#endif
+
+   NeuralNetwork nn1;
+   NeuralNetwork nn2;
+
+   Vector<size_t> architecture(3);
+   Vector<double> inputs(3);
+
+   // Test
+
+   architecture[0] = 3;
+   architecture[1] = 4;
+   architecture[2] = 2;
+
+   nn1.set(architecture);
+   nn1.randomize_parameters_normal();
+
+   nn1.get_multilayer_perceptron_pointer()->set_layer_activation_function(1, Perceptron::Logistic);
+
+   nn1.construct_scaling_layer();
+   nn1.get_scaling_layer_pointer()->set_item_statistics(1, Statistics<double>(-3.0, 5.0, 1.0, 2.0));
+   nn1.get_scaling_layer_pointer()->set_scaling_method(ScalingLayer::MeanStandardDeviation);
+
+   nn1.construct_unscaling_layer();
+   nn1.get_unscaling_layer_pointer()->set_item_statistics(0, Statistics<double>(-2.0, 8.0, 0.5, 4.0));
+
+   nn1.construct_bounding_layer();
+   nn1.get_bounding_layer_pointer()->set_lower_bound(0, -1.0);
+   nn1.get_bounding_layer_pointer()->set_upper_bound(0, 1.0);
+   nn1.get_bounding_layer_pointer()->set_lower_bound(1, -10.0);
+   nn1.get_bounding_layer_pointer()->set_upper_bound(1, 10.0);
+
+   nn1.get_multilayer_perceptron_pointer()->set_fast_activation(true);
+
+   nn1.save_binary(file_name);
+
+   nn2.load_binary(file_name);
+
+   assert_true(nn2.get_multilayer_perceptron_pointer()->arrange_architecture() == architecture, LOG);
+   assert_true(nn2.get_multilayer_perceptron_pointer()->get_layer(1).get_activation_function() == Perceptron::Logistic, LOG);
+   assert_true(nn2.get_multilayer_perceptron_pointer()->get_fast_activation(), LOG);
+   assert_true(nn2.get_scaling_layer_pointer()->get_scaling_method() == ScalingLayer::MeanStandardDeviation, LOG);
+   assert_true(nn2.get_unscaling_layer_pointer()->get_statistics()[0].maximum == 8.0, LOG);
+   assert_true(nn2.get_probabilistic_layer_pointer() == NULL, LOG);
+   assert_true(nn2.arrange_parameters() == nn1.arrange_parameters(), LOG);
+
+   inputs[0] = 0.3;
+   inputs[1] = -2.0;
+   inputs[2] = 4.0;
+
+   assert_true(nn2.calculate_outputs(inputs) == nn1.calculate_outputs(inputs), LOG);
+
+   // Test
+
+   nn1.get_multilayer_perceptron_pointer()->get_layer_pointer(1)->set_fast_activation(false);
+
+   nn1.save_binary(file_name);
+
+   nn2.load_binary(file_name);
+
+   assert_true(nn2.get_multilayer_perceptron_pointer()->get_layer(0).get_fast_activation(), LOG);
+   assert_true(!nn2.get_multilayer_perceptron_pointer()->get_layer(1).get_fast_activation(), LOG);
+   assert_true(nn2.calculate_outputs(inputs) == nn1.calculate_outputs(inputs), LOG);
+
+   // Test
+
+   nn1.set(2, 3);
+   nn1.construct_probabilistic_layer();
+   nn1.get_probabilistic_layer_pointer()->set_probabilistic_method(ProbabilisticLayer::Softmax);
+
+   nn1.save_binary(file_name);
+
+   nn2.load_binary(file_name);
+
+   assert_true(nn2.get_scaling_layer_pointer() == NULL, LOG);
+   assert_true(nn2.get_probabilistic_layer_pointer()->get_probabilistic_method() == ProbabilisticLayer::Softmax, LOG);
+   assert_true(nn2.arrange_parameters() == nn1.arrange_parameters(), LOG);
+
+   // Truncated and corrupted files
+
+   nn1.set(3, 5);
+   nn1.randomize_parameters_normal();
+   nn1.construct_scaling_layer();
+
+   nn1.save_binary(file_name);
+
+   std::ifstream input_file(file_name.c_str(), std::ios::binary);
+
+   const std::string contents((std::istreambuf_iterator<char>(input_file)), std::istreambuf_iterator<char>());
+
+   input_file.close();
+
+   const Vector<double> parameters = nn2.arrange_parameters();
+
+   architecture = nn2.get_multilayer_perceptron_pointer()->arrange_architecture();
+
+   Vector<std::string> corrupted_contents(4, contents);
+
+   corrupted_contents[0].resize(contents.size() - 8);
+
+   const uint64_t architecture_size = 1000000000000;
+   memcpy(&corrupted_contents[1][16], &architecture_size, sizeof(uint64_t));
+
+   const uint32_t activation_function = 99;
+   memcpy(&corrupted_contents[2][40], &activation_function, sizeof(uint32_t));
+
+   const uint32_t fast_activation = 2;
+   memcpy(&corrupted_contents[3][44], &fast_activation, sizeof(uint32_t));
+
+   for(size_t i = 0; i < corrupted_contents.size(); i++)
+   {
+      std::ofstream output_file(file_name.c_str(), std::ios::binary);
+
+      output_file.write(corrupted_contents[i].data(), corrupted_contents[i].size());
+
+      output_file.close();
+
+      try
+      {
+         nn2.load_binary(file_name);
+
+         assert_true(false, LOG);
+      }
+      catch(const std::logic_error&)
+      {
+         assert_true(true, LOG);
+      }
+
+      assert_true(nn2.get_multilayer_perceptron_pointer()->arrange_architecture() == architecture, LOG);
+      assert_true(nn2.arrange_parameters() == parameters, LOG);
+      assert_true(nn2.get_scaling_layer_pointer() == NULL, LOG);
+      assert_true(nn2.get_probabilistic_layer_pointer()->get_probabilistic_method() == ProbabilisticLayer::Softmax, LOG);
+   }
+
+   remove(file_name.c_str());
+}
+
+
 // @todo
 
 void NeuralNetworkTest::test_write_expression(void)
@@ -1197,6 +1488,155 @@ void NeuralNetworkTest::test_write_expression(void)
 }
 
 
+void NeuralNetworkTest::test_write_expression_cpp(void)
+{
+   message += "test_write_expression_cpp\n";
+
+   NeuralNetwork nn;
+   std::string expression;
+
+   // Test
+
+   nn.set(2, 3, 1);
+   nn.initialize_parameters(0.5);
+
+   expression = nn.write_expression_cpp("model");
+
+   assert_true(expression.find("namespace model") != std::string::npos, LOG);
+   assert_true(expression.find("constexpr std::size_t inputs_number = 2;") != std::string::npos, LOG);
+   assert_true(expression.find("constexpr double layer_0_synaptic_weights[6] = {0.5, 0.5, 0.5, 0.5, 0.5, 0.5};") != std::string::npos, LOG);
+   assert_true(expression.find("constexpr double layer_1_biases[1] = {0.5};") != std::string::npos, LOG);
+   assert_true(expression.find("std::tanh(combination)") != std::string::npos, LOG);
+   assert_true(expression.find("scaling_slopes") == std::string::npos, LOG);
+
+   // Test
+
+   nn.construct_scaling_layer();
+   nn.construct_bounding_layer();
+
+   expression = nn.write_expression_cpp();
+
+   assert_true(expression.find("namespace neural_network") != std::string::npos, LOG);
+   assert_true(expression.find("constexpr double scaling_slopes[2] = {1, 1};") != std::string::npos, LOG);
+   assert_true(expression.find("constexpr double lower_bounds[1]") != std::string::npos, LOG);
+
+   // Test
+
+   nn.construct_conditions_layer();
+
+   try
+   {
+      expression = nn.write_expression_cpp();
+
+      assert_true(false, LOG);
+   }
+   catch(const std::logic_error&)
+   {
+      assert_true(true, LOG);
+   }
+}
+
+
+void NeuralNetworkTest::test_calculate_expression_cpp_outputs(void)
+{
+   message += "test_calculate_expression_cpp_outputs\n";
+
+   NeuralNetwork nn(2, 3, 1);
+
+   Vector<double> parameters(nn.count_parameters_number());
+
+   for(size_t i = 0; i < parameters.size(); i++)
+   {
+      parameters[i] = 0.25*((double)(i%7) - 3.0);
+   }
+
+   nn.set_parameters(parameters);
+
+   nn.construct_scaling_layer();
+   nn.construct_unscaling_layer();
+   nn.construct_bounding_layer();
+
+   Vector< Statistics<double> > inputs_statistics(2);
+
+   inputs_statistics[0].set_minimum(-1.0);
+   inputs_statistics[0].set_maximum(3.0);
+   inputs_statistics[1].set_minimum(0.0);
+   inputs_statistics[1].set_maximum(2.0);
+
+   nn.get_scaling_layer_pointer()->set_statistics(inputs_statistics);
+   nn.get_scaling_layer_pointer()->set_scaling_method(ScalingLayer::MinimumMaximum);
+
+   Vector< Statistics<double> > outputs_statistics(1);
+
+   outputs_statistics[0].set_mean(10.0);
+   outputs_statistics[0].set_standard_deviation(2.0);
+
+   nn.get_unscaling_layer_pointer()->set_statistics(outputs_statistics);
+   nn.get_unscaling_layer_pointer()->set_unscaling_method(UnscalingLayer::MeanStandardDeviation);
+
+   nn.get_bounding_layer_pointer()->set_lower_bounds(Vector<double>(1, 8.0));
+   nn.get_bounding_layer_pointer()->set_upper_bounds(Vector<double>(1, 12.0));
+
+   // Test
+
+#ifdef __OPENNN_EXPRESSION_CPP_TEST_HEADER__
+
+   std::ifstream file(__OPENNN_EXPRESSION_CPP_TEST_HEADER__);
+
+   const std::string expression((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+   assert_true(nn.write_expression_cpp("neural_network_expression") == expression, LOG);
+
+#endif
+
+   // Test
+
+   Matrix<double> inputs(5, 2);
+
+   inputs(0,0) = 0.5;
+   inputs(0,1) = 1.5;
+   inputs(1,0) = 3.0;
+   inputs(1,1) = -2.0;
+   inputs(2,0) = -1.0;
+   inputs(2,1) = 0.0;
+   inputs(3,0) = 2.0;
+   inputs(3,1) = 2.0;
+   inputs(4,0) = -10.0;
+   inputs(4,1) = 10.0;
+
+   Vector<double> outputs;
+   double expression_outputs[1];
+
+   for(size_t i = 0; i < inputs.get_rows_number(); i++)
+   {
+      const Vector<double> row = inputs.arrange_row(i);
+
+      outputs = nn.calculate_outputs(row);
+
+      neural_network_expression::calculate_outputs(row.data(), expression_outputs);
+
+      assert_true(fabs(expression_outputs[0] - outputs[0]) < 1.0e-12, LOG);
+   }
+
+   // Test
+
+   // Matrices are stored by columns, so the transpose gives the inputs row by row, as the batch function expects
+
+   const Matrix<double> transposed_inputs = inputs.calculate_transpose();
+
+   Vector<double> batch_outputs(inputs.get_rows_number());
+
+   neural_network_expression::calculate_outputs(transposed_inputs.data(), batch_outputs.data(), inputs.get_rows_number());
+
+   for(size_t i = 0; i < inputs.get_rows_number(); i++)
+   {
+      outputs = nn.calculate_outputs(inputs.arrange_row(i));
+
+      assert_true(fabs(batch_outputs[i] - outputs[0]) < 1.0e-12, LOG);
+   }
+}
+
+
 void NeuralNetworkTest::test_get_Hinton_diagram_XML(void)
 {
    message += "test_get_Hinton_diagram_XML\n";
@@ -1292,6 +1732,7 @@ void NeuralNetworkTest::run_test_case(void)
 
    test_calculate_outputs();
    test_calculate_output_data();
+   test_calculate_float_outputs();
 
    test_calculate_Jacobian();
    test_calculate_Jacobian_data();
@@ -1302,6 +1743,8 @@ void NeuralNetworkTest::run_test_case(void)
    // Expression methods
 
    test_write_expression();
+   test_write_expression_cpp();
+   test_calculate_expression_cpp_outputs();
 
    // Hinton diagram methods
 
@@ -1319,6 +1762,8 @@ void NeuralNetworkTest::run_test_case(void)
 
    test_load();
 
+   test_load_binary();
+
    message += "End of neural network test case.\n";
 }
 
@@ -128,6 +128,7 @@ public:
 
    void test_calculate_outputs(void);
    void test_calculate_output_data(void);
+   void test_calculate_float_outputs(void);
 
    void test_calculate_Jacobian(void);
    void test_calculate_Jacobian_data(void);
@@ -140,6 +141,8 @@ public:
    // XML expression methods
 
    void test_write_expression(void);
+   void test_write_expression_cpp(void);
+   void test_calculate_expression_cpp_outputs(void);
    void test_save_expression(void);
 
    // Hinton diagram methods
@@ -157,6 +160,8 @@ public:
    void test_save(void);
    void test_load(void);
 
+   void test_load_binary(void);
+
    // Unit testing methods
 
    void run_test_case(void);
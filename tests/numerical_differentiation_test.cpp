@@ -374,6 +374,52 @@ void NumericalDifferentiationTest::test_calculate_Hessian(void)
    central = nd.calculate_Hessian(*this, &NumericalDifferentiationTest::f2, x);
 
    assert_true((forward-central).calculate_absolute_value() < 1.0e-3, LOG);
+
+   // Test
+
+   Matrix<double> H_true(3, 3);
+
+   x.set(3);
+   x[0] = 1.0;
+   x[1] = 2.0;
+   x[2] = -0.5;
+
+   H_true(0,0) = 4.0;
+   H_true(0,1) = 2.0;
+   H_true(0,2) = 0.0;
+   H_true(1,0) = 2.0;
+   H_true(1,1) = 12.0;
+   H_true(1,2) = 1.0;
+   H_true(2,0) = 0.0;
+   H_true(2,1) = 1.0;
+   H_true(2,2) = 0.0;
+
+   nd.set_numerical_differentiation_method(NumericalDifferentiation::ForwardDifferences);
+
+   forward = nd.calculate_Hessian(*this, &NumericalDifferentiationTest::f9, x);
+
+   assert_true((forward-H_true).calculate_absolute_value() < 1.0e-1, LOG);
+   assert_true(forward == forward.calculate_transpose(), LOG);
+
+   nd.set_numerical_differentiation_method(NumericalDifferentiation::CentralDifferences);
+
+   central = nd.calculate_Hessian(*this, &NumericalDifferentiationTest::f9, x);
+
+   assert_true((central-H_true).calculate_absolute_value() < 1.0e-3, LOG);
+   assert_true(central == central.calculate_transpose(), LOG);
+
+   // Test
+
+   nd.set_parallel_evaluation(true);
+
+   nd.set_numerical_differentiation_method(NumericalDifferentiation::ForwardDifferences);
+
+   assert_true(nd.calculate_Hessian(*this, &NumericalDifferentiationTest::f9, x) == forward, LOG);
+
+   nd.set_numerical_differentiation_method(NumericalDifferentiation::CentralDifferences);
+
+   assert_true(nd.calculate_Hessian(*this, &NumericalDifferentiationTest::f9, x) == central, LOG);
+   assert_true(nd.calculate_gradient(*this, &NumericalDifferentiationTest::f9, x) == nd.calculate_central_differences_gradient(*this, &NumericalDifferentiationTest::f9, x), LOG);
 }
 
 
@@ -667,6 +713,12 @@ Vector<double> NumericalDifferentiationTest::f8(const size_t&, const size_t&, co
 }
 
 
+double NumericalDifferentiationTest::f9(const Vector<double>& x) const
+{
+   return(x[0]*x[0]*x[1] + x[1]*x[1]*x[1] + x[1]*x[2]);
+}
+
+
 
 // OpenNN: Open Neural Networks Library.
 // Copyright (C) 2005-2015 Roberto Lopez.
@@ -110,6 +110,8 @@ private:
 
    Vector<double> f8(const size_t&, const size_t&, const Vector<double>&) const;
 
+   double f9(const Vector<double>&) const;
+
 };
 
 
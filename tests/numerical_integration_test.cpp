@@ -82,6 +82,59 @@ void NumericalIntegrationTest::test_calculate_Simpson_integral(void)
 }
 
 
+void NumericalIntegrationTest::test_calculate_Gauss_Kronrod_integral(void)
+{
+   message += "test_calculate_Gauss_Kronrod_integral\n";
+
+   NumericalIntegration ni;
+
+   Vector<double> integrals;
+
+   // Test
+
+   ni.set_Gauss_Kronrod_tolerance(1.0e-9);
+
+   integrals = ni.calculate_Gauss_Kronrod_integral(*this, &NumericalIntegrationTest::f1, 0.0, 1.0);
+
+   assert_true(integrals.size() == 3, LOG);
+   assert_true(fabs(integrals[0] - 1.0/3.0) < 1.0e-12, LOG);
+   assert_true(fabs(integrals[1] - (1.0 - cos(1.0))) < 1.0e-12, LOG);
+   assert_true(fabs(integrals[2] - 2.0/3.0) < 1.0e-8, LOG);
+
+   // Test
+
+   integrals = ni.calculate_Gauss_Kronrod_integral(*this, &NumericalIntegrationTest::f1, 1.0, 0.0);
+
+   assert_true(fabs(integrals[0] + 1.0/3.0) < 1.0e-12, LOG);
+
+   // Test
+
+   ni.set_maximum_Gauss_Kronrod_intervals_number(1);
+   ni.set_display(false);
+
+   integrals = ni.calculate_Gauss_Kronrod_integral(*this, &NumericalIntegrationTest::f1, 0.0, 1.0);
+
+   assert_true(fabs(integrals[2] - 2.0/3.0) < 1.0e-2, LOG);
+}
+
+
+Matrix<double> NumericalIntegrationTest::f1(const Matrix<double>& x) const
+{
+   const size_t rows_number = x.get_rows_number();
+
+   Matrix<double> y(rows_number, 3);
+
+   for(size_t i = 0; i < rows_number; i++)
+   {
+      y(i,0) = x(i,0)*x(i,0);
+      y(i,1) = sin(x(i,0));
+      y(i,2) = sqrt(x(i,0));
+   }
+
+   return(y);
+}
+
+
 void NumericalIntegrationTest::run_test_case(void)
 {
    message += "Running numerical integration test case...\n";
@@ -96,6 +149,8 @@ void NumericalIntegrationTest::run_test_case(void)
    test_calculate_trapezoid_integral();
    test_calculate_Simpson_integral();
 
+   test_calculate_Gauss_Kronrod_integral();
+
    message += "End of numerical integration test case.\n";
 }
 
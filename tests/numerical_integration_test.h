@@ -50,9 +50,17 @@ public:
    void test_calculate_trapezoid_integral(void);
    void test_calculate_Simpson_integral(void);
 
+   void test_calculate_Gauss_Kronrod_integral(void);
+
    // Unit testing methods
 
    void run_test_case(void);
+
+private:
+
+   // Integrand methods
+
+   Matrix<double> f1(const Matrix<double>&) const;
 };
 
 
@@ -21,6 +21,7 @@
 #include "vector_test.h"
 #include "matrix_test.h"
 #include "numerical_differentiation_test.h"
+#include "instrumentation_test.h"
 #include "numerical_integration_test.h"
 #include "ordinary_differential_equations_test.h"
 
@@ -65,6 +66,7 @@
 #include "training_rate_algorithm_test.h"
 #include "training_algorithm_test.h"
 #include "random_search_test.h"
+#include "ensemble_training_test.h"
 #include "evolutionary_algorithm_test.h"
 #include "gradient_descent_test.h"
 #include "conjugate_gradient_test.h"
@@ -457,6 +457,219 @@ void OrdinaryDifferentialEquationsTest::test_calculate_Runge_Kutta_Fehlberg_inte
 }
 
 
+void OrdinaryDifferentialEquationsTest::test_calculate_Runge_Kutta_Fehlberg_dense_solution(void)
+{
+   message += "test_calculate_Runge_Kutta_Fehlberg_dense_solution\n";
+
+   MockOrdinaryDifferentialEquations mode;
+   NeuralNetwork nn;
+
+   Matrix<double> solution;
+   Vector<double> output_independent_variables;
+
+   mode.set_display(false);
+   mode.set_initial_independent_variable(0.0);
+   mode.set_final_independent_variable(1.0);
+   mode.set_initial_dependent_variables(Vector<double>(1, 2.0));
+   mode.set_tolerance(1.0e-9);
+
+   // Solution with geometric growth
+
+   mode.set_initial_size(2);
+
+   solution = mode.calculate_Runge_Kutta_Fehlberg_solution(nn);
+
+   const size_t rows_number = solution.get_rows_number();
+
+   assert_true(rows_number > 2, LOG);
+   assert_true(solution(0,0) == 0.0, LOG);
+   assert_true(solution(0,1) == 2.0, LOG);
+   assert_true(fabs(solution(rows_number-1,0) - 1.0) < 1.0e-12, LOG);
+   assert_true(fabs(solution(rows_number-1,1) - 2.0*exp(-1.0)) < 1.0e-6, LOG);
+
+   // Solution with a tolerance which is never met, also when displaying messages
+
+   const size_t error_size = mode.get_error_size();
+
+   mode.set_display(true);
+   mode.set_tolerance(0.0);
+   mode.set_error_size(1000);
+
+   try
+   {
+      solution = mode.calculate_Runge_Kutta_Fehlberg_solution(nn);
+
+      assert_true(false, LOG);
+   }
+   catch(const std::logic_error&)
+   {
+      assert_true(true, LOG);
+   }
+
+   mode.set_display(false);
+   mode.set_tolerance(1.0e-9);
+   mode.set_error_size(error_size);
+
+   // Dense output
+
+   output_independent_variables.set(0.0, 0.125, 1.0);
+
+   solution = mode.calculate_Runge_Kutta_Fehlberg_solution(nn, output_independent_variables);
+
+   assert_true(solution.get_rows_number() == 9, LOG);
+   assert_true(solution.get_columns_number() == 2, LOG);
+
+   for(size_t i = 0; i < 9; i++)
+   {
+      assert_true(solution(i,0) == output_independent_variables[i], LOG);
+      assert_true(fabs(solution(i,1) - 2.0*exp(-output_independent_variables[i])) < 1.0e-6, LOG);
+   }
+
+   // Dense output before the final independent variable
+
+   output_independent_variables.set(1, 0.3);
+
+   solution = mode.calculate_dense_solutions(nn, output_independent_variables);
+
+   assert_true(solution.get_rows_number() == 1, LOG);
+   assert_true(fabs(solution(0,1) - 2.0*exp(-0.3)) < 1.0e-6, LOG);
+
+   // Dense output with a tolerance which is never met
+
+   mode.set_tolerance(0.0);
+   mode.set_error_size(1000);
+
+   try
+   {
+      solution = mode.calculate_Runge_Kutta_Fehlberg_solution(nn, output_independent_variables);
+
+      assert_true(false, LOG);
+   }
+   catch(const std::logic_error&)
+   {
+      assert_true(true, LOG);
+   }
+
+   // Dense output with an error estimate which is not a number
+
+   mode.set_tolerance(1.0e-9);
+   mode.set_initial_dependent_variables(Vector<double>(1, std::numeric_limits<double>::quiet_NaN()));
+
+   try
+   {
+      solution = mode.calculate_Runge_Kutta_Fehlberg_solution(nn, output_independent_variables);
+
+      assert_true(false, LOG);
+   }
+   catch(const std::logic_error&)
+   {
+      assert_true(true, LOG);
+   }
+}
+
+
+void OrdinaryDifferentialEquationsTest::test_calculate_ensemble_final_solutions(void)
+{
+   message += "test_calculate_ensemble_final_solutions\n";
+
+   MockOrdinaryDifferentialEquations mode;
+   NeuralNetwork nn;
+
+   mode.set_display(false);
+   mode.set_initial_independent_variable(0.0);
+   mode.set_final_independent_variable(1.0);
+   mode.set_points_number(101);
+   mode.set_tolerance(1.0e-9);
+
+   Matrix<double> initial_dependent_variables_ensemble(3, 1);
+   initial_dependent_variables_ensemble(0,0) = 1.0;
+   initial_dependent_variables_ensemble(1,0) = 2.0;
+   initial_dependent_variables_ensemble(2,0) = -0.5;
+
+   Matrix<double> final_solutions;
+   Vector< Matrix<double> > solutions;
+   Vector<double> final_solution;
+
+   // Runge-Kutta
+
+   final_solutions = mode.calculate_Runge_Kutta_final_solutions(nn, initial_dependent_variables_ensemble);
+
+   assert_true(final_solutions.get_rows_number() == 3, LOG);
+   assert_true(final_solutions.get_columns_number() == 2, LOG);
+
+   solutions = mode.calculate_Runge_Kutta_solutions(nn, initial_dependent_variables_ensemble);
+
+   assert_true(solutions.size() == 3, LOG);
+
+   for(size_t i = 0; i < 3; i++)
+   {
+      assert_true(final_solutions(i,0) == 1.0, LOG);
+      assert_true(fabs(final_solutions(i,1) - initial_dependent_variables_ensemble(i,0)*exp(-1.0)) < 1.0e-9, LOG);
+
+      assert_true(solutions[i].get_rows_number() == 101, LOG);
+      assert_true(solutions[i](100,0) == 1.0, LOG);
+      assert_true(solutions[i](100,1) == final_solutions(i,1), LOG);
+
+      mode.set_initial_dependent_variables(Vector<double>(1, initial_dependent_variables_ensemble(i,0)));
+
+      final_solution = mode.calculate_Runge_Kutta_final_solution(nn);
+
+      assert_true(fabs(final_solution[1] - final_solutions(i,1)) < 1.0e-12, LOG);
+   }
+
+   // Runge-Kutta-Fehlberg
+
+   mode.set_solution_method(OrdinaryDifferentialEquations::RungeKuttaFehlberg);
+
+   final_solutions = mode.calculate_ensemble_final_solutions(nn, initial_dependent_variables_ensemble);
+
+   for(size_t i = 0; i < 3; i++)
+   {
+      assert_true(fabs(final_solutions(i,0) - 1.0) < 1.0e-12, LOG);
+      assert_true(fabs(final_solutions(i,1) - initial_dependent_variables_ensemble(i,0)*exp(-1.0)) < 1.0e-6, LOG);
+
+      mode.set_initial_dependent_variables(Vector<double>(1, initial_dependent_variables_ensemble(i,0)));
+
+      final_solution = mode.calculate_Runge_Kutta_Fehlberg_final_solution(nn);
+
+      assert_true(fabs(final_solution[1] - final_solutions(i,1)) < 1.0e-12, LOG);
+   }
+
+   // Runge-Kutta-Fehlberg with a tolerance which is never met
+
+   mode.set_tolerance(0.0);
+   mode.set_error_size(1000);
+
+   try
+   {
+      final_solutions = mode.calculate_ensemble_final_solutions(nn, initial_dependent_variables_ensemble);
+
+      assert_true(false, LOG);
+   }
+   catch(const std::logic_error&)
+   {
+      assert_true(true, LOG);
+   }
+
+   // Runge-Kutta-Fehlberg with an error estimate which is not a number
+
+   mode.set_tolerance(1.0e-9);
+
+   initial_dependent_variables_ensemble(1,0) = std::numeric_limits<double>::quiet_NaN();
+
+   try
+   {
+      final_solutions = mode.calculate_ensemble_final_solutions(nn, initial_dependent_variables_ensemble);
+
+      assert_true(false, LOG);
+   }
+   catch(const std::logic_error&)
+   {
+      assert_true(true, LOG);
+   }
+}
+
+
 double OrdinaryDifferentialEquationsTest::calculate_zero_dot(const NeuralNetwork&, const double&, const double&) const
 {
    return(0.0);
@@ -584,6 +797,12 @@ void OrdinaryDifferentialEquationsTest::run_test_case(void)
    test_calculate_Runge_Kutta_Fehlberg_integral_4();
    test_calculate_Runge_Kutta_Fehlberg_integral_5();
 
+   test_calculate_Runge_Kutta_Fehlberg_dense_solution();
+
+   // Ensemble methods
+
+   test_calculate_ensemble_final_solutions();
+
    message += "End of ordinary differential equations test case.\n";
 }
 
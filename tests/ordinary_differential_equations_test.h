@@ -17,6 +17,7 @@
 // Unit testing includes
 
 #include "unit_testing.h"
+#include "mock_ordinary_differential_equations.h"
 
 
 using namespace OpenNN;
@@ -84,6 +85,12 @@ public:
    void test_calculate_Runge_Kutta_Fehlberg_integral_4(void);
    void test_calculate_Runge_Kutta_Fehlberg_integral_5(void);
 
+   void test_calculate_Runge_Kutta_Fehlberg_dense_solution(void);
+
+   // Ensemble methods
+
+   void test_calculate_ensemble_final_solutions(void);
+
    double calculate_zero_dot(const NeuralNetwork&, const double&, const double&) const;
    double calculate_zero_dot(const NeuralNetwork&, const double&, const double&, const double&) const;
    double calculate_zero_dot(const NeuralNetwork&, const double&, const double&, const double&, const double&) const;
@@ -58,23 +58,61 @@ void OutputsIntegralsTest::test_destructor(void)
 void OutputsIntegralsTest::test_calculate_performance(void)   
 {
    message += "test_calculate_performance\n";
-/*
-   NeuralNetwork nn;
-   Vector<double> network_parameters;
+
+   NeuralNetwork nn(1, 1);
 
    OutputsIntegrals oi(&nn);
 
+   NumericalIntegration ni;
+
+   Vector<double> parameters;
+
    double performance;
 
    // Test
 
-   nn.set(1, 1);
    nn.initialize_parameters(0.0);
 
    performance = oi.calculate_performance();
 
-   assert_true(performance == 0.0, LOG);
-*/
+   assert_true(fabs(performance) < 1.0e-12, LOG);
+
+   // Test
+
+   nn.initialize_parameters(1.0);
+
+   oi.set_integration_limits(-1.0, 2.0);
+
+   const Vector<double> x(-1.0, 0.001, 2.0);
+   const Vector<double> y = nn.calculate_output_data(x.to_column_matrix()).arrange_column(0);
+
+   performance = oi.calculate_performance();
+
+   assert_true(fabs(performance - ni.calculate_Simpson_integral(x, y)) < 1.0e-6, LOG);
+
+   // Test
+
+   parameters = nn.arrange_parameters();
+
+   nn.initialize_parameters(0.0);
+
+   assert_true(fabs(oi.calculate_performance(parameters) - performance) < 1.0e-12, LOG);
+   assert_true(fabs(oi.calculate_performance()) < 1.0e-12, LOG);
+
+   // Test
+
+   nn.set(2, 1);
+
+   try
+   {
+      performance = oi.calculate_performance();
+
+      assert_true(false, LOG);
+   }
+   catch(const std::logic_error&)
+   {
+      assert_true(true, LOG);
+   }
 }
 
 // @todo
@@ -1286,6 +1286,94 @@ void PerceptronLayerTest::test_calculate_activation_derivative(void)
 }
 
 
+void PerceptronLayerTest::test_calculate_fast_activations(void)
+{
+   message += "test_calculate_fast_activations\n";
+
+   PerceptronLayer pl;
+
+   Vector<double> combination;
+   Vector<double> activation;
+
+   // Test
+
+   pl.set(1, 5);
+
+   combination.set(5);
+   combination[0] = -30.0;
+   combination[1] =  -1.3;
+   combination[2] =   0.0;
+   combination[3] =   2.7;
+   combination[4] =  30.0;
+
+   pl.set_activation_function(Perceptron::Logistic);
+   activation = pl.calculate_activations(combination);
+
+   pl.set_fast_activation(true);
+   assert_true((pl.calculate_activations(combination) - activation).calculate_absolute_value() < 1.0e-6, LOG);
+
+   pl.set_fast_activation(false);
+   pl.set_activation_function(Perceptron::HyperbolicTangent);
+   activation = pl.calculate_activations(combination);
+
+   pl.set_fast_activation(true);
+   assert_true((pl.calculate_activations(combination) - activation).calculate_absolute_value() < 1.0e-6, LOG);
+
+   // Test
+
+   Matrix<double> combinations(3, 5);
+   Matrix<double> activations;
+
+   combinations.set_row(0, combination);
+   combinations.set_row(1, combination*0.5);
+   combinations.set_row(2, combination*(-1.0));
+
+   pl.set_fast_activation(false);
+   pl.set_activation_function(Perceptron::Logistic);
+
+   activations = pl.calculate_activations(combinations);
+
+   assert_true(activations.get_rows_number() == 3, LOG);
+   assert_true(activations.get_columns_number() == 5, LOG);
+   assert_true(activations.arrange_row(1) == pl.calculate_activations(combination*0.5), LOG);
+   assert_true(activations.arrange_row(2) == pl.calculate_activations(combination*(-1.0)), LOG);
+}
+
+
+void PerceptronLayerTest::test_calculate_activations_and_derivatives(void)
+{
+   message += "test_calculate_activations_and_derivatives\n";
+
+   PerceptronLayer pl;
+
+   Vector<double> combination;
+
+   // Test
+
+   pl.set(2, 4);
+
+   combination.set(4);
+   combination[0] =  1.56;
+   combination[1] = -0.68;
+   combination[2] =  0.91;
+   combination[3] = -1.99;
+
+   Vector< Vector<double> > activations_and_derivatives;
+
+   pl.set_activation_function(Perceptron::HyperbolicTangent);
+   pl.set_fast_activation(true);
+
+   activations_and_derivatives = pl.calculate_activations_and_derivatives(combination);
+
+   assert_true(activations_and_derivatives[0] == pl.calculate_activations(combination), LOG);
+   assert_true(activations_and_derivatives[1] == pl.calculate_activations_derivatives(combination), LOG);
+
+   pl.set_fast_activation(false);
+
+   assert_true((activations_and_derivatives[1] - pl.calculate_activations_derivatives(combination)).calculate_absolute_value() < 1.0e-6, LOG);
+}
+
+
 void PerceptronLayerTest::test_calculate_activation_second_derivative(void)
 {
    message += "test_calculate_activation_second_derivative\n";
@@ -1823,6 +1911,11 @@ void PerceptronLayerTest::run_test_case(void)
    test_arrange_synaptic_weights();
    test_arrange_parameters();
 
+   // Layer activation kernels
+
+   test_calculate_fast_activations();
+   test_calculate_activations_and_derivatives();
+
    // Activation functions
 
    test_get_activation_function();
@@ -142,6 +142,9 @@ public:
    void test_calculate_activation_derivative(void);
    void test_calculate_activation_second_derivative(void);
 
+   void test_calculate_fast_activations(void);
+   void test_calculate_activations_and_derivatives(void);
+
    // PerceptronLayer outputs 
 
    void test_calculate_outputs(void);
@@ -19,6 +19,34 @@
 using namespace OpenNN;
 
 
+// Evaluation function of the in-process plug-in tests.
+// Each output is the sum of the parameters in the set times the row index plus one, plus the column index.
+
+extern "C" int plug_in_test_evaluate(const double* parameters, size_t parameters_number, size_t batch_size,
+                                     double* outputs, size_t output_rows_number, size_t output_columns_number)
+{
+   for(size_t k = 0; k < batch_size; k++)
+   {
+      double sum = 0.0;
+
+      for(size_t p = 0; p < parameters_number; p++)
+      {
+         sum += parameters[k*parameters_number+p];
+      }
+
+      for(size_t i = 0; i < output_rows_number; i++)
+      {
+         for(size_t j = 0; j < output_columns_number; j++)
+         {
+            outputs[(k*output_rows_number+i)*output_columns_number+j] = sum*(i+1.0) + j;
+         }
+      }
+   }
+
+   return(0);
+}
+
+
 PlugInTest::PlugInTest(void) : UnitTesting() 
 {   
 }
@@ -237,6 +265,175 @@ void PlugInTest::test_calculate_output_data(void)
 }
 
 
+void PlugInTest::test_calculate_batch_solutions(void)
+{
+   message += "test_calculate_batch_solutions\n";
+
+   PlugIn pi;
+
+   Matrix<double> parameters_batch;
+   Vector< Matrix<double> > solutions;
+   Matrix<double> solution;
+
+   // Evaluation function not set
+
+   try
+   {
+      pi.calculate_batch_solutions(Matrix<double>(1, 1, 0.0));
+
+      assert_true(false, LOG);
+   }
+   catch(const std::logic_error&)
+   {
+      assert_true(true, LOG);
+   }
+
+   // Library not found
+
+   pi.set_library_file_name("opennn_missing_plug_in_library.so");
+
+   try
+   {
+      pi.load_library();
+
+      assert_true(false, LOG);
+   }
+   catch(const std::logic_error&)
+   {
+      assert_true(pi.has_evaluation_function() == false, LOG);
+   }
+
+   // Batch
+
+   pi.set_evaluation_function(&plug_in_test_evaluate);
+   pi.set_output_rows_number(2);
+   pi.set_output_columns_number(3);
+
+   parameters_batch.set(2, 2);
+   parameters_batch(0,0) = 1.0;
+   parameters_batch(0,1) = 2.0;
+   parameters_batch(1,0) = -1.0;
+   parameters_batch(1,1) = 0.5;
+
+   solutions = pi.calculate_batch_solutions(parameters_batch);
+
+   assert_true(solutions.size() == 2, LOG);
+   assert_true(solutions[0].get_rows_number() == 2, LOG);
+   assert_true(solutions[0].get_columns_number() == 3, LOG);
+   assert_true(solutions[0](0,0) == 3.0, LOG);
+   assert_true(solutions[0](1,2) == 8.0, LOG);
+   assert_true(solutions[1](0,1) == 0.5, LOG);
+   assert_true(solutions[1](1,0) == -1.0, LOG);
+
+   // Neural network
+
+   NeuralNetwork nn(2);
+
+   nn.get_independent_parameters_pointer()->set_parameters(parameters_batch.arrange_row(0));
+
+   pi.set_evaluation_method(PlugIn::SharedLibraryEvaluation);
+
+   solution = pi.calculate_solutions(nn);
+
+   assert_true(solution == solutions[0], LOG);
+
+   // Copy
+
+   PlugIn pi_copy(pi);
+
+   assert_true(pi_copy.has_evaluation_function() == true, LOG);
+   assert_true(pi_copy.calculate_solutions(nn) == solutions[0], LOG);
+}
+
+
+void PlugInTest::test_load_library(void)
+{
+   message += "test_load_library\n";
+
+#ifdef __OPENNN_PLUG_IN_TEST_LIBRARY__
+
+   PlugIn pi;
+
+   Matrix<double> parameters_batch(2, 2);
+   Vector< Matrix<double> > solutions;
+
+   NeuralNetwork nn(2);
+
+   // Test
+
+   pi.set_library_file_name(__OPENNN_PLUG_IN_TEST_LIBRARY__);
+   pi.set_output_rows_number(2);
+   pi.set_output_columns_number(3);
+
+   pi.load_library();
+
+   assert_true(pi.has_evaluation_function() == true, LOG);
+
+   parameters_batch(0,0) = 1.0;
+   parameters_batch(0,1) = 2.0;
+   parameters_batch(1,0) = -1.0;
+   parameters_batch(1,1) = 0.5;
+
+   solutions = pi.calculate_batch_solutions(parameters_batch);
+
+   assert_true(solutions.size() == 2, LOG);
+   assert_true(solutions[0].get_rows_number() == 2, LOG);
+   assert_true(solutions[0].get_columns_number() == 3, LOG);
+   assert_true(solutions[0](0,0) == 5.0, LOG);
+   assert_true(solutions[0](1,2) == 17.0, LOG);
+   assert_true(solutions[1](0,1) == 2.25, LOG);
+   assert_true(solutions[1](1,0) == 11.25, LOG);
+
+   // Test
+
+   nn.get_independent_parameters_pointer()->set_parameters(parameters_batch.arrange_row(1));
+
+   pi.set_evaluation_method(PlugIn::SharedLibraryEvaluation);
+
+   assert_true(pi.calculate_solutions(nn) == solutions[1], LOG);
+
+   // Test
+
+   PlugIn pi2;
+
+   pi2 = pi;
+
+   assert_true(pi2.has_evaluation_function() == true, LOG);
+   assert_true(pi2.calculate_solutions(nn) == solutions[1], LOG);
+
+   // Test
+
+   PlugIn pi3;
+
+   pi3.set_output_rows_number(5);
+
+   pi.set_library_file_name("missing_plug_in_library.so");
+
+   try
+   {
+      pi3 = pi;
+
+      assert_true(false, LOG);
+   }
+   catch(const std::logic_error&)
+   {
+      assert_true(pi3.get_output_rows_number() == 5, LOG);
+      assert_true(pi3.get_library_file_name().empty(), LOG);
+      assert_true(pi3.has_evaluation_function() == false, LOG);
+   }
+
+   pi.set_library_file_name(__OPENNN_PLUG_IN_TEST_LIBRARY__);
+
+   // Test
+
+   pi.unload_library();
+
+   assert_true(pi.has_evaluation_function() == false, LOG);
+
+#endif
+}
+
+
 void PlugInTest::test_to_XML(void)   
 {
    message += "test_to_XML\n";
@@ -246,6 +443,79 @@ void PlugInTest::test_to_XML(void)
 void PlugInTest::test_from_XML(void)   
 {
    message += "test_from_XML\n";
+
+   PlugIn pi1;
+   PlugIn pi2;
+
+   tinyxml2::XMLDocument* document;
+
+   // Test
+
+   pi1.set_evaluation_method(PlugIn::ScriptEvaluation);
+   pi1.set_library_file_name("plug_in_library.so");
+   pi1.set_evaluation_function_name("evaluate_model");
+   pi1.set_output_rows_number(4);
+   pi1.set_output_columns_number(2);
+
+   document = pi1.to_XML();
+
+   pi2.from_XML(*document);
+
+   delete document;
+
+   assert_true(pi2.get_evaluation_method() == PlugIn::ScriptEvaluation, LOG);
+   assert_true(pi2.get_library_file_name() == "plug_in_library.so", LOG);
+   assert_true(pi2.get_evaluation_function_name() == "evaluate_model", LOG);
+   assert_true(pi2.get_output_rows_number() == 4, LOG);
+   assert_true(pi2.get_output_columns_number() == 2, LOG);
+   assert_true(pi2.has_evaluation_function() == false, LOG);
+
+   // Test
+
+   document = new tinyxml2::XMLDocument;
+
+   document->Parse("<PlugIn><EvaluationMethod>SharedLibrary</EvaluationMethod><LibraryFileName>plug_in_library.so</LibraryFileName></PlugIn>");
+
+   PlugIn pi3;
+
+   pi3.set_display(false);
+
+   pi3.from_XML(*document);
+
+   delete document;
+
+   assert_true(pi3.get_evaluation_method() == PlugIn::SharedLibraryEvaluation, LOG);
+   assert_true(pi3.get_library_file_name() == "plug_in_library.so", LOG);
+
+#ifdef __OPENNN_PLUG_IN_TEST_LIBRARY__
+
+   // Test
+
+   pi1.set_evaluation_method(PlugIn::SharedLibraryEvaluation);
+   pi1.set_library_file_name(__OPENNN_PLUG_IN_TEST_LIBRARY__);
+   pi1.set_evaluation_function_name("evaluate");
+   pi1.set_output_rows_number(1);
+   pi1.set_output_columns_number(2);
+
+   document = pi1.to_XML();
+
+   PlugIn pi4;
+
+   pi4.from_XML(*document);
+
+   delete document;
+
+   assert_true(pi4.get_evaluation_method() == PlugIn::SharedLibraryEvaluation, LOG);
+   assert_true(pi4.get_library_file_name() == __OPENNN_PLUG_IN_TEST_LIBRARY__, LOG);
+   assert_true(pi4.has_evaluation_function() == true, LOG);
+
+   const Vector< Matrix<double> > solutions = pi4.calculate_batch_solutions(Matrix<double>(1, 3, 1.0));
+
+   assert_true(solutions.size() == 1, LOG);
+   assert_true(solutions[0](0,0) == 3.0, LOG);
+   assert_true(solutions[0](0,1) == 4.0, LOG);
+
+#endif
 }
 
 
@@ -354,6 +624,10 @@ void PlugInTest::run_test_case(void)
 
    test_calculate_output_data();
 
+   test_calculate_batch_solutions();
+
+   test_load_library();
+
    // Serialization methods
 
    test_to_XML();   
@@ -73,6 +73,10 @@ public:
 
    void test_calculate_output_data(void);
 
+   void test_calculate_batch_solutions(void);
+
+   void test_load_library(void);
+
    // Serialization methods
 
    void test_to_XML(void);   
@@ -0,0 +1,68 @@
+/****************************************************************************************************************/
+/*                                                                                                              */
+/*   OpenNN: Open Neural Networks Library                                                                       */
+/*   www.opennn.net                                                                                             */
+/*                                                                                                              */
+/*   P L U G - I N   T E S T   L I B R A R Y                                                                    */
+/*                                                                                                              */
+/*   Roberto Lopez                                                                                              */
+/*   Artelnics - Making intelligent use of data                                                                 */
+/*   robertolopez@artelnics.com                                                                                 */
+/*                                                                                                              */
+/****************************************************************************************************************/
+
+// Shared library loaded by the plug-in tests. 
+// It exports the evaluation function with the C signature expected by the PlugIn class.
+// Each output is the sum of the squares of the parameters in the set, plus the row index times ten, plus the column index.
+
+// System includes
+
+#include <cstddef>
+
+#ifdef _WIN32
+#define PLUG_IN_TEST_LIBRARY_EXPORT __declspec(dllexport)
+#else
+#define PLUG_IN_TEST_LIBRARY_EXPORT
+#endif
+
+extern "C" PLUG_IN_TEST_LIBRARY_EXPORT int evaluate(const double* parameters, size_t parameters_number, size_t batch_size,
+                                                    double* outputs, size_t output_rows_number, size_t output_columns_number)
+{
+   for(size_t k = 0; k < batch_size; k++)
+   {
+      double sum = 0.0;
+
+      for(size_t p = 0; p < parameters_number; p++)
+      {
+         sum += parameters[k*parameters_number+p]*parameters[k*parameters_number+p];
+      }
+
+      for(size_t i = 0; i < output_rows_number; i++)
+      {
+         for(size_t j = 0; j < output_columns_number; j++)
+         {
+            outputs[(k*output_rows_number+i)*output_columns_number+j] = sum + 10.0*i + j;
+         }
+      }
+   }
+
+   return(0);
+}
+
+
+// OpenNN: Open Neural Networks Library.
+// Copyright (C) 2005-2016 Roberto Lopez.
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
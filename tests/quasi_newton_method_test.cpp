@@ -385,6 +385,142 @@ void QuasiNewtonMethodTest::test_perform_training(void)
 }
 
 
+void QuasiNewtonMethodTest::test_resume_training(void)
+{
+   message += "test_resume_training\n";
+
+   DataSet ds(10, 1, 1);
+   ds.randomize_data_normal();
+   NeuralNetwork nn(1, 3, 1);
+   PerformanceFunctional pf(&nn, &ds);
+   QuasiNewtonMethod qnm(&pf);
+
+   QuasiNewtonMethod::QuasiNewtonMethodResults* results_pointer;
+
+   size_t iterations_number;
+
+   const std::string file_name = "../data/training_checkpoint.bin";
+
+   Vector<double> initial_parameters;
+   Vector<double> parameters;
+   Vector<double> performance_history;
+
+   qnm.set_display(false);
+   qnm.set_reserve_performance_history(true);
+   qnm.set_minimum_parameters_increment_norm(0.0);
+   qnm.set_performance_goal(0.0);
+   qnm.set_minimum_performance_increase(0.0);
+   qnm.set_gradient_norm_goal(0.0);
+   qnm.set_maximum_selection_performance_decreases(1000);
+   qnm.set_maximum_time(1000.0);
+
+   // Test
+
+   nn.randomize_parameters_normal();
+
+   initial_parameters = nn.arrange_parameters();
+
+   qnm.set_maximum_iterations_number(10);
+
+   results_pointer = qnm.perform_training();
+   iterations_number = results_pointer->iterations_number;
+   performance_history = results_pointer->performance_history;
+   delete results_pointer;
+
+   parameters = nn.arrange_parameters();
+
+   nn.set_parameters(initial_parameters);
+
+   qnm.set_checkpoint_file_name(file_name);
+   qnm.set_checkpoint_period(5);
+   qnm.set_maximum_iterations_number(7);
+
+   results_pointer = qnm.perform_training();
+   delete results_pointer;
+
+   assert_true(QuasiNewtonMethod::load_checkpoint(file_name).iteration == 5, LOG);
+
+   nn.randomize_parameters_normal();
+
+   qnm.set_checkpoint_period(0);
+   qnm.set_maximum_iterations_number(10);
+
+   results_pointer = static_cast<QuasiNewtonMethod::QuasiNewtonMethodResults*>(qnm.resume_training(file_name));
+
+   assert_true(results_pointer->iterations_number == iterations_number, LOG);
+   assert_true(nn.arrange_parameters() == parameters, LOG);
+   assert_true(results_pointer->performance_history.size() == iterations_number - 5 + 1, LOG);
+   assert_true(results_pointer->performance_history[0] == performance_history[5], LOG);
+   assert_true(results_pointer->performance_history[iterations_number - 5] == performance_history[iterations_number], LOG);
+
+   delete results_pointer;
+
+   // Test
+
+   nn.randomize_parameters_normal();
+
+   qnm.set_history_stride(2);
+
+   results_pointer = static_cast<QuasiNewtonMethod::QuasiNewtonMethodResults*>(qnm.resume_training(file_name));
+
+   assert_true(results_pointer->performance_history.size() == (iterations_number - 5)/2 + 1, LOG);
+   assert_true(results_pointer->performance_history[0] == performance_history[5], LOG);
+   assert_true(results_pointer->performance_history[1] == performance_history[7], LOG);
+
+   delete results_pointer;
+
+   qnm.set_history_stride(1);
+
+   // Test
+
+   QuasiNewtonMethod::TrainingCheckpoint checkpoint = QuasiNewtonMethod::load_checkpoint(file_name);
+
+   checkpoint.vectors.set(2);
+
+   QuasiNewtonMethod::save_checkpoint(checkpoint, file_name);
+
+   try
+   {
+      results_pointer = static_cast<QuasiNewtonMethod::QuasiNewtonMethodResults*>(qnm.resume_training(file_name));
+
+      delete results_pointer;
+
+      assert_true(false, LOG);
+   }
+   catch(const std::logic_error&)
+   {
+      assert_true(true, LOG);
+   }
+
+   // Test
+
+   std::ifstream checkpoint_file(file_name.c_str(), std::ios::binary);
+
+   std::string checkpoint_data((std::istreambuf_iterator<char>(checkpoint_file)), std::istreambuf_iterator<char>());
+
+   checkpoint_file.close();
+
+   std::ofstream truncated_file(file_name.c_str(), std::ios::binary);
+
+   truncated_file.write(checkpoint_data.data(), checkpoint_data.size()/2);
+
+   truncated_file.close();
+
+   try
+   {
+      QuasiNewtonMethod::load_checkpoint(file_name);
+
+      assert_true(false, LOG);
+   }
+   catch(const std::logic_error&)
+   {
+      assert_true(true, LOG);
+   }
+
+   remove(file_name.c_str());
+}
+
+
 void QuasiNewtonMethodTest::test_to_XML(void)   
 {
    message += "test_to_XML\n";
@@ -471,6 +607,8 @@ void QuasiNewtonMethodTest::run_test_case(void)
 
    test_perform_training();
 
+   test_resume_training();
+
    // Training history methods
 
    test_resize_training_history();
@@ -67,6 +67,8 @@ public:
 
    void test_perform_training(void);
 
+   void test_resume_training(void);
+
    // Training history methods
 
    void test_resize_training_history(void);
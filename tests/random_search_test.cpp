@@ -107,12 +107,79 @@ void RandomSearchTest::test_set_reserve_performance_history(void)
 }
 
 
+void RandomSearchTest::test_set_candidates_number(void)
+{
+   message += "test_set_candidates_number\n";
+
+   RandomSearch rs;
+
+   assert_true(rs.get_candidates_number() == 1, LOG);
+
+   rs.set_candidates_number(8);
+
+   assert_true(rs.get_candidates_number() == 8, LOG);
+
+   try
+   {
+      rs.set_candidates_number(0);
+
+      assert_true(false, LOG);
+   }
+   catch(const std::logic_error&)
+   {
+      assert_true(rs.get_candidates_number() == 8, LOG);
+   }
+}
+
+
 void RandomSearchTest::test_calculate_training_direction(void)
 {
    message += "test_calculate_training_direction\n";
 }
 
 
+void RandomSearchTest::test_calculate_candidates_performance(void)
+{
+   message += "test_calculate_candidates_performance\n";
+
+   NeuralNetwork nn(1, 1);
+
+   PerformanceFunctional pf(&nn);
+
+   pf.destruct_all_terms();
+   pf.set_regularization_type(PerformanceFunctional::NEURAL_PARAMETERS_NORM_REGULARIZATION);
+
+   RandomSearch rs(&pf);
+
+   const size_t parameters_number = nn.count_parameters_number();
+
+   Vector< Vector<double> > candidates(5);
+
+   Vector<double> performances;
+
+   // Test
+
+   for(size_t i = 0; i < candidates.size(); i++)
+   {
+      candidates[i].set(parameters_number);
+      candidates[i].randomize_normal();
+   }
+
+   nn.initialize_parameters(0.0);
+
+   performances = rs.calculate_candidates_performance(candidates);
+
+   assert_true(performances.size() == 5, LOG);
+
+   for(size_t i = 0; i < candidates.size(); i++)
+   {
+      assert_true(fabs(performances[i] - pf.calculate_performance(candidates[i])) < 1.0e-12, LOG);
+   }
+
+   assert_true(nn.arrange_parameters() == 0.0, LOG);
+}
+
+
 void RandomSearchTest::test_perform_training(void)
 {
    message += "test_perform_training\n";
@@ -144,6 +211,22 @@ void RandomSearchTest::test_perform_training(void)
    assert_true(rstr != NULL, LOG);   
 
    delete rstr;
+
+   // Test
+
+   nn.initialize_parameters(1.0);
+
+   const double old_performance = pf.calculate_performance();
+
+   rs.set_candidates_number(4);
+   rs.set_maximum_iterations_number(10);
+
+   rstr = rs.perform_training();
+
+   assert_true(rstr->final_performance <= old_performance, LOG);
+   assert_true(pf.calculate_performance() <= old_performance, LOG);
+
+   delete rstr;
 }
 
 
@@ -224,10 +307,14 @@ void RandomSearchTest::run_test_case(void)
 
    test_set_reserve_performance_history();
 
+   test_set_candidates_number();
+
    // Training methods
 
    test_calculate_training_direction();
 
+   test_calculate_candidates_performance();
+
    test_perform_training();
 
    // Training history methods
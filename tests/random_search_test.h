@@ -66,10 +66,14 @@ public:
 
    void test_set_reserve_performance_history(void);
 
+   void test_set_candidates_number(void);
+
    // Training methods
 
    void test_calculate_training_direction(void);
 
+   void test_calculate_candidates_performance(void);
+
    void test_perform_training(void);
 
    // Training history methods
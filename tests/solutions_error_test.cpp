@@ -18,6 +18,35 @@
 using namespace OpenNN;
 
 
+// Evaluation function of the plug-in mathematical model of the solutions error tests.
+// The first column is the independent variable x in [0, 1] and the second one is p0*sin(p1*x) + p0*p0*x.
+
+extern "C" int solutions_error_test_evaluate(const double* parameters, size_t parameters_number, size_t batch_size,
+                                            double* outputs, size_t output_rows_number, size_t output_columns_number)
+{
+   if(parameters_number != 2 || output_columns_number != 2)
+   {
+      return(1);
+   }
+
+   for(size_t k = 0; k < batch_size; k++)
+   {
+      const double p0 = parameters[k*parameters_number];
+      const double p1 = parameters[k*parameters_number+1];
+
+      for(size_t i = 0; i < output_rows_number; i++)
+      {
+         const double x = i/(output_rows_number-1.0);
+
+         outputs[(k*output_rows_number+i)*output_columns_number] = x;
+         outputs[(k*output_rows_number+i)*output_columns_number+1] = p0*sin(p1*x) + p0*p0*x;
+      }
+   }
+
+   return(0);
+}
+
+
 SolutionsErrorTest::SolutionsErrorTest(void) : UnitTesting() 
 {
 }
@@ -46,6 +75,61 @@ void SolutionsErrorTest::test_calculate_constraints(void)
 }
 
 
+void SolutionsErrorTest::test_calculate_gradient(void)
+{
+   message += "test_calculate_gradient\n";
+
+   NeuralNetwork nn(2);
+
+   PlugIn pi;
+
+   Vector<double> independent_parameters(2);
+
+   Vector<double> gradient;
+   Matrix<double> Hessian;
+
+   // Test
+
+   pi.set_evaluation_method(PlugIn::SharedLibraryEvaluation);
+   pi.set_evaluation_function(&solutions_error_test_evaluate);
+   pi.set_independent_variables_number(1);
+   pi.set_dependent_variables_number(1);
+   pi.set_output_rows_number(11);
+   pi.set_output_columns_number(2);
+
+   independent_parameters[0] = 0.5;
+   independent_parameters[1] = 2.0;
+
+   nn.get_independent_parameters_pointer()->set_parameters(independent_parameters);
+
+   SolutionsError se(&nn, &pi);
+
+   se.construct_numerical_differentiation();
+
+   gradient = se.calculate_gradient();
+   Hessian = se.calculate_Hessian();
+
+   assert_true(gradient.size() == 2, LOG);
+   assert_true(gradient.calculate_norm() > 0.0, LOG);
+
+   se.get_numerical_differentiation_pointer()->set_parallel_evaluation(true);
+
+   assert_true(pi.is_thread_safe() == true, LOG);
+   assert_true(se.arrange_numerical_differentiation().get_parallel_evaluation() == true, LOG);
+
+   assert_true(se.calculate_gradient() == gradient, LOG);
+   assert_true(se.calculate_Hessian() == Hessian, LOG);
+
+   // Test
+
+   pi.set_evaluation_method(PlugIn::ScriptEvaluation);
+
+   assert_true(pi.is_thread_safe() == false, LOG);
+   assert_true(se.arrange_numerical_differentiation().get_parallel_evaluation() == false, LOG);
+   assert_true(se.get_numerical_differentiation_pointer()->get_parallel_evaluation() == true, LOG);
+}
+
+
 void SolutionsErrorTest::test_to_XML(void)   
 {
 	message += "test_to_XML\n"; 
@@ -55,6 +139,32 @@ void SolutionsErrorTest::test_to_XML(void)
 void SolutionsErrorTest::test_from_XML(void)
 {
 	message += "test_from_XML\n"; 
+
+   SolutionsError se1;
+   SolutionsError se2;
+
+   tinyxml2::XMLDocument* document;
+
+   Vector<double> evaluation_independent_variables;
+
+   // Test
+
+   evaluation_independent_variables.set(3);
+   evaluation_independent_variables[0] = 0.0;
+   evaluation_independent_variables[1] = 0.25;
+   evaluation_independent_variables[2] = 1.0;
+
+   se1.set_evaluation_independent_variables(evaluation_independent_variables);
+   se1.set_display(false);
+
+   document = se1.to_XML();
+
+   se2.from_XML(*document);
+
+   delete document;
+
+   assert_true(se2.get_evaluation_independent_variables() == evaluation_independent_variables, LOG);
+   assert_true(se2.get_display() == false, LOG);
 }
 
 
@@ -75,6 +185,10 @@ void SolutionsErrorTest::run_test_case(void)
 
    test_calculate_constraints();   
 
+   // Performance methods
+
+   test_calculate_gradient();
+
    // Serialization methods
 
    test_to_XML();   
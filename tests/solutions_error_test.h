@@ -53,6 +53,10 @@ public:
 
    void test_calculate_constraints(void); 
 
+   // Performance methods
+
+   void test_calculate_gradient(void);
+
    // Serialization methods
 
    void test_to_XML(void);   
@@ -905,6 +905,157 @@ void SumSquaredErrorTest::test_from_XML(void)
 }
 
 
+void SumSquaredErrorTest::test_calculate_single_precision_performance(void)
+{
+   message += "test_calculate_single_precision_performance\n";
+
+   NeuralNetwork nn;
+   DataSet ds;
+   SumSquaredError sse(&nn, &ds);
+
+   Vector<size_t> architecture;
+
+   Vector<double> parameters;
+
+   double performance;
+   double single_precision_performance;
+
+   // Test
+
+   assert_true(sse.get_single_precision() == false, LOG);
+
+   // Test
+
+   architecture.set(3);
+   architecture[0] = 3;
+   architecture[1] = 5;
+   architecture[2] = 2;
+
+   nn.set(architecture);
+   nn.randomize_parameters_normal(0.0, 0.5);
+
+   ds.set(300, 3, 2);
+   ds.randomize_data_normal();
+
+   performance = sse.calculate_performance();
+
+   sse.set_single_precision(true);
+
+   single_precision_performance = sse.calculate_performance();
+
+   assert_true(fabs(single_precision_performance - performance) <= 1.0e-4*performance, LOG);
+   assert_true(single_precision_performance == sse.calculate_single_precision_performance(), LOG);
+
+   // Test
+
+   parameters = nn.arrange_parameters()*2.0;
+
+   sse.set_single_precision(false);
+
+   performance = sse.calculate_performance(parameters);
+
+   sse.set_single_precision(true);
+
+   single_precision_performance = sse.calculate_performance(parameters);
+
+   assert_true(fabs(single_precision_performance - performance) <= 1.0e-4*performance, LOG);
+
+   // Test
+
+   ds.get_instances_pointer()->split_random_indices(0.5, 0.25, 0.25);
+
+   sse.set_single_precision(false);
+
+   performance = sse.calculate_performance();
+
+   sse.set_single_precision(true);
+
+   assert_true(fabs(sse.calculate_performance() - performance) <= 1.0e-4*performance, LOG);
+
+   // Test
+
+   tinyxml2::XMLDocument* document = sse.to_XML();
+
+   SumSquaredError sse2;
+
+   sse2.from_XML(*document);
+
+   delete document;
+
+   assert_true(sse2.get_single_precision() == true, LOG);
+}
+
+
+void SumSquaredErrorTest::test_calculate_single_precision_gradient(void)
+{
+   message += "test_calculate_single_precision_gradient\n";
+
+   NeuralNetwork nn;
+   DataSet ds;
+   SumSquaredError sse(&nn, &ds);
+
+   Vector<size_t> architecture;
+
+   Vector<double> gradient;
+   Vector<double> single_precision_gradient;
+
+   // Test
+
+   nn.set(1, 1, 1);
+   nn.initialize_parameters(0.0);
+
+   ds.set(1, 1, 1);
+   ds.initialize_data(0.0);
+
+   sse.set_single_precision(true);
+
+   single_precision_gradient = sse.calculate_gradient();
+
+   assert_true(single_precision_gradient.size() == nn.count_parameters_number(), LOG);
+   assert_true(single_precision_gradient == 0.0, LOG);
+
+   // Test
+
+   architecture.set(4);
+   architecture[0] = 3;
+   architecture[1] = 6;
+   architecture[2] = 4;
+   architecture[3] = 2;
+
+   nn.set(architecture);
+   nn.randomize_parameters_normal(0.0, 0.5);
+
+   ds.set(600, 3, 2);
+   ds.randomize_data_normal();
+
+   sse.set_single_precision(false);
+
+   gradient = sse.calculate_gradient();
+
+   sse.set_single_precision(true);
+
+   single_precision_gradient = sse.calculate_gradient();
+
+   assert_true(single_precision_gradient.size() == gradient.size(), LOG);
+   assert_true((single_precision_gradient - gradient).calculate_norm() <= 1.0e-4*gradient.calculate_norm(), LOG);
+
+   // Test
+
+   nn.get_multilayer_perceptron_pointer()->set_layer_activation_function(1, Perceptron::Logistic);
+   nn.get_multilayer_perceptron_pointer()->set_layer_activation_function(2, Perceptron::HyperbolicTangent);
+
+   sse.set_single_precision(false);
+
+   gradient = sse.calculate_gradient();
+
+   sse.set_single_precision(true);
+
+   single_precision_gradient = sse.calculate_gradient();
+
+   assert_true((single_precision_gradient - gradient).calculate_norm() <= 1.0e-4*gradient.calculate_norm(), LOG);
+}
+
+
 void SumSquaredErrorTest::run_test_case(void)
 {
    message += "Running sum squared error test case...\n";
@@ -927,6 +1078,11 @@ void SumSquaredErrorTest::run_test_case(void)
 
    test_calculate_Hessian();
 
+   // Single precision methods
+
+   test_calculate_single_precision_performance();
+   test_calculate_single_precision_gradient();
+
    // Objective terms methods
 
 //   test_calculate_terms();
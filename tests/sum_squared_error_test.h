@@ -60,6 +60,11 @@ public:
 
    void test_calculate_Hessian(void);
 
+   // Single precision methods
+
+   void test_calculate_single_precision_performance(void);
+   void test_calculate_single_precision_gradient(void);
+
    // Objective terms methods 
 
    void test_calculate_terms(void);
@@ -29,6 +29,7 @@ SOURCES += \
     data_set_test.cpp \
     plug_in_test.cpp \
     ordinary_differential_equations_test.cpp \
+    mock_ordinary_differential_equations.cpp \
     mathematical_model_test.cpp \
     unscaling_layer_test.cpp \
     scaling_layer_test.cpp \
@@ -62,6 +63,7 @@ SOURCES += \
     mock_training_algorithm.cpp \
     training_algorithm_test.cpp \
     random_search_test.cpp \
+    ensemble_training_test.cpp \
     quasi_newton_method_test.cpp \
     newton_method_test.cpp \
     levenberg_marquardt_algorithm_test.cpp \
@@ -82,6 +84,7 @@ SOURCES += \
     matrix_test.cpp \
     numerical_integration_test.cpp \
     numerical_differentiation_test.cpp \
+    instrumentation_test.cpp \
     main.cpp
 
 HEADERS += \
@@ -92,6 +95,7 @@ HEADERS += \
     data_set_test.h \
     plug_in_test.h \
     ordinary_differential_equations_test.h \
+    mock_ordinary_differential_equations.h \
     mathematical_model_test.h \
     unscaling_layer_test.h \
     scaling_layer_test.h \
@@ -99,6 +103,7 @@ HEADERS += \
     perceptron_layer_test.h \
     perceptron_test.h \
     neural_network_test.h \
+    neural_network_expression.h \
     multilayer_perceptron_test.h \
     inputs_test.h \
     outputs_test.h \
@@ -125,6 +130,7 @@ HEADERS += \
     mock_training_algorithm.h \
     training_algorithm_test.h \
     random_search_test.h \
+    ensemble_training_test.h \
     quasi_newton_method_test.h \
     newton_method_test.h \
     levenberg_marquardt_algorithm_test.h \
@@ -145,6 +151,7 @@ HEADERS += \
     matrix_test.h \
     numerical_integration_test.h \
     numerical_differentiation_test.h \
+    instrumentation_test.h \
     opennn_tests.h
 
 win32-g++{
@@ -183,6 +190,12 @@ else:win32:!win32-g++:CONFIG(release, debug|release): PRE_TARGETDEPS += $$OUT_PW
 else:win32:!win32-g++:CONFIG(debug, debug|release): PRE_TARGETDEPS += $$OUT_PWD/../tinyxml2/debug/tinyxml2.lib
 else:unix: PRE_TARGETDEPS += $$OUT_PWD/../tinyxml2/libtinyxml2.a
 
+# Dynamic loading library
+unix: LIBS += -ldl
+
+# Threads library
+unix: LIBS += -lpthread
+
 # OpenMP library
 unix: !mac{
 QMAKE_CXXFLAGS+= -fopenmp
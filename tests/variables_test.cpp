@@ -153,6 +153,36 @@ void VariablesTest::test_arrange_targets_indices(void)
 }
 
 
+void VariablesTest::test_get_generation(void)
+{
+   message += "test_get_generation\n";
+
+   Variables v(2, 1);
+
+   size_t generation;
+
+   // Test
+
+   generation = v.get_generation();
+
+   assert_true(v.get_inputs_indices().size() == 2, LOG);
+   assert_true(v.get_targets_indices().size() == 1, LOG);
+   assert_true(v.get_targets_indices()[0] == 2, LOG);
+   assert_true(v.get_generation() == generation, LOG);
+
+   // Test
+
+   v.set_use(0, Variables::Unused);
+
+   assert_true(v.get_generation() != generation, LOG);
+
+   assert_true(v.count_inputs_number() == 1, LOG);
+   assert_true(v.get_inputs_indices()[0] == 1, LOG);
+   assert_true(v.get_unused_indices()[0] == 0, LOG);
+   assert_true(v.count_used_variables_number() == 2, LOG);
+}
+
+
 void VariablesTest::test_arrange_used_indices(void)
 {
     message += "test_arrange_used_indices\n";
@@ -470,6 +500,8 @@ void VariablesTest::run_test_case(void)
    test_arrange_targets_indices();
    test_arrange_used_indices();
 
+   test_get_generation();
+
    // Information methods
 
    test_arrange_names();
@@ -15,6 +15,10 @@
 
 #include "vector_test.h"
 
+// System includes
+
+#include <thread>
+
 // GENERAL CONSTRUCTOR
 
 VectorTest::VectorTest(void) : UnitTesting() 
@@ -663,6 +667,62 @@ void VectorTest::test_randomize_normal(void)
 }
 
 
+void VectorTest::test_set_random_seed(void)
+{
+   message += "test_set_random_seed\n";
+
+   Vector<double> v1(10);
+   Vector<double> v2(10);
+   Vector<double> v3(10);
+   Vector<double> v4(10);
+
+   // Test
+
+   set_random_seed(1);
+   v1.randomize_normal();
+
+   set_random_seed(1);
+   v2.randomize_normal();
+
+   assert_true(v1 == v2, LOG);
+
+   // Test
+
+   set_random_seed(2);
+   v2.randomize_normal();
+
+   assert_true(v1 != v2, LOG);
+
+   // Test
+
+   set_random_seed(1);
+
+   set_random_stream(1);
+   v3.randomize_normal();
+
+   assert_true(v1 != v3, LOG);
+
+   std::thread thread([&v4]()
+   {
+      set_random_stream(1);
+      v4.randomize_normal();
+   });
+
+   thread.join();
+
+   assert_true(v3 == v4, LOG);
+
+   set_random_stream(0);
+
+   // Test
+
+   for(size_t i = 0; i < 100; i++)
+   {
+      assert_true(calculate_random_index(3) < 3, LOG);
+   }
+}
+
+
 void VectorTest::test_contains(void)
 {
    message += "test_contains\n";
@@ -1040,7 +1100,23 @@ void VectorTest::test_calculate_histogram(void)
 
    assert_true(histogram.frequencies.calculate_sum() == 20, LOG);
 
+   // Test
+
+   v.set(0.0, 1.0, 9.0);
+
+   Vector<double> edges(4);
+   edges[0] = 0.0;
+   edges[1] = 1.0;
+   edges[2] = 5.0;
+   edges[3] = 9.0;
 
+   histogram = v.calculate_histogram(edges);
+
+   assert_true(histogram.get_bins_number() == 3, LOG);
+   assert_true(histogram.centers[1] == 3.0, LOG);
+   assert_true(histogram.frequencies[0] == 1, LOG);
+   assert_true(histogram.frequencies[1] == 4, LOG);
+   assert_true(histogram.frequencies[2] == 5, LOG);
 }
 
 
@@ -1075,6 +1151,17 @@ void VectorTest::test_calculate_bin(void)
     bin = histogram.calculate_bin(v[2]);
 
     assert_true(bin == 2, LOG);
+
+    // Test
+
+    bin = histogram.calculate_bin(v[9]);
+
+    assert_true(bin == 9, LOG);
+
+    // Test
+
+    assert_true(histogram.calculate_bin(-5.0) == 0, LOG);
+    assert_true(histogram.calculate_bin(50.0) == 9, LOG);
 }
 
 
@@ -1860,6 +1947,121 @@ void VectorTest::test_calculate_linear_correlation_missing_values(void)
 }
 
 
+void VectorTest::test_calculate_autocorrelation(void)
+{
+    message += "test_calculate_autocorrelation\n";
+
+    Vector<double> a;
+
+    Vector<double> autocorrelation;
+
+    // Test
+
+    a.set(10, 1.0);
+
+    autocorrelation = a.calculate_autocorrelation(5);
+
+    assert_true(autocorrelation.size() == 5, LOG);
+    assert_true(autocorrelation == 1.0, LOG);
+
+    // Test
+
+    a.set(100);
+    a.randomize_normal();
+
+    autocorrelation = a.calculate_autocorrelation(20);
+
+    const double mean = a.calculate_mean();
+
+    double numerator;
+    double denominator = 0.0;
+
+    for(size_t j = 0; j < 100; j++)
+    {
+        denominator += (a[j] - mean)*(a[j] - mean)/100.0;
+    }
+
+    assert_true(fabs(autocorrelation[0] - 1.0) < 1.0e-9, LOG);
+
+    for(size_t i = 0; i < 20; i++)
+    {
+        numerator = 0.0;
+
+        for(size_t j = 0; j < 100 - i; j++)
+        {
+            numerator += (a[j] - mean)*(a[j+i] - mean)/(100.0 - i);
+        }
+
+        assert_true(fabs(autocorrelation[i] - numerator/denominator) < 1.0e-9, LOG);
+    }
+}
+
+
+void VectorTest::test_calculate_cross_correlation(void)
+{
+    message += "test_calculate_cross_correlation\n";
+
+    Vector<double> a;
+    Vector<double> b;
+
+    Vector<double> cross_correlation;
+
+    // Test
+
+    a.set(0, 1, 9);
+    b.set(0, 1, 9);
+
+    cross_correlation = a.calculate_cross_correlation(b, 3);
+
+    assert_true(cross_correlation.size() == 3, LOG);
+    assert_true(fabs(cross_correlation[0] - 1.0) < 1.0e-9, LOG);
+
+    // Test
+
+    a.set(10, 2.0);
+    b.set(0, 1, 9);
+
+    cross_correlation = a.calculate_cross_correlation(b);
+
+    assert_true(cross_correlation == 0.0, LOG);
+
+    // Test
+
+    a.set(50);
+    a.randomize_normal();
+
+    b.set(50);
+    b.randomize_normal();
+
+    cross_correlation = a.calculate_cross_correlation(b, 10);
+
+    const double a_mean = a.calculate_mean();
+    const double b_mean = b.calculate_mean();
+
+    double numerator;
+    double a_denominator = 0.0;
+    double b_denominator = 0.0;
+
+    for(size_t j = 0; j < 50; j++)
+    {
+        a_denominator += (a[j] - a_mean)*(a[j] - a_mean);
+        b_denominator += (b[j] - b_mean)*(b[j] - b_mean);
+    }
+
+    for(size_t i = 0; i < 10; i++)
+    {
+        numerator = 0.0;
+
+        for(size_t j = 0; j < 50 - i; j++)
+        {
+            numerator += (a[j] - a_mean)*(b[j+i] - b_mean);
+        }
+
+        assert_true(fabs(cross_correlation[i] - numerator/sqrt(a_denominator*b_denominator)) < 1.0e-9, LOG);
+    }
+}
+
+
 void VectorTest::test_calculate_linear_regression_parameters(void)
 {
     message += "test_calculate_linear_regression_parameters\n";
@@ -2003,6 +2205,105 @@ void VectorTest::test_load(void)
    assert_true(v[0] == -1, LOG);   
    assert_true(v[1] == 1, LOG);   
 
+   // Test
+
+   Vector<double> w(3);
+   w[0] = 0.5;
+   w[1] = -1.0e-3;
+   w[2] = 42.0;
+
+   w.save(file_name);
+   w.load(file_name);
+
+   assert_true(w.size() == 3, LOG);
+   assert_true(w[0] == 0.5, LOG);
+   assert_true(w[1] == -1.0e-3, LOG);
+   assert_true(w[2] == 42.0, LOG);
+}
+
+
+void VectorTest::test_load_binary(void)
+{
+   message += "test_load_binary\n";
+
+#ifdef __APPLE__
+   std::string file_name = "../../../../data/vector.bin";
+#else
+   std::string file_name = "../data/vector.bin";
+#endif
+
+   Vector<double> v(7);
+   Vector<double> w;
+
+   // Test
+
+   v.randomize_normal();
+
+   v.save_binary(file_name);
+   w.load_binary(file_name);
+
+   assert_true(w == v, LOG);
+
+   // Test
+
+   Vector<size_t> indices(0, 1, 4);
+   Vector<size_t> loaded_indices;
+
+   indices.save_binary(file_name);
+   loaded_indices.load_binary(file_name);
+
+   assert_true(loaded_indices == indices, LOG);
+
+   // Test
+
+   const uint32_t version = 1;
+   const uint32_t element_size = sizeof(double);
+   const uint64_t huge_size = (uint64_t)1 << 60;
+
+   std::ofstream file(file_name.c_str(), std::ios::binary);
+
+   file.write("OPENNNV", 8);
+   file.write(reinterpret_cast<const char*>(&version), sizeof(uint32_t));
+   file.write(reinterpret_cast<const char*>(&element_size), sizeof(uint32_t));
+   file.write(reinterpret_cast<const char*>(&huge_size), sizeof(uint64_t));
+   file.write(reinterpret_cast<const char*>(v.data()), v.size()*sizeof(double));
+
+   file.close();
+
+   try
+   {
+      w.load_binary(file_name);
+
+      assert_true(false, LOG);
+   }
+   catch(const std::logic_error&)
+   {
+      assert_true(w == v, LOG);
+   }
+
+   // Test
+
+   const uint64_t size = 8;
+
+   file.open(file_name.c_str(), std::ios::binary);
+
+   file.write("OPENNNV", 8);
+   file.write(reinterpret_cast<const char*>(&version), sizeof(uint32_t));
+   file.write(reinterpret_cast<const char*>(&element_size), sizeof(uint32_t));
+   file.write(reinterpret_cast<const char*>(&size), sizeof(uint64_t));
+   file.write(reinterpret_cast<const char*>(v.data()), v.size()*sizeof(double));
+
+   file.close();
+
+   try
+   {
+      w.load_binary(file_name);
+
+      assert_true(false, LOG);
+   }
+   catch(const std::logic_error&)
+   {
+   }
 }
 
 
@@ -2092,6 +2393,7 @@ void VectorTest::run_test_case(void)
    test_initialize_sequential();
    test_randomize_uniform();
    test_randomize_normal();
+   test_set_random_seed();
 
    // Checking methods
 
@@ -2165,6 +2467,8 @@ void VectorTest::run_test_case(void)
 
    test_calculate_linear_correlation();
    test_calculate_linear_correlation_missing_values();
+   test_calculate_autocorrelation();
+   test_calculate_cross_correlation();
    test_calculate_linear_regression_parameters();
 
    // Scaling and unscaling
@@ -2181,6 +2485,7 @@ void VectorTest::run_test_case(void)
    test_save();
 
    test_load();
+   test_load_binary();
 
    message += "End vector test case\n";
 
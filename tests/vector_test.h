@@ -107,6 +107,7 @@ public:
    void test_initialize_sequential(void);
    void test_randomize_uniform(void);
    void test_randomize_normal(void);
+   void test_set_random_seed(void);
 
    // Checking methods
 
@@ -184,6 +185,9 @@ public:
    void test_calculate_linear_correlation(void);
    void test_calculate_linear_correlation_missing_values(void);
 
+   void test_calculate_autocorrelation(void);
+   void test_calculate_cross_correlation(void);
+
    void test_calculate_linear_regression_parameters(void);
 
    // Scaling and unscaling
@@ -198,6 +202,7 @@ public:
    // Serizalization methods
 
    void test_load(void);
+   void test_load_binary(void);
    void test_save(void);
 
    // Unit testing methods